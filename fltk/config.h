@@ -117,6 +117,14 @@
 
 #define USE_XDBE HAVE_XDBE
 
+/*
+ * HAVE_XSHM:
+ *
+ * Do we have the X shared memory extension, used by fl_draw_image()?
+ */
+
+#define HAVE_XSHM 0
+
 /*
  * USE_QUARTZ:
  *
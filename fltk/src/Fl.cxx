@@ -92,6 +92,7 @@ Fl_Window *Fl::modal_;	// topmost modal() window
 void *Fl::user_data = NULL;
 
 Fl_Focus_Changing_Handler Fl::focus_changing_handler = NULL;
+Fl_Widget_Destroy_Handler Fl::widget_destroy_handler = NULL;
 #endif // FL_DOXYGEN
 
 //
@@ -36,13 +36,17 @@
 // so that the number of items in the browser and size of those items
 // is unlimited. The only problem is that the old browser used an
 // index number to identify a line, and it is slow to convert from/to
-// a pointer. I use a cache of the last match to try to speed this up.
+// a pointer. So the lines are also kept, in order, in an array of
+// blocks of up to BLOCK_LINES pointers, each knowing how many lines it
+// holds and their total height. A line number or a line position is
+// found by a binary search on the blocks and a look into one block.
 
 // Also added the ability to "hide" a line. This sets its height to
 // zero, so the Fl_Browser_ cannot pick it.
 
 #define SELECTED 1
 #define NOTDISPLAYED 2
+#define BULK 4		// allocated by add_lines(), freed by clear()
 
 // WARNING:
 //       Fl_File_Chooser.cxx also has a definition of this structure (FL_BLINE).
@@ -54,11 +58,23 @@ struct FL_BLINE {	// data is in a linked list of these
   FL_BLINE* next;
   void* data;
   Fl_Image* icon;
+  FL_BLOCK* block;	// block holding this line
+  int height;		// cached Fl_Browser::item_height() when shown, or -1
   short length;		// sizeof(txt)-1, may be longer than string
   char flags;		// selected, displayed
   char txt[1];		// start of allocated array
 };
 
+#define BLOCK_LINES 512
+
+struct FL_BLOCK {
+  int count;		// lines in this block
+  int height;		// sum of their item_height()
+  int index;		// position in the array of blocks
+  int line0, y0;	// lines and height of the blocks before this one
+  FL_BLINE* line[BLOCK_LINES];
+};
+
 /**
   Returns the very first item in the list.
   Example of use:
@@ -132,16 +148,82 @@ const char *Fl_Browser::item_text(void *item) const {
   return ((FL_BLINE*)item)->txt;
 }
 
+/**
+  Brings the position of every block, and the lines and height before
+  it, up to date after blocks were changed, added or removed.
+*/
+void Fl_Browser::update_blocks() const {
+  int i = blocks_valid, n = 0, y = 0;
+  if (i) {
+    n = blocks[i-1]->line0 + blocks[i-1]->count;
+    y = blocks[i-1]->y0 + blocks[i-1]->height;
+  }
+  for (; i < nblocks; i++) {
+    FL_BLOCK* b = blocks[i];
+    b->index = i;
+    b->line0 = n; n += b->count;
+    b->y0 = y; y += b->height;
+  }
+  ((Fl_Browser*)this)->blocks_valid = nblocks;
+}
+
+/**
+  Returns the block holding \p line, and sets \p index to the position of
+  the line in it. A \p line past the end gives the last block and its
+  count. Returns NULL if the browser is empty.
+*/
+FL_BLOCK* Fl_Browser::find_block(int line, int* index) const {
+  *index = 0;
+  if (!nblocks) return 0;
+  update_blocks();
+  int lo = 0, hi = nblocks-1;
+  while (lo < hi) {
+    int mid = (lo+hi+1)/2;
+    if (blocks[mid]->line0 < line) lo = mid;
+    else hi = mid-1;
+  }
+  FL_BLOCK* b = blocks[lo];
+  *index = line-1 - b->line0;
+  if (*index < 0) *index = 0;
+  if (*index > b->count) *index = b->count;
+  return b;
+}
+
+/**
+  Inserts an empty block at \p index in the array of blocks.
+*/
+FL_BLOCK* Fl_Browser::new_block(int index) {
+  if (nblocks == blocks_alloc) {
+    blocks_alloc = blocks_alloc ? 2*blocks_alloc : 16;
+    blocks = (FL_BLOCK**)realloc(blocks, blocks_alloc*sizeof(FL_BLOCK*));
+  }
+  FL_BLOCK* b = (FL_BLOCK*)malloc(sizeof(FL_BLOCK));
+  b->count = b->height = 0;
+  b->index = index;
+  memmove(blocks+index+1, blocks+index, (nblocks-index)*sizeof(FL_BLOCK*));
+  blocks[index] = b;
+  nblocks++;
+  if (blocks_valid > index) blocks_valid = index;
+  return b;
+}
+
+/**
+  Adds \p dh to the height of the block holding \p item, and to
+  full_height().
+*/
+void Fl_Browser::block_height(FL_BLINE* item, int dh) {
+  if (!dh) return;
+  item->block->height += dh;
+  full_height_ += dh;
+  if (blocks_valid > item->block->index) blocks_valid = item->block->index;
+}
+
 /**
   Returns the item for specified \p line.
 
-  Note: This call is slow. It's fine for e.g. responding to user
-  clicks, but slow if called often, such as in a tight sorting loop.
-  Finding an item 'by line' involves a linear lookup on the internal
-  linked list. The performance hit can be significant if the browser's
-  contents is large, and the method is called often (e.g. during a sort).
-  If you're writing a subclass, use the protected methods item_first(),
-  item_next(), etc. to access the internal linked list more efficiently.
+  The lines are kept in blocks, so this takes O(log n) time, n being
+  the number of blocks. To go through all the items, the protected
+  methods item_first(), item_next(), etc. are still faster.
 
   \param[in] line The line number of the item to return. (1 based)
   \retval item that was found.
@@ -149,25 +231,14 @@ const char *Fl_Browser::item_text(void *item) const {
   \see item_at(), find_line(), lineno()
 */
 FL_BLINE* Fl_Browser::find_line(int line) const {
-  int n; FL_BLINE* l;
-  if (line == cacheline) return cache;
-  if (cacheline && line > (cacheline/2) && line < ((cacheline+lines)/2)) {
-    n = cacheline; l = cache;
-  } else if (line <= (lines/2)) {
-    n = 1; l = first;
-  } else {
-    n = lines; l = last;
-  }
-  for (; n < line && l; n++) l = l->next;
-  for (; n > line && l; n--) l = l->prev;
-  ((Fl_Browser*)this)->cacheline = line;
-  ((Fl_Browser*)this)->cache = l;
-  return l;
+  if (line < 1 || line > lines) return 0;
+  int i;
+  FL_BLOCK* b = find_block(line, &i);
+  return b->line[i];
 }
 
 /**
   Returns line number corresponding to \p item, or zero if not found.
-  Caveat: See efficiency note in find_line().
   \param[in] item The item to be found
   \returns The line number of the item, or 0 if not found.
   \see item_at(), find_line(), lineno()
@@ -175,51 +246,57 @@ FL_BLINE* Fl_Browser::find_line(int line) const {
 int Fl_Browser::lineno(void *item) const {
   FL_BLINE* l = (FL_BLINE*)item;
   if (!l) return 0;
-  if (l == cache) return cacheline;
-  if (l == first) return 1;
-  if (l == last) return lines;
-  if (!cache) {
-    ((Fl_Browser*)this)->cache = first;
-    ((Fl_Browser*)this)->cacheline = 1;
-  }
-  // assume it is near cache, search both directions:
-  FL_BLINE* b = cache->prev;
-  int bnum = cacheline-1;
-  FL_BLINE* f = cache->next;
-  int fnum = cacheline+1;
-  int n = 0;
-  for (;;) {
-    if (b == l) {n = bnum; break;}
-    if (f == l) {n = fnum; break;}
-    if (b) {b = b->prev; bnum--;}
-    if (f) {f = f->next; fnum++;}
-  }
-  ((Fl_Browser*)this)->cache = l;
-  ((Fl_Browser*)this)->cacheline = n;
-  return n;
+  update_blocks();
+  FL_BLOCK* b = l->block;
+  for (int i = 0; i < b->count; i++)
+    if (b->line[i] == l) return b->line0 + i + 1;
+  return 0;
 }
 
 /**
   Removes the item at the specified \p line.
-  Caveat: See efficiency note in find_line().
   You must call redraw() to make any changes visible.
   \param[in] line The line number to be removed. (1 based) Must be in range!
   \returns Pointer to browser item that was removed (and is no longer valid).
   \see add(), insert(), remove(), swap(int,int), clear()
 */
 FL_BLINE* Fl_Browser::_remove(int line) {
-  FL_BLINE* ttt = find_line(line);
+  check_heights();
+  int i;
+  FL_BLOCK* b = find_block(line, &i);
+  FL_BLINE* ttt = b->line[i];
   deleting(ttt);
 
-  cacheline = line-1;
-  cache = ttt->prev;
   lines--;
-  full_height_ -= item_height(ttt);
+  block_height(ttt, -item_height(ttt));
   if (ttt->prev) ttt->prev->next = ttt->next;
   else first = ttt->next;
   if (ttt->next) ttt->next->prev = ttt->prev;
   else last = ttt->prev;
 
+  b->count--;
+  memmove(b->line+i, b->line+i+1, (b->count-i)*sizeof(FL_BLINE*));
+  if (blocks_valid > b->index) blocks_valid = b->index;
+  // drop an empty block, or merge it with the next one if both are small:
+  int n = b->index+1;
+  FL_BLOCK* next = n < nblocks ? blocks[n] : 0;
+  if (!b->count || (next && b->count + next->count <= BLOCK_LINES/2)) {
+    if (b->count) {
+      for (int j = 0; j < next->count; j++) {
+	b->line[b->count+j] = next->line[j];
+	next->line[j]->block = b;
+      }
+      b->count += next->count;
+      b->height += next->height;
+      free(next);
+    } else {
+      free(b);
+      n--;
+    }
+    nblocks--;
+    memmove(blocks+n, blocks+n+1, (nblocks-n)*sizeof(FL_BLOCK*));
+  }
+
   return(ttt);
 }
 
@@ -232,19 +309,19 @@ FL_BLINE* Fl_Browser::_remove(int line) {
 */
 void Fl_Browser::remove(int line) {
   if (line < 1 || line > lines) return;
-  free(_remove(line));
+  FL_BLINE* t = _remove(line);
+  if (!(t->flags & BULK)) free(t);
 }
 
 /**
   Insert specified \p item above \p line.
   If \p line > size() then the line is added to the end.
 
-  Caveat: See efficiency note in find_line().
-
   \param[in] line  The new line will be inserted above this line (1 based).
   \param[in] item  The item to be added.
 */
 void Fl_Browser::insert(int line, FL_BLINE* item) {
+  check_heights();
   if (!first) {
     item->prev = item->next = 0;
     first = last = item;
@@ -267,10 +344,33 @@ void Fl_Browser::insert(int line, FL_BLINE* item) {
     item->prev->next = item;
     n->prev = item;
   }
-  cacheline = line;
-  cache = item;
+
+  int i;
+  FL_BLOCK* b = find_block(line, &i);
+  if (!b || b->count == BLOCK_LINES) {
+    // add a block, after b if there is one, moving half of b into it
+    FL_BLOCK* nb = new_block(b ? b->index+1 : 0);
+    if (b) {
+      nb->count = BLOCK_LINES/2;
+      b->count -= nb->count;
+      for (int j = 0; j < nb->count; j++) {
+	FL_BLINE* l = b->line[b->count+j];
+	nb->line[j] = l;
+	l->block = nb;
+	nb->height += item_height(l);
+      }
+      b->height -= nb->height;
+      if (blocks_valid > b->index) blocks_valid = b->index;
+      if (i > b->count) {i -= b->count; b = nb;}
+    } else b = nb;
+  }
+  memmove(b->line+i+1, b->line+i, (b->count-i)*sizeof(FL_BLINE*));
+  b->line[i] = item;
+  b->count++;
+  item->block = b;
+  if (blocks_valid > b->index) blocks_valid = b->index;
   lines++;
-  full_height_ += item_height(item);
+  block_height(item, item_height(item));
   redraw_line(item);
 }
 
@@ -295,6 +395,7 @@ void Fl_Browser::insert(int line, const char* newtext, void* d) {
   strcpy(t->txt, newtext);
   t->data = d;
   t->icon = 0;
+  t->height = -1;
   insert(line, t);
 }
 
@@ -322,24 +423,31 @@ void Fl_Browser::move(int to, int from) {
 */
 void Fl_Browser::text(int line, const char* newtext) {
   if (line < 1 || line > lines) return;
-  FL_BLINE* t = find_line(line);
+  check_heights();
+  int i;
+  FL_BLOCK* b = find_block(line, &i);
+  FL_BLINE* t = b->line[i];
+  int oldh = item_height(t);
   int l = strlen(newtext);
   if (l > t->length) {
     FL_BLINE* n = (FL_BLINE*)malloc(sizeof(FL_BLINE)+l);
     replacing(t, n);
-    cache = n;
+    b->line[i] = n;
+    n->block = b;
     n->data = t->data;
     n->icon = t->icon;
     n->length = (short)l;
-    n->flags = t->flags;
+    n->flags = t->flags & ~BULK;
     n->prev = t->prev;
     if (n->prev) n->prev->next = n; else first = n;
     n->next = t->next;
     if (n->next) n->next->prev = n; else last = n;
-    free(t);
+    if (!(t->flags & BULK)) free(t);
     t = n;
   }
   strcpy(t->txt, newtext);
+  t->height = -1;
+  block_height(t, item_height(t) - oldh);
   redraw_line(t);
 }
 
@@ -365,6 +473,8 @@ void Fl_Browser::data(int line, void* d) {
 int Fl_Browser::item_height(void *item) const {
   FL_BLINE* l = (FL_BLINE*)item;
   if (l->flags & NOTDISPLAYED) return 0;
+  check_heights();
+  if (l->height >= 0) return l->height;
 
   int hmax = 2; // use 2 to insure we don't return a zero!
 
@@ -411,9 +521,51 @@ int Fl_Browser::item_height(void *item) const {
   if (l->icon && (l->icon->h()+2)>hmax) {
     hmax = l->icon->h() + 2;	// leave 2px above/below
   }
+  l->height = hmax;
   return hmax; // previous version returned hmax+2!
 }
 
+// Number of columns the lines are split in, item_height() measures
+// each of them
+static int column_count(const int* widths) {
+  int n = 0;
+  while (widths[n]) n++;
+  return n;
+}
+
+/**
+  Measures all the items again if the font, size, format character or
+  columns changed since their heights were cached, and sums the heights
+  of the blocks if add_lines() left them to be summed. The column_widths()
+  array is looked at, not only its address, so it may be edited in place.
+*/
+void Fl_Browser::check_heights() const {
+  Fl_Browser* b = (Fl_Browser*)this;
+  int i, j;
+  int columns = column_count(column_widths());
+  if (height_font_ != textfont() || height_size_ != textsize() ||
+      height_format_ != format_char() || height_columns_ != columns ||
+      (columns && height_column_char_ != column_char())) {
+    b->height_font_ = textfont();
+    b->height_size_ = textsize();
+    b->height_format_ = format_char();
+    b->height_column_char_ = column_char();
+    b->height_columns_ = columns;
+    for (i = 0; i < nblocks; i++)
+      for (j = 0; j < blocks[i]->count; j++) blocks[i]->line[j]->height = -1;
+    b->full_height_ = -1;
+  }
+  if (full_height_ >= 0) return;
+  b->full_height_ = 0;
+  for (i = 0; i < nblocks; i++) {
+    FL_BLOCK* k = blocks[i];
+    k->height = 0;
+    for (j = 0; j < k->count; j++) k->height += item_height(k->line[j]);
+    b->full_height_ += k->height;
+  }
+  b->blocks_valid = 0;
+}
+
 /**
   Returns width of \p item in pixels.
   This takes into account embedded \@ codes within the text() label.
@@ -484,6 +636,7 @@ int Fl_Browser::item_width(void *item) const {
        incr_height(), full_height()
 */
 int Fl_Browser::full_height() const {
+  check_heights();
   return full_height_;
 }
 
@@ -608,14 +761,22 @@ Fl_Browser::Fl_Browser(int X, int Y, int W, int H, const char *L)
   column_widths_owned_ = NULL;
   lines = 0;
   full_height_ = 0;
-  cacheline = 0;
   format_char_ = '@';
   column_char_ = '\t';
-  first = last = cache = 0;
+  first = last = 0;
+  blocks = 0;
+  bulk_ = 0;
+  nblocks = blocks_alloc = blocks_valid = 0;
+  height_font_ = textfont();
+  height_size_ = textsize();
+  height_format_ = format_char_;
+  height_column_char_ = column_char_;
+  height_columns_ = 0;
 }
 
 Fl_Browser::~Fl_Browser() {
   clear();
+  free(blocks);
   if(column_widths_owned_) {
   	free(column_widths_owned_);
   }
@@ -632,11 +793,15 @@ void Fl_Browser::lineposition(int line, Fl_Line_Position pos) {
   if (line>lines) line = lines;
   int p = 0;
 
-  FL_BLINE* l;
-  for (l=first; l && line>1; l = l->next) {
-    line--; p += item_height(l);
+  // the block positions are summed from the heights, measure them first:
+  check_heights();
+  int i;
+  FL_BLOCK* b = find_block(line, &i);
+  if (b) {
+    p = b->y0;
+    for (int j = 0; j < i; j++) p += item_height(b->line[j]);
+    if (pos == BOTTOM) p += item_height(b->line[i]);
   }
-  if (l && (pos == BOTTOM)) p += item_height (l);
 
   int final = p, X, Y, W, H;
   bbox(X, Y, W, H);
@@ -667,9 +832,16 @@ int Fl_Browser::topline() const {
 void Fl_Browser::clear() {
   for (FL_BLINE* l = first; l;) {
     FL_BLINE* n = l->next;
-    free(l);
+    if (!(l->flags & BULK)) free(l);
     l = n;
   }
+  while (bulk_) {
+    void* n = *(void**)bulk_;
+    free(bulk_);
+    bulk_ = n;
+  }
+  for (int i = 0; i < nblocks; i++) free(blocks[i]);
+  nblocks = blocks_valid = 0;
   full_height_ = 0;
   first = 0;
   last = 0;
@@ -694,6 +866,62 @@ void Fl_Browser::add(const char* newtext, void* d) {
   //Fl_Browser_::display(last);
 }
 
+// size of a line in an add_lines() allocation, keeping the next aligned
+#define BULK_SIZE(l) \
+  ((sizeof(FL_BLINE)+(l)+sizeof(void*)-1) / sizeof(void*) * sizeof(void*))
+
+/**
+  Adds \p n lines to the end of the browser, like calling add() for each
+  of them, but much faster for a large number of lines: they are copied
+  into one allocation, their heights are measured when first needed, and
+  the browser is redrawn once. The data() of each line is set to NULL.
+
+  The memory of the lines added this way is only released by clear(),
+  or when the browser is deleted, even if some are removed before.
+
+  \param[in] newtext Array of \p n label texts, may contain NULL for a
+             blank line. Text may contain format characters; see
+             format_char() for details.
+  \param[in] n The number of lines to add.
+  \see add(), load()
+*/
+void Fl_Browser::add_lines(const char* const* newtext, int n) {
+  if (n <= 0) return;
+  size_t size = sizeof(void*);
+  int i;
+  for (i = 0; i < n; i++) size += BULK_SIZE(newtext[i] ? strlen(newtext[i]) : 0);
+  char* p = (char*)malloc(size);
+  if (!p) return;
+  *(void**)p = bulk_;
+  bulk_ = p;
+  p += sizeof(void*);
+
+  FL_BLOCK* b = nblocks ? blocks[nblocks-1] : 0;
+  if (b && blocks_valid > b->index) blocks_valid = b->index;
+  for (i = 0; i < n; i++) {
+    const char* s = newtext[i] ? newtext[i] : "";
+    int l = strlen(s);
+    FL_BLINE* t = (FL_BLINE*)p;
+    p += BULK_SIZE(l);
+    t->length = (short)l;
+    t->flags = BULK;
+    memcpy(t->txt, s, l+1);
+    t->data = 0;
+    t->icon = 0;
+    t->height = -1;
+    t->next = 0;
+    t->prev = last;
+    if (last) last->next = t; else first = t;
+    last = t;
+    if (!b || b->count == BLOCK_LINES) b = new_block(nblocks);
+    b->line[b->count++] = t;
+    t->block = b;
+  }
+  lines += n;
+  full_height_ = -1;	// let check_heights() measure them
+  redraw();
+}
+
 /**
   Returns the label text for the specified \p line.
   Return value can be NULL if \p line is out of range or unset.
@@ -754,8 +982,9 @@ int Fl_Browser::selected(int line) const {
 void Fl_Browser::show(int line) {
   FL_BLINE* t = find_line(line);
   if (t->flags & NOTDISPLAYED) {
+    check_heights();
     t->flags &= ~NOTDISPLAYED;
-    full_height_ += item_height(t);
+    block_height(t, item_height(t));
     if (Fl_Browser_::displayed(t)) redraw();
   }
 }
@@ -772,7 +1001,8 @@ void Fl_Browser::show(int line) {
 void Fl_Browser::hide(int line) {
   FL_BLINE* t = find_line(line);
   if (!(t->flags & NOTDISPLAYED)) {
-    full_height_ -= item_height(t);
+    check_heights();
+    block_height(t, -item_height(t));
     t->flags |= NOTDISPLAYED;
     if (Fl_Browser_::displayed(t)) redraw();
   }
@@ -819,6 +1049,19 @@ void Fl_Browser::swap(FL_BLINE *a, FL_BLINE *b) {
 
   if ( a == b || !a || !b) return;          // nothing to do
   swapping(a, b);
+  // exchange their places in the blocks
+  check_heights();
+  FL_BLOCK *ablock = a->block, *bblock = b->block;
+  int i, j;
+  for (i = 0; ablock->line[i] != a; i++) {}
+  for (j = 0; bblock->line[j] != b; j++) {}
+  ablock->line[i] = b;
+  bblock->line[j] = a;
+  int ah = item_height(a), bh = item_height(b);
+  block_height(a, bh - ah);
+  block_height(b, ah - bh);
+  a->block = bblock;
+  b->block = ablock;
   FL_BLINE *aprev  = a->prev;
   FL_BLINE *anext  = a->next;
   FL_BLINE *bprev  = b->prev;
@@ -849,9 +1092,6 @@ void Fl_Browser::swap(FL_BLINE *a, FL_BLINE *b) {
      if ( bprev ) bprev->next = a; else first = a;
      a->next = bnext;
   }
-  // Disable cache -- we played around with positions
-  cacheline = 0;
-  cache = 0;
 }
 
 /**
@@ -881,16 +1121,13 @@ void Fl_Browser::icon(int line, Fl_Image* icon) {
 
   FL_BLINE* bl = find_line(line);
 
-  int old_h = bl->icon ? bl->icon->h()+2 : 0;	// init with *old* icon height
-  bl->icon = 0;					// remove icon, if any
-  int th = item_height(bl);			// height of text only
-  int new_h = icon ? icon->h()+2 : 0;		// init with *new* icon height
-  if (th > old_h) old_h = th;
-  if (th > new_h) new_h = th;
-  int dh = new_h - old_h;
-  full_height_ += dh;				// do this *always*
-
+  check_heights();
+  int old_h = item_height(bl);			// height with *old* icon
   bl->icon = icon;				// set new icon
+  bl->height = -1;
+  int dh = item_height(bl) - old_h;
+  block_height(bl, dh);				// do this *always*
+
   if (dh>0) {
     redraw();					// icon larger than item? must redraw widget
   } else {
@@ -144,8 +144,11 @@ void Fl_Browser_::update_top() {
     void* l;
     int ly;
     int yy = position_;
-    // start from either head or current position, whichever is closer:
-    if (!top_ || yy <= (real_position_/2)) {
+    // ask the subclass, else start from either head or current position,
+    // whichever is closer:
+    if ((l = item_at_position(yy, &ly)) != 0) {
+      // found directly
+    } else if (!top_ || yy <= (real_position_/2)) {
       l = item_first();
       ly = 0;
     } else {
@@ -1062,6 +1065,19 @@ int Fl_Browser_::incr_height() const {
   return item_quick_height(item_first());
 }
 
+/**
+  This method may be provided by the subclass to find the item at the
+  vertical position \p pos without stepping through the list, which makes
+  scrolling independent of the number of items.
+  The default implementation returns NULL, the list is then searched.
+  \param[in] pos The position, in pixels from the top of the list.
+  \param[out] item_pos The position of the top of the returned item.
+  \returns The item containing \p pos, or NULL.
+*/
+void *Fl_Browser_::item_at_position(int pos, int *item_pos) const {
+  return 0;
+}
+
 /**
   This method may be provided by the subclass to indicate the full height
   of the item list, in pixels.
@@ -28,6 +28,7 @@
 #include <FL/Fl.H>
 #include <FL/Fl_Browser.H>
 #include <stdio.h>
+#include <stdlib.h>
 #include <FL/fl_utf8.h>
 
 /**
@@ -37,31 +38,67 @@
   was any error in opening or reading the file, in which case errno
   is set to the system error.  The data() of each line is set
   to NULL.
+
+  The file is read at once and its lines are added with add_lines(), so
+  lines of any length are kept whole.
   \param[in] filename The filename to load
   \returns 1 if OK, 0 on error (errno has reason)
-  \see add()
+  \see add(), add_lines()
 */
 int Fl_Browser::load(const char *filename) {
-#define MAXFL_BLINE 1024
-    char newtext[MAXFL_BLINE];
-    int c;
-    int i;
     clear();
     if (!filename || !(filename[0])) return 1;
     FILE *fl = fl_fopen(filename,"r");
     if (!fl) return 0;
-    i = 0;
-    do {
-	c = getc(fl);
-	if (c == '\n' || c <= 0 || i>=(MAXFL_BLINE-1)) {
-	    newtext[i] = 0;
-	    add(newtext);
-	    i = 0;
-	} else {
-	    newtext[i++] = c;
-	}
-    } while (c >= 0);
+
+    // read the whole file, growing the buffer if it is not the size
+    // the file claims (text mode, pipes...)
+    long size = 0, alloc = 0;
+    if (fseek(fl, 0, SEEK_END) == 0) {
+	alloc = ftell(fl);
+	rewind(fl);
+    }
+    if (alloc <= 0) alloc = 65536;
+    char *text = (char*)malloc(alloc+1);
+    int ok = text != 0;
+    while (ok) {
+	size += fread(text+size, 1, alloc-size, fl);
+	if (size < alloc) break;
+	int c = getc(fl);
+	if (c == EOF) break;
+	alloc *= 2;
+	char *t = (char*)realloc(text, alloc+1);
+	if (!t) ok = 0; else {text = t; text[size++] = (char)c;}
+    }
+    if (ferror(fl)) ok = 0;
     fclose(fl);
+    if (!ok) {
+	free(text);
+	return 0;
+    }
+    text[size] = 0;
+
+    // every newline (or nul) ends a line, and what follows the last one
+    // is a line too
+    int n = 1;
+    long i;
+    for (i = 0; i < size; i++)
+	if (text[i] == '\n' || !text[i]) n++;
+    const char **ptr = (const char**)malloc(n*sizeof(char*));
+    if (!ptr) {
+	free(text);
+	return 0;
+    }
+    n = 0;
+    ptr[n++] = text;
+    for (i = 0; i < size; i++)
+	if (text[i] == '\n' || !text[i]) {
+	    text[i] = 0;
+	    ptr[n++] = text+i+1;
+	}
+    add_lines(ptr, n);
+    free(ptr);
+    free(text);
     return 1;
 }
 
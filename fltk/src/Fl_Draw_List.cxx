@@ -0,0 +1,305 @@
+//
+// "$Id$"
+//
+// Display list code for the Fast Light Tool Kit (FLTK).
+//
+// Copyright 1998-2009 by Bill Spitzak and others.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Library General Public
+// License as published by the Free Software Foundation; either
+// version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA.
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+#include <FL/Fl_Draw_List.H>
+#include <FL/fl_draw.H>
+#include <stdlib.h>
+#include <string.h>
+
+// Number of ints following each command, -1 for a point list
+static const int op_args[] = {
+  0,	// unused
+  1,	// FL_DL_COLOR
+  4,	// FL_DL_RECTF
+  4,	// FL_DL_RECT
+  4,	// FL_DL_LINE
+  2,	// FL_DL_POINT
+  -1,	// FL_DL_POLYGON
+  -1,	// FL_DL_LOOP
+  2,	// FL_DL_LINE_STYLE
+  2,	// FL_DL_FONT
+  4,	// FL_DL_PUSH_CLIP
+  0,	// FL_DL_POP_CLIP
+  4,	// FL_DL_TEXT
+  7	// FL_DL_TEXT_BOX
+};
+
+Fl_Draw_List::Fl_Draw_List() {
+  ops_ = 0;
+  size_ = alloc_ = 0;
+  text_ = 0;
+  text_size_ = text_alloc_ = 0;
+  commands_ = 0;
+}
+
+Fl_Draw_List::~Fl_Draw_List() {
+  free(ops_);
+  free(text_);
+}
+
+// Make room for n more ints and return where they go, 0 if out of memory
+int *Fl_Draw_List::grow(int n) {
+  if (size_ + n > alloc_) {
+    int a = alloc_ ? alloc_ : 256;
+    while (a < size_ + n) a *= 2;
+    int *p = (int *)realloc(ops_, a * sizeof(int));
+    if (!p) return 0;
+    ops_ = p;
+    alloc_ = a;
+  }
+  int *p = ops_ + size_;
+  size_ += n;
+  commands_++;
+  return p;
+}
+
+// Copy n bytes of s to the text pool and return their offset, -1 on failure
+int Fl_Draw_List::add_text(const char *s, int n) {
+  if (text_size_ + n + 1 > text_alloc_) {
+    int a = text_alloc_ ? text_alloc_ : 256;
+    while (a < text_size_ + n + 1) a *= 2;
+    char *p = (char *)realloc(text_, a);
+    if (!p) return -1;
+    text_ = p;
+    text_alloc_ = a;
+  }
+  memcpy(text_ + text_size_, s, n);
+  text_[text_size_ + n] = 0;
+  int o = text_size_;
+  text_size_ += n + 1;
+  return o;
+}
+
+/** Records fl_color(c). */
+void Fl_Draw_List::color(Fl_Color c) {
+  int *p = grow(2);
+  if (p) { p[0] = FL_DL_COLOR; p[1] = (int)c; }
+}
+
+static void add4(int *p, int op, int a, int b, int c, int d) {
+  if (!p) return;
+  p[0] = op; p[1] = a; p[2] = b; p[3] = c; p[4] = d;
+}
+
+/** Records fl_rectf(x, y, w, h). */
+void Fl_Draw_List::rectf(int x, int y, int w, int h) {
+  add4(grow(5), FL_DL_RECTF, x, y, w, h);
+}
+
+/** Records fl_rect(x, y, w, h). */
+void Fl_Draw_List::rect(int x, int y, int w, int h) {
+  add4(grow(5), FL_DL_RECT, x, y, w, h);
+}
+
+/** Records fl_line(x, y, x1, y1). */
+void Fl_Draw_List::line(int x, int y, int x1, int y1) {
+  add4(grow(5), FL_DL_LINE, x, y, x1, y1);
+}
+
+/** Records fl_point(x, y). */
+void Fl_Draw_List::point(int x, int y) {
+  int *p = grow(3);
+  if (p) { p[0] = FL_DL_POINT; p[1] = x; p[2] = y; }
+}
+
+/** Records a filled polygon through the n points in xy (x,y pairs). */
+void Fl_Draw_List::polygon(const int *xy, int n) {
+  if (n < 3) return;
+  int *p = grow(2 + 2 * n);
+  if (!p) return;
+  p[0] = FL_DL_POLYGON; p[1] = n;
+  memcpy(p + 2, xy, 2 * n * sizeof(int));
+}
+
+/** Records the closed outline through the n points in xy (x,y pairs). */
+void Fl_Draw_List::loop(const int *xy, int n) {
+  if (n < 2) return;
+  int *p = grow(2 + 2 * n);
+  if (!p) return;
+  p[0] = FL_DL_LOOP; p[1] = n;
+  memcpy(p + 2, xy, 2 * n * sizeof(int));
+}
+
+/** Records fl_line_style(style, width). */
+void Fl_Draw_List::line_style(int style, int width) {
+  int *p = grow(3);
+  if (p) { p[0] = FL_DL_LINE_STYLE; p[1] = style; p[2] = width; }
+}
+
+/** Records fl_font(face, size). */
+void Fl_Draw_List::font(Fl_Font face, Fl_Fontsize size) {
+  int *p = grow(3);
+  if (p) { p[0] = FL_DL_FONT; p[1] = face; p[2] = size; }
+}
+
+/** Records fl_push_clip(x, y, w, h). */
+void Fl_Draw_List::push_clip(int x, int y, int w, int h) {
+  add4(grow(5), FL_DL_PUSH_CLIP, x, y, w, h);
+}
+
+/** Records fl_pop_clip(). */
+void Fl_Draw_List::pop_clip() {
+  int *p = grow(1);
+  if (p) p[0] = FL_DL_POP_CLIP;
+}
+
+/** Records fl_draw(s, x, y). The string is copied. */
+void Fl_Draw_List::text(const char *s, int x, int y) {
+  if (!s) return;
+  int n = strlen(s);
+  int o = add_text(s, n);
+  if (o < 0) return;
+  add4(grow(5), FL_DL_TEXT, x, y, o, n);
+}
+
+/** Records fl_draw(s, x, y, w, h, align). The string is copied. */
+void Fl_Draw_List::text(const char *s, int x, int y, int w, int h, Fl_Align align) {
+  if (!s) return;
+  int n = strlen(s);
+  int o = add_text(s, n);
+  if (o < 0) return;
+  int *p = grow(8);
+  if (!p) return;
+  p[0] = FL_DL_TEXT_BOX; p[1] = x; p[2] = y; p[3] = w; p[4] = h;
+  p[5] = (int)align; p[6] = o; p[7] = n;
+}
+
+/**
+  Returns the number of ints taken by the packed command at v, which has
+  n ints left, or -1 if it is not a command or its arguments are missing.
+*/
+int Fl_Draw_List::command_size(const int *v, int n) {
+  if (n < 1 || v[0] < FL_DL_COLOR || v[0] > FL_DL_TEXT_BOX) return -1;
+  int k = op_args[v[0]];
+  if (k < 0) {
+    // point list: count, then count x,y pairs
+    if (n < 2 || v[1] < (v[0] == FL_DL_POLYGON ? 3 : 2) || v[1] > (n - 2) / 2)
+      return -1;
+    k = 1 + 2 * v[1];
+  }
+  return k < n ? k + 1 : -1;
+}
+
+/**
+  Appends commands already packed as in the list: an Fl_Draw_List_Op
+  followed by its arguments, repeated. Text commands cannot be appended
+  this way as their strings live in the list's own pool.
+  \returns the number of commands appended, or -1 if v is malformed,
+  in which case nothing is appended.
+*/
+int Fl_Draw_List::append(const int *v, int n) {
+  int i, k, count = 0;
+  for (i = 0; i < n; i += k, count++) {
+    if (v[i] >= FL_DL_TEXT) return -1;
+    k = command_size(v + i, n - i);
+    if (k < 0) return -1;
+  }
+  int c = commands_;
+  int *p = grow(n);
+  if (!p) return -1;
+  memcpy(p, v, n * sizeof(int));
+  commands_ = c + count;
+  return count;
+}
+
+/**
+  Draws the list, with every coordinate moved by dx, dy.
+  Clip regions left pushed by the list are popped at the end.
+*/
+void Fl_Draw_List::draw(int dx, int dy) const {
+  const int *p = ops_, *e = ops_ + size_;
+  int clips = 0;
+  while (p < e) {
+    switch (p[0]) {
+      case FL_DL_COLOR:
+        fl_color((Fl_Color)p[1]);
+        p += 2;
+        break;
+      case FL_DL_RECTF:
+        fl_rectf(p[1] + dx, p[2] + dy, p[3], p[4]);
+        p += 5;
+        break;
+      case FL_DL_RECT:
+        fl_rect(p[1] + dx, p[2] + dy, p[3], p[4]);
+        p += 5;
+        break;
+      case FL_DL_LINE:
+        fl_line(p[1] + dx, p[2] + dy, p[3] + dx, p[4] + dy);
+        p += 5;
+        break;
+      case FL_DL_POINT:
+        fl_point(p[1] + dx, p[2] + dy);
+        p += 3;
+        break;
+      case FL_DL_POLYGON:
+      case FL_DL_LOOP: {
+        int n = p[1];
+        const int *xy = p + 2;
+        if (p[0] == FL_DL_POLYGON) fl_begin_polygon();
+        else fl_begin_loop();
+        for (int i = 0; i < n; i++, xy += 2)
+          fl_vertex(xy[0] + dx, xy[1] + dy);
+        if (p[0] == FL_DL_POLYGON) fl_end_polygon();
+        else fl_end_loop();
+        p += 2 + 2 * n;
+        break; }
+      case FL_DL_LINE_STYLE:
+        fl_line_style(p[1], p[2]);
+        p += 3;
+        break;
+      case FL_DL_FONT:
+        fl_font((Fl_Font)p[1], (Fl_Fontsize)p[2]);
+        p += 3;
+        break;
+      case FL_DL_PUSH_CLIP:
+        fl_push_clip(p[1] + dx, p[2] + dy, p[3], p[4]);
+        clips++;
+        p += 5;
+        break;
+      case FL_DL_POP_CLIP:
+        if (clips > 0) { fl_pop_clip(); clips--; }
+        p += 1;
+        break;
+      case FL_DL_TEXT:
+        fl_draw(text_ + p[3], p[4], p[1] + dx, p[2] + dy);
+        p += 5;
+        break;
+      case FL_DL_TEXT_BOX:
+        fl_draw(text_ + p[6], p[1] + dx, p[2] + dy, p[3], p[4], (Fl_Align)p[5]);
+        p += 8;
+        break;
+      default:
+        p = e;	// cannot happen, append() checks the commands
+        break;
+    }
+  }
+  while (clips-- > 0) fl_pop_clip();
+}
+
+//
+// End of "$Id$".
+//
@@ -89,6 +89,8 @@ struct FL_BLINE			// data is in a linked list of these
   FL_BLINE	*next;		// Next item in list
   void		*data;		// Pointer to data (function)
   Fl_Image      *icon;		// Pointer to optional icon
+  struct FL_BLOCK *block;	// Block holding this line
+  int		height;		// Cached Fl_Browser::item_height() or -1
   short		length;		// sizeof(txt)-1, may be longer than string
   char		flags;		// selected, displayed
   char		txt[1];		// start of allocated array
@@ -102,12 +104,12 @@ struct FL_BLINE			// data is in a linked list of these
 int					// O - Height in pixels
 Fl_File_Browser::full_height() const
 {
-  int	i,				// Looping var
-	th;				// Total height of list.
+  void	*item;			// Looping var
+  int	th;				// Total height of list.
 
 
-  for (i = 0, th = 0; i < size(); i ++)
-    th += item_height(find_line(i));
+  for (item = item_first(), th = 0; item; item = item_next(item))
+    th += item_height(item);
 
   return (th);
 }
@@ -198,6 +198,234 @@ struct fl_margins {
 	}
 };
 
+//
+// Measurements kept between Fl_Help_View::format() calls...
+//
+// A document is formatted again for every new width and font, while
+// the words and tables it is made of do not change. The widths of the
+// words and the natural column widths of the tables are measured once
+// and looked up afterwards, so only the line breaking is redone.
+//
+
+struct Fl_Help_Word {
+	Fl_Help_Word	*next;		// Next word in the hash bucket
+	unsigned	hash;		// Hash of font, size and text
+	Fl_Font	font;		// Font and size of the text
+	Fl_Fontsize	size;
+	int		len,		// Length of text
+		 width;		// Width of text
+	char		text[1];	// Text, not nul-terminated
+};
+
+struct Fl_Help_Table {
+	const char	*table;		// Start of the table in value_
+	int		num_columns;	// Number of columns
+	int		*widths;	// Widest then minimum width of each column
+	int		hsize;		// hsize_ of the scan if it used % widths, else -1
+	Fl_Help_Font_Stack fstack;	// Font stack after scanning the table
+};
+
+struct Fl_Help_Layout {
+	Fl_Help_Word	**words;	// Hash table of word widths
+	int		nbuckets,	// Number of buckets, a power of 2
+		 nwords;		// Number of words
+	Fl_Help_Table	*tables;	// Scanned tables, sorted by start
+	int		ntables,	// Number of tables
+		 atables;	// Allocated tables
+	Fl_Font	font;		// Default text attributes of the tables
+	Fl_Fontsize	size;
+	Fl_Color	color;
+	int		min_hsize,	// Widest word or image of the document
+		 basis,		// Width available to the last format()
+		 percents;	// Number of % lengths converted by get_length()
+
+	Fl_Help_Layout() {
+		words     = 0;
+		nbuckets  = 0;
+		nwords    = 0;
+		tables    = 0;
+		ntables   = 0;
+		atables   = 0;
+		font      = 0;
+		size      = 0;
+		color     = 0;
+		min_hsize = 0;
+		basis     = -1;
+		percents  = 0;
+	}
+
+	~Fl_Help_Layout() {
+		clear();
+		free( words );
+		free( tables );
+	}
+
+	// Forgets everything measured for the current document
+	void clear() {
+		for ( int i = 0; i < nbuckets; i ++ ) {
+			while ( words[i] ) {
+				Fl_Help_Word *wd = words[i];
+				words[i] = wd->next;
+				free( wd );
+			}
+		}
+
+		nwords = 0;
+		clear_tables();
+		basis = -1;
+	}
+
+	void clear_tables() {
+		for ( int i = 0; i < ntables; i ++ )
+			free( tables[i].widths );
+
+		ntables   = 0;
+		min_hsize = 0;
+	}
+
+	// Tables and the widest word depend on the default text attributes
+	void check( Fl_Font f, Fl_Fontsize s, Fl_Color c ) {
+		if ( f != font || s != size || c != color ) {
+			clear_tables();
+			font  = f;
+			size  = s;
+			color = c;
+		}
+	}
+
+	int width( const char *s );
+	Fl_Help_Table *find_table( const char *t );
+	Fl_Help_Table *add_table( const char *t, int n, const int *columns, const int *minwidths, int hsize );
+};
+
+// Returns the width of s in the current font, like fl_width()
+int Fl_Help_Layout::width( const char *s ) {
+	Fl_Font	f = fl_font();
+	Fl_Fontsize	sz = fl_size();
+	int		len = strlen( s );
+	unsigned	h = 2166136261u ^ ( unsigned )f ^ ( ( unsigned )sz << 16 );
+	Fl_Help_Word	*wd;
+
+	for ( int i = 0; i < len; i ++ )
+		h = ( h ^ ( uchar )s[i] ) * 16777619u;
+
+	if ( nbuckets ) {
+		for ( wd = words[h & ( nbuckets - 1 )]; wd; wd = wd->next )
+			if ( wd->hash == h && wd->font == f && wd->size == sz && wd->len == len &&
+					!memcmp( wd->text, s, len ) )
+				return wd->width;
+	}
+
+	int ww = ( int )fl_width( s, len );
+
+	if ( nwords >= nbuckets ) {
+		int		n = nbuckets ? 2 * nbuckets : 1024;
+		Fl_Help_Word	**nw = ( Fl_Help_Word ** )calloc( n, sizeof( Fl_Help_Word * ) );
+
+		if ( !nw )
+			return ww;
+
+		for ( int i = 0; i < nbuckets; i ++ ) {
+			while ( words[i] ) {
+				wd = words[i];
+				words[i] = wd->next;
+				wd->next = nw[wd->hash & ( n - 1 )];
+				nw[wd->hash & ( n - 1 )] = wd;
+			}
+		}
+
+		free( words );
+		words    = nw;
+		nbuckets = n;
+	}
+
+	wd = ( Fl_Help_Word * )malloc( sizeof( Fl_Help_Word ) + len );
+
+	if ( wd ) {
+		wd->hash  = h;
+		wd->font  = f;
+		wd->size  = sz;
+		wd->len   = len;
+		wd->width = ww;
+		memcpy( wd->text, s, len );
+		wd->next  = words[h & ( nbuckets - 1 )];
+		words[h & ( nbuckets - 1 )] = wd;
+		nwords ++;
+	}
+
+	return ww;
+}
+
+// Returns the scanned table starting at t, or NULL
+Fl_Help_Table *Fl_Help_Layout::find_table( const char *t ) {
+	int lo = 0, hi = ntables;
+
+	while ( lo < hi ) {
+		int mid = ( lo + hi ) / 2;
+
+		if ( tables[mid].table == t ) return tables + mid;
+
+		if ( tables[mid].table < t ) lo = mid + 1;
+		else hi = mid;
+	}
+
+	return 0;
+}
+
+// Remembers the column widths of the table starting at t, measured at
+// the width hsize if they depend on it, -1 if they do not
+Fl_Help_Table *Fl_Help_Layout::add_table( const char *t, int n,
+		const int *columns, const int *minwidths, int hsize ) {
+	int *widths = ( int * )malloc( 2 * n * sizeof( int ) + 1 );
+
+	if ( !widths )
+		return 0;
+
+	Fl_Help_Table *old = find_table( t );
+
+	if ( old ) {
+		// Scanned again at another width
+		free( old->widths );
+		memcpy( widths, columns, n * sizeof( int ) );
+		memcpy( widths + n, minwidths, n * sizeof( int ) );
+		old->num_columns = n;
+		old->widths      = widths;
+		old->hsize       = hsize;
+		return old;
+	}
+
+	if ( ntables >= atables ) {
+		int		na = atables + 16;
+		Fl_Help_Table	*nt = ( Fl_Help_Table * )realloc( tables, na * sizeof( Fl_Help_Table ) );
+
+		if ( !nt ) {
+			free( widths );
+			return 0;
+		}
+
+		tables  = nt;
+		atables = na;
+	}
+
+	// Tables are met in document order, so this normally appends
+	int i = ntables;
+
+	while ( i > 0 && tables[i - 1].table > t )
+		i --;
+
+	memmove( tables + i + 1, tables + i, ( ntables - i ) * sizeof( Fl_Help_Table ) );
+	ntables ++;
+
+	memcpy( widths, columns, n * sizeof( int ) );
+	memcpy( widths + n, minwidths, n * sizeof( int ) );
+	tables[i].table       = t;
+	tables[i].num_columns = n;
+	tables[i].widths      = widths;
+	tables[i].hsize       = hsize;
+
+	return tables + i;
+}
+
 //
 // All the stuff needed to implement text selection in Fl_Help_View
 //
@@ -1385,9 +1613,21 @@ void Fl_Help_View::format() {
 	fl_margins	margins;	// Left margin stack...
 
 
+	// Forget the tables measured with other default text attributes...
+	if ( !layout_ )
+		layout_ = new Fl_Help_Layout;
+
+	layout_->check( textfont_, textsize_, textcolor() );
+
 	// Reset document width...
 	int scrollsize = scrollbar_size_ ? scrollbar_size_ : Fl::scrollbar_size();
 	hsize_ = w() - scrollsize - Fl::box_dw( b );
+	layout_->basis = hsize_;
+
+	// Start as wide as the widest word found by a previous format(), this
+	// saves the passes that would find it again...
+	if ( hsize_ < layout_->min_hsize )
+		hsize_ = layout_->min_hsize;
 
 	done = 0;
 
@@ -1437,18 +1677,18 @@ void Fl_Help_View::format() {
 			if ( ( *ptr == '<' || isspace( ( *ptr ) & 255 ) ) && s > buf ) {
 				// Get width of word parsed so far...
 				*s = '\0';
-				ww = ( int )fl_width( buf );
+				ww = layout_->width( buf );
 
 				if ( !head && !pre ) {
 					// Check width...
 					if ( ww > hsize_ ) {
-						hsize_ = ww;
+						hsize_ = layout_->min_hsize = ww;
 						done   = 0;
 						break;
 					}
 
 					if ( needspace && xx > block->x )
-						ww += ( int )fl_width( ' ' );
+						ww += layout_->width( " " );
 
 					//        printf("line = %d, xx = %d, ww = %d, block->x = %d, block->w = %d\n",
 					//	       line, xx, ww, block->x, block->w);
@@ -1491,7 +1731,7 @@ void Fl_Help_View::format() {
 							block->h += hh;
 							hh       = fsize + font_increment_;
 						} else
-							xx += ( int )fl_width( ' ' );
+							xx += layout_->width( " " );
 
 						if ( ( fsize + font_increment_ ) > hh )
 							hh = fsize + font_increment_;
@@ -1847,14 +2087,14 @@ void Fl_Help_View::format() {
 						ww = width;
 
 						if ( ww > hsize_ ) {
-							hsize_ = ww;
+							hsize_ = layout_->min_hsize = ww;
 							done   = 0;
 							do_break_loop = true;
 							break;
 						}
 
 						if ( needspace && xx > block->x ) {
-							ww += ( int ) fl_width ( ' ' );
+							ww += layout_->width ( " " );
 						}
 
 						if ( ( xx + ww ) > block->w ) {
@@ -2072,7 +2312,7 @@ end_tag_switch:
 				needspace = 1;
 
 				if ( pre ) {
-					xx += ( int )fl_width( ' ' );
+					xx += layout_->width( " " );
 				}
 
 				ptr ++;
@@ -2109,19 +2349,19 @@ end_tag_switch:
 
 		if ( s > buf && !head ) {
 			*s = '\0';
-			ww = ( int )fl_width( buf );
+			ww = layout_->width( buf );
 
 			//    printf("line = %d, xx = %d, ww = %d, block->x = %d, block->w = %d\n",
 			//	   line, xx, ww, block->x, block->w);
 
 			if ( ww > hsize_ ) {
-				hsize_ = ww;
+				hsize_ = layout_->min_hsize = ww;
 				done   = 0;
 				break;
 			}
 
 			if ( needspace && xx > block->x )
-				ww += ( int )fl_width( ' ' );
+				ww += layout_->width( " " );
 
 			if ( ( xx + ww ) > block->w ) {
 				line     = do_align( block, line, xx, newalign, links );
@@ -2149,6 +2389,15 @@ end_tag_switch:
 		qsort( targets_, ntargets_, sizeof( Fl_Help_Target ),
 			   ( compare_func_t )compare_targets );
 
+	format_scrollbars();
+}
+
+
+/** Shows, places and sets the scrollbars for the formatted text. */
+void
+Fl_Help_View::format_scrollbars() {
+	Fl_Boxtype	b = box() ? box() : FL_DOWN_BOX;
+	// Box to draw...
 	int dx = Fl::box_dw( b ) - Fl::box_dx( b );
 	int dy = Fl::box_dh( b ) - Fl::box_dy( b );
 	int ss = scrollbar_size_ ? scrollbar_size_ : Fl::scrollbar_size();
@@ -2227,6 +2476,8 @@ Fl_Help_View::format_table( int        *table_width,	// O - Total table width
 	Fl_Font       font;
 	Fl_Fontsize   fsize;				        // Current font and size
 	Fl_Color      fcolor;                                 // Currrent font color
+	Fl_Help_Table *scanned;				// Table measured before
+	int		percents;				// % lengths converted before the scan
 
 	// Clear widths...
 	*table_width = 0;
@@ -2236,11 +2487,26 @@ Fl_Help_View::format_table( int        *table_width,	// O - Total table width
 		minwidths[column] = 0;
 	}
 
+	// A table scanned by a previous format() only needs scaling, unless
+	// its % widths were converted at another width...
+	if ( ( scanned = layout_->find_table( table ) ) != NULL &&
+	     ( scanned->hsize < 0 || scanned->hsize == hsize_ ) ) {
+		num_columns = scanned->num_columns;
+		memcpy( columns, scanned->widths, num_columns * sizeof( int ) );
+		memcpy( minwidths, scanned->widths + num_columns, num_columns * sizeof( int ) );
+		fstack_ = scanned->fstack;
+		fstack_.top( font, fsize, fcolor );
+		fl_font( font, fsize );
+		fl_color( fcolor );
+		goto scale_table;
+	}
+
 	num_columns = 0;
 	colspan     = 0;
 	max_width   = 0;
 	pre         = 0;
 	needspace   = 0;
+	percents    = layout_->percents;
 	fstack_.top( font, fsize, fcolor );
 
 	// Scan the table...
@@ -2253,7 +2519,7 @@ Fl_Help_View::format_table( int        *table_width,	// O - Total table width
 			}
 
 			*s         = '\0';
-			temp_width = ( int )fl_width( buf );
+			temp_width = layout_->width( buf );
 			s          = buf;
 
 			if ( temp_width > minwidths[column] )
@@ -2487,7 +2753,7 @@ Fl_Help_View::format_table( int        *table_width,	// O - Total table width
 					width += iwidth;
 
 					if ( needspace ) {
-						width += ( int ) fl_width ( ' ' );
+						width += layout_->width ( " " );
 					}
 
 					if ( width > max_width ) {
@@ -2539,6 +2805,11 @@ Fl_Help_View::format_table( int        *table_width,	// O - Total table width
 		}
 	}
 
+	if ( ( scanned = layout_->add_table( table, num_columns, columns, minwidths,
+	                                     layout_->percents != percents ? hsize_ : -1 ) ) != NULL )
+		scanned->fstack = fstack_;
+
+scale_table:
 	// Now that we have scanned the entire table, adjust the table and
 	// cell widths to fit on the screen...
 	if ( get_attr( table + 6, "WIDTH", attr, sizeof( attr ) ) )
@@ -2637,6 +2908,9 @@ Fl_Help_View::format_table( int        *table_width,	// O - Total table width
 /** Frees memory used for the document. */
 void
 Fl_Help_View::free_data() {
+	// Images still loading no longer concern this document...
+	Fl_Shared_Image::cancel_async( this );
+
 	// Release all images...
 	if ( value_ ) {
 		const char	*ptr,		// Pointer into block
@@ -2707,6 +2981,9 @@ Fl_Help_View::free_data() {
 		value_ = 0;
 	}
 
+	if ( layout_ )
+		layout_->clear();
+
 	// Free all of the arrays...
 	if ( nblocks_ ) {
 		free( blocks_ );
@@ -2977,7 +3254,12 @@ Fl_Help_View::get_image( const char *name, int W, int H ) {
 	if ( strncmp( localname, "file:", 5 ) == 0 ) localname += 5;
 
 	if ( initial_load ) {
-		if ( ( ip = Fl_Shared_Image::get( localname, W, H ) ) == NULL ) {
+		if ( async_images_ )
+			ip = Fl_Shared_Image::get_async( localname, W, H, image_loaded, this );
+		else
+			ip = Fl_Shared_Image::get( localname, W, H );
+
+		if ( ip == NULL ) {
 			ip = ( Fl_Shared_Image * )&broken_image;
 		}
 	} else { // draw or resize
@@ -2992,6 +3274,26 @@ Fl_Help_View::get_image( const char *name, int W, int H ) {
 }
 
 
+/** Lays out the document again when an image loaded in the background
+    got another size than its placeholder, else just redraws it. */
+void
+Fl_Help_View::image_loaded( Fl_Shared_Image *,	// I - Loaded image
+							int resized,	// I - Size changed?
+							void *data ) {	// I - Help view
+	Fl_Help_View *view = ( Fl_Help_View * )data;
+
+	if ( resized && view->value_ ) {
+		// The tables and the widest image were measured with the old size...
+		if ( view->layout_ )
+			view->layout_->clear_tables();
+
+		view->format();
+	}
+
+	view->redraw();
+}
+
+
 /** Gets a length value, either absolute or %. */
 int
 Fl_Help_View::get_length( const char *l ) {	// I - Value
@@ -3007,6 +3309,7 @@ Fl_Help_View::get_length( const char *l ) {	// I - Value
 
 		int scrollsize = scrollbar_size_ ? scrollbar_size_ : Fl::scrollbar_size();
 		val = val * ( hsize_ - scrollsize ) / 100;
+		if ( layout_ ) layout_->percents ++;	// the result depends on hsize_
 	}
 
 	return val;
@@ -3476,6 +3779,8 @@ Fl_Help_View::Fl_Help_View( int        xx,	// I - Left position
 	td_bottom_gap_ = 5;
 	tr_gap_ = 2;
 	line31_ = 31;
+	layout_ = 0;
+	async_images_ = 0;
 
 	scrollbar_.value( 0, hh, 0, 1 );
 	scrollbar_.step( 8.0 );
@@ -3501,6 +3806,7 @@ Fl_Help_View::Fl_Help_View( int        xx,	// I - Left position
 Fl_Help_View::~Fl_Help_View() {
 	clear_selection();
 	free_data();
+	delete layout_;
 }
 
 
@@ -3650,7 +3956,11 @@ Fl_Help_View::resize( int xx,	// I - New left position
 						y() + h() - scrollsize - Fl::box_dh( b ) + Fl::box_dy( b ),
 						w() - scrollsize - Fl::box_dw( b ), scrollsize );
 
-	format();
+	// The text only needs breaking again for a new width...
+	if ( value_ && layout_ && layout_->basis == w() - scrollsize - Fl::box_dw( b ) )
+		format_scrollbars();
+	else
+		format();
 }
 
 
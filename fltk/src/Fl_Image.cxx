@@ -39,6 +39,15 @@ void fl_release_dc(HWND, HDC); // from Fl_win32.cxx
 
 void fl_restore_clip(); // from fl_rect.cxx
 
+// from fl_scale_image.cxx:
+void fl_scale_image(const uchar *src, int w, int h, int d, int ld,
+                    uchar *dst, int W, int H, Fl_RGB_Scaling filter);
+void fl_average_image(const uchar *src, int ld, uchar *dst, int dld,
+                      int w, int h, int d, const unsigned *mul,
+                      const unsigned *add);
+void fl_desaturate_image(const uchar *src, int ld, uchar *dst, int dld,
+                         int w, int h, int d);
+
 //
 // Base image class...
 //
@@ -197,7 +206,19 @@ void Fl_RGB_Image::uncache() {
 #endif
 }
 
+Fl_RGB_Scaling Fl_RGB_Image::scaling_ = FL_RGB_SCALING_NEAREST;
+
 Fl_Image *Fl_RGB_Image::copy(int W, int H) {
+  return copy(W, H, scaling_);
+}
+
+/**
+  Creates a copy of the image, resized to \p W x \p H with \p filter.
+  FL_RGB_SCALING_NEAREST is the fastest. The other filters weigh all
+  the pixels they cover, which avoids the aliasing of nearest when the
+  image is reduced. Large images are resized by several threads.
+*/
+Fl_Image *Fl_RGB_Image::copy(int W, int H, Fl_RGB_Scaling filter) {
   Fl_RGB_Image	*new_image;	// New RGB image
   uchar		*new_array;	// New array for image data
 
@@ -252,6 +273,11 @@ Fl_Image *Fl_RGB_Image::copy(int W, int H) {
   new_image = new Fl_RGB_Image(new_array, W, H, d());
   new_image->alloc_array = 1;
 
+  if (filter != FL_RGB_SCALING_NEAREST) {
+    fl_scale_image(array, w(), h(), d(), line_d, new_array, W, H, filter);
+    return new_image;
+  }
+
   // Scale the image using a nearest-neighbor algorithm...
   for (dy = H, sy = 0, yerr = H, new_ptr = new_array; dy > 0; dy --) {
     for (dx = W, xerr = W, old_ptr = array + sy * line_d; dx > 0; dx --) {
@@ -285,48 +311,42 @@ void Fl_RGB_Image::color_average(Fl_Color c, float i) {
   uncache();
 
   // Allocate memory as needed...
-  uchar		*new_array,
-		*new_ptr;
+  uchar		*new_array;
 
   if (!alloc_array) new_array = new uchar[h() * w() * d()];
   else new_array = (uchar *)array;
 
   // Get the color to blend with...
   uchar		r, g, b;
-  unsigned	ia, ir, ig, ib;
+  unsigned	ia, mul[4], add[4];
 
   Fl::get_color(c, r, g, b);
   if (i < 0.0f) i = 0.0f;
   else if (i > 1.0f) i = 1.0f;
 
   ia = (unsigned)(256 * i);
-  ir = r * (256 - ia);
-  ig = g * (256 - ia);
-  ib = b * (256 - ia);
 
-  // Update the image data to do the blend...
-  const uchar	*old_ptr;
-  int		x, y;
-  int   line_i = ld() ? ld() - (w()*d()) : 0; // increment from line end to beginning of next line
+  // Each channel becomes (value * mul + add) >> 8, alpha is kept...
+  mul[0] = mul[1] = mul[2] = mul[3] = ia;
+  if (!(d() & 1)) mul[d() - 1] = 256;
 
   if (d() < 3) {
-    ig = (r * 31 + g * 61 + b * 8) / 100 * (256 - ia);
-
-    for (new_ptr = new_array, old_ptr = array, y = 0; y < h(); y ++, old_ptr += line_i)
-      for (x = 0; x < w(); x ++) {
-	*new_ptr++ = (*old_ptr++ * ia + ig) >> 8;
-	if (d() > 1) *new_ptr++ = *old_ptr++;
-      }
+    add[0] = (r * 31 + g * 61 + b * 8) / 100 * (256 - ia);
+    add[1] = 0;
   } else {
-    for (new_ptr = new_array, old_ptr = array, y = 0; y < h(); y ++, old_ptr += line_i)
-      for (x = 0; x < w(); x ++) {
-	*new_ptr++ = (*old_ptr++ * ia + ir) >> 8;
-	*new_ptr++ = (*old_ptr++ * ia + ig) >> 8;
-	*new_ptr++ = (*old_ptr++ * ia + ib) >> 8;
-	if (d() > 3) *new_ptr++ = *old_ptr++;
-      }
+    add[0] = r * (256 - ia);
+    add[1] = g * (256 - ia);
+    add[2] = b * (256 - ia);
+    add[3] = 0;
   }
 
+  // Update the image data to do the blend, in place the lines keep
+  // their length...
+  int	line_d = ld() ? ld() : w() * d();
+
+  fl_average_image(array, line_d, new_array, alloc_array ? line_d : w() * d(),
+                   w(), h(), d(), mul, add);
+
   // Set the new pointers/values as needed...
   if (!alloc_array) {
     array       = new_array;
@@ -347,23 +367,15 @@ void Fl_RGB_Image::desaturate() {
   uncache();
 
   // Allocate memory for a grayscale image...
-  uchar		*new_array,
-		*new_ptr;
+  uchar		*new_array;
   int		new_d;
 
   new_d     = d() - 2;
   new_array = new uchar[h() * w() * new_d];
 
   // Copy the image data, converting to grayscale...
-  const uchar	*old_ptr;
-  int		x, y;
-  int   line_i = ld() ? ld() - (w()*d()) : 0; // increment from line end to beginning of next line
-
-  for (new_ptr = new_array, old_ptr = array, y = 0; y < h(); y ++, old_ptr += line_i)
-    for (x = 0; x < w(); x ++, old_ptr += d()) {
-      *new_ptr++ = (uchar)((31 * old_ptr[0] + 61 * old_ptr[1] + 8 * old_ptr[2]) / 100);
-      if (d() > 3) *new_ptr++ = old_ptr[3];
-    }
+  fl_desaturate_image(array, ld() ? ld() : w() * d(), new_array, w() * new_d,
+                      w(), h(), d());
 
   // Free the old array as needed, and then set the new pointers/values...
   if (alloc_array) delete[] (uchar *)array;
@@ -50,15 +50,285 @@ int	Fl_Shared_Image::alloc_handlers_ = 0;	// Allocated format handlers
 
 
 //
-// Typedef the C API sort function type the only way I know how...
+// Cache index and memory budget...
 //
+// Images are found through a hash table on their name, so all sizes
+// of a file are in the same bucket. When a budget is set with
+// cache_size(), released images stay in the cache in least recently
+// used order, and their decoded data is dropped when the decoded
+// images take more than the budget.
+//
+
+static Fl_Shared_Image **hash_table = 0;	// Images by name
+static int	hash_size = 0;			// Number of buckets, a power of 2
+static size_t	cache_budget = 0;		// Bytes allowed, 0 = no caching
+static size_t	cache_used = 0;			// Bytes of decoded images
+static int	cache_hit_count = 0;		// Images found in the cache
+static int	cache_miss_count = 0;		// Files decoded
+static int	cache_evict_count = 0;		// Decoded images dropped
+static Fl_Shared_Image *lru_first = 0;		// Least recently released image
+static Fl_Shared_Image *lru_last = 0;		// Most recently released image
+
+// FNV-1a hash of a file name
+static unsigned hash_name(const char *n) {
+  unsigned h = 2166136261U;
+
+  while (*n) {
+    h ^= (uchar)*n++;
+    h *= 16777619U;
+  }
+
+  return h;
+}
+
+// Estimates the memory used by the data of img
+static size_t image_bytes(Fl_Image *img) {
+  int d = img->d();
+
+  if (d < 1) d = 1;	// Bitmaps and pixmaps, roughly
+
+  return (size_t)img->w() * img->h() * d;
+}
+
+
+//
+// Background loading for get_async()...
+//
+// Image files are decoded by a small pool of threads and handed back
+// to the main thread with Fl::awake(), which stores them in their
+// shared image and calls the functions waiting for them. Only the job
+// lists and the handler list are used by the threads, they are protected
+// by a mutex.
+//
+
+#ifdef WIN32
+#  include <windows.h>
+#  define HAVE_ASYNC_LOAD 1
+#elif HAVE_PTHREAD
+#  include <pthread.h>
+#  define HAVE_ASYNC_LOAD 1
+#endif // WIN32
+
+struct Fl_Shared_Job {
+  Fl_Shared_Job	*next;		// Next job in the list
+  char		*name;		// File to decode
+  Fl_Image	*image;		// Decoded image, or NULL
+  Fl_Shared_Image *target;	// Shared image waiting for it
+};
+
+struct Fl_Shared_Listener {
+  char		*name;		// File waited for
+  Fl_Shared_Loaded cb;		// Function to call
+  void		*data;		// User data for the function
+};
+
+static Fl_Shared_Listener *listeners = 0;	// Functions waiting for files
+static int	num_listeners = 0;		// Number of waiting functions
+static int	alloc_listeners = 0;		// Allocated waiting functions
+static int	num_loading = 0;		// Originals being loaded
+
+struct Fl_Shared_Loader {
+  static Fl_Shared_Job *todo, *todo_last;	// Files to decode
+  static Fl_Shared_Job *done;			// Decoded files
+  static int	threads;			// Number of threads started
+
+  static int	start();
+  static void	queue(Fl_Shared_Job *job);
+  static Fl_Shared_Job *next();
+  static void	run();
+  static void	finish_jobs(void *);
+};
+
+Fl_Shared_Job *Fl_Shared_Loader::todo = 0;
+Fl_Shared_Job *Fl_Shared_Loader::todo_last = 0;
+Fl_Shared_Job *Fl_Shared_Loader::done = 0;
+int	Fl_Shared_Loader::threads = -1;
+
+#ifdef WIN32
+static CRITICAL_SECTION jobs_cs;		// Protects the job lists
+static HANDLE	jobs_sem;			// Counts the files to decode
+
+static void lock_jobs() { EnterCriticalSection(&jobs_cs); }
+static void unlock_jobs() { LeaveCriticalSection(&jobs_cs); }
+
+static DWORD WINAPI loader_thread(LPVOID) {
+  Fl_Shared_Loader::run();
+  return 0;
+}
+#elif HAVE_PTHREAD
+static pthread_mutex_t jobs_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t jobs_cond = PTHREAD_COND_INITIALIZER;
+
+static void lock_jobs() { pthread_mutex_lock(&jobs_mutex); }
+static void unlock_jobs() { pthread_mutex_unlock(&jobs_mutex); }
+
+static void *loader_thread(void *) {
+  Fl_Shared_Loader::run();
+  return 0;
+}
+#endif // WIN32
+
+#ifdef HAVE_ASYNC_LOAD
+// Starts the threads the first time, returns the number running
+int Fl_Shared_Loader::start() {
+  const int NUM_LOADERS = 2;
+
+  if (threads >= 0) return threads;
+
+  threads = 0;
+#  ifdef WIN32
+  InitializeCriticalSection(&jobs_cs);
+  jobs_sem = CreateSemaphore(NULL, 0, 0x7fffffff, NULL);
+  if (!jobs_sem) return 0;
+
+  for (; threads < NUM_LOADERS; threads ++) {
+    HANDLE h = CreateThread(NULL, 0, loader_thread, NULL, 0, NULL);
+    if (!h) break;
+    CloseHandle(h);
+  }
+#  else
+  for (; threads < NUM_LOADERS; threads ++) {
+    pthread_t t;
+    if (pthread_create(&t, NULL, loader_thread, NULL)) break;
+    pthread_detach(t);
+  }
+#  endif // WIN32
+
+  return threads;
+}
+
+// Adds a file to decode
+void Fl_Shared_Loader::queue(Fl_Shared_Job *job) {
+  lock_jobs();
+  job->next = 0;
+  if (todo_last) todo_last->next = job;
+  else todo = job;
+  todo_last = job;
+  unlock_jobs();
+
+#  ifdef WIN32
+  ReleaseSemaphore(jobs_sem, 1, NULL);
+#  else
+  pthread_cond_signal(&jobs_cond);
+#  endif // WIN32
+}
+
+// Waits for a file to decode
+Fl_Shared_Job *Fl_Shared_Loader::next() {
+  Fl_Shared_Job *job;
+
+#  ifdef WIN32
+  WaitForSingleObject(jobs_sem, INFINITE);
+  lock_jobs();
+#  else
+  lock_jobs();
+  while (!todo) pthread_cond_wait(&jobs_cond, &jobs_mutex);
+#  endif // WIN32
 
-extern "C" {
-  typedef int (*compare_func_t)(const void *, const void *);
+  job = todo;
+  todo = job->next;
+  if (!todo) todo_last = 0;
+  unlock_jobs();
+
+  return job;
 }
 
+// Body of the threads, decodes files forever
+void Fl_Shared_Loader::run() {
+  for (;;) {
+    Fl_Shared_Job *job = next();
+
+    job->image = Fl_Shared_Image::decode(job->name);
+
+    lock_jobs();
+    job->next = done;
+    done      = job;
+    unlock_jobs();
+
+    Fl::awake(finish_jobs, 0);
+  }
+}
+#else
+int Fl_Shared_Loader::start() { return 0; }
+#endif // HAVE_ASYNC_LOAD
+
+// Protects the handler list once the threads are running
+static void lock_handlers() {
+#ifdef HAVE_ASYNC_LOAD
+  if (Fl_Shared_Loader::threads > 0) lock_jobs();
+#endif // HAVE_ASYNC_LOAD
+}
 
-/** Returns the Fl_Shared_Image* array */
+static void unlock_handlers() {
+#ifdef HAVE_ASYNC_LOAD
+  if (Fl_Shared_Loader::threads > 0) unlock_jobs();
+#endif // HAVE_ASYNC_LOAD
+}
+
+// Stores the decoded files in their images, runs in the main thread
+void Fl_Shared_Loader::finish_jobs(void *) {
+  for (;;) {
+    Fl_Shared_Job	*job;		// Decoded file
+    Fl_Shared_Image	**b,		// Bucket of the file
+			*img;		// Image in the bucket
+
+#ifdef HAVE_ASYNC_LOAD
+    lock_jobs();
+    job = done;
+    if (job) done = job->next;
+    unlock_jobs();
+#else
+    job = 0;
+#endif // HAVE_ASYNC_LOAD
+
+    if (!job) break;
+
+    // The image may have been released, or loaded by get(), meanwhile...
+    b = Fl_Shared_Image::bucket(job->name);
+
+    for (img = b ? *b : 0; img; img = img->hash_next_)
+      if (img == job->target) break;
+
+    if (img && img->loading_ && !strcmp(img->name_, job->name))
+      img->loaded(job->image);
+    else
+      delete job->image;
+
+    delete[] job->name;
+    delete job;
+  }
+}
+
+// Makes cb wait for file n, unless it does already
+static void add_listener(const char *n, Fl_Shared_Loaded cb, void *data) {
+  int i;
+
+  for (i = 0; i < num_listeners; i ++)
+    if (listeners[i].cb == cb && listeners[i].data == data &&
+        !strcmp(listeners[i].name, n)) return;
+
+  if (num_listeners >= alloc_listeners) {
+    Fl_Shared_Listener *temp = new Fl_Shared_Listener[alloc_listeners + 32];
+
+    if (alloc_listeners) {
+      memcpy(temp, listeners, alloc_listeners * sizeof(Fl_Shared_Listener));
+
+      delete[] listeners;
+    }
+
+    listeners       = temp;
+    alloc_listeners += 32;
+  }
+
+  listeners[num_listeners].name = new char[strlen(n) + 1];
+  strcpy(listeners[num_listeners].name, n);
+  listeners[num_listeners].cb   = cb;
+  listeners[num_listeners].data = data;
+  num_listeners ++;
+}
+
+
+/** Returns the Fl_Shared_Image* array, in no particular order */
 Fl_Shared_Image **Fl_Shared_Image::images() {
   return images_;
 }
@@ -98,6 +368,12 @@ Fl_Shared_Image::Fl_Shared_Image() : Fl_Image(0,0,0) {
   original_    = 0;
   image_       = 0;
   alloc_image_ = 0;
+  loading_     = 0;
+  bytes_       = 0;
+  index_       = -1;
+  hash_next_   = 0;
+  lru_prev_    = 0;
+  lru_next_    = 0;
 }
 
 
@@ -118,6 +394,12 @@ Fl_Shared_Image::Fl_Shared_Image(const char *n,		// I - Filename
   image_       = img;
   alloc_image_ = !img;
   original_    = 1;
+  loading_     = 0;
+  bytes_       = 0;
+  index_       = -1;
+  hash_next_   = 0;
+  lru_prev_    = 0;
+  lru_next_    = 0;
 
   if (!img) reload();
   else update();
@@ -147,12 +429,189 @@ Fl_Shared_Image::add() {
   }
 
   images_[num_images_] = this;
+  index_ = num_images_;
   num_images_ ++;
 
-  if (num_images_ > 1) {
-    qsort(images_, num_images_, sizeof(Fl_Shared_Image *),
-          (compare_func_t)compare);
+  if (num_images_ > hash_size) {
+    // Grow the hash table and index all images again...
+    int			i;		// Looping var
+    Fl_Shared_Image	**b;		// Bucket
+
+    hash_size = hash_size ? 2 * hash_size : 64;
+
+    delete[] hash_table;
+    hash_table = new Fl_Shared_Image *[hash_size];
+    memset(hash_table, 0, hash_size * sizeof(Fl_Shared_Image *));
+
+    for (i = 0; i < num_images_; i ++) {
+      b = bucket(images_[i]->name_);
+      images_[i]->hash_next_ = *b;
+      *b = images_[i];
+    }
+  } else {
+    Fl_Shared_Image **b = bucket(name_);
+    hash_next_ = *b;
+    *b = this;
   }
+
+  trim();
+}
+
+
+//
+// 'Fl_Shared_Image::remove()' - Remove a shared image from the array.
+//
+
+void
+Fl_Shared_Image::remove() {
+  Fl_Shared_Image	**b;		// Bucket
+
+  if (index_ < 0) return;
+
+  lru_remove();
+
+  for (b = bucket(name_); *b; b = &(*b)->hash_next_)
+    if (*b == this) {
+      *b = hash_next_;
+      break;
+    }
+
+  // Move the last image into the hole...
+  num_images_ --;
+  images_[index_] = images_[num_images_];
+  images_[index_]->index_ = index_;
+  index_     = -1;
+  hash_next_ = 0;
+
+  if (num_images_ == 0) {
+    delete[] images_;
+    delete[] hash_table;
+
+    images_       = 0;
+    alloc_images_ = 0;
+    hash_table    = 0;
+    hash_size     = 0;
+  }
+}
+
+
+//
+// 'Fl_Shared_Image::bucket()' - Find the hash bucket of a file name.
+//
+
+Fl_Shared_Image **
+Fl_Shared_Image::bucket(const char *n) {
+  if (!hash_table) return 0;
+  else return hash_table + (hash_name(n) & (hash_size - 1));
+}
+
+
+//
+// 'Fl_Shared_Image::lookup()' - Find a shared image without using it.
+//
+
+Fl_Shared_Image *
+Fl_Shared_Image::lookup(const char *n,	// I - Filename
+                        int        W,	// I - Width, 0 for the original
+                        int        H) {	// I - Height
+  Fl_Shared_Image	**b = bucket(n),// Bucket
+			*img;		// Image in the bucket
+
+  for (img = b ? *b : 0; img; img = img->hash_next_) {
+    if (strcmp(img->name_, n)) continue;
+
+    if (W == 0) {
+      if (img->original_) return img;
+    } else if (img->w() == W && img->h() == H) return img;
+  }
+
+  return 0;
+}
+
+
+//
+// 'Fl_Shared_Image::use()' - Add a reference to a cached image.
+//
+
+void
+Fl_Shared_Image::use() {
+  if (refcount_ <= 0) lru_remove();
+
+  refcount_ ++;
+}
+
+
+//
+// 'Fl_Shared_Image::lru_add()' - Add a released image to the LRU list.
+//
+
+void
+Fl_Shared_Image::lru_add() {
+  lru_prev_ = lru_last;
+  lru_next_ = 0;
+
+  if (lru_last) lru_last->lru_next_ = this;
+  else lru_first = this;
+
+  lru_last = this;
+}
+
+
+//
+// 'Fl_Shared_Image::lru_remove()' - Remove an image from the LRU list.
+//
+
+void
+Fl_Shared_Image::lru_remove() {
+  if (!lru_prev_ && lru_first != this) return;
+
+  if (lru_prev_) lru_prev_->lru_next_ = lru_next_;
+  else lru_first = lru_next_;
+
+  if (lru_next_) lru_next_->lru_prev_ = lru_prev_;
+  else lru_last = lru_prev_;
+
+  lru_prev_ = 0;
+  lru_next_ = 0;
+}
+
+
+//
+// 'Fl_Shared_Image::evict()' - Drop the decoded data of a released image.
+//
+// Originals stay in the cache with their name and size, so that they
+// are decoded again when they are asked for. Copies are deleted.
+//
+
+void
+Fl_Shared_Image::evict() {
+  lru_remove();
+  cache_evict_count ++;
+
+  if (!original_) {
+    remove();
+    delete this;
+    return;
+  }
+
+  if (alloc_image_) delete image_;
+
+  image_       = 0;
+  alloc_image_ = 0;
+  data(0, 0);
+
+  cache_used -= bytes_;
+  bytes_     = 0;
+}
+
+
+//
+// 'Fl_Shared_Image::trim()' - Evict released images over the budget.
+//
+
+void
+Fl_Shared_Image::trim() {
+  while (cache_used > cache_budget && lru_first) lru_first->evict();
 }
 
 
@@ -168,6 +627,10 @@ Fl_Shared_Image::update() {
     d(image_->d());
     data(image_->data(), image_->count());
   }
+
+  cache_used -= bytes_;
+  bytes_     = image_ ? image_bytes(image_) : 0;
+  cache_used += bytes_;
 }
 
 /**
@@ -177,8 +640,22 @@ Fl_Shared_Image::update() {
   instead.
 */
 Fl_Shared_Image::~Fl_Shared_Image() {
+  if (loading_ && original_) {
+    // Nobody will load this file now...
+    int i, j;
+
+    for (i = 0, j = 0; i < num_listeners; i ++)
+      if (!strcmp(listeners[i].name, name_)) delete[] listeners[i].name;
+      else listeners[j ++] = listeners[i];
+
+    num_listeners = j;
+    num_loading --;
+  }
+
   if (name_) delete[] (char *)name_;
   if (alloc_image_) delete image_;
+
+  cache_used -= bytes_;
 }
 
 
@@ -186,69 +663,88 @@ Fl_Shared_Image::~Fl_Shared_Image() {
 /** 
   Releases and possibly destroys (if refcount <=0) a shared image. 
   In the latter case, it will reorganize the shared image array so that no hole will occur.
+
+  When a cache budget is set with cache_size(), an image that is no
+  longer used stays in the cache until get() asks for it again or its
+  data is evicted to keep within the budget.
 */
 void Fl_Shared_Image::release() {
-  int	i;	// Looping var...
-
   refcount_ --;
   if (refcount_ > 0) return;
 
-  for (i = 0; i < num_images_; i ++)
-    if (images_[i] == this) {
-      num_images_ --;
-
-      if (i < num_images_) {
-        memmove(images_ + i, images_ + i + 1,
-               (num_images_ - i) * sizeof(Fl_Shared_Image *));
-      }
-
-      break;
+  if (cache_budget && index_ >= 0 && (loading_ || (image_ && alloc_image_))) {
+    // Keep it for later, images being loaded join the list when done...
+    if (image_) {
+      lru_add();
+      trim();
     }
 
-  delete this;
-
-  if (num_images_ == 0 && images_) {
-    delete[] images_;
-
-    images_       = 0;
-    alloc_images_ = 0;
+    return;
   }
+
+  remove();
+  delete this;
 }
 
 
 //
-/** Reloads the shared image from disk */
-void Fl_Shared_Image::reload() {
-  // Load image from disk...
+/**
+  Loads the image file \p n, without adding it to the cache.
+  This is also called by the threads of get_async().
+  \return the new image, or NULL if the file could not be read
+*/
+Fl_Image *Fl_Shared_Image::decode(const char *n) {
   int		i;		// Looping var
   FILE		*fp;		// File pointer
   uchar		header[64];	// Buffer for auto-detecting files
   Fl_Image	*img;		// New image
+  Fl_Shared_Handler *handlers;	// Copy of the image handlers
+  int		num_handlers;	// Number of image handlers
 
-  if (!name_) return;
-
-  if ((fp = fl_fopen(name_, "rb")) != NULL) {
+  if ((fp = fl_fopen(n, "rb")) != NULL) {
     fread(header, 1, sizeof(header), fp);
     fclose(fp);
   } else {
-    return;
+    return 0;
   }
 
   // Load the image as appropriate...
   if (memcmp(header, "#define", 7) == 0) // XBM file
-    img = new Fl_XBM_Image(name_);
+    img = new Fl_XBM_Image(n);
   else if (memcmp(header, "/* XPM */", 9) == 0) // XPM file
-    img = new Fl_XPM_Image(name_);
+    img = new Fl_XPM_Image(n);
   else {
-    // Not a standard format; try an image handler...
-    for (i = 0, img = 0; i < num_handlers_; i ++) {
-      img = (handlers_[i])(name_, header, sizeof(header));
+    // Not a standard format; try an image handler, using a copy of
+    // the list since the main thread may change it meanwhile...
+    lock_handlers();
+    num_handlers = num_handlers_;
+    handlers     = num_handlers ? new Fl_Shared_Handler [num_handlers] : 0;
+    if (num_handlers)
+      memcpy(handlers, handlers_, num_handlers * sizeof(Fl_Shared_Handler));
+    unlock_handlers();
+
+    for (i = 0, img = 0; i < num_handlers; i ++) {
+      img = (handlers[i])(n, header, sizeof(header));
 
       if (img) break;
     }
+
+    delete[] handlers;
   }
 
-  if (img) {
+  return img;
+}
+
+
+//
+/** Reloads the shared image from disk */
+void Fl_Shared_Image::reload() {
+  // Load image from disk...
+  Fl_Image	*img;		// New image
+
+  if (!name_) return;
+
+  if ((img = decode(name_)) != NULL) {
     if (alloc_image_) delete image_;
 
     alloc_image_ = 1;
@@ -347,29 +843,22 @@ void Fl_Shared_Image::uncache()
 
 /** Finds a shared image from its named and size specifications */
 Fl_Shared_Image* Fl_Shared_Image::find(const char *n, int W, int H) {
-  Fl_Shared_Image	*key,		// Image key
-			**match;	// Matching image
-
-  if (num_images_) {
-    key = new Fl_Shared_Image();
-    key->name_ = new char[strlen(n) + 1];
-    strcpy((char *)key->name_, n);
-    key->w(W);
-    key->h(H);
+  Fl_Shared_Image	*temp;		// Matching image
 
-    match = (Fl_Shared_Image **)bsearch(&key, images_, num_images_,
-                                        sizeof(Fl_Shared_Image *),
-                                        (compare_func_t)compare);
+  if ((temp = lookup(n, W, H)) == NULL) return 0;
 
-    delete key;
+  temp->use();
 
-    if (match) {
-      (*match)->refcount_ ++;
-      return *match;
-    }
+  if (!temp->image_ && temp->original_ && !temp->loading_) {
+    // Its data was evicted, decode the file again...
+    temp->reload();
+    if (temp->image_) cache_miss_count ++;
+    trim();
+  } else {
+    cache_hit_count ++;
   }
 
-  return 0;
+  return temp;
 }
 
 
@@ -383,6 +872,9 @@ Fl_Shared_Image* Fl_Shared_Image::find(const char *n, int W, int H) {
 Fl_Shared_Image* Fl_Shared_Image::get(const char *n, int W, int H) {
   Fl_Shared_Image	*temp;		// Image
 
+  // Don't return an image still loaded by get_async()...
+  if (num_loading) finish(n);
+
   if ((temp = find(n, W, H)) != NULL) return temp;
 
   if ((temp = find(n)) == NULL) {
@@ -393,12 +885,22 @@ Fl_Shared_Image* Fl_Shared_Image::get(const char *n, int W, int H) {
       return NULL;
     }
 
+    cache_miss_count ++;
     temp->add();
+  } else if (!temp->image_) {
+    // The file could not be decoded again...
+    temp->release();
+    return NULL;
   }
 
   if ((temp->w() != W || temp->h() != H) && W && H) {
-    temp = (Fl_Shared_Image *)temp->copy(W, H);
+    Fl_Shared_Image *orig = temp;
+
+    temp = (Fl_Shared_Image *)orig->copy(W, H);
     temp->add();
+
+    // Without a cache budget the original is kept for other sizes...
+    if (cache_budget) orig->release();
   }
 
   return temp;
@@ -406,6 +908,345 @@ Fl_Shared_Image* Fl_Shared_Image::get(const char *n, int W, int H) {
 
 
 
+/**
+  Gets a shared image like get(), without waiting for the file to be
+  decoded.
+
+  If the image is not in the cache, a placeholder is returned at once
+  and the file is decoded by a background thread. The placeholder has
+  the size \p W, \p H when both are given, else the size found by
+  probe(), and is drawn as an empty box. When the file is decoded the
+  placeholder and its scaled copies get the image data and \p cb is
+  called with \p data from the main thread. \p resized is non-zero
+  if the original image got another size than the placeholder; images
+  that cannot be decoded stay empty. \p cb is also called when the
+  image was already being loaded, but not when it is returned loaded.
+
+  The decoded images are delivered with Fl::awake(), so the program
+  must have called Fl::lock() once, see \ref advanced_multithreading.
+  On systems without threads this is the same as get().
+
+  \return the image or its placeholder, or NULL if the file cannot be
+  opened.
+*/
+Fl_Shared_Image *Fl_Shared_Image::get_async(const char *n, int W, int H,
+                                            Fl_Shared_Loaded cb, void *data) {
+  Fl_Shared_Image	*temp,		// Image
+			*orig;		// Original size image
+  int			pw, ph;		// Size of placeholder
+
+  if (Fl_Shared_Loader::start() <= 0) return get(n, W, H);
+
+  if ((temp = lookup(n, W, H)) != NULL &&
+      (temp->image_ || temp->loading_ || !temp->original_)) {
+    temp->use();
+    cache_hit_count ++;
+    if (temp->loading_) add_listener(n, cb, data);
+    return temp;
+  }
+
+  if ((orig = lookup(n)) == NULL) {
+    if (probe(n, pw, ph) < 0) return NULL;
+
+    orig = new Fl_Shared_Image();
+    orig->name_ = new char[strlen(n) + 1];
+    strcpy((char *)orig->name_, n);
+    orig->original_ = 1;
+    orig->w(pw);
+    orig->h(ph);
+    orig->add();
+  } else {
+    orig->use();
+  }
+
+  if (!orig->image_ && !orig->loading_) {
+    // Not decoded yet, or its data was evicted...
+    orig->loading_ = 1;
+    num_loading ++;
+    cache_miss_count ++;
+
+    Fl_Shared_Job *job = new Fl_Shared_Job;
+    job->name = new char[strlen(n) + 1];
+    strcpy(job->name, n);
+    job->image  = 0;
+    job->target = orig;
+    Fl_Shared_Loader::queue(job);
+  } else {
+    cache_hit_count ++;
+  }
+
+  if (orig->loading_) add_listener(n, cb, data);
+
+  if ((orig->w() != W || orig->h() != H) && W && H) {
+    if (orig->loading_) {
+      // Scaled when the original is decoded...
+      temp = new Fl_Shared_Image();
+      temp->name_ = new char[strlen(n) + 1];
+      strcpy((char *)temp->name_, n);
+      temp->loading_ = 1;
+      temp->w(W);
+      temp->h(H);
+    } else {
+      temp = (Fl_Shared_Image *)orig->copy(W, H);
+    }
+
+    temp->add();
+
+    // With a cache budget an original being loaded stays in the cache
+    // until its copies are scaled, see release()...
+    if (cache_budget) orig->release();
+    return temp;
+  }
+
+  return orig;
+}
+
+
+/**
+  Stops calling the functions given to get_async() with \p data.
+  Use this before \p data is destroyed.
+*/
+void Fl_Shared_Image::cancel_async(void *data) {
+  int	i, j;	// Looping vars
+
+  for (i = 0, j = 0; i < num_listeners; i ++)
+    if (listeners[i].data == data) delete[] listeners[i].name;
+    else listeners[j ++] = listeners[i];
+
+  num_listeners = j;
+}
+
+
+// Decodes the file n now if get_async() is loading it
+void Fl_Shared_Image::finish(const char *n) {
+  Fl_Shared_Image	**b = bucket(n),// Bucket of the file
+			*img;		// Image in the bucket
+
+  for (img = b ? *b : 0; img; img = img->hash_next_)
+    if (img->loading_ && img->original_ && !strcmp(img->name_, n)) {
+      img->loaded(decode(n));
+      return;
+    }
+}
+
+
+// Stores the decoded image of a placeholder and calls the functions
+// waiting for it
+void Fl_Shared_Image::loaded(Fl_Image *img) {
+  int			i, j, k;	// Looping vars
+  int			ow = w(),	// Size of placeholder
+			oh = h();
+  int			resized;	// Other size than the placeholder?
+  Fl_Shared_Listener	*temp;		// Functions to call
+  Fl_Shared_Image	*c,		// Image in the bucket
+			*next;		// Next image in the bucket
+
+  loading_ = 0;
+  num_loading --;
+
+  if (img) {
+    image_       = img;
+    alloc_image_ = 1;
+    update();
+  }
+
+  // Scale the copies asked for while loading, the ones already
+  // released are cached now, or deleted if the file could not be read...
+  for (c = index_ >= 0 ? *bucket(name_) : 0; c; c = next) {
+    next = c->hash_next_;
+
+    if (c->loading_ && !c->original_ && !strcmp(c->name_, name_)) {
+      c->loading_ = 0;
+
+      if (image_) {
+        c->image_       = image_->copy(c->w(), c->h());
+        c->alloc_image_ = 1;
+        c->update();
+      }
+
+      if (c->refcount_ <= 0) {
+        if (c->image_) c->lru_add();
+        else {
+          c->remove();
+          delete c;
+        }
+      }
+    }
+  }
+
+  resized = w() != ow || h() != oh;
+
+  // Take the waiting functions off the list first, they may ask for
+  // more images...
+  for (i = 0, j = 0; i < num_listeners; i ++)
+    if (!strcmp(listeners[i].name, name_)) j ++;
+
+  temp = j ? new Fl_Shared_Listener[j] : 0;
+
+  for (i = 0, j = 0, k = 0; i < num_listeners; i ++)
+    if (!strcmp(listeners[i].name, name_)) temp[j ++] = listeners[i];
+    else listeners[k ++] = listeners[i];
+
+  num_listeners = k;
+
+  refcount_ ++;
+
+  for (i = 0; i < j; i ++) {
+    (temp[i].cb)(this, resized, temp[i].data);
+    delete[] temp[i].name;
+  }
+
+  delete[] temp;
+
+  // Caches or deletes the image if it was released while loading...
+  release();
+  trim();
+}
+
+
+/**
+  Reads the size of the image file \p n from its header, without
+  decoding it. GIF, BMP, PNG and JPEG files are understood.
+  \return 1 if the size was found, 0 if not, or -1 if the file cannot
+  be opened.
+*/
+int Fl_Shared_Image::probe(const char *n, int &W, int &H) {
+  FILE		*fp;		// File pointer
+  uchar		h[32];		// Start of file
+  int		len;		// Bytes read
+
+  W = H = 0;
+
+  if ((fp = fl_fopen(n, "rb")) == NULL) return -1;
+
+  len = fread(h, 1, sizeof(h), fp);
+
+  if (len >= 24 && memcmp(h, "\211PNG", 4) == 0 && memcmp(h + 12, "IHDR", 4) == 0) {
+    W = (h[16] << 24) | (h[17] << 16) | (h[18] << 8) | h[19];
+    H = (h[20] << 24) | (h[21] << 16) | (h[22] << 8) | h[23];
+  } else if (len >= 10 && (memcmp(h, "GIF87a", 6) == 0 || memcmp(h, "GIF89a", 6) == 0)) {
+    W = h[6] | (h[7] << 8);
+    H = h[8] | (h[9] << 8);
+  } else if (len >= 26 && memcmp(h, "BM", 2) == 0) {
+    if (h[14] == 12) { // OS/2 header
+      W = h[18] | (h[19] << 8);
+      H = h[20] | (h[21] << 8);
+    } else {
+      W = h[18] | (h[19] << 8) | (h[20] << 16) | (h[21] << 24);
+      H = h[22] | (h[23] << 8) | (h[24] << 16) | (h[25] << 24);
+      if (H < 0) H = -H; // top-down bitmap
+    }
+  } else if (len >= 4 && h[0] == 0xff && h[1] == 0xd8) {
+    // Walk the JPEG markers up to the start-of-frame...
+    int c, marker, seglen;
+
+    fseek(fp, 2, SEEK_SET);
+
+    for (;;) {
+      while ((c = getc(fp)) != EOF && c != 0xff);
+      while ((c = getc(fp)) == 0xff);
+      if (c == EOF || c == 0xd9 || c == 0xda) break;
+
+      marker = c;
+      if (marker == 0x01 || (marker >= 0xd0 && marker <= 0xd7)) continue;
+
+      seglen = getc(fp) << 8;
+      seglen |= getc(fp);
+      if (seglen < 2) break;
+
+      if (marker >= 0xc0 && marker <= 0xcf &&
+          marker != 0xc4 && marker != 0xc8 && marker != 0xcc) {
+        if (fread(h, 1, 5, fp) == 5) {
+          H = (h[1] << 8) | h[2];
+          W = (h[3] << 8) | h[4];
+        }
+        break;
+      }
+
+      if (fseek(fp, seglen - 2, SEEK_CUR)) break;
+    }
+  }
+
+  fclose(fp);
+
+  if (W <= 0 || H <= 0) {
+    W = H = 0;
+    return 0;
+  }
+
+  return 1;
+}
+
+
+
+/**
+  Sets the memory budget of the image cache, in bytes.
+
+  By default (0) an image is deleted as soon as it is released. With a
+  budget, released images stay in the cache for the next get(), and
+  when the decoded images take more than \p bytes the data of the least
+  recently released ones is dropped. Their name and size are kept, the
+  file is decoded again when it is asked for. Images that are still
+  used are never evicted, so the budget can be exceeded by them.
+
+  Also, get() then releases the original of a scaled copy instead of
+  keeping it for other sizes.
+*/
+void Fl_Shared_Image::cache_size(size_t bytes) {
+  int	i;	// Looping var
+
+  cache_budget = bytes;
+
+  if (bytes) {
+    trim();
+    return;
+  }
+
+  // Delete the released images, images being loaded go when done...
+  for (i = num_images_ - 1; i >= 0; i --) {
+    Fl_Shared_Image *img = images_[i];
+
+    if (img->refcount_ <= 0 && !img->loading_) {
+      img->remove();
+      delete img;
+    }
+  }
+}
+
+/** Returns the memory budget of the image cache, 0 if released images are not kept. */
+size_t Fl_Shared_Image::cache_size() {
+  return cache_budget;
+}
+
+/** Returns the bytes used by the decoded shared images, roughly. */
+size_t Fl_Shared_Image::cache_bytes() {
+  return cache_used;
+}
+
+/** Returns the number of images found in the cache by find(), get() and get_async(). */
+int Fl_Shared_Image::cache_hits() {
+  return cache_hit_count;
+}
+
+/** Returns the number of image files decoded for the cache. */
+int Fl_Shared_Image::cache_misses() {
+  return cache_miss_count;
+}
+
+/** Returns the number of decoded images dropped to keep within cache_size(). */
+int Fl_Shared_Image::cache_evictions() {
+  return cache_evict_count;
+}
+
+/** Sets the cache_hits(), cache_misses() and cache_evictions() counters to 0. */
+void Fl_Shared_Image::clear_cache_stats() {
+  cache_hit_count   = 0;
+  cache_miss_count  = 0;
+  cache_evict_count = 0;
+}
+
+
+
 /** Adds a shared image handler, which is basically a test function for adding new formats */
 void Fl_Shared_Image::add_handler(Fl_Shared_Handler f) {
   int			i;		// Looping var...
@@ -416,6 +1257,8 @@ void Fl_Shared_Image::add_handler(Fl_Shared_Handler f) {
     if (handlers_[i] == f) return;
   }
 
+  lock_handlers();
+
   if (num_handlers_ >= alloc_handlers_) {
     // Allocate more memory...
     temp = new Fl_Shared_Handler [alloc_handlers_ + 32];
@@ -432,6 +1275,8 @@ void Fl_Shared_Image::add_handler(Fl_Shared_Handler f) {
 
   handlers_[num_handlers_] = f;
   num_handlers_ ++;
+
+  unlock_handlers();
 }
 
 
@@ -448,6 +1293,8 @@ void Fl_Shared_Image::remove_handler(Fl_Shared_Handler f) {
   if (i >= num_handlers_) return;
 
   // OK, remove the handler from the array...
+  lock_handlers();
+
   num_handlers_ --;
 
   if (i < num_handlers_) {
@@ -455,6 +1302,8 @@ void Fl_Shared_Image::remove_handler(Fl_Shared_Handler f) {
     memmove(handlers_ + i, handlers_ + i + 1,
            (num_handlers_ - i) * sizeof(Fl_Shared_Handler ));
   }
+
+  unlock_handlers();
 }
 
 
@@ -116,6 +116,9 @@ Fl_Table::Fl_Table(int X, int Y, int W, int H, const char *l) : Fl_Group(X,Y,W,H
   _redraw_botrow    = -1;
   _redraw_leftcol   = -1;
   _redraw_rightcol  = -1;
+  _drawn_hpos       = -1;
+  _drawn_vpos       = -1;
+  _scroll_context   = CONTEXT_CELL;
   table_w           = 0;
   table_h           = 0;
   toprow            = 0;
@@ -592,7 +595,14 @@ void Fl_Table::scroll_cb(Fl_Widget*w, void *data) {
   Fl_Table *o = (Fl_Table*)data;
   o->recalc_dimensions();	// recalc tix, tiy, etc.
   o->table_scrolled();
-  o->redraw();
+  // OPTIMIZATION: move what is on screen and draw only the exposed strip.
+  //     Child fltk widgets would have to be moved too, so redraw those.
+  //
+  if ( o->table->visible() || o->_drawn_vpos == -1 ) {
+    o->redraw();
+  } else {
+    o->damage(FL_DAMAGE_SCROLL);
+  }
 }
 
 // Set number of rows
@@ -1034,6 +1044,76 @@ void Fl_Table::_redraw_cell(TableContext context, int r, int c) {
   draw_cell(context, r, c, X, Y, W, H);	// call users' function to draw it
 }
 
+// Draw the cells of 'context' that intersect X/Y/W/H,
+//     and the dead zone past the last row/col.
+//
+void Fl_Table::_redraw_area(TableContext context, int X, int Y, int W, int H) {
+  int CX, CY, CW, CH;
+  fl_push_clip(X, Y, W, H);
+  // Table smaller than window? Fill dead zones first
+  if ( context != CONTEXT_ROW_HEADER && table_w < tiw ) {
+    fl_rectf(tix + table_w, Y, tiw - table_w, H, color());
+  }
+  if ( context != CONTEXT_COL_HEADER && table_h < tih ) {
+    fl_rectf(X, tiy + table_h, W, tih - table_h, color());
+  }
+  if ( context == CONTEXT_ROW_HEADER ) {
+    for ( int r = toprow; r <= botrow; r++ ) {
+      find_cell(context, r, 0, CX, CY, CW, CH);
+      if ( CY >= Y + H ) break;			// OPT: rows are in order
+      if ( CY + CH > Y ) draw_cell(context, r, 0, CX, CY, CW, CH);
+    }
+  } else if ( context == CONTEXT_COL_HEADER ) {
+    for ( int c = leftcol; c <= rightcol; c++ ) {
+      find_cell(context, 0, c, CX, CY, CW, CH);
+      if ( CX >= X + W ) break;			// OPT: cols are in order
+      if ( CX + CW > X ) draw_cell(context, 0, c, CX, CY, CW, CH);
+    }
+  } else {
+    for ( int r = toprow; r <= botrow; r++ ) {
+      find_cell(context, r, leftcol, CX, CY, CW, CH);
+      if ( CY >= Y + H ) break;
+      if ( CY + CH <= Y ) continue;
+      for ( int c = leftcol; c <= rightcol; c++ ) {
+        find_cell(context, r, c, CX, CY, CW, CH);
+        if ( CX >= X + W ) break;
+        if ( CX + CW > X ) draw_cell(context, r, c, CX, CY, CW, CH);
+      }
+    }
+  }
+  fl_pop_clip();
+}
+
+void Fl_Table::_scroll_area_cb(void *d, int X, int Y, int W, int H) {
+  Fl_Table *o = (Fl_Table*)d;
+  o->_redraw_area(o->_scroll_context, X, Y, W, H);
+}
+
+// Scrolled since last draw:
+//     Move cells and headers already on screen with fl_scroll(),
+//     which calls back to draw only the strips that came into view.
+//
+void Fl_Table::_draw_scrolled() {
+  int hpos = (int)hscrollbar->value();
+  int vpos = (int)vscrollbar->value();
+  int dx = _drawn_hpos - hpos;
+  int dy = _drawn_vpos - vpos;
+  _drawn_hpos = hpos;
+  _drawn_vpos = vpos;
+  if ( dx == 0 && dy == 0 ) return;
+  _scroll_context = CONTEXT_CELL;
+  fl_scroll(tix, tiy, tiw, tih, dx, dy, _scroll_area_cb, this);
+  if ( dy && row_header() ) {
+    _scroll_context = CONTEXT_ROW_HEADER;
+    fl_scroll(wix, tiy, row_header_width(), tih, 0, dy, _scroll_area_cb, this);
+  }
+  if ( dx && col_header() ) {
+    _scroll_context = CONTEXT_COL_HEADER;
+    fl_scroll(tix, wiy, tiw, col_header_height(), dx, 0, _scroll_area_cb, this);
+  }
+  _scroll_context = CONTEXT_CELL;
+}
+
 int Fl_Table::is_selected(int r, int c) {
   int s_left, s_right, s_top, s_bottom;
   
@@ -1110,13 +1190,18 @@ void Fl_Table::draw() {
   //    that leak around the border.
   //
   if ( ! table->visible() ) {
-    if ( damage() & FL_DAMAGE_ALL || damage() & FL_DAMAGE_CHILD ) {
+    if ( damage() & FL_DAMAGE_ALL || 
+         ( damage() & FL_DAMAGE_CHILD && !( damage() & FL_DAMAGE_SCROLL ) ) ) {
       draw_box(table->box(), tox, toy, tow, toh, table->color());
     }
   } 
   // Clip all further drawing to the inner widget dimensions
   fl_push_clip(wix, wiy, wiw, wih);
   {
+    // Only scrolled? Move what is on screen, draw what came into view
+    if ( ! ( damage() & FL_DAMAGE_ALL ) && ( damage() & FL_DAMAGE_SCROLL ) ) {
+      _draw_scrolled();
+    }
     // Only redraw a few cells?
     if ( ! ( damage() & FL_DAMAGE_ALL ) && _redraw_leftcol != -1 ) {
       fl_push_clip(tix, tiy, tiw, tih);
@@ -1214,6 +1299,8 @@ void Fl_Table::draw() {
     draw_cell(CONTEXT_ENDPAGE, 0, 0,		// let user's drawing
               tix, tiy, tiw, tih);		// routines cleanup
     
+    _drawn_hpos = (int)hscrollbar->value();
+    _drawn_vpos = (int)vscrollbar->value();
     _redraw_leftcol = _redraw_rightcol = _redraw_toprow = _redraw_botrow = -1;
   }
   fl_pop_clip();
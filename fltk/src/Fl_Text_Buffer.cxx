@@ -32,6 +32,11 @@
 #include <ctype.h>
 #include <FL/Fl.H>
 #include <FL/Fl_Text_Buffer.H>
+#ifndef WIN32
+#  include <sys/uio.h>
+#  include <unistd.h>
+#  include <errno.h>
+#endif
 
 /*
  This file is based on a port of NEdit to FLTK many years ago. NEdit at that
@@ -138,27 +143,23 @@ static const char *ControlCodeTable[32] = {
   "can", "em", "sub", "esc", "fs", "gs", "rs", "us"
 };
 
-static char *undobuffer;
-static int undobufferlength;
-static Fl_Text_Buffer *undowidget;
-static int undoat;		// points after insertion
-static int undocut;		// number of characters deleted there
-static int undoinsert;		// number of characters inserted
-static int undoyankcut;		// length of valid contents of buffer, even if undocut=0
-
-static void undobuffersize(int n)
-{
-  if (n > undobufferlength) {
-    if (undobuffer) {
-      do {
-	undobufferlength *= 2;
-      } while (undobufferlength < n);
-      undobuffer = (char *) realloc(undobuffer, undobufferlength);
-    } else {
-      undobufferlength = n + 9;
-      undobuffer = (char *) malloc(undobufferlength);
-    }
-  }
+/*
+ One entry of the undo journal. It is followed in the journal by the text
+ deleted at pos and then the text inserted there, and padded to an int
+ boundary.
+ */
+struct Fl_Text_Undo_Record {
+  int size;			// bytes taken by the entry
+  int prevsize;			// bytes taken by the entry before it, 0 if first
+  int pos;
+  int nDeleted;
+  int nInserted;
+};
+
+static int undo_size(int nDeleted, int nInserted)
+{
+  int n = sizeof(Fl_Text_Undo_Record) + nDeleted + nInserted;
+  return (n + sizeof(int) - 1) & ~(int) (sizeof(int) - 1);
 }
 
 
@@ -189,6 +190,14 @@ Fl_Text_Buffer::Fl_Text_Buffer(int requestedSize, int preferredGapSize)
   mPredeleteCbArgs = NULL;
   mCursorPosHint = 0;
   mCanUndo = 1;
+  mUndoBuf = NULL;
+  mUndoAlloc = mUndoTop = mUndoEnd = 0;
+  mUndoLast = -1;
+  mUndoCount = mRedoCount = 0;
+  mUndoOpen = 0;
+  mUndoLimit = 1024 * 1024;
+  mNewlines = NULL;
+  mNewlineGapStart = mNewlineGapEnd = mNewlineAlloc = 0;
 #ifdef PURIFY
   {
     int i;
@@ -203,6 +212,8 @@ Fl_Text_Buffer::Fl_Text_Buffer(int requestedSize, int preferredGapSize)
 Fl_Text_Buffer::~Fl_Text_Buffer()
 {
   free(mBuf);
+  free(mNewlines);
+  free(mUndoBuf);
   if (mNModifyProcs != 0) {
     delete[]mModifyProcs;
     delete[]mCbArgs;
@@ -243,6 +254,8 @@ void Fl_Text_Buffer::text(const char *t)
   mGapStart = insertedLength;
   mGapEnd = mGapStart + mPreferredGapSize;
   memcpy(mBuf, t, insertedLength);
+  index_rebuild();
+  undo_clear();
 #ifdef PURIFY
   {
     int i;
@@ -340,8 +353,15 @@ void Fl_Text_Buffer::replace(int start, int end, const char *text)
   
   call_predelete_callbacks(start, end - start);
   const char *deletedText = text_range(start, end);
+  mUndoOpen = 0;		// a replacement is an undo step of its own
+  /* journal both halves in one entry, or none if it can not be kept */
+  char canUndo = mCanUndo;
+  if (mCanUndo && (start < end || *text) &&
+      !undo_reserve_(undo_size(end - start, strlen(text))))
+    mCanUndo = 0;
   remove_(start, end);
   int nInserted = insert_(start, text);
+  mCanUndo = canUndo;
   mCursorPosHint = start + nInserted;
   call_modify_callbacks(start, end - start, nInserted, 0, deletedText);
   free((void *) deletedText);
@@ -407,48 +427,246 @@ void Fl_Text_Buffer::copy(Fl_Text_Buffer * fromBuf, int fromStart,
     memcpy(&mBuf[toPos + part1Length],
 	   &fromBuf->mBuf[fromBuf->mGapEnd], copiedLength - part1Length);
   }
-  mGapStart += copiedLength;
-  mLength += copiedLength;
-  update_selections(toPos, 0, copiedLength);
+  gap_inserted_(toPos, copiedLength);
 }
 
 int Fl_Text_Buffer::undo(int *cursorPos)
 {
-  if (undowidget != this || !undocut && !undoinsert && !mCanUndo)
+  if (!mCanUndo || mUndoLast < 0)
     return 0;
   
-  int ilen = undocut;
-  int xlen = undoinsert;
-  int b = undoat - xlen;
-  
-  if (xlen && undoyankcut && !ilen) {
-    ilen = undoyankcut;
-  }
-  
-  if (xlen && ilen) {
-    undobuffersize(ilen + 1);
-    undobuffer[ilen] = 0;
-    char *tmp = strdup(undobuffer);
-    replace(b, undoat, tmp);
-    if (cursorPos)
-      *cursorPos = mCursorPosHint;
-    free(tmp);
-  } else if (xlen) {
-    remove(b, undoat);
-    if (cursorPos)
-      *cursorPos = mCursorPosHint;
-  } else if (ilen) {
-    undobuffersize(ilen + 1);
-    undobuffer[ilen] = 0;
-    insert(undoat, undobuffer);
-    if (cursorPos)
-      *cursorPos = mCursorPosHint;
-    undoyankcut = 0;
-  }
+  Fl_Text_Undo_Record *u = (Fl_Text_Undo_Record *) (mUndoBuf + mUndoLast);
+  mUndoTop = mUndoLast;
+  mUndoLast = u->prevsize ? mUndoLast - u->prevsize : -1;
+  mUndoCount--;
+  mRedoCount++;
+  mUndoOpen = 0;
+  undo_apply_(u->pos, u->nInserted, (char *) (u + 1), u->nDeleted);
+  if (cursorPos)
+    *cursorPos = mCursorPosHint;
+  return 1;
+}
+
+int Fl_Text_Buffer::redo(int *cursorPos)
+{
+  if (!mCanUndo || mUndoTop >= mUndoEnd)
+    return 0;
   
+  Fl_Text_Undo_Record *u = (Fl_Text_Undo_Record *) (mUndoBuf + mUndoTop);
+  mUndoLast = mUndoTop;
+  mUndoTop += u->size;
+  mUndoCount++;
+  mRedoCount--;
+  mUndoOpen = 0;
+  undo_apply_(u->pos, u->nDeleted, (char *) (u + 1) + u->nDeleted,
+	      u->nInserted);
+  if (cursorPos)
+    *cursorPos = mCursorPosHint;
+  return 1;
+}
+
+void Fl_Text_Buffer::undo_clear()
+{
+  mUndoTop = mUndoEnd = 0;
+  mUndoLast = -1;
+  mUndoCount = mRedoCount = 0;
+  mUndoOpen = 0;
+}
+
+void Fl_Text_Buffer::undo_limit(int bytes)
+{
+  mUndoLimit = bytes > 0 ? bytes : 0;
+  undo_trim_();
+}
+
+/*
+ Replace the nRemove bytes at pos by text, without journaling it, and
+ redisplay. The journal must be up to date already, as the callbacks may
+ edit the buffer again.
+ */
+void Fl_Text_Buffer::undo_apply_(int pos, int nRemove, const char *text,
+				 int nInsert)
+{
+  call_predelete_callbacks(pos, nRemove);
+  const char *deletedText = text_range(pos, pos + nRemove);
+  char canUndo = mCanUndo;
+  mCanUndo = 0;
+  if (nRemove)
+    remove_(pos, pos + nRemove);
+  if (nInsert)
+    insert_(pos, text, nInsert);
+  mCanUndo = canUndo;
+  mCursorPosHint = pos + nInsert;
+  call_modify_callbacks(pos, nRemove, nInsert, 0, deletedText);
+  free((void *) deletedText);
+}
+
+/*
+ Make room for an entry of size bytes after the undoable entries and drop
+ the entries that could be redone. Returns 0 if the entry can not be kept.
+ */
+int Fl_Text_Buffer::undo_reserve_(int size)
+{
+  mUndoEnd = mUndoTop;
+  mRedoCount = 0;
+  if (size > mUndoLimit) {
+    undo_clear();
+    return 0;
+  }
+  if (mUndoTop + size > mUndoAlloc) {
+    int n = mUndoAlloc ? mUndoAlloc : 256;
+    while (n < mUndoTop + size)
+      n *= 2;
+    char *b = (char *) realloc(mUndoBuf, n);
+    if (!b) {
+      undo_clear();
+      return 0;
+    }
+    mUndoBuf = b;
+    mUndoAlloc = n;
+  }
   return 1;
 }
 
+/*
+ Drop the oldest entries until the journal fits in mUndoLimit, with some
+ headroom so that this does not happen on every keystroke. The last entry
+ is kept, or the whole journal is cleared if it alone is over the limit,
+ so that a replace() being journaled is never cut in half.
+ */
+void Fl_Text_Buffer::undo_trim_()
+{
+  if (mUndoEnd <= mUndoLimit)
+    return;
+  int keep = mUndoLimit - mUndoLimit / 4, drop = 0;
+  while (drop < mUndoLast && mUndoEnd - drop > keep) {
+    drop += ((Fl_Text_Undo_Record *) (mUndoBuf + drop))->size;
+    mUndoCount--;
+  }
+  if (mUndoEnd - drop > mUndoLimit) {
+    undo_clear();
+    return;
+  }
+  memmove(mUndoBuf, mUndoBuf + drop, mUndoEnd - drop);
+  mUndoTop -= drop;
+  mUndoEnd -= drop;
+  mUndoLast = mUndoCount ? mUndoLast - drop : -1;
+  if (mUndoEnd)
+    ((Fl_Text_Undo_Record *) mUndoBuf)->prevsize = 0;
+}
+
+/*
+ Start a new journal entry for an edit at pos, or return NULL. Its size
+ and text lengths are left to the caller.
+ */
+Fl_Text_Undo_Record *Fl_Text_Buffer::undo_new_(int pos, int size)
+{
+  if (!undo_reserve_(size))
+    return NULL;
+  Fl_Text_Undo_Record *u = (Fl_Text_Undo_Record *) (mUndoBuf + mUndoTop);
+  u->prevsize = mUndoLast >= 0 ? mUndoTop - mUndoLast : 0;
+  u->pos = pos;
+  u->nDeleted = u->nInserted = 0;
+  mUndoLast = mUndoTop;
+  mUndoCount++;
+  mUndoOpen = 1;
+  return u;
+}
+
+/*
+ Grow the last entry to hold nDeleted and nInserted bytes of text, or
+ return NULL if the journal was cleared to stay within its limit.
+ */
+Fl_Text_Undo_Record *Fl_Text_Buffer::undo_grow_(int nDeleted, int nInserted)
+{
+  int size = undo_size(nDeleted, nInserted);
+  if (!undo_reserve_(mUndoLast - mUndoTop + size))
+    return NULL;
+  Fl_Text_Undo_Record *u = (Fl_Text_Undo_Record *) (mUndoBuf + mUndoLast);
+  u->size = size;
+  mUndoTop = mUndoEnd = mUndoLast + size;
+  return u;
+}
+
+/* journal the n bytes inserted at pos, typing coalesces into one entry */
+void Fl_Text_Buffer::undo_insert_(int pos, int n)
+{
+  if (!mCanUndo || !n)
+    return;
+  
+  Fl_Text_Undo_Record *u = mUndoOpen && mUndoLast >= 0 ?
+    (Fl_Text_Undo_Record *) (mUndoBuf + mUndoLast) : NULL;
+  int nDeleted = 0, nInserted = 0;
+  if (u && pos == u->pos + u->nInserted) {
+    nDeleted = u->nDeleted;
+    nInserted = u->nInserted;
+    u = undo_grow_(nDeleted, nInserted + n);
+  } else if ((u = undo_new_(pos, undo_size(0, n))) != NULL) {
+    u->size = undo_size(0, n);
+    mUndoTop = mUndoEnd = mUndoLast + u->size;
+  }
+  if (!u)
+    return;
+  memcpy((char *) (u + 1) + nDeleted + nInserted, &mBuf[pos], n);
+  u->nInserted = nInserted + n;
+  undo_trim_();
+}
+
+/* copy the text between start and end, on either side of the gap, to dst */
+void Fl_Text_Buffer::copy_range_(char *dst, int start, int end) const
+{
+  int mid = max(start, min(end, mGapStart));
+  memcpy(dst, &mBuf[start], mid - start);
+  memcpy(dst + mid - start, &mBuf[mid + mGapEnd - mGapStart], end - mid);
+}
+
+/* journal the text about to be removed, Backspace and Delete coalesce */
+void Fl_Text_Buffer::undo_remove_(int start, int end)
+{
+  if (!mCanUndo || start == end)
+    return;
+  
+  int n = end - start;
+  Fl_Text_Undo_Record *u = mUndoOpen && mUndoLast >= 0 ?
+    (Fl_Text_Undo_Record *) (mUndoBuf + mUndoLast) : NULL;
+  if (u && u->nInserted && start >= u->pos && end == u->pos + u->nInserted) {
+    /* erasing the end of the text just typed */
+    int nDeleted = u->nDeleted, nInserted = u->nInserted - n;
+    if (!nDeleted && !nInserted) {
+      mUndoTop = mUndoEnd = mUndoLast;
+      mUndoLast = u->prevsize ? mUndoLast - u->prevsize : -1;
+      mUndoCount--;
+      mRedoCount = 0;
+      mUndoOpen = 0;
+      return;
+    }
+    if ((u = undo_grow_(nDeleted, nInserted)) != NULL)
+      u->nInserted = nInserted;
+  } else if (u && !u->nInserted && end == u->pos) {
+    /* Backspace: prepend to the deleted text */
+    int nDeleted = u->nDeleted;
+    if ((u = undo_grow_(nDeleted + n, 0)) != NULL) {
+      char *d = (char *) (u + 1);
+      memmove(d + n, d, nDeleted);
+      copy_range_(d, start, end);
+      u->pos = start;
+      u->nDeleted = nDeleted + n;
+    }
+  } else if (u && !u->nInserted && start == u->pos) {
+    /* Delete: append to the deleted text */
+    int nDeleted = u->nDeleted;
+    if ((u = undo_grow_(nDeleted + n, 0)) != NULL) {
+      copy_range_((char *) (u + 1) + nDeleted, start, end);
+      u->nDeleted = nDeleted + n;
+    }
+  } else if ((u = undo_new_(start, undo_size(n, 0))) != NULL) {
+    u->size = undo_size(n, 0);
+    mUndoTop = mUndoEnd = mUndoLast + u->size;
+    copy_range_((char *) (u + 1), start, end);
+    u->nDeleted = n;
+  }
+  undo_trim_();
+}
 
 // unicode ok
 void Fl_Text_Buffer::canUndo(char flag)
@@ -931,17 +1149,40 @@ char *Fl_Text_Buffer::line_text(int pos) const {
 } 
 
 int Fl_Text_Buffer::line_start(int pos) const {
-  if (!findchar_backward(pos, '\n', &pos))
+  if (pos <= 0 || pos > mLength)
     return 0;
-  return pos + 1;
+  int n = line_of(pos);
+  return n ? newline_pos(n - 1) + 1 : 0;
 } 
 
 int Fl_Text_Buffer::line_end(int pos) const {
-  if (!findchar_forward(pos, '\n', &pos))
-    pos = mLength;
-  return pos;
+  if (pos < 0 || pos >= mLength)
+    return mLength;
+  int n = line_of(pos);
+  return n < newline_count() ? newline_pos(n) : mLength;
 } 
 
+// Binary search in the newline index: the number of newlines before pos
+int Fl_Text_Buffer::line_of(int pos) const {
+  int lo = 0, hi = newline_count();
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (newline_pos(mid) < pos)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+int Fl_Text_Buffer::pos_of_line(int line) const {
+  if (line <= 0)
+    return 0;
+  if (line > newline_count())
+    return mLength;
+  return newline_pos(line - 1) + 1;
+}
+
 int Fl_Text_Buffer::word_start(int pos) const {
   // FIXME: character is ucs-4
   while (pos && (isalnum(character(pos)) || character(pos) == '_')) {
@@ -1090,73 +1331,177 @@ int Fl_Text_Buffer::skip_displayed_characters(int lineStartPos, int nChars)
 }
 
 int Fl_Text_Buffer::count_lines(int startPos, int endPos) const {
-  int gapLen = mGapEnd - mGapStart;
-  int lineCount = 0;
-  
-  int pos = startPos;
-  while (pos < mGapStart)
-  {
-    if (pos == endPos)
-      return lineCount;
-    if (mBuf[pos++] == '\n')
-      lineCount++;
-  } while (pos < mLength) {
-    if (pos == endPos)
-      return lineCount;
-    if (mBuf[pos++ + gapLen] == '\n')
-      lineCount++;
-  }
-  return lineCount;
+  if (startPos >= mLength)
+    return 0;
+  if (endPos < startPos || endPos > mLength)
+    endPos = mLength;
+  return line_of(endPos) - line_of(startPos);
 }
 
 int Fl_Text_Buffer::skip_lines(int startPos, int nLines)
 {
-  if (nLines == 0)
+  if (nLines <= 0)
     return startPos;
   
-  int gapLen = mGapEnd - mGapStart;
-  int pos = startPos;
-  int lineCount = 0;
-  while (pos < mGapStart) {
-    if (mBuf[pos++] == '\n') {
-      lineCount++;
-      if (lineCount == nLines)
-	return pos;
-    }
-  }
-  while (pos < mLength) {
-    if (mBuf[pos++ + gapLen] == '\n') {
-      lineCount++;
-      if (lineCount >= nLines)
-	return pos;
-    }
-  }
-  return pos;
+  int n = line_of(startPos) + nLines - 1;
+  if (n >= newline_count())
+    return startPos > mLength ? startPos : mLength;
+  return newline_pos(n) + 1;
 }
 
 int Fl_Text_Buffer::rewind_lines(int startPos, int nLines)
 {
-  int pos = startPos - 1;
-  if (pos <= 0)
+  if (startPos - 1 <= 0)
     return 0;
+  if (startPos > mLength)
+    startPos = mLength;
   
-  int gapLen = mGapEnd - mGapStart;
-  int lineCount = -1;
-  while (pos >= mGapStart) {
-    if (mBuf[pos + gapLen] == '\n') {
-      if (++lineCount >= nLines)
-	return pos + 1;
+  int n = line_of(startPos) - 1 - nLines;
+  return n < 0 ? 0 : newline_pos(n) + 1;
+}
+
+/*
+ Boyer-Moore-Horspool matcher used by the searches. Without matchCase the
+ text is compared through toupper() like it always was. The skip table is
+ set up for scanning forwards or backwards.
+ */
+struct Fl_Text_Search {
+  unsigned char fold[256];
+  int skip[256];
+  unsigned char *pat;
+  int len;
+  int matchCase;
+  
+  Fl_Text_Search(const char *s, int mc, int backward) {
+    int i;
+    matchCase = mc;
+    len = strlen(s);
+    for (i = 0; i < 256; i++) {
+      fold[i] = (unsigned char) (matchCase ? i : toupper(i));
+      skip[i] = len;
     }
-    pos--;
+    pat = (unsigned char *) malloc(len + 1);
+    for (i = 0; i < len; i++)
+      pat[i] = fold[(unsigned char) s[i]];
+    if (backward)
+      for (i = len - 1; i > 0; i--)
+	skip[pat[i]] = i;
+    else
+      for (i = 0; i < len - 1; i++)
+	skip[pat[i]] = len - 1 - i;
+  }
+  ~Fl_Text_Search() { free(pat); }
+  
+  int match(const unsigned char *p) const {
+    if (matchCase)
+      return !memcmp(p, pat, len);
+    for (int i = 0; i < len; i++)
+      if (fold[p[i]] != pat[i])
+	return 0;
+    return 1;
   }
-  while (pos >= 0) {
-    if (mBuf[pos] == '\n') {
-      if (++lineCount >= nLines)
-	return pos + 1;
+  
+  /* first match lying between s and e */
+  const char *first(const char *s, const char *e) const {
+    if (e - s < len)
+      return NULL;
+    if (len == 1 && matchCase)
+      return (const char *) memchr(s, pat[0], e - s);
+    const unsigned char *p = (const unsigned char *) s;
+    const unsigned char *end = (const unsigned char *) e - len;
+    unsigned char last = pat[len - 1];
+    while (p <= end) {
+      unsigned char c = fold[p[len - 1]];
+      if (c == last && match(p))
+	return (const char *) p;
+      p += skip[c];
     }
-    pos--;
+    return NULL;
+  }
+  
+  /* last match lying between s and e */
+  const char *last(const char *s, const char *e) const {
+    if (e - s < len)
+      return NULL;
+    const unsigned char *p = (const unsigned char *) e - len;
+    const unsigned char *start = (const unsigned char *) s;
+    unsigned char first = pat[0];
+    while (p >= start) {
+      unsigned char c = fold[p[0]];
+      if (c == first && match(p))
+	return (const char *) p;
+      if (p - start < skip[c])
+	break;
+      p -= skip[c];
+    }
+    return NULL;
   }
-  return 0;
+};
+
+/*
+ Run the matcher on the text in front of the gap, the text around it and
+ the text behind it, in that order or the reverse, so the scans run on
+ contiguous memory. Returns the first or last match between from and to,
+ or -1.
+ */
+int Fl_Text_Buffer::search_range_(const Fl_Text_Search &s, int from, int to,
+				  int backward) const
+{
+  int m = s.len, gapLen = mGapEnd - mGapStart;
+  if (!s.pat)			// no memory for the pattern
+    return -1;
+  if (from < 0)
+    from = 0;
+  if (to > mLength)
+    to = mLength;
+  if (to - from < m)
+    return -1;
+  
+  /* contiguous halves */
+  const char *front = NULL, *back = NULL;
+  int mid = max(from, min(to, mGapStart));
+  if (backward) {
+    back = s.last(mBuf + mid + gapLen, mBuf + to + gapLen);
+    if (back)
+      return back - mBuf - gapLen;
+  } else {
+    front = s.first(mBuf + from, mBuf + mid);
+    if (front)
+      return front - mBuf;
+  }
+  
+  /* matches spanning the gap */
+  int a = max(from, mGapStart - m + 1), b = min(to, mGapStart + m - 1);
+  if (a < mGapStart && b > mGapStart && b - a >= m) {
+    char local[256], *tmp = b - a <= 256 ? local : (char *) malloc(b - a);
+    int found = -1;
+    if (tmp) {
+      copy_range_(tmp, a, b);
+      const char *p = backward ? s.last(tmp, tmp + b - a) : s.first(tmp, tmp + b - a);
+      found = p ? a + (p - tmp) : -1;
+      if (tmp != local)
+	free(tmp);
+    } else {
+      /* no memory for the copy, compare each position across the gap */
+      for (int i = 0; i <= b - a - m && found < 0; i++) {
+	int p = backward ? b - m - i : a + i, j = 0;
+	while (j < m && s.fold[(unsigned char) mBuf[p + j < mGapStart ? p + j :
+		       p + j + gapLen]] == s.pat[j])
+	  j++;
+	if (j == m)
+	  found = p;
+      }
+    }
+    if (found >= 0)
+      return found;
+  }
+  
+  if (backward) {
+    front = s.last(mBuf + from, mBuf + mid);
+    return front ? front - mBuf : -1;
+  }
+  back = s.first(mBuf + mid + gapLen, mBuf + to + gapLen);
+  return back ? back - mBuf - gapLen : -1;
 }
 
 int Fl_Text_Buffer::search_forward(int startPos, const char *searchString,
@@ -1165,23 +1510,18 @@ int Fl_Text_Buffer::search_forward(int startPos, const char *searchString,
 {
   if (!searchString)
     return 0;
-  int bp;
-  const char *sp;
-  while (startPos < length()) {
-    bp = startPos;
-    sp = searchString;
-    do {
-      if (!*sp) {
-        *foundPos = startPos;
-        return 1;
-      }
-      // FIXME: character is ucs-4
-    } while ((matchCase ? character(bp++) == *sp++ :
-              toupper(character(bp++)) == toupper(*sp++))
-             && bp < length());
-    startPos++;
-  }
-  return 0;
+  if (startPos < 0)
+    startPos = 0;
+  if (!*searchString) {
+    *foundPos = startPos;
+    return startPos < mLength;
+  }
+  Fl_Text_Search s(searchString, matchCase, 0);
+  int pos = search_range_(s, startPos, mLength, 0);
+  if (pos < 0)
+    return 0;
+  *foundPos = pos;
+  return 1;
 }
 
 int Fl_Text_Buffer::search_backward(int startPos, const char *searchString,
@@ -1189,24 +1529,41 @@ int Fl_Text_Buffer::search_backward(int startPos, const char *searchString,
 				    int matchCase) const {
   if (!searchString)
     return 0;
-  int bp;
-  const char *sp;
-  while (startPos > 0)
-  {
-    bp = startPos - 1;
-    sp = searchString + strlen(searchString) - 1;
-    do {
-      if (sp < searchString) {
-        *foundPos = bp + 1;
-        return 1;
-      }
-      // FIXME: character is ucs-4
-    } while ((matchCase ? character(bp--) == *sp-- :
-              toupper(character(bp--)) == toupper(*sp--))
-             && bp >= 0);
-    startPos--;
+  if (startPos > mLength)
+    startPos = mLength;
+  if (!*searchString) {
+    *foundPos = startPos;
+    return startPos > 0;
+  }
+  Fl_Text_Search s(searchString, matchCase, 1);
+  int pos = search_range_(s, 0, startPos, 1);
+  if (pos < 0)
+    return 0;
+  *foundPos = pos;
+  return 1;
+}
+
+int *Fl_Text_Buffer::search_all(int startPos, int endPos,
+				const char *searchString, int *nFound,
+				int matchCase) const {
+  *nFound = 0;
+  if (!searchString || !*searchString)
+    return NULL;
+  
+  Fl_Text_Search s(searchString, matchCase, 0);
+  int *found = NULL, alloc = 0, pos;
+  while ((pos = search_range_(s, startPos, endPos, 0)) >= 0) {
+    if (*nFound == alloc) {
+      alloc = alloc ? alloc * 2 : 64;
+      int *n = (int *) realloc(found, alloc * sizeof(int));
+      if (!n)
+	break;
+      found = n;
+    }
+    found[(*nFound)++] = pos;
+    startPos = pos + s.len;
   }
-  return 0;
+  return found;
 }
 
 int Fl_Text_Buffer::findchars_forward(int startPos,
@@ -1274,8 +1631,11 @@ int Fl_Text_Buffer::findchars_backward(int startPos,
 
 int Fl_Text_Buffer::insert_(int pos, const char *text)
 {
-  int insertedLength = strlen(text);
-  
+  return insert_(pos, text, strlen(text));
+}
+
+int Fl_Text_Buffer::insert_(int pos, const char *text, int insertedLength)
+{
   /* Prepare the buffer to receive the new text.  If the new text fits in
    the current buffer, just move the gap (if necessary) to where
    the text should be inserted.  If the new text is too large, reallocate
@@ -1288,60 +1648,30 @@ int Fl_Text_Buffer::insert_(int pos, const char *text)
   
   /* Insert the new text (pos now corresponds to the start of the gap) */
   memcpy(&mBuf[pos], text, insertedLength);
+  gap_inserted_(pos, insertedLength);
+  return insertedLength;
+}
+
+void Fl_Text_Buffer::gap_inserted_(int pos, int insertedLength)
+{
+  index_insert(pos, &mBuf[pos], insertedLength);
   mGapStart += insertedLength;
   mLength += insertedLength;
   update_selections(pos, 0, insertedLength);
-  
-  if (mCanUndo) {
-    if (undowidget == this && undoat == pos && undoinsert) {
-      undoinsert += insertedLength;
-    } else {
-      undoinsert = insertedLength;
-      undoyankcut = (undoat == pos) ? undocut : 0;
-    }
-    undoat = pos + insertedLength;
-    undocut = 0;
-    undowidget = this;
-  }
-  
-  return insertedLength;
+  undo_insert_(pos, insertedLength);
 }
 
 void Fl_Text_Buffer::remove_(int start, int end)
 {
-  /* if the gap is not contiguous to the area to remove, move it there */
+  undo_remove_(start, end);
   
-  if (mCanUndo) {
-    if (undowidget == this && undoat == end && undocut) {
-      undobuffersize(undocut + end - start + 1);
-      memmove(undobuffer + end - start, undobuffer, undocut);
-      undocut += end - start;
-    } else {
-      undocut = end - start;
-      undobuffersize(undocut);
-    }
-    undoat = start;
-    undoinsert = 0;
-    undoyankcut = 0;
-    undowidget = this;
-  }
-  
-  if (start > mGapStart) {
-    if (mCanUndo)
-      memcpy(undobuffer, mBuf + (mGapEnd - mGapStart) + start,
-	     end - start);
+  /* if the gap is not contiguous to the area to remove, move it there */
+  if (start > mGapStart)
     move_gap(start);
-  } else if (end < mGapStart) {
-    if (mCanUndo)
-      memcpy(undobuffer, mBuf + start, end - start);
+  else if (end < mGapStart)
     move_gap(end);
-  } else {
-    int prelen = mGapStart - start;
-    if (mCanUndo) {
-      memcpy(undobuffer, mBuf + start, prelen);
-      memcpy(undobuffer + prelen, mBuf + mGapEnd, end - start - prelen);
-    }
-  }
+  
+  index_remove(start, end);
   
   /* expand the gap to encompass the deleted characters */
   mGapEnd += end - mGapStart;
@@ -1874,7 +2204,6 @@ void Fl_Text_Buffer::remove_selection_(Fl_Text_Selection * sel)
     remove_rectangular(start, end, rectStart, rectEnd);
   else {
     remove(start, end);
-    //undoyankcut = undocut;
   }
 }
 
@@ -2049,6 +2378,57 @@ void Fl_Text_Buffer::reallocate_with_gap(int newGapStart, int newGapLen)
 #endif
 }
 
+void Fl_Text_Buffer::move_newline_gap(int pos)
+{
+  while (mNewlineGapStart > 0 && mNewlines[mNewlineGapStart - 1] >= pos)
+    mNewlines[--mNewlineGapEnd] = mNewlines[--mNewlineGapStart] - mLength;
+  while (mNewlineGapEnd < mNewlineAlloc && mNewlines[mNewlineGapEnd] + mLength < pos)
+    mNewlines[mNewlineGapStart++] = mNewlines[mNewlineGapEnd++] + mLength;
+}
+
+void Fl_Text_Buffer::index_insert(int pos, const char *text, int n)
+{
+  const char *p = text, *e = text + n;
+  move_newline_gap(pos);
+  while ((p = (const char *) memchr(p, '\n', e - p)) != NULL) {
+    if (mNewlineGapStart == mNewlineGapEnd) {
+      int back = mNewlineAlloc - mNewlineGapEnd;
+      int alloc = mNewlineAlloc ? mNewlineAlloc * 2 : 256;
+      int *b = (int *) realloc(mNewlines, alloc * sizeof(int));
+      /* a newline missing from the index would misplace every line after
+       it, there is no way to go on without it */
+      if (!b)
+	Fl::fatal("Fl_Text_Buffer: out of memory for the line index");
+      mNewlines = b;
+      memmove(mNewlines + alloc - back, mNewlines + mNewlineGapEnd,
+	      back * sizeof(int));
+      mNewlineGapEnd = alloc - back;
+      mNewlineAlloc = alloc;
+    }
+    mNewlines[mNewlineGapStart++] = pos + (p - text);
+    p++;
+  }
+}
+
+void Fl_Text_Buffer::index_remove(int start, int end)
+{
+  move_newline_gap(start);
+  while (mNewlineGapEnd < mNewlineAlloc && mNewlines[mNewlineGapEnd] + mLength < end)
+    mNewlineGapEnd++;
+}
+
+void Fl_Text_Buffer::index_rebuild()
+{
+  int length = mLength;
+  mNewlineGapStart = 0;
+  mNewlineGapEnd = mNewlineAlloc;
+  mLength = 0;
+  index_insert(0, mBuf, mGapStart);
+  mLength = mGapStart;
+  index_insert(mGapStart, mBuf + mGapEnd, length - mGapStart);
+  mLength = length;
+}
+
 void Fl_Text_Buffer::update_selections(int pos, int nDeleted,
 				       int nInserted)
 {
@@ -2088,20 +2468,17 @@ int Fl_Text_Buffer::findchar_forward(int startPos, char searchChar,
     return 0;
   }
   
-  int pos = startPos;
-  while (pos < mGapStart) {
-    if (mBuf[pos] == searchChar) {
-      *foundPos = pos;
-      return 1;
-    }
-    pos++;
+  const char *p;
+  int gapLen = mGapEnd - mGapStart;
+  if (startPos < mGapStart &&
+      (p = (const char *) memchr(&mBuf[startPos], searchChar, mGapStart - startPos))) {
+    *foundPos = p - mBuf;
+    return 1;
   }
-  
-  for (int gapLen = mGapEnd - mGapStart; pos < mLength; pos++) {
-    if (mBuf[pos + gapLen] == searchChar) {
-      *foundPos = pos;
-      return 1;
-    }
+  int pos = max(startPos, mGapStart);
+  if ((p = (const char *) memchr(&mBuf[pos + gapLen], searchChar, mLength - pos))) {
+    *foundPos = p - mBuf - gapLen;
+    return 1;
   }
   *foundPos = mLength;
   return 0;
@@ -2362,15 +2739,48 @@ int Fl_Text_Buffer::insertfile(const char *file, int pos, int buflen)
   FILE *fp;
   if (!(fp = fl_fopen(file, "r")))
     return 1;
-  char *buffer = new char[buflen];
-  for (int r; (r = fread(buffer, 1, buflen - 1, fp)) > 0; pos += r) {
-    buffer[r] = (char) 0;
-    insert(pos, buffer);
-  }
+  if (pos > mLength)
+    pos = mLength;
+  if (pos < 0)
+    pos = 0;
+  call_predelete_callbacks(pos, 0);
   
+  /* size the gap once from the file size (one more byte so that the end of
+   the file is seen without growing it), then read straight into it */
+  long size = 0;
+  if (fseek(fp, 0, SEEK_END) == 0) {
+    size = ftell(fp);
+    if (size < 0)
+      size = 0;
+    fseek(fp, 0, SEEK_SET);
+  }
+  if (size + 1 > mGapEnd - mGapStart)
+    reallocate_with_gap(pos, size + 1 + mPreferredGapSize);
+  else if (pos != mGapStart)
+    move_gap(pos);
+  
+  int n = 0;
+  for (;;) {
+    if (n == mGapEnd - mGapStart) {
+      /* the file grew or could not be sized: enlarge the gap, keeping the
+       bytes read so far in front of it */
+      mGapStart += n;
+      mLength += n;
+      reallocate_with_gap(mGapStart, buflen + mPreferredGapSize);
+      mGapStart -= n;
+      mLength -= n;
+    }
+    int r = fread(&mBuf[pos + n], 1, mGapEnd - mGapStart - n, fp);
+    if (r <= 0)
+      break;
+    n += r;
+  }
   int e = ferror(fp) ? 2 : 0;
   fclose(fp);
-  delete[]buffer;
+  
+  gap_inserted_(pos, n);
+  mCursorPosHint = pos + n;
+  call_modify_callbacks(pos, 0, n, 0, NULL);
   return e;
 }
 
@@ -2380,16 +2790,53 @@ int Fl_Text_Buffer::outputfile(const char *file, int start, int end,
   FILE *fp;
   if (!(fp = fl_fopen(file, "wb")))
     return 1;
-  for (int n; (n = min(end - start, buflen)); start += n) {
-    const char *p = text_range(start, start + n);
-    int r = fwrite(p, 1, n, fp);
-    free((void *) p);
-    if (r != n)
-      break;
+  if (start < 0)
+    start = 0;
+  if (end > mLength)
+    end = mLength;
+  if (end < start)
+    end = start;
+  
+  /* write the text on both sides of the gap in place, without copying */
+  int mid = max(start, min(end, mGapStart));
+  const char *p1 = &mBuf[start], *p2 = &mBuf[mid + mGapEnd - mGapStart];
+  int n1 = mid - start, n2 = end - mid;
+  
+  int e = 0;
+#ifndef WIN32
+  struct iovec iov[2];
+  iov[0].iov_base = (void *) p1;
+  iov[0].iov_len = n1;
+  iov[1].iov_base = (void *) p2;
+  iov[1].iov_len = n2;
+  struct iovec *v = iov;
+  int nv = 2;
+  while (nv && !e) {
+    ssize_t r = writev(fileno(fp), v, nv);
+    if (r < 0) {
+      if (errno != EINTR)
+	e = 2;
+      continue;
+    }
+    while (nv && (size_t) r >= v->iov_len) {
+      r -= v->iov_len;
+      v++;
+      nv--;
+    }
+    if (nv) {
+      v->iov_base = (char *) v->iov_base + r;
+      v->iov_len -= r;
+    }
   }
+#else
+  if ((int) fwrite(p1, 1, n1, fp) != n1 || (int) fwrite(p2, 1, n2, fp) != n2)
+    e = 2;
+#endif
   
-  int e = ferror(fp) ? 2 : 0;
-  fclose(fp);
+  if (ferror(fp))
+    e = 2;
+  if (fclose(fp))
+    e = 2;
   return e;
 }
 
@@ -67,6 +67,24 @@ static int max( int i1, int i2 );
 static int min( int i1, int i2 );
 static int countlines( const char *string );
 
+/* Layout of each line of the buffer, kept by the display so that wrapping
+   and measuring a large buffer do not go through all of its text every time
+   the display is resized or scrolled far. Entries are -1 until measured, and
+   are cleared for the lines an edit touches by wrap_cache_update(). */
+struct Fl_Text_Line_Layout {
+  struct Line {
+    int breaks;   /* # of wrap points in the line at the current wrap width */
+    int extent;   /* width of the whole line, in pixels or columns as
+                     wrapped_line_counter() measures it */
+    int pixels;   /* width of the whole line as measure_vline() measures it */
+  } *line;
+  int nLines, alloc;
+  /* what the entries were measured with */
+  Fl_Font font;
+  Fl_Fontsize size;
+  int tabDist, countPixels, wrap;
+};
+
 /* The variables below are used in a timer event to allow smooth
    scrolling of the text area when the pointer has left the area. */
 static int scroll_direction = 0;
@@ -141,6 +159,7 @@ Fl_Text_Display::Fl_Text_Display(int X, int Y, int W, int H,  const char* l)
   mSuppressResync = 0;
   mNLinesDeleted = 0;
   mModifyingTabDistance = 0;
+  mLayout = 0;
 
   mUnfinishedStyle = 0;
   mUnfinishedHighlightCB = 0;
@@ -166,6 +185,10 @@ Fl_Text_Display::~Fl_Text_Display() {
     mBuffer->remove_predelete_callback(buffer_predelete_cb, this);
   }
   if (mLineStarts) delete[] mLineStarts;
+  if (mLayout) {
+    free(mLayout->line);
+    delete mLayout;
+  }
 }
 
 /**
@@ -185,6 +208,7 @@ void Fl_Text_Display::buffer( Fl_Text_Buffer *buf ) {
   /* Add the buffer to the display, and attach a callback to the buffer for
      receiving modification information when the buffer contents change */
   mBuffer = buf;
+  if (mLayout) mLayout->nLines = -1;
   if (mBuffer) {
     mBuffer->add_modify_callback( buffer_modified_cb, this );
     mBuffer->add_predelete_callback( buffer_predelete_cb, this );
@@ -222,7 +246,8 @@ void Fl_Text_Display::highlight_data(Fl_Text_Buffer *styleBuffer,
   mUnfinishedHighlightCB = unfinishedHighlightCB;
   mHighlightCBArg = cbArg;
 
-  mStyleBuffer->canUndo(0);
+  if (mStyleBuffer)
+    mStyleBuffer->canUndo(0);
   damage(FL_DAMAGE_EXPOSE);
 }
 
@@ -1022,6 +1047,22 @@ int Fl_Text_Display::count_lines(int startPos, int endPos,
     if (!mContinuousWrap)
     	return buffer()->count_lines(startPos, endPos);
 
+    /* Whole buffer lines in between are counted from the wrap cache, only
+       the partial lines at both ends are measured */
+    int first = buffer()->line_of(startPos), last = buffer()->line_of(endPos);
+    if (last - first > 1 && wrap_cache_valid()) {
+	wrapped_line_counter(buffer(), startPos, buffer()->pos_of_line(first+1)-1,
+		INT_MAX, startPosIsLineStart, 0, &retPos, &retLines,
+		&retLineStart, &retLineEnd, false);
+	int nLines = retLines + 1;
+	for (int line = first+1; line < last; line++)
+	    nLines += wrap_breaks(line) + 1;
+	wrapped_line_counter(buffer(), buffer()->pos_of_line(last), endPos,
+		INT_MAX, true, 0, &retPos, &retLines, &retLineStart,
+		&retLineEnd);
+	return nLines + retLines;
+    }
+
     wrapped_line_counter(buffer(), startPos, endPos, INT_MAX,
 	    startPosIsLineStart, 0, &retPos, &retLines, &retLineStart,
 	    &retLineEnd);
@@ -1052,6 +1093,20 @@ int Fl_Text_Display::skip_lines(int startPos, int nLines,
     if (nLines == 0)
     	return startPos;
 
+    /* skip whole buffer lines using the wrap cache */
+    int line = buffer()->line_of(startPos);
+    if (buffer()->pos_of_line(line) == startPos && wrap_cache_valid()) {
+	int last = mLayout->nLines - 1;
+	while (line < last && nLines > wrap_breaks(line)) {
+	    nLines -= wrap_breaks(line) + 1;
+	    line++;
+	}
+	startPos = buffer()->pos_of_line(line);
+	if (nLines == 0)
+	    return startPos;
+	startPosIsLineStart = true;
+    }
+
     /* use the common line counting routine to count forward */
     wrapped_line_counter(buffer(), startPos, buffer()->length(),
     	    nLines, startPosIsLineStart, 0, &retPos, &retLines, &retLineStart,
@@ -1118,11 +1173,16 @@ int Fl_Text_Display::rewind_lines(int startPos, int nLines) {
     if (!mContinuousWrap)
     	return buf->rewind_lines(startPos, nLines);
 
+    /* whole buffer lines are counted from the wrap cache */
+    int cached = wrap_cache_valid();
     pos = startPos;
     for (;;) {
 	lineStart = buf->line_start(pos);
-	wrapped_line_counter(buf, lineStart, pos, INT_MAX,
-	    	true, 0, &retPos, &retLines, &retLineStart, &retLineEnd, false);
+	if (cached && (pos == buf->length() || buf->character(pos) == '\n'))
+	    retLines = wrap_breaks(buf->line_of(pos));
+	else
+	    wrapped_line_counter(buf, lineStart, pos, INT_MAX,
+	    	    true, 0, &retPos, &retLines, &retLineStart, &retLineEnd, false);
 	if (retLines > nLines)
     	    return skip_lines(lineStart, retLines-nLines,
     	    	    true);
@@ -1206,8 +1266,10 @@ void Fl_Text_Display::buffer_modified_cb( int pos, int nInserted, int nDeleted,
   int wrapModStart, wrapModEnd;
 
   /* buffer modification cancels vertical cursor motion column */
-  if ( nInserted != 0 || nDeleted != 0 )
+  if ( nInserted != 0 || nDeleted != 0 ) {
     textD->mCursorPreferredCol = -1;
+    textD->wrap_cache_update(pos, nInserted, nDeleted, deletedText);
+  }
 
     /* Count the number of lines inserted and deleted, and in the case
        of continuous wrap mode, how much has changed */
@@ -1344,12 +1406,8 @@ int Fl_Text_Display::get_absolute_top_line_number() const {
    Re-calculate absolute top line number for a change in scroll position.
 */
 void Fl_Text_Display::absolute_top_line_number(int oldFirstChar) {
-    if (maintaining_absolute_top_line_number()) {
-	if (mFirstChar < oldFirstChar)
-	    mAbsTopLineNum -= buffer()->count_lines(mFirstChar, oldFirstChar);
-	else
-	    mAbsTopLineNum += buffer()->count_lines(oldFirstChar, mFirstChar);
-    }
+    if (maintaining_absolute_top_line_number())
+	mAbsTopLineNum = buffer()->line_of(mFirstChar) + 1;
 }
 
 /**
@@ -2344,6 +2402,20 @@ int Fl_Text_Display::measure_vline( int visLineNum ) const {
   char expandedChar[ FL_TEXT_MAX_EXP_CHAR_LEN ];
 
   if (lineStartPos < 0 || lineLen == 0) return 0;
+
+  /* a line shown whole is measured once, and kept in the wrap cache */
+  int line = -1;
+  if ( wrap_cache_valid() ) {
+    line = mBuffer->line_of( lineStartPos );
+    int lineEnd = line < mLayout->nLines - 1 ?
+                  mBuffer->pos_of_line( line + 1 ) - 1 : mBuffer->length();
+    if ( mBuffer->pos_of_line( line ) != lineStartPos ||
+         lineStartPos + lineLen != lineEnd )
+      line = -1;
+    else if ( mLayout->line[ line ].pixels >= 0 )
+      return mLayout->line[ line ].pixels;
+  }
+
   if ( mStyleBuffer == NULL ) {
     for ( i = 0; i < lineLen; i++ ) {
       len = mBuffer->expand_character( lineStartPos + i,
@@ -2373,6 +2445,7 @@ int Fl_Text_Display::measure_vline( int visLineNum ) const {
       charCount += len;
     }
   }
+  if ( line >= 0 ) mLayout->line[ line ].pixels = width;
   return width;
 }
 
@@ -2876,6 +2949,148 @@ int Fl_Text_Display::wrap_uses_character(int lineEndPos) const {
     	    lineEndPos + 1 != buffer()->length());
 }
 
+/**
+   Makes sure the wrap cache matches the buffer, fonts and wrap width, and
+   returns true if it can be used.  Entries measured with other fonts are
+   dropped, a new wrap width only drops the wrap points.  The cache is not
+   used when the styles differ in font or size, since the widths then depend
+   on a style buffer that can change without the display being told.
+*/
+int Fl_Text_Display::wrap_cache_valid() const {
+    Fl_Text_Line_Layout *c = mLayout;
+    Fl_Font font = textfont();
+    Fl_Fontsize size = textsize();
+    int i, nLines, countPixels, wrap;
+
+    if (!mBuffer)
+    	return 0;
+    if (mStyleBuffer && mNStyles > 0) {
+    	font = mStyleTable[0].font;
+    	size = mStyleTable[0].size;
+    	for (i = 1; i < mNStyles; i++)
+    	    if (mStyleTable[i].font != font || mStyleTable[i].size != size)
+    	    	return 0;
+    }
+
+    /* same wrap target as wrapped_line_counter() */
+    countPixels = mFixedFontWidth == -1 && mWrapMargin == 0;
+    if (mWrapMargin)
+    	wrap = mWrapMargin;
+    else
+    	wrap = countPixels ? text_area.w : text_area.w / (mFixedFontWidth + 1);
+
+    if (!c) {
+    	c = mLayout = new Fl_Text_Line_Layout;
+    	c->line = 0;
+    	c->nLines = -1;
+    	c->alloc = 0;
+    }
+    nLines = mBuffer->newline_count() + 1;
+    if (c->nLines != nLines || c->font != font || c->size != size ||
+    	    c->tabDist != mBuffer->tab_distance() ||
+    	    c->countPixels != countPixels) {
+    	if (nLines > c->alloc) {
+    	    Fl_Text_Line_Layout::Line *l = (Fl_Text_Line_Layout::Line *)
+    	    	    realloc(c->line, (nLines + nLines / 4) * sizeof(*l));
+    	    if (!l) {
+    	    	c->nLines = -1;
+    	    	return 0;
+    	    }
+    	    c->line = l;
+    	    c->alloc = nLines + nLines / 4;
+    	}
+    	memset(c->line, -1, nLines * sizeof(*c->line));
+    	c->nLines = nLines;
+    	c->font = font;
+    	c->size = size;
+    	c->tabDist = mBuffer->tab_distance();
+    	c->countPixels = countPixels;
+    	c->wrap = wrap;
+    } else if (c->wrap != wrap) {
+    	for (i = 0; i < nLines; i++)
+    	    c->line[i].breaks = -1;
+    	c->wrap = wrap;
+    }
+    return 1;
+}
+
+/**
+   Keeps the wrap cache in step with a buffer modification: the entries of
+   the deleted lines are removed, and those of the lines the modification
+   touches are cleared.
+*/
+void Fl_Text_Display::wrap_cache_update(int pos, int nInserted, int nDeleted,
+	const char *deletedText) {
+    Fl_Text_Line_Layout *c = mLayout;
+    int first, linesInserted, linesDeleted, nLines;
+
+    if (!c || c->nLines < 0)
+    	return;
+    first = mBuffer->line_of(pos);
+    linesInserted = nInserted ? mBuffer->count_lines(pos, pos + nInserted) : 0;
+    linesDeleted = countlines(deletedText);
+    nLines = c->nLines + linesInserted - linesDeleted;
+    if ((nDeleted && !deletedText) || nLines != mBuffer->newline_count() + 1 ||
+    	    first + linesDeleted >= c->nLines || nLines > c->alloc) {
+    	c->nLines = -1;   /* measure again from scratch */
+    	return;
+    }
+    memmove(c->line + first + 1 + linesInserted,
+    	    c->line + first + 1 + linesDeleted,
+    	    (c->nLines - first - 1 - linesDeleted) * sizeof(*c->line));
+    memset(c->line + first, -1, (linesInserted + 1) * sizeof(*c->line));
+    c->nLines = nLines;
+}
+
+/**
+   Returns the number of wrap points in buffer line "line" (the first line
+   being 0), from the wrap cache, which must be valid.
+*/
+int Fl_Text_Display::wrap_breaks(int line) const {
+    Fl_Text_Line_Layout::Line *l = mLayout->line + line;
+    int lineStart, lineEnd, retPos, retLines, retLineStart, retLineEnd;
+
+    if (l->breaks < 0) {
+    	if (line_extent(line) <= mLayout->wrap)
+    	    l->breaks = 0;
+    	else {
+    	    lineStart = mBuffer->pos_of_line(line);
+    	    lineEnd = line < mLayout->nLines - 1 ?
+    	    	    mBuffer->pos_of_line(line + 1) - 1 : mBuffer->length();
+    	    wrapped_line_counter(mBuffer, lineStart, lineEnd, INT_MAX, true, 0,
+    	    	    &retPos, &retLines, &retLineStart, &retLineEnd, false);
+    	    l->breaks = retLines;
+    	}
+    }
+    return l->breaks;
+}
+
+/**
+   Returns the width of buffer line "line" when not wrapped, in the units
+   wrapped_line_counter() compares with the wrap width, from the wrap cache,
+   which must be valid.  The line is wrapped if, and only if, this is wider
+   than the wrap width.
+*/
+int Fl_Text_Display::line_extent(int line) const {
+    Fl_Text_Line_Layout::Line *l = mLayout->line + line;
+    int p, lineStart, lineEnd, colNum = 0, width = 0;
+    int tabDist = mBuffer->tab_distance();
+
+    if (l->extent < 0) {
+    	lineStart = mBuffer->pos_of_line(line);
+    	lineEnd = line < mLayout->nLines - 1 ?
+    	    	mBuffer->pos_of_line(line + 1) - 1 : mBuffer->length();
+    	for (p = lineStart; p < lineEnd; p++) {
+    	    const char *s = mBuffer->address(p);
+    	    colNum += Fl_Text_Buffer::character_width(s, colNum, tabDist); // FIXME: unicode
+    	    if (mLayout->countPixels)
+    	    	width += measure_proportional_character(s, colNum, p);
+    	}
+    	l->extent = mLayout->countPixels ? width : colNum;
+    }
+    return l->extent;
+}
+
 /**
    Return true if the selection "sel" is rectangular, and touches a
    buffer position withing "rangeStart" to "rangeEnd"
@@ -0,0 +1,242 @@
+//
+// "$Id$"
+//
+// Text highlighter code for the Fast Light Tool Kit (FLTK).
+//
+// Copyright 1998-2009 by Bill Spitzak and others.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Library General Public
+// License as published by the Free Software Foundation; either
+// version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA.
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+#include <FL/Fl_Text_Highlighter.H>
+#include <stdlib.h>
+#include <string.h>
+
+Fl_Text_Highlighter::Fl_Text_Highlighter() {
+  display_ = 0;
+  buffer_ = 0;
+  styles_ = 0;
+  table_ = 0;
+  nstyles_ = 0;
+  states_ = 0;
+  nstates_ = states_alloc_ = 0;
+  styled_ = 0;
+  lines_per_pass_ = 100;
+}
+
+Fl_Text_Highlighter::~Fl_Text_Highlighter() {
+  detach();
+  free(states_);
+}
+
+/**
+  Highlights the text of \p d with the \p nStyles styles of \p table,
+  which is copied. The display must have its text buffer already, and the
+  highlighter must be detached or deleted before the display.
+*/
+void Fl_Text_Highlighter::attach(Fl_Text_Display *d,
+				 const Fl_Text_Display::Style_Table_Entry *table,
+				 int nStyles) {
+  detach();
+  if (!d || !d->buffer() || !table || nStyles <= 0) return;
+  display_ = d;
+  buffer_ = d->buffer();
+  table_ = new Fl_Text_Display::Style_Table_Entry[nStyles];
+  memcpy(table_, table, nStyles * sizeof(*table_));
+  nstyles_ = nStyles;
+  styles_ = new Fl_Text_Buffer(buffer_->length());
+  restyle();
+  // added last, so it runs before the display's own modify callback
+  buffer_->add_modify_callback(modify_cb, this);
+  d->highlight_data(styles_, table_, nStyles, UNFINISHED, unfinished_cb, this);
+}
+
+/** Removes the highlighting from the display. */
+void Fl_Text_Highlighter::detach() {
+  if (!display_) return;
+  buffer_->remove_modify_callback(modify_cb, this);
+  display_->highlight_data(0, 0, 0, 0, 0, 0);
+  delete styles_;
+  delete[] table_;
+  display_ = 0;
+  buffer_ = 0;
+  styles_ = 0;
+  table_ = 0;
+  nstyles_ = 0;
+  nstates_ = 0;
+  styled_ = 0;
+}
+
+/**
+  Marks all the text as unstyled, to be styled again as it is drawn. Call
+  it when the rules used by style_line() change.
+*/
+void Fl_Text_Highlighter::restyle() {
+  if (!styles_) return;
+  int n = buffer_->length();
+  char *s = (char *)malloc(n + 1);
+  if (!s) return;
+  memset(s, UNFINISHED, n);
+  s[n] = 0;
+  styles_->text(s);
+  free(s);
+  if (!resize_states(buffer_->newline_count() + 2)) return;
+  nstates_ = buffer_->newline_count() + 2;
+  states_[0] = 0;
+  styled_ = 0;
+  display_->redisplay_range(0, n);
+}
+
+int Fl_Text_Highlighter::style_line(const char *, int len, char *style, int state) {
+  memset(style, 'A', len);
+  return state;
+}
+
+int Fl_Text_Highlighter::resize_states(int n) {
+  if (n <= states_alloc_) return 1;
+  int a = states_alloc_ ? states_alloc_ : 256;
+  while (a < n) a *= 2;
+  int *s = (int *)realloc(states_, a * sizeof(int));
+  if (!s) return 0;
+  states_ = s;
+  states_alloc_ = a;
+  return 1;
+}
+
+// Style lines first to last, in batches of lines sharing one text copy
+int Fl_Text_Highlighter::style_lines(int first, int last) {
+  int nLines = nstates_ - 1;
+  if (last >= nLines) last = nLines - 1;
+  int line = first, state = states_[first];
+  int start = buffer_->pos_of_line(first);
+  while (line <= last) {
+    int count = last - line + 1;
+    if (count > 64) count = 64;
+    int end = line + count < nLines ? buffer_->pos_of_line(line + count) : buffer_->length();
+    char *text = buffer_->text_range(start, end);
+    char *style = (char *)malloc(end - start + 1);
+    if (!text || !style) { free(text); free(style); break; }
+    int p = 0;
+    for (; count > 0; count--) {
+      const char *nl = (const char *)memchr(text + p, '\n', end - start - p);
+      int len = nl ? nl - (text + p) : end - start - p;
+      state = style_line(text + p, len, style + p, state);
+      p += len;
+      if (nl) {
+	style[p] = len ? style[p - 1] : 'A';
+	p++;
+      }
+      states_[++line] = state;
+    }
+    style[p] = 0;
+    styles_->replace(start, start + p, style);
+    free(text);
+    free(style);
+    start += p;
+  }
+  return state;
+}
+
+// Mark lines first to last-1 unstyled again
+void Fl_Text_Highlighter::unstyle(int first, int last) {
+  int a = buffer_->pos_of_line(first);
+  int b = last < nstates_ - 1 ? buffer_->pos_of_line(last) : buffer_->length();
+  if (b <= a) return;
+  char *s = (char *)malloc(b - a + 1);
+  if (!s) return;
+  memset(s, UNFINISHED, b - a);
+  s[b - a] = 0;
+  styles_->replace(a, b, s);
+  free(s);
+  display_->redisplay_range(a, b);
+}
+
+void Fl_Text_Highlighter::modify_cb(int pos, int nInserted, int nDeleted, int,
+				    const char *deletedText, void *arg) {
+  if (nInserted || nDeleted)
+    ((Fl_Text_Highlighter *)arg)->modified(pos, nInserted, nDeleted, deletedText);
+}
+
+void Fl_Text_Highlighter::modified(int pos, int nInserted, int nDeleted,
+				   const char *deletedText) {
+  // Keep the style buffer in step, the new text is unstyled
+  char local[256], *s = nInserted < 256 ? local : (char *)malloc(nInserted + 1);
+  if (!s || (nDeleted && !deletedText)) { restyle(); return; }
+  memset(s, UNFINISHED, nInserted);
+  s[nInserted] = 0;
+  styles_->replace(pos, pos + nDeleted, s);
+  if (s != local) free(s);
+
+  // Move the line states after the edit
+  int line = buffer_->line_of(pos);
+  int added = buffer_->count_lines(pos, pos + nInserted), removed = 0;
+  for (const char *p = deletedText, *e = deletedText + nDeleted;
+       p && (p = (const char *)memchr(p, '\n', e - p)) != 0; p++)
+    removed++;
+  if (!resize_states(nstates_ + added - removed)) { restyle(); return; }
+  memmove(states_ + line + 1 + added, states_ + line + 1 + removed,
+	  (nstates_ - line - 1 - removed) * sizeof(int));
+  nstates_ += added - removed;
+  if (styled_ <= line) return;	// all unstyled already
+  styled_ = styled_ > line + removed ? styled_ + added - removed : line + 1;
+
+  // Restyle the edited lines, then the next ones until one starts in the
+  // same state as before
+  int last = line + added, next = last + 1;
+  int old = states_[next];
+  int state = style_lines(line, last);
+  int budget = lines_per_pass_;
+  while (next < styled_ && state != old) {
+    if (!budget--) {
+      unstyle(next, styled_);
+      styled_ = next;
+      break;
+    }
+    old = states_[next + 1];
+    state = style_lines(next, next);
+    next++;
+  }
+  if (styled_ < last + 1) styled_ = last + 1;
+  int end = next < nstates_ - 1 ? buffer_->pos_of_line(next) : buffer_->length();
+  display_->redisplay_range(buffer_->pos_of_line(line), end);
+}
+
+void Fl_Text_Highlighter::unfinished_cb(int pos, void *arg) {
+  ((Fl_Text_Highlighter *)arg)->style_to(pos);
+}
+
+/**
+  Styles the text up to \p pos, and lines_per_pass() lines after it, if
+  it is not styled yet. The display calls it when it meets unstyled text.
+*/
+void Fl_Text_Highlighter::style_to(int pos) {
+  // the display may see an edit before the highlighter does
+  if (!styles_ || styles_->length() != buffer_->length()) return;
+  int line = buffer_->line_of(pos);
+  if (line < styled_) return;
+  int last = line + lines_per_pass_;
+  if (last > nstates_ - 2) last = nstates_ - 2;
+  style_lines(styled_, last);
+  styled_ = last + 1;
+}
+
+//
+// End of "$Id$".
+//
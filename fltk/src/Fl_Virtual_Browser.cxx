@@ -0,0 +1,358 @@
+//
+// "$Id$"
+//
+// Virtual browser widget for the Fast Light Tool Kit (FLTK).
+//
+// Copyright 1998-2009 by Bill Spitzak and others.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Library General Public
+// License as published by the Free Software Foundation; either
+// version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA.
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+#include <FL/Fl.H>
+#include <FL/Fl_Virtual_Browser.H>
+#include <FL/Flv_Data_Source.H>
+#include <FL/fl_draw.H>
+#include <stdlib.h>
+#include <string.h>
+
+// The items given to Fl_Browser_ are the line numbers themselves:
+static void *line_item(int line) { return line ? (void*)((char*)0 + line) : 0; }
+static int item_line(void *item) { return (int)((char*)item - (char*)0); }
+
+static const int no_columns[1] = {0};
+
+/**
+  The constructor makes an empty browser.
+  \param[in] X,Y,W,H position and size.
+  \param[in] L label string, may be NULL.
+*/
+Fl_Virtual_Browser::Fl_Virtual_Browser(int X, int Y, int W, int H, const char *L)
+: Fl_Browser_(X, Y, W, H, L) {
+  lines_ = 0;
+  text_cb_ = 0;
+  text_data_ = 0;
+  block_ = 0;
+  block_len_ = 0;
+  starts_ = 0;
+  source_ = 0;
+  source_col_ = 0;
+  column_widths_ = no_columns;
+  column_widths_owned_ = 0;
+  column_char_ = '\t';
+  height_ = 0;
+  buf_[0] = 0;
+}
+
+Fl_Virtual_Browser::~Fl_Virtual_Browser() {
+  free(starts_);
+  free(column_widths_owned_);
+}
+
+void Fl_Virtual_Browser::clear_provider() {
+  text_cb_ = 0;
+  text_data_ = 0;
+  block_ = 0;
+  block_len_ = 0;
+  free(starts_);
+  starts_ = 0;
+  source_ = 0;
+}
+
+/**
+  Sets the number of lines to \p n.
+  The current selection and scroll position are kept when they are
+  still in range.
+*/
+void Fl_Virtual_Browser::size(int n) {
+  if (n < 0) n = 0;
+  if (n == lines_) {redraw(); return;}
+  int sel = value(), pos = position();
+  int shrink = n < lines_;
+  lines_ = n;
+  if (shrink) {
+    // top() and selection() may refer to lines that are gone
+    new_list();
+    if (sel <= n) value(sel);
+  }
+  position(pos);
+  redraw();
+}
+
+/**
+  Gets the text of each line from \p cb, called with \p data.
+  The number of lines is set separately with size().
+*/
+void Fl_Virtual_Browser::text_callback(Fl_Virtual_Browser_Text *cb, void *data) {
+  clear_provider();
+  text_cb_ = cb;
+  text_data_ = data;
+  redraw();
+}
+
+/**
+  Shows the lines of \p text, separated by newlines.
+  The text is indexed, not copied, and must stay valid while it is shown.
+  \p len is the length of the text, -1 if it is zero terminated.
+  A newline at the end does not start another line.
+*/
+void Fl_Virtual_Browser::lines(const char *text, int len) {
+  clear_provider();
+  if (!text) {size(0); return;}
+  if (len < 0) len = strlen(text);
+  int n = 0;
+  for (const char *p = text; (p = (const char*)memchr(p, '\n', text + len - p)); p++) n++;
+  if (len && text[len-1] != '\n') n++;
+  starts_ = (int*)malloc((n + 1) * sizeof(int));
+  if (!starts_) {size(0); return;}
+  int i = 0;
+  for (int s = 0; s < len; i++) {
+    starts_[i] = s;
+    const char *e = (const char*)memchr(text + s, '\n', len - s);
+    s = e ? int(e - text) + 1 : len;
+  }
+  starts_[n] = len;
+  block_ = text;
+  block_len_ = len;
+  size(n);
+  redraw();
+}
+
+/**
+  Shows column \p col of the view rows of \p ds, or all its columns
+  separated by column_char() when \p col is negative.
+  The number of lines is set to the number of rows of \p ds, call
+  data_changed() when that changes. The source is not deleted by the
+  browser.
+*/
+void Fl_Virtual_Browser::data_source(Flv_Data_Source *ds, int col) {
+  clear_provider();
+  source_ = ds;
+  source_col_ = col;
+  size(ds ? ds->rows() : 0);
+  redraw();
+}
+
+/**
+  Updates the browser after the lines of the provider were modified.
+  With a data source the number of lines is read from it again.
+*/
+void Fl_Virtual_Browser::data_changed() {
+  if (source_) size(source_->rows());
+  redraw();
+}
+
+const char *Fl_Virtual_Browser::line_text(int line, char *buf, int len) const {
+  if (line < 1 || line > lines_ || len < 1) return 0;
+  if (text_cb_) return text_cb_(line, buf, len, text_data_);
+  if (starts_) {
+    int s = starts_[line-1], e = starts_[line];
+    if (e > s && block_[e-1] == '\n') e--;
+    if (e > s && block_[e-1] == '\r') e--;
+    if (e - s >= len) e = s + len - 1;
+    memcpy(buf, block_ + s, e - s);
+    buf[e - s] = 0;
+    return buf;
+  }
+  if (source_) {
+    if (line > source_->rows()) return 0;
+    if (source_col_ >= 0) return source_->as_string(line - 1, source_col_, buf, len);
+    char cell[256];
+    int n = 0;
+    for (int c = 0; c < source_->cols() && n < len - 1; c++) {
+      if (c) buf[n++] = column_char_;
+      const char *s = source_->as_string(line - 1, c, cell, sizeof(cell));
+      for (; s && *s && n < len - 1; s++) buf[n++] = *s;
+    }
+    buf[n] = 0;
+    return buf;
+  }
+  return 0;
+}
+
+/**
+  Returns the text of \p line, or NULL if it is out of range or the
+  provider has none. The text is kept in a buffer of the browser that
+  is overwritten by the next call.
+*/
+const char *Fl_Virtual_Browser::text(int line) const {
+  return line_text(line, buf_, sizeof(buf_));
+}
+
+/**
+  Returns the height of every line, in pixels.
+*/
+int Fl_Virtual_Browser::line_height() const {
+  if (!height_ || height_font_ != textfont() || height_size_ != textsize()) {
+    fl_font(textfont(), textsize());
+    height_ = fl_height();
+    if (height_ < 2) height_ = 2;
+    height_font_ = textfont();
+    height_size_ = textsize();
+  }
+  return height_;
+}
+
+void *Fl_Virtual_Browser::item_first() const { return line_item(lines_ ? 1 : 0); }
+
+void *Fl_Virtual_Browser::item_next(void *item) const {
+  int l = item_line(item);
+  return line_item(l < lines_ ? l + 1 : 0);
+}
+
+void *Fl_Virtual_Browser::item_prev(void *item) const {
+  return line_item(item_line(item) - 1);
+}
+
+void *Fl_Virtual_Browser::item_last() const { return line_item(lines_); }
+
+void *Fl_Virtual_Browser::item_at(int line) const {
+  return line_item(line >= 1 && line <= lines_ ? line : 0);
+}
+
+int Fl_Virtual_Browser::item_height(void *) const { return line_height(); }
+
+int Fl_Virtual_Browser::full_height() const { return lines_ * line_height(); }
+
+int Fl_Virtual_Browser::incr_height() const { return line_height(); }
+
+void *Fl_Virtual_Browser::item_at_position(int pos, int *item_pos) const {
+  if (!lines_) return 0;
+  int h = line_height();
+  int l = pos / h;
+  if (l < 0) l = 0;
+  if (l >= lines_) l = lines_ - 1;
+  *item_pos = l * h;
+  return line_item(l + 1);
+}
+
+const char *Fl_Virtual_Browser::item_text(void *item) const {
+  return text(item_line(item));
+}
+
+int Fl_Virtual_Browser::item_width(void *item) const {
+  char buf[1024];
+  const char *str = line_text(item_line(item), buf, sizeof(buf));
+  if (!str) str = "";
+  const int *i = column_widths_;
+  int ww = 0;
+  while (*i) { // add up all separated fields
+    const char *e = strchr(str, column_char_);
+    if (!e) break; // last one occupied by text
+    str = e + 1;
+    ww += *i++;
+  }
+  fl_font(textfont(), textsize());
+  return ww + int(fl_width(str)) + 6;
+}
+
+void Fl_Virtual_Browser::item_draw(void *item, int X, int Y, int W, int H) const {
+  char buf[1024];
+  const char *str = line_text(item_line(item), buf, sizeof(buf));
+  if (!str) return;
+  if (str != buf) { // columns are cut in place
+    strncpy(buf, str, sizeof(buf) - 1);
+    buf[sizeof(buf) - 1] = 0;
+  }
+  char *s = buf;
+  Fl_Color lcol = textcolor();
+  if (item_selected(item)) lcol = fl_contrast(lcol, selection_color());
+  if (!active_r()) lcol = fl_inactive(lcol);
+  fl_font(textfont(), textsize());
+  fl_color(lcol);
+  const int *i = column_widths_;
+  while (W > 6) { // do each separated field
+    int w1 = W;
+    char *e = 0;
+    if (*i) {
+      e = strchr(s, column_char_);
+      if (e) {*e = 0; w1 = *i++;}
+    }
+    fl_draw(s, X+3, Y, w1-6, H, e ? Fl_Align(FL_ALIGN_LEFT|FL_ALIGN_CLIP) : FL_ALIGN_LEFT, 0, 0);
+    if (!e) break;
+    X += w1;
+    W -= w1;
+    s = e + 1;
+  }
+}
+
+void Fl_Virtual_Browser::draw() {
+  if (source_ && lines_) {
+    // let the source load the visible rows in one go
+    int X, Y, W, H; bbox(X, Y, W, H);
+    int h = line_height();
+    int first = position() / h;
+    if (first >= lines_) first = lines_ - 1;
+    int n = H / h + 2;
+    if (first + n > lines_) n = lines_ - first;
+    source_->prefetch(first, n);
+  }
+  Fl_Browser_::draw();
+}
+
+/**
+  Returns the selected line, or 0 if none.
+*/
+int Fl_Virtual_Browser::value() const {
+  return item_line(selection());
+}
+
+/**
+  Selects \p line and shows it, 0 clears the selection.
+*/
+void Fl_Virtual_Browser::value(int line) {
+  if (line < 1 || line > lines_) {deselect(); return;}
+  select_only(line_item(line));
+  display(line);
+}
+
+/**
+  Returns the line shown at the top of the browser.
+*/
+int Fl_Virtual_Browser::topline() const {
+  return lines_ ? position() / line_height() + 1 : 0;
+}
+
+/**
+  Scrolls the browser so that \p line is shown at the top.
+*/
+void Fl_Virtual_Browser::topline(int line) {
+  if (line > lines_) line = lines_;
+  if (line < 1) line = 1;
+  int X, Y, W, H; bbox(X, Y, W, H);
+  int p = (line - 1) * line_height();
+  if (p > full_height() - H) p = full_height() - H;
+  position(p < 0 ? 0 : p);
+}
+
+/**
+  Scrolls the browser as little as needed to show \p line.
+*/
+void Fl_Virtual_Browser::display(int line) {
+  if (line < 1 || line > lines_) return;
+  int X, Y, W, H; bbox(X, Y, W, H);
+  int h = line_height();
+  int p = (line - 1) * h;
+  if (p < position()) position(p);
+  else if (p + h > position() + H) position(p + h - H);
+}
+
+//
+// End of "$Id$".
+//
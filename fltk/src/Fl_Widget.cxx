@@ -177,6 +177,7 @@ extern void fl_throw_focus(Fl_Widget*); // in Fl_x.cxx
    destroyed destroy all their children. This is convenient and fast.
 */
 Fl_Widget::~Fl_Widget() {
+  if (Fl::widget_destroy_handler) (*Fl::widget_destroy_handler)(this);
   Fl::clear_widget_pointer(this);
   if (flags() & COPIED_LABEL) free((void *)(label_.value));
   // remove from parent group
@@ -1 +1,490 @@
+//	======================================================================
+//	File:    Flv_Data_Source.cxx - Flv_Data_Source implementation
+//	Program: Flv_Data_Source - FLTK Widget
+//	Version: 0.1.0
+//	Started: 11/21/99
+//
+//	Copyright (C) 1999 Laurence Charlton
+//
+//	Description:
+//	Flv_Data_Source implements an abstract data source for managing a table
+//	of information to be supplied to Flv_List or Flv_Table.
+//	Flv_Array_Data_Source keeps the data in memory in typed columns.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Library General Public
+// License as published by the Free Software Foundation; either
+// version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA.
+//	======================================================================
 
+#include <FL/Flv_Data_Source.H>
+#include <stdio.h>
+#include <stdlib.h>
+#include "flstring.h"
+
+#define CELL_BUFSIZE 64
+
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+
+Flv_Data_Source::Flv_Data_Source()
+{
+	vrow_map = NULL;
+	vrow_count = 0;
+	vcol_map = NULL;
+	vcol_count = 0;
+}
+
+Flv_Data_Source::~Flv_Data_Source()
+{
+	free(vrow_map);
+	free(vcol_map);
+}
+
+double Flv_Data_Source::data_number( int R, int C )
+{
+	char buf[CELL_BUFSIZE];
+	const char *s = data_string( R, C, buf, sizeof(buf) );
+	return s ? strtod(s,NULL) : 0;
+}
+
+int Flv_Data_Source::data_type( int )
+{
+	return FLV_DS_STRING;
+}
+
+const char *Flv_Data_Source::data_name( int )
+{
+	return NULL;
+}
+
+int Flv_Data_Source::data_compare( int R1, int R2, int C )
+{
+	if (data_type(C)==FLV_DS_STRING)
+	{
+		char b1[CELL_BUFSIZE], b2[CELL_BUFSIZE];
+		const char *s1 = data_string( R1, C, b1, sizeof(b1) );
+		const char *s2 = data_string( R2, C, b2, sizeof(b2) );
+		return strcmp( s1?s1:"", s2?s2:"" );
+	}
+	double d1 = data_number(R1,C);
+	double d2 = data_number(R2,C);
+	return d1<d2 ? -1 : (d1>d2 ? 1 : 0);
+}
+
+//	Make sure there is a row map to rearrange, starting from the identity
+bool Flv_Data_Source::own_row_map(void)
+{
+	if (vrow_map)
+		return true;
+	int n = data_rows();
+	vrow_map = (int *)malloc( (n?n:1)*sizeof(int) );
+	if (!vrow_map)
+		return false;
+	for (int r=0;	r<n;	r++ )
+		vrow_map[r] = r;
+	vrow_count = n;
+	return true;
+}
+
+//	Bottom up merge sort, so equal keys keep their order and sorting on
+//	several columns one after the other works as expected.
+void Flv_Data_Source::sort( int C, bool ascending )
+{
+	int n, w, i, *a, *b, *t;
+
+	if (C<0 || C>=cols() || !own_row_map())
+		return;
+	C = map_col(C);
+	n = vrow_count;
+	b = (int *)malloc( (n?n:1)*sizeof(int) );
+	if (!b)
+		return;
+	a = vrow_map;
+	for (w=1;	w<n;	w*=2 )
+	{
+		for (i=0;	i<n;	i+=2*w )
+		{
+			int lo = i, mid = min(i+w,n), hi = min(i+2*w,n);
+			int l = lo, r = mid, k = lo;
+			while (l<mid && r<hi)
+			{
+				int c = data_compare( a[l], a[r], C );
+				if (!ascending)
+					c = -c;
+				b[k++] = (c<=0 ? a[l++] : a[r++]);
+			}
+			while (l<mid)
+				b[k++] = a[l++];
+			while (r<hi)
+				b[k++] = a[r++];
+		}
+		t = a;	a = b;	b = t;
+	}
+	vrow_map = a;
+	free(b);
+}
+
+int Flv_Data_Source::filter( int C, double lo, double hi )
+{
+	int r, n;
+	if (C<0 || C>=cols() || !own_row_map())
+		return rows();
+	C = map_col(C);
+	for (r=n=0;	r<vrow_count;	r++ )
+	{
+		double v = data_number( vrow_map[r], C );
+		if (v>=lo && v<=hi)
+			vrow_map[n++] = vrow_map[r];
+	}
+	return (vrow_count=n);
+}
+
+int Flv_Data_Source::filter( int C, const char *text )
+{
+	char buf[CELL_BUFSIZE];
+	int r, n;
+	if (C<0 || C>=cols() || !text || !own_row_map())
+		return rows();
+	C = map_col(C);
+	for (r=n=0;	r<vrow_count;	r++ )
+	{
+		const char *s = data_string( vrow_map[r], C, buf, sizeof(buf) );
+		if (s && strstr(s,text))
+			vrow_map[n++] = vrow_map[r];
+	}
+	return (vrow_count=n);
+}
+
+void Flv_Data_Source::clear_row_map(void)
+{
+	free(vrow_map);
+	vrow_map = NULL;
+	vrow_count = 0;
+}
+
+int Flv_Data_Source::row_map( const int *map, int n )
+{
+	int i, k, dr = data_rows();
+	int *m = (int *)malloc( (n>0?n:1)*sizeof(int) );
+	if (!m)
+		return rows();
+	for (i=k=0;	i<n;	i++ )
+		if (map[i]>=0 && map[i]<dr)
+			m[k++] = map[i];
+	free(vrow_map);
+	vrow_map = m;
+	return (vrow_count=k);
+}
+
+int Flv_Data_Source::col_map( const int *map, int n )
+{
+	int i, k, dc = data_cols();
+	int *m = (int *)malloc( (n>0?n:1)*sizeof(int) );
+	if (!m)
+		return cols();
+	for (i=k=0;	i<n;	i++ )
+		if (map[i]>=0 && map[i]<dc)
+			m[k++] = map[i];
+	free(vcol_map);
+	vcol_map = m;
+	return (vcol_count=k);
+}
+
+void Flv_Data_Source::clear_col_map(void)
+{
+	free(vcol_map);
+	vcol_map = NULL;
+	vcol_count = 0;
+}
+
+//	Drop mapped rows and columns that no longer exist
+void Flv_Data_Source::data_changed(void)
+{
+	int i, k, n;
+	if (vrow_map)
+	{
+		n = data_rows();
+		for (i=k=0;	i<vrow_count;	i++ )
+			if (vrow_map[i]<n)
+				vrow_map[k++] = vrow_map[i];
+		vrow_count = k;
+	}
+	if (vcol_map)
+	{
+		n = data_cols();
+		for (i=k=0;	i<vcol_count;	i++ )
+			if (vcol_map[i]<n)
+				vcol_map[k++] = vcol_map[i];
+		vcol_count = k;
+	}
+}
+
+void Flv_Data_Source::prefetch( int, int )
+{
+}
+
+//	==================================================================
+//	Flv_Array_Data_Source
+
+Flv_Array_Data_Source::Flv_Array_Data_Source()
+{
+	vcolumns = NULL;
+	vcols = 0;
+	vrows = 0;
+	vallocated = 0;
+}
+
+Flv_Array_Data_Source::~Flv_Array_Data_Source()
+{
+	clear();
+}
+
+void Flv_Array_Data_Source::clear(void)
+{
+	for (int c=0;	c<vcols;	c++ )
+	{
+		Column &col = vcolumns[c];
+		if (col.type==FLV_DS_STRING)
+			for (int r=0;	r<vrows;	r++ )
+				free(col.v.s[r]);
+		free(col.v.i);		//	Union, any member frees the array
+		free(col.name);
+	}
+	free(vcolumns);
+	vcolumns = NULL;
+	vcols = vrows = vallocated = 0;
+	clear_row_map();
+	clear_col_map();
+}
+
+static size_t cell_size( int type )
+{
+	switch(type)
+	{
+		case FLV_DS_INT:		return sizeof(int);
+		case FLV_DS_DOUBLE:	return sizeof(double);
+		default:						return sizeof(char *);
+	}
+}
+
+//	Grow every column to hold at least n rows, new cells are zeroed
+bool Flv_Array_Data_Source::reserve( int n )
+{
+	int c, a;
+	if (n<=vallocated)
+		return true;
+	a = vallocated ? vallocated : 64;
+	while (a<n)
+		a *= 2;
+	for (c=0;	c<vcols;	c++ )
+	{
+		size_t sz = cell_size(vcolumns[c].type);
+		void *p = realloc( vcolumns[c].v.i, a*sz );
+		if (!p)
+			return false;
+		memset( (char *)p + vallocated*sz, 0, (a-vallocated)*sz );
+		vcolumns[c].v.i = (int *)p;
+	}
+	vallocated = a;
+	return true;
+}
+
+int Flv_Array_Data_Source::add_col( int type, const char *name )
+{
+	Column *p;
+	size_t sz;
+	if (type!=FLV_DS_INT && type!=FLV_DS_DOUBLE)
+		type = FLV_DS_STRING;
+	p = (Column *)realloc( vcolumns, (vcols+1)*sizeof(Column) );
+	if (!p)
+		return -1;
+	vcolumns = p;
+	sz = cell_size(type);
+	p = vcolumns + vcols;
+	p->type = type;
+	p->name = name ? strdup(name) : NULL;
+	p->v.i = (int *)calloc( vallocated?vallocated:1, sz );
+	if (!p->v.i)
+	{
+		free(p->name);
+		return -1;
+	}
+	return vcols++;
+}
+
+int Flv_Array_Data_Source::data_rows( int n )
+{
+	if (n<0)
+		n = 0;
+	if (!reserve(n))
+		return vrows;
+	//	Clear removed cells, so growing again gives empty cells
+	for (int c=0;	c<vcols;	c++ )
+	{
+		Column &col = vcolumns[c];
+		size_t sz = cell_size(col.type);
+		if (col.type==FLV_DS_STRING)
+			for (int r=n;	r<vrows;	r++ )
+				free(col.v.s[r]);
+		if (n<vrows)
+			memset( (char *)col.v.i + n*sz, 0, (vrows-n)*sz );
+	}
+	vrows = n;
+	data_changed();
+	return vrows;
+}
+
+int Flv_Array_Data_Source::add_row(void)
+{
+	if (!reserve(vrows+1))
+		return -1;
+	return vrows++;
+}
+
+int Flv_Array_Data_Source::data_type( int C )
+{
+	return (C>=0 && C<vcols) ? vcolumns[C].type : FLV_DS_STRING;
+}
+
+const char *Flv_Array_Data_Source::data_name( int C )
+{
+	return (C>=0 && C<vcols) ? vcolumns[C].name : NULL;
+}
+
+const char *Flv_Array_Data_Source::data_string( int R, int C, char *buf, int len )
+{
+	if (R<0 || R>=vrows || C<0 || C>=vcols)
+		return NULL;
+	Column &col = vcolumns[C];
+	switch(col.type)
+	{
+		case FLV_DS_INT:
+			snprintf( buf, len, "%d", col.v.i[R] );
+			return buf;
+		case FLV_DS_DOUBLE:
+			snprintf( buf, len, "%g", col.v.d[R] );
+			return buf;
+		default:
+			return col.v.s[R] ? col.v.s[R] : "";
+	}
+}
+
+double Flv_Array_Data_Source::data_number( int R, int C )
+{
+	if (R<0 || R>=vrows || C<0 || C>=vcols)
+		return 0;
+	Column &col = vcolumns[C];
+	switch(col.type)
+	{
+		case FLV_DS_INT:			return col.v.i[R];
+		case FLV_DS_DOUBLE:		return col.v.d[R];
+		default:							return col.v.s[R] ? strtod(col.v.s[R],NULL) : 0;
+	}
+}
+
+int Flv_Array_Data_Source::data_compare( int R1, int R2, int C )
+{
+	Column &col = vcolumns[C];
+	switch(col.type)
+	{
+		case FLV_DS_INT:
+			return col.v.i[R1]<col.v.i[R2] ? -1 : (col.v.i[R1]>col.v.i[R2] ? 1 : 0);
+		case FLV_DS_DOUBLE:
+			return col.v.d[R1]<col.v.d[R2] ? -1 : (col.v.d[R1]>col.v.d[R2] ? 1 : 0);
+		default:
+			return strcmp( col.v.s[R1]?col.v.s[R1]:"", col.v.s[R2]?col.v.s[R2]:"" );
+	}
+}
+
+void Flv_Array_Data_Source::set_int( int R, int C, int v )
+{
+	if (R<0 || R>=vrows || C<0 || C>=vcols)
+		return;
+	Column &col = vcolumns[C];
+	switch(col.type)
+	{
+		case FLV_DS_INT:		col.v.i[R] = v;	break;
+		case FLV_DS_DOUBLE:	col.v.d[R] = v;	break;
+		default:
+		{
+			char buf[CELL_BUFSIZE];
+			snprintf( buf, sizeof(buf), "%d", v );
+			set_string( R, C, buf );
+		}
+	}
+}
+
+void Flv_Array_Data_Source::set_double( int R, int C, double v )
+{
+	if (R<0 || R>=vrows || C<0 || C>=vcols)
+		return;
+	Column &col = vcolumns[C];
+	switch(col.type)
+	{
+		case FLV_DS_INT:		col.v.i[R] = (int)v;	break;
+		case FLV_DS_DOUBLE:	col.v.d[R] = v;				break;
+		default:
+		{
+			char buf[CELL_BUFSIZE];
+			snprintf( buf, sizeof(buf), "%g", v );
+			set_string( R, C, buf );
+		}
+	}
+}
+
+void Flv_Array_Data_Source::set_string( int R, int C, const char *v )
+{
+	if (R<0 || R>=vrows || C<0 || C>=vcols)
+		return;
+	Column &col = vcolumns[C];
+	switch(col.type)
+	{
+		case FLV_DS_INT:		col.v.i[R] = v ? atoi(v) : 0;				break;
+		case FLV_DS_DOUBLE:	col.v.d[R] = v ? strtod(v,NULL) : 0;	break;
+		default:
+			free(col.v.s[R]);
+			col.v.s[R] = v ? strdup(v) : NULL;
+	}
+}
+
+int Flv_Array_Data_Source::set_ints( int C, const int *v, int n, int R )
+{
+	int i;
+	if (C<0 || C>=vcols || R<0 || n<=0)
+		return 0;
+	if (R+n>vrows && data_rows(R+n)!=R+n)
+		return 0;
+	if (vcolumns[C].type==FLV_DS_INT)
+		memcpy( vcolumns[C].v.i+R, v, n*sizeof(int) );
+	else
+		for (i=0;	i<n;	i++ )
+			set_int( R+i, C, v[i] );
+	return n;
+}
+
+int Flv_Array_Data_Source::set_doubles( int C, const double *v, int n, int R )
+{
+	int i;
+	if (C<0 || C>=vcols || R<0 || n<=0)
+		return 0;
+	if (R+n>vrows && data_rows(R+n)!=R+n)
+		return 0;
+	if (vcolumns[C].type==FLV_DS_DOUBLE)
+		memcpy( vcolumns[C].v.d+R, v, n*sizeof(double) );
+	else
+		for (i=0;	i<n;	i++ )
+			set_double( R+i, C, v[i] );
+	return n;
+}
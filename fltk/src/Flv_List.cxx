@@ -52,7 +52,7 @@ static void vscrollbar_cb(Fl_Widget* o, void*)
 {
 	Flv_List *s = (Flv_List *)(o->parent());
 	s->top_row( ((Fl_Scrollbar *)o)->value() );
-	s->damage(FL_DAMAGE_CHILD);
+	s->damage(FL_DAMAGE_SCROLL);		//	Rows already on screen are moved
 //	s->select_start_row( ((Fl_Scrollbar *)o)->value() );
 }
 
@@ -100,6 +100,9 @@ Flv_List::Flv_List( int X, int Y, int W, int H, const char *l ) :
 	vfeature = FLVF_PERSIST_SELECT;
 	vhas_scrollbars = FLVS_BOTH;
 	vlast_row = 0;
+	vredraw_top = -1;
+	vredraw_bottom = -1;
+	vscroll_top = -1;
 	vrow = 0;
 	vrow_offset = 0;
 	vrow_width = 0;
@@ -205,11 +208,11 @@ int Flv_List::handle(int event)
 			return 1;
 		case FL_FOCUS:
 			Fl::focus(this);
-			damage(FL_DAMAGE_CHILD);
+			damage(FLV_DAMAGE_CONTENTS);
 			Fl_Group::handle(event);
 			return 1;
 		case FL_UNFOCUS:
-			damage(FL_DAMAGE_CHILD);
+			damage(FLV_DAMAGE_CONTENTS);
 			Fl_Group::handle(event);
 			return 1;
 		case FL_KEYBOARD:
@@ -221,8 +224,10 @@ int Flv_List::handle(int event)
 			if (check_resize())
 				return 1;
 		case FL_PUSH:
+			if (scrollbar.visible() && Fl::event_inside(&scrollbar))
+				return Fl_Group::handle(event);	//	Scrolling needs no full redraw
 			Fl::focus(this);
-			damage(FL_DAMAGE_CHILD);
+			damage(FLV_DAMAGE_CONTENTS);
 			x = Fl::event_x();
 			y = Fl::event_y();
 			t = get_row( x, y );
@@ -362,6 +367,13 @@ int Flv_List::row_height( int r )
 		rh = global_style.height();
 	if (r<0)
 		rh += 4;
+	if (row_style.ranges())
+	{
+		Flv_Style s;
+		row_style.add_ranges( s, r );
+		if (s.height_defined())
+			rh = s.height();
+	}
 	rows = row_style.find(r);
 	if (rows)
 		if (rows->height_defined())
@@ -433,7 +445,7 @@ void Flv_List::get_style(Flv_Style &s, int R, int )
 	get_default_style(s);				//	Get default style information
 	s = global_style;						//	Add global style information
 
-
+	row_style.add_ranges( s, R );	//	Add row range styles
 	rows = row_style.skip_to(R);
 	if (rows) s = *rows;				//	Add row style information
 	if (R<0)										//	Headers/Labels have different default
@@ -473,7 +485,7 @@ Flv_Feature Flv_List::feature(Flv_Feature v)
 			do_callback(this, user_data());
 			vwhy_event = 0;
 		}
-		damage(FL_DAMAGE_CHILD);	//	Because features are visible
+		damage(FLV_DAMAGE_CONTENTS);	//	Because features are visible
 	}
 	return vfeature;
 }
@@ -489,7 +501,7 @@ Flv_Feature Flv_List::feature_add(Flv_Feature v)
 			do_callback(this, user_data());
 			vwhy_event = 0;
 		}
-		damage(FL_DAMAGE_CHILD);	//	Because features are visible
+		damage(FLV_DAMAGE_CONTENTS);	//	Because features are visible
 	}
 	return vfeature;
 }
@@ -505,7 +517,7 @@ Flv_Feature Flv_List::feature_remove(Flv_Feature v)
 			do_callback(this, user_data());
 			vwhy_event = 0;
 		}
-		damage(FL_DAMAGE_CHILD);	//	Because features are visible
+		damage(FLV_DAMAGE_CONTENTS);	//	Because features are visible
 	}
 	return vfeature;
 }
@@ -515,7 +527,7 @@ Flv_ShowScrollbar Flv_List::has_scrollbar( Flv_ShowScrollbar v )
 	if (v!=vhas_scrollbars)
 	{
 		vhas_scrollbars = v;
-		damage(FL_DAMAGE_CHILD);
+		damage(FLV_DAMAGE_CONTENTS);
 	}
 	return vhas_scrollbars;
 }
@@ -550,13 +562,15 @@ int Flv_List::bottom_row(void)
 
 int Flv_List::row(int n)
 {
-	int X, Y, W, H;
+	int X, Y, W, H, o, t;
 	if (n>=vrows)
 		n=vrows-1;
 	if (n<0)
 		n=0;
 	if (n!=vrow)
 	{
+		o = vrow;
+		t = vtop_row;
 		vrow = n;
 		client_area(X,Y,W,H);
 		update_top_row(H);
@@ -567,7 +581,9 @@ int Flv_List::row(int n)
 			do_callback(this, user_data());
 			vwhy_event = 0;
 		}
-		damage(FL_DAMAGE_CHILD);
+		if (t!=vtop_row)						//	Move the rows on screen
+			damage(FL_DAMAGE_SCROLL);
+		redraw_rows( o, vrow );				//	Only rows between old and new change
 	}
 	return vrow;
 }
@@ -595,7 +611,7 @@ int Flv_List::row_offset( int n )
 	{
 		vrow_offset = n;
 		vlast_row = vrow;			//	Make sure we draw everything
-		damage(FL_DAMAGE_CHILD);
+		damage(FLV_DAMAGE_CONTENTS);
 	}
 	return vrow_offset;
 }
@@ -615,7 +631,7 @@ int Flv_List::rows(int n)
 			do_callback(this, user_data());
 			vwhy_event = 0;
 		}
-		damage(FL_DAMAGE_CHILD);
+		damage(FLV_DAMAGE_CONTENTS);
 	}
 	return vrows;
 }
@@ -640,7 +656,7 @@ int Flv_List::row_width( int n )
 	if (n>=0 && n!=vrow_width)
 	{
 		vrow_width = n;
-		damage(FL_DAMAGE_CHILD);
+		damage(FLV_DAMAGE_CONTENTS);
 	}
 	return vrow_width;
 }
@@ -650,17 +666,20 @@ int Flv_List::scrollbar_width(int n)
 	if (n!=vscrollbar_width && n>0)
 	{
 		vscrollbar_width = n;
-		damage(FL_DAMAGE_CHILD);
+		damage(FLV_DAMAGE_CONTENTS);
 	}
 	return vscrollbar_width;
 }
 
 int Flv_List::select_start_row(int n)			//	Set first selected row
 {
+	int t;
+
 	if (n>=vrows)	n=vrows-1;
 	if (n<0) n=0;
 	if (n!=vselect_row)
 	{
+		t = vselect_row;
 		vselect_row = n;
 		vlast_row = vrow;
 		if (DOcb(FLVEcb_SELECTION_CHANGED))
@@ -669,7 +688,7 @@ int Flv_List::select_start_row(int n)			//	Set first selected row
 			do_callback(this, user_data());
 			vwhy_event = 0;
 		}
-		damage(FL_DAMAGE_CHILD);
+		redraw_rows( t, n );					//	Selection changes between them
 	}
 	return vselect_row;
 }
@@ -1000,6 +1019,7 @@ void Flv_List::start_draw(int &X, int &Y, int &W, int &H, int &trow_width )
 #endif
 
 	draw_scrollbars( X, Y, W, H );	// Place/set values, update bounding box
+	vscroll_top = vtop_row;
 
 	trow_width = vrow_width;
 	if (!trow_width)
@@ -1069,6 +1089,15 @@ void Flv_List::draw()
 	if (vediting && !veditor)
 		switch_editor(row());
 
+	if (draw_scrolled())
+		return;
+	if (!(damage()&~FLV_DAMAGE_ROWS) && vredraw_top>=0)
+	{
+		draw_damaged_rows();				//	Only some rows changed
+		return;
+	}
+	vredraw_top = -1;
+
 	start_draw(X,Y,W,H,rw);
 
 	B = W-(rw-vrow_offset);
@@ -1112,6 +1141,182 @@ void Flv_List::draw()
 	fl_pop_clip();
 }
 
+//	Ask to redraw rows r1..r2 without repainting the rest of the list
+void Flv_List::redraw_rows( int r1, int r2 )
+{
+	int t;
+
+	if (r1>r2)
+	{
+		t = r1;
+		r1 = r2;
+		r2 = t;
+	}
+	if (r1<vtop_row)
+		r1 = vtop_row;
+	if (r2>=vrows)
+		r2 = vrows-1;
+	if (r1>r2)										//	Nothing visible
+		return;
+	if (vredraw_top<0)
+	{
+		vredraw_top = r1;
+		vredraw_bottom = r2;
+	} else
+	{
+		if (r1<vredraw_top)
+			vredraw_top = r1;
+		if (r2>vredraw_bottom)
+			vredraw_bottom = r2;
+	}
+	damage(FLV_DAMAGE_ROWS);
+}
+
+//	Draw the rows from redraw_rows over what is already on screen
+//	Everything else (headers, scrollbars, dead space) is left alone
+void Flv_List::draw_damaged_rows(void)
+{
+	int r, rh, rw, top, bottom;
+	int X, Y, W, H, B;
+	int CX, CY, CW, CH;
+
+	top = vredraw_top;							//	Requests made while drawing
+	bottom = vredraw_bottom;				//	are for the next draw
+	vredraw_top = -1;
+
+	rows_area(X,Y,W,H);
+	rw = vrow_width;
+	if (!rw)
+		rw = W;
+
+	B = Y + H;
+	fl_clip( X, Y, W, H );
+	for (	r=vtop_row;	Y<B && r<vrows && r<=bottom;	r++, Y+=rh )
+	{
+		rh = row_height(r);
+		if (r<top)
+			continue;
+		fl_clip( X, Y, W, rh );
+		CX=X;	CY=Y;	CW=rw;	CH=rh;
+		draw_row( vrow_offset, CX, CY, CW, CH, r );
+		fl_pop_clip();
+	}
+	if (veditor && veditor->visible() && edit_row>=top && edit_row<=bottom)
+		draw_child(*veditor);
+	fl_pop_clip();
+}
+
+//	Area the rows are drawn in: client area less title, header and footer
+void Flv_List::rows_area( int &X, int &Y, int &W, int &H )
+{
+	int rh;
+
+	client_area(X,Y,W,H);
+	if (label())
+	{
+		rh = row_height(-3);
+		Y += rh;
+		H -= rh;
+	}
+	if (row_header())
+	{
+		rh = row_height(-1);
+		Y += rh;
+		H -= rh;
+	}
+	if (row_footer())
+		H -= row_height(-2);
+}
+
+//	After a vertical scroll copy the rows still visible to their new place
+//	and draw only the rows that came into view.  Anything else damaged
+//	(features, sizes, horizontal offset) needs the full draw.
+bool Flv_List::draw_scrolled(void)
+{
+	int d, r, dy, X, Y, W, H;
+
+	d = damage();
+	if (!(d&FL_DAMAGE_SCROLL) || (d&~(FL_DAMAGE_SCROLL|FL_DAMAGE_CHILD|FLV_DAMAGE_ROWS)))
+		return false;
+	if (vscroll_top<0 || vscroll_top>=vrows)
+		return false;
+	if ((d&FL_DAMAGE_CHILD) && !scrollbar.damage())
+		return false;										//	Another child needs drawing
+	if (veditor && veditor->visible())
+		return false;										//	Editor doesn't move with the rows
+
+	rows_area(X,Y,W,H);
+	dy = 0;
+	if (vtop_row>vscroll_top)
+	{
+		for (r=vscroll_top;	r<vtop_row && dy>-H;	r++ )
+			dy -= row_height(r);
+	} else
+	{
+		for (r=vtop_row;	r<vscroll_top && dy<H;	r++ )
+			dy += row_height(r);
+	}
+	vscroll_top = vtop_row;
+	if (dy)
+		fl_scroll( X, Y, W, H, 0, dy, scroll_area_cb, this );
+
+	if (scrollbar.visible())
+	{
+		scrollbar.Fl_Valuator::value( vtop_row );
+		update_child(scrollbar);
+	}
+	if (vredraw_top>=0)
+		draw_damaged_rows();
+	return true;
+}
+
+void Flv_List::scroll_area_cb( void *v, int X, int Y, int W, int H )
+{
+	((Flv_List *)v)->draw_rows_area( X, Y, W, H );
+}
+
+//	Draw the part of the rows area inside cx,cy,cw,ch, with dead space
+void Flv_List::draw_rows_area( int cx, int cy, int cw, int ch )
+{
+	int r, rh, rw;
+	int X, Y, W, H, B;
+	int CX, CY, CW, CH;
+
+	rows_area(X,Y,W,H);
+	rw = vrow_width;
+	if (!rw)
+		rw = W;
+
+	fl_clip( cx, cy, cw, ch );
+	B = X+rw-vrow_offset;
+	//	Fill-in area at right of list
+	if (B<X+W)
+	{
+		fl_color( dead_space_color() );
+		fl_rectf( B, cy, X+W-B, ch );
+	}
+
+	B = Y + H;
+	for (	r=vtop_row;	Y<B && Y<cy+ch && r<vrows;	r++, Y+=rh )
+	{
+		rh = row_height(r);
+		if (Y+rh<=cy)
+			continue;
+		fl_clip( X, Y, W, rh );
+		CX=X;	CY=Y;	CW=rw;	CH=rh;
+		draw_row( vrow_offset, CX, CY, CW, CH, r );
+		fl_pop_clip();
+	}
+
+	//	Fill-in area at bottom of list
+	if (Y<B && Y<cy+ch)
+	{
+		fl_color( dead_space_color() );
+		fl_rectf( X, Y, W, B-Y );
+	}
+	fl_pop_clip();
+}
+
 int Flv_List::page_size(void)
 {
 	int ps, H;
@@ -1223,7 +1428,7 @@ bool Flv_List::check_resize(void)
 			if (h>1)
 			{
 				row_style[drag_row].height(h);
-				damage(FL_DAMAGE_CHILD);
+				damage(FLV_DAMAGE_CONTENTS);
 				anchor_top = ey;
 				w = true;
 			}
@@ -1232,7 +1437,7 @@ bool Flv_List::check_resize(void)
 			h = ey-anchor_top;
 			if (h<1) h=1;
 			row_style[drag_row].height(h);
-			damage(FL_DAMAGE_CHILD);
+			damage(FLV_DAMAGE_CONTENTS);
 			w=true;
 		}
 	}
@@ -60,6 +60,57 @@ Flv_Style::Flv_Style( int value )
 	//	variables since they are undefined.
 }
 
+//	==================================================================
+//	Style pool
+//	Styles are carved POOLSIZE at a time out of one block and recycled
+//	through a free list, so a style for each of thousands of rows doesn't
+//	cost a heap allocation each.  Blocks are never returned to the heap.
+//	Classes derived from Flv_Style use the normal heap.
+#define POOLSIZE	256
+
+union Flv_Style_Slot
+{
+	Flv_Style_Slot *next;										//	Next free slot
+	char data[sizeof(Flv_Style)];
+	double align_d;
+	void *align_p;
+};
+
+static Flv_Style_Slot *style_free = NULL;		//	Free slots
+
+void *Flv_Style::operator new( size_t n )
+{
+	Flv_Style_Slot *p;
+	int t;
+
+	if (n!=sizeof(Flv_Style))
+		return ::operator new(n);
+	if (!style_free)
+	{
+		p = (Flv_Style_Slot *)::operator new( sizeof(Flv_Style_Slot)*POOLSIZE );
+		for (t=0;	t<POOLSIZE-1;	t++ )
+			p[t].next = p+t+1;
+		p[t].next = NULL;
+		style_free = p;
+	}
+	p = style_free;
+	style_free = p->next;
+	return p;
+}
+
+void Flv_Style::operator delete( void *p, size_t n )
+{
+	if (!p)
+		return;
+	if (n!=sizeof(Flv_Style))
+	{
+		::operator delete(p);
+		return;
+	}
+	((Flv_Style_Slot *)p)->next = style_free;
+	style_free = (Flv_Style_Slot *)p;
+}
+
 //	==================================================================
 //	Set drawing alignment
 const Fl_Align &Flv_Style::align(const Fl_Align &n)
@@ -463,18 +514,140 @@ const Flv_Style &Flv_Style::add(const Flv_Style &n)
 //	**********************************************************************
 //	Routines for Flv_Style_List
 //
-//	Implemented as a dynamic sparse array
+//	Implemented as a dynamic sparse array, or as a table indexed by
+//	value-vbase once the styles are dense enough (see want_dense)
 //	**********************************************************************
+#define DENSE_MIN			16					//	Styles needed for a value table
+#define DENSE_RATIO		4						//	Max table slots per style
+
 Flv_Style_List::Flv_Style_List()
 {
 	list = NULL;
 	vcount = vallocated = vcurrent = 0;
+	vbase = 0;
+	vdense = false;
+	vranges = NULL;
+	vrange_count = vrange_allocated = 0;
+}
+
+//	Sorted array covers few enough values to index it by value?
+bool Flv_Style_List::want_dense(void)
+{
+	return !vdense && vcount>=DENSE_MIN &&
+		list[vcount-1]->value()-list[0]->value() < DENSE_RATIO*vcount;
+}
+
+//	Binary search of sorted array, index of first value >= v
+int Flv_Style_List::locate( int v )
+{
+	int l, h, m;
+
+	l = 0;
+	h = vcount;
+	while (l < h)
+	{
+		m = (l+h) / 2;
+		if (list[m]->value() < v)
+			l = m+1;
+		else
+			h = m;
+	}
+	return l;
+}
+
+//	Convert sorted array to a value table
+bool Flv_Style_List::make_dense(void)
+{
+	Flv_Style **a;
+	int t, n;
+
+	if (vdense || !vcount)
+		return vdense;
+	n = list[vcount-1]->value() - list[0]->value() + 1;
+	a = new Flv_Style *[n];
+	if (!a)
+		return false;
+	memset( a, 0, sizeof(Flv_Style *)*n );
+	vbase = list[0]->value();
+	for (t=0;	t<vcount;	t++ )
+		a[list[t]->value()-vbase] = list[t];
+	vcurrent = (vcurrent<vcount ? list[vcurrent]->value()-vbase : 0);
+	delete []list;
+	list = a;
+	vallocated = n;
+	vdense = true;
+	return true;
+}
+
+//	Convert value table back to sorted array
+bool Flv_Style_List::make_sparse(void)
+{
+	Flv_Style **a;
+	int t, n, c;
+
+	if (!vdense)
+		return true;
+	a = new Flv_Style *[vcount+ADDSIZE];
+	if (!a)
+		return false;
+	memset( a, 0, sizeof(Flv_Style *)*(vcount+ADDSIZE) );
+	for (t=n=c=0;	t<vallocated;	t++ )
+	{
+		if (!list[t])
+			continue;
+		if (t<=vcurrent)
+			c = n;
+		a[n++] = list[t];
+	}
+	delete []list;
+	list = a;
+	vallocated = vcount+ADDSIZE;
+	vcurrent = c;
+	vdense = false;
+	return true;
+}
+
+//	Grow value table to hold v, fails if the table would get too sparse
+bool Flv_Style_List::cover( int v )
+{
+	Flv_Style **a;
+	int lo, hi, n;
+
+	lo = vbase;
+	hi = vbase+vallocated-1;
+	if (v>=lo && v<=hi)
+		return true;
+	if (v<lo)
+		lo = v;
+	else
+		hi = v;
+	n = hi-lo+1;
+	if (n > DENSE_RATIO*(vcount+1))
+		return false;
+	if (v<vbase)											//	Leave room to keep growing
+		lo -= n/2;											//	the same way
+	else
+		hi += n/2;
+	n = hi-lo+1;
+	a = new Flv_Style *[n];
+	if (!a)
+		return false;
+	memset( a, 0, sizeof(Flv_Style *)*n );
+	memcpy( a+(vbase-lo), list, sizeof(Flv_Style *)*vallocated );
+	vcurrent += vbase-lo;
+	delete []list;
+	list = a;
+	vbase = lo;
+	vallocated = n;
+	return true;
 }
 
 void Flv_Style_List::compact(void)
 {
 	int n, t;
 
+	make_sparse();													//	Pack the list first
+
   //	Release memory for any dead items
 	for (t=0; 	t<vcount;	t++ )
   {
@@ -506,14 +679,18 @@ void Flv_Style_List::compact(void)
     list = NULL;
     vcount = vcurrent = vallocated = 0;
   }
+  if (want_dense())
+  	make_dense();
 }
 //	Undefine all styles in list
 void Flv_Style_List::clear(void)
 {
 	int t;
 
-  for (t=0;	t<vcount;	t++ )									//	Make all entries clear
-  	list[t]->clear_all();
+  for (t=0;	t<vallocated;	t++ )							//	Make all entries clear
+  	if (list[t])
+	  	list[t]->clear_all();
+	clear_ranges();
   compact();																//	Remove dead space thats left
 }
 
@@ -521,8 +698,10 @@ void Flv_Style_List::clear(void)
 void Flv_Style_List::release(void)
 {
 	int t;
-	for (t = 0; t < vcount; t++ )
+	for (t = 0; t < vallocated; t++ )
 	{
+		if (!list[t])
+			continue;
 		list[t]->cell_style.release();
 		delete list[t];
 	}
@@ -530,108 +709,127 @@ void Flv_Style_List::release(void)
 		delete []list;
 	list = NULL;
 	vcurrent = vcount = vallocated = 0;
+	vdense = false;
+	clear_ranges();
 }
 
 Flv_Style *Flv_Style_List::current(void)			//	Current node
 {
-	if (!list)
+	if (!list || vcurrent<0 || vcurrent>=(vdense?vallocated:vcount))
 		return NULL;
 	return list[vcurrent];
 }
 
-//	Find closest match
-//	It will find the first value >= n
+//	Find value n
+//	If there is no match, current is left at the first value > n
+//	when the list is sorted, and is unchanged when it's a value table
 Flv_Style *Flv_Style_List::find( int n )
 {
-	int t, l, h;
+	int t;
 
 	if (!list || vcount == 0)	//	If list is empty, there will be no matches
 		return NULL;
 
+	if (vdense)
+	{
+		t = n-vbase;
+		if (t<0 || t>=vallocated || !list[t])
+			return NULL;
+		vcurrent = t;
+		return list[t];
+	}
+
 	//	How a about a nice binary search?  It will be slower for sequential
 	//	processing and a small number of styles, but worlds faster as the
 	//	number of styles increases.  Use skip_to for sequential processing
 	//	and find for random access.
-	l = 0;
-	h = vcount-1;
-	while (l+1 < h)
-	{
-		vcurrent = (l+h) / 2;
-		t = list[vcurrent]->value();
-		if (t == n)
-			return list[vcurrent];
-		else if (t < n)
-			l = vcurrent;
-		else
-			h = vcurrent;
-	}
-
-	//	This needs cleaning, I fairly certain there's way too much logic here
-	//	While this will work, I think we only need to check one of the values
-	//	but I've been wrong before... :)
-	vcurrent = l;
-	t = list[vcurrent]->value();
-	if (t == n)
-		return list[vcurrent];
-	if (t < n && vcurrent < vcount-1)
-	{
-		vcurrent=h;
-		t = list[vcurrent]->value();
-		if (t == n)
-			return list[vcurrent];
-	}
+	t = locate(n);
+	vcurrent = (t<vcount ? t : vcount-1);
+	if (t<vcount && list[t]->value()==n)
+		return list[t];
 	return NULL;
 }
 
 Flv_Style *Flv_Style_List::first(void)											//	Get first style
 {
-	if (!list)
+	if (!list || !vcount)
 		return NULL;
 	vcurrent = 0;
+	if (vdense)
+		while (!list[vcurrent])
+			vcurrent++;
 	return list[vcurrent];
 }
 
 bool Flv_Style_List::insert( Flv_Style *n )		//	Add style (if doesn't exist)
 {
-	int t;
+	Flv_Style **a;
+	int t, v = n->value();
+
+	if (vdense && !cover(v))						//	Too far out, back to sorted array
+		make_sparse();
+
+	if (vdense)
+	{
+		t = v-vbase;
+		if (list[t])											//	No duplicates
+			return false;
+		list[t] = n;
+		vcurrent = t;
+		vcount++;
+		return true;
+	}
+
 	//	Make sure there is room for a new item
 	if (vcount == vallocated)
 	{
-		Flv_Style **a = new Flv_Style *[vallocated+ADDSIZE];
+		t = vallocated+(vallocated>ADDSIZE?vallocated:ADDSIZE);
+		a = new Flv_Style *[t];
 		if (!a)
 			return false;
     //	Wasted CPU cycles, but list is pretty
-    memset( a, 0, sizeof(Flv_Style *)*(vallocated+ADDSIZE) );
+    memset( a, 0, sizeof(Flv_Style *)*t );
 		if (vcount)
 			memcpy( a, list, sizeof(Flv_Style *)*vcount );
-		vallocated += ADDSIZE;
+		vallocated = t;
     if (list)
 			delete []list;
 		list = a;
 	}
 
-  if (vcount)
-  {
-		find(n->value());									//	Point to insert candidate
-  	if (n->value()==list[vcurrent]->value())	//	No duplicates
-  		return false;
-	  if (n->value()>list[vcurrent]->value())		//	Insert at end of list
-  		vcurrent++;
-  }
-
+	t = locate(v);
+	if (t<vcount && list[t]->value()==v)	//	No duplicates
+	{
+		vcurrent = t;
+		return false;
+	}
 
 	//	Make room for insert if not appending
-  for (t=vcount;	t>vcurrent;	t-- )
-  	list[t] = list[t-1];
-
-	list[vcurrent] = n;
+	if (t<vcount)
+		memmove( list+t+1, list+t, sizeof(Flv_Style *)*(vcount-t) );
+	list[t] = n;
+	vcurrent = t;
 	vcount++;
+
+	if (want_dense())
+		make_dense();
 	return true;
 }
 
 Flv_Style *Flv_Style_List::next(void)											//	Next style
 {
-	if (!list || vcurrent >= vcount-1)
+	int t;
+
+	if (!list)
+		return NULL;
+	if (vdense)
+	{
+		for (t=vcurrent+1;	t<vallocated;	t++ )
+			if (list[t])
+				return list[vcurrent=t];
+		return NULL;
+	}
+	if (vcurrent >= vcount-1)
 		return NULL;
 
 	vcurrent++;
@@ -640,37 +838,51 @@ Flv_Style *Flv_Style_List::next(void)											//	Next style
 
 Flv_Style *Flv_Style_List::prior(void)
 {
+	int t;
 
 	if (!vcurrent || !list)
 		return 0;
+	if (vdense)
+	{
+		for (t=vcurrent-1;	t>=0;	t-- )
+			if (list[t])
+				return list[vcurrent=t];
+		return NULL;
+	}
 	vcurrent--;
 	return list[vcurrent];
 }
 
 bool Flv_Style_List::clear_current(void)
 {
-	if (!list)
+	Flv_Style *p = current();
+
+	if (!p)
 		return false;
 
-	if (list[vcurrent]->cell_style.count() == 0)
+	if (p->cell_style.count() == 0)
 		return release_current();
-	list[vcurrent]->clear_all();
+	p->clear_all();
 	return true;
 }
 
 bool Flv_Style_List::release_current(void)										//	Remove current style
 {
-	if (!list)
+	Flv_Style *p = current();
+
+	if (!p)
 		return false;
 
-	delete list[vcurrent];
-	if (vcurrent < vcount-1)
+	delete p;
+	vcount--;
+	if (vdense)
 	{
-		memmove(list+vcurrent, list+vcurrent+1, sizeof(Flv_Style *)*(vcount-vcurrent) );
-		vcount--;
-		list[vcount] = NULL;
+		list[vcurrent] = NULL;
+		return true;
 	}
-	if (vcurrent == vcount)
+	memmove(list+vcurrent, list+vcurrent+1, sizeof(Flv_Style *)*(vcount-vcurrent) );
+	list[vcount] = NULL;
+	if (vcurrent == vcount && vcurrent)
 		vcurrent--;
 
 	return true;
@@ -684,6 +896,9 @@ Flv_Style *Flv_Style_List::skip_to( int v )
 	if (!list || !vcount)
 		return NULL;
 
+	if (vdense)													//	Random access is just as quick
+		return find(v);
+
 	//	In case we're backing up or starting over
 	//	We're checking vcurrent-1 so if the last search found
 	//	an entry > the desired value, and this search isn't quite
@@ -694,6 +909,8 @@ Flv_Style *Flv_Style_List::skip_to( int v )
 	//	search for 5 (stay at seven since 3 is < value, return false)
 	//		If we started at 0 we'd end up here anyway... :)
 	//	search for 7 (stay at seven, we'll find it quick, return true)
+	if (vcurrent>=vcount)
+		vcurrent = 0;
 	if (vcurrent)
 	{
   	if (list[vcurrent-1]->value() >= v)
@@ -725,12 +942,75 @@ Flv_Style &Flv_Style_List::get(int value)
 {
 	Flv_Style *p;
 
-	if (find(value))							//	If it exists
-		return *(list[vcurrent]);		//		return it
+	p = find(value);							//	If it exists
+	if (p)
+		return *p;									//		return it
 
-	p = new Flv_Style;
-	p->value(value);
+	p = new Flv_Style(value);
 	insert(p);
 	return *p;
 }
 
+//	Get/Create the style for every step'th value from..to
+//	Like get, asking again for the same range returns the same style
+Flv_Style &Flv_Style_List::range( int from, int to, int step )
+{
+	Range *a;
+	int t;
+
+	if (from>to)
+	{
+		t = from;
+		from = to;
+		to = t;
+	}
+	if (step<1)
+		step = 1;
+	for (t=0;	t<vrange_count;	t++ )
+		if (vranges[t].from==from && vranges[t].to==to && vranges[t].step==step)
+			return *vranges[t].style;
+
+	if (vrange_count==vrange_allocated)
+	{
+		a = new Range[vrange_allocated+ADDSIZE];
+		if (vrange_count)
+			memcpy( a, vranges, sizeof(Range)*vrange_count );
+		if (vranges)
+			delete []vranges;
+		vranges = a;
+		vrange_allocated += ADDSIZE;
+	}
+	a = vranges+vrange_count++;
+	a->from = from;
+	a->to = to;
+	a->step = step;
+	a->style = new Flv_Style(from);
+	return *a->style;
+}
+
+//	Free all range styles
+void Flv_Style_List::clear_ranges(void)
+{
+	int t;
+
+	for (t=0;	t<vrange_count;	t++ )
+	{
+		vranges[t].style->cell_style.release();
+		delete vranges[t].style;
+	}
+	if (vranges)
+		delete []vranges;
+	vranges = NULL;
+	vrange_count = vrange_allocated = 0;
+}
+
+//	Add the styles of all ranges holding value to s, in creation order
+void Flv_Style_List::add_ranges( Flv_Style &s, int value )
+{
+	Range *r, *e;
+
+	for (r=vranges, e=vranges+vrange_count;	r<e;	r++ )
+		if (value>=r->from && value<=r->to &&
+				(r->step==1 || (value-r->from)%r->step==0))
+			s = *r->style;
+}
@@ -69,6 +69,11 @@ Flv_Table::Flv_Table( int X, int Y, int W, int H, const char *l ) :
 	vmove_on_enter = FLV_MOVE_ON_ENTER_COL_ROW;
 	vselect_col = 0;
 	vbuttons = FLV_BUTTON1 | FLV_BUTTON2 | FLV_BUTTON3;
+	vdata_source = NULL;
+	vredraw_left = 0;
+	vredraw_right = -1;
+	vdraw_left = -2;
+	vdraw_right = 0x7fffffff;
 }
 
 Flv_Table::~Flv_Table()
@@ -95,7 +100,8 @@ void Flv_Table::draw_row( int Offset, int &X, int &Y, int &, int &H, int R )
 	{
 		cw = col_width(-1);		//	Column width
 		TX = CX;	TY = Y;	TW = cw;	TH = H;
-		draw_cell( 0, TX, TY, TW, TH, R, -1 );
+		if (vdraw_left<=-1)
+			draw_cell( 0, TX, TY, TW, TH, R, -1 );
 		CX += cw;
 		dX += cw;
 		dW -= cw;
@@ -103,7 +109,7 @@ void Flv_Table::draw_row( int Offset, int &X, int &Y, int &, int &H, int R )
 
 	dW -= FW;
 	//	Draw column footer
-	if (FW)
+	if (FW && vdraw_left<=-2)
 	{
 		TX = dX+dW;	TY = Y;	TW = FW;	TH = H;
 		draw_cell( 0, TX, TY, TW, TH, R, -2 );
@@ -115,6 +121,8 @@ void Flv_Table::draw_row( int Offset, int &X, int &Y, int &, int &H, int R )
 		cw = col_width(c);					//	Column width
 		if (CX-Offset+cw<dX)				//	Before left
 			continue;
+		if (c<vdraw_left || c>vdraw_right)	//	Not being redrawn
+			continue;
 		fl_clip( CX-Offset, Y, cw, H );
 		TX = CX;	TY = Y;	TW = cw;	TH = H;
 		draw_cell( Offset, TX, TY, TW, TH, R, c );
@@ -127,7 +135,7 @@ void Flv_Table::draw_row( int Offset, int &X, int &Y, int &, int &H, int R )
 		fl_rect( dX, Y, dW, H );
 	}
 	//	Fill-in area at right of list
-	if (CX-Offset<dX+dW)
+	if (CX-Offset<dX+dW && vdraw_right>=vcols-1)
 	{
 		cw = dX+dW-(CX-Offset);
 		fl_color( dead_space_color() );
@@ -188,6 +196,36 @@ void Flv_Table::draw_cell( int Offset, int &X, int &Y, int &W, int &H, int R, in
 	if (!active())
 		s.foreground( fl_inactive(s.foreground()) );
 	fl_color(s.foreground());
+
+	//	Draw data source contents, column titles in the row header
+	if (vdata_source && C>-1 && C<vdata_source->cols())
+	{
+		char buf[64];
+		const char *t = NULL;
+		if (R>-1 && R<vdata_source->rows())
+			t = vdata_source->as_string( R, C, buf, sizeof(buf) );
+		else if (R==FLV_ROW_HEADER)
+			t = vdata_source->col_name(C);
+		if (t)
+			fl_draw( t, X-Offset, Y, W, H, s.align() );
+	}
+}
+
+Flv_Data_Source *Flv_Table::data_source( Flv_Data_Source *v )
+{
+	vdata_source = v;
+	data_changed();
+	return vdata_source;
+}
+
+void Flv_Table::data_changed(void)
+{
+	if (vdata_source)
+	{
+		rows( vdata_source->rows() );
+		cols( vdata_source->cols() );
+	}
+	damage(FLV_DAMAGE_CONTENTS);
 }
 
 bool Flv_Table::get_cell_bounds( int &X, int &Y, int &W, int &H, int R, int C )
@@ -291,6 +329,29 @@ void Flv_Table::draw(void)
 
 	row_width(rw);					//	Set the row width so we can draw intelligently
 
+	if (vdata_source)
+		vdata_source->prefetch( top_row(), page_size()+1 );
+	if (draw_scrolled())		//	Only scrolled vertically
+	{
+		vredraw_left = 0;
+		vredraw_right = -1;
+		return;
+	}
+	if (!(damage()&~FLV_DAMAGE_ROWS) && vredraw_top>=0)
+	{
+		vdraw_left = vredraw_left;		//	Only some cells changed
+		vdraw_right = vredraw_right;
+		vredraw_left = 0;
+		vredraw_right = -1;
+		draw_damaged_rows();
+		vdraw_left = -2;
+		vdraw_right = 0x7fffffff;
+		return;
+	}
+	vredraw_top = -1;
+	vredraw_left = 0;
+	vredraw_right = -1;
+
 	start_draw(X,Y,W,H,rw);
 
 	//	This is why draw is here and we're not using the code from
@@ -395,6 +456,13 @@ int Flv_Table::col_width(int C)					//	Get column width
 
 	if (global_style.width_defined())
 		fw = global_style.width();
+	if (col_style.ranges())
+	{
+		Flv_Style s;
+		col_style.add_ranges( s, C );
+		if (s.width_defined())
+			fw = s.width();
+	}
 	cols = col_style.find(C);
 	if (cols)
 		if (cols->width_defined())
@@ -412,7 +480,7 @@ int Flv_Table::col_width(int n, int c)	//	Set column width
 	if (n!=cw)
 	{
 		col_style[c].width(n);
-		damage(FL_DAMAGE_CHILD);
+		damage(FLV_DAMAGE_CONTENTS);
 	}
 	return col_width(c);
 }
@@ -426,6 +494,7 @@ void Flv_Table::get_style( Flv_Style &s, int R, int C )
 
 	if (R!=-3)
 	{
+		col_style.add_ranges( s, C );
 		cols = col_style.skip_to(C);
 		if (cols) s = *cols;
 	}
@@ -504,7 +573,7 @@ int Flv_Table::handle(int event)
 			Fl::focus(this);
 //			take_focus();
 			internal_handle(FL_KEYBOARD);
-			damage(FL_DAMAGE_CHILD);
+			damage(FLV_DAMAGE_CONTENTS);
 			return 1;
 		}
 		switch( Fl::event_key() )
@@ -647,7 +716,7 @@ int Flv_Table::internal_handle(int event)
 				LY = TY;
 			}
 
-			damage(FL_DAMAGE_CHILD);
+			damage(FLV_DAMAGE_CONTENTS);
 			rd = (r>row()?1:r==row()?0:-1);
 			cd = (c>col()?1:c==col()?0:-1);
 			if (r>=0)
@@ -871,7 +940,7 @@ int Flv_Table::internal_handle(int event)
 
 int Flv_Table::row(int n)
 {
-	int X,Y,W,H;
+	int X,Y,W,H,o,t;
 
 	if (n>=rows())
 		n=rows()-1;
@@ -879,6 +948,8 @@ int Flv_Table::row(int n)
 		n=0;
 	if (n!=vrow)
 	{
+		o = vrow;
+		t = top_row();
 		vrow = n;
 		client_area(X,Y,W,H);
 		update_top_row(H);
@@ -892,7 +963,9 @@ int Flv_Table::row(int n)
 			do_callback(this, user_data());
 			vwhy_event = 0;
 		}
-		damage(FL_DAMAGE_CHILD);
+		if (t!=top_row())							//	Move the rows on screen
+			damage(FL_DAMAGE_SCROLL);
+		redraw_rows( o, vrow );					//	Only rows between old and new change
 	}
 	return vrow;
 }
@@ -900,6 +973,7 @@ int Flv_Table::row(int n)
 int Flv_Table::col( int n )
 {
 	Flv_Style s;
+	int o, t;
 
 	if (n>=vcols)
 		n=vcols-1;
@@ -907,6 +981,8 @@ int Flv_Table::col( int n )
 		n=0;
 	if (n!=vcol)
 	{
+		o = vcol;
+		t = row_offset();
 		vcol = n;
 		end_edit();
 		if (edit_when()==FLV_EDIT_ALWAYS)
@@ -919,7 +995,10 @@ int Flv_Table::col( int n )
 			do_callback(this, user_data());
 			vwhy_event = 0;
 		}
-		damage(FL_DAMAGE_CHILD);
+		if (t==row_offset())					//	Not scrolled, redraw columns in between
+			redraw_cells( select_start_row(), o, vrow, vcol );	//	in selected rows
+		else
+			damage(FLV_DAMAGE_CONTENTS);
 	}
 	return vcol;
 }
@@ -959,7 +1038,7 @@ int Flv_Table::cols( int n )
 			do_callback(this, user_data());
 			vwhy_event = 0;
 		}
-		damage(FL_DAMAGE_CHILD);
+		damage(FLV_DAMAGE_CONTENTS);
 	}
 	return vcols;
 }
@@ -972,6 +1051,43 @@ bool Flv_Table::col_selected(int n)
 		return (vcol<=n && n<=vselect_col);
 }
 
+//	Ask to redraw all cells of rows r1..r2
+void Flv_Table::redraw_rows( int r1, int r2 )
+{
+	vredraw_left = -2;
+	vredraw_right = vcols;
+	Flv_List::redraw_rows( r1, r2 );
+}
+
+//	Ask to redraw cells r1..r2 x c1..c2 without repainting the rest
+//	Columns -1 and -2 are the column header and footer
+void Flv_Table::redraw_cells( int r1, int c1, int r2, int c2 )
+{
+	int t;
+	bool first = (vredraw_top<0);
+
+	if (c1>c2)
+	{
+		t = c1;
+		c1 = c2;
+		c2 = t;
+	}
+	Flv_List::redraw_rows( r1, r2 );
+	if (vredraw_top<0)							//	Rows not visible
+		return;
+	if (first)
+	{
+		vredraw_left = c1;
+		vredraw_right = c2;
+	} else
+	{
+		if (c1<vredraw_left)
+			vredraw_left = c1;
+		if (c2>vredraw_right)
+			vredraw_right = c2;
+	}
+}
+
 //	Get column from x,y
 int Flv_Table::get_col( int x, int y )
 {
@@ -1019,12 +1135,15 @@ int Flv_Table::get_col( int x, int y )
 
 int Flv_Table::select_start_col(int n)
 {
+	int t;
+
 	if (n>=vcols)
 		n=vcols-1;
 	if (n<0)
 		n=0;
 	if (n!=vselect_col)
 	{
+		t = vselect_col;
 		vselect_col = n;
 		if (DOcb(FLVEcb_SELECTION_CHANGED))
 		{
@@ -1032,7 +1151,7 @@ int Flv_Table::select_start_col(int n)
 			do_callback(this, user_data());
 			vwhy_event = 0;
 		}
-		damage(FL_DAMAGE_CHILD);
+		redraw_cells( select_start_row(), t, vrow, n );	//	Selection changes between them
 	}
 	return vselect_col;
 }
@@ -1050,7 +1169,7 @@ void Flv_Table::update_width()
 	if (rw!=row_width())
 	{
 		row_width(rw);
-		damage(FL_DAMAGE_CHILD);
+		damage(FLV_DAMAGE_CONTENTS);
 	}
 }
 
@@ -1074,7 +1193,7 @@ void Flv_Table::adjust_for_cell()
 		if (o+cw-row_offset()>W)
 		{
 			row_offset(o+cw-W);
-		  damage(FL_DAMAGE_CHILD);
+		  damage(FLV_DAMAGE_CONTENTS);
 		}
 	}
 }
@@ -1096,7 +1215,7 @@ bool Flv_Table::check_resize(void)
 		v = ey-anchor_top;
 		if (v<2) v=2;
 		row_style[drag_row].height(v);
-		damage(FL_DAMAGE_CHILD);
+		damage(FLV_DAMAGE_CONTENTS);
 		return true;
 	}
 
@@ -1127,7 +1246,7 @@ bool Flv_Table::check_resize(void)
 				anchor_left = X+W-2;
 			}
 			col_style[drag_col].width(v);
-			damage(FL_DAMAGE_CHILD);
+			damage(FLV_DAMAGE_CONTENTS);
 			if (v!=W-1 && v!=2)
 				anchor_left = ex;
 		} else
@@ -1144,7 +1263,7 @@ bool Flv_Table::check_resize(void)
 			if (v<2)
 				v=2;
 			col_width(v,drag_col);
-			damage(FL_DAMAGE_CHILD);
+			damage(FLV_DAMAGE_CONTENTS);
 		}
 	}
 
@@ -1170,7 +1289,7 @@ bool Flv_Table::check_resize(void)
 				anchor_top = Y+H-2;
 			}
 			row_style[drag_row].height(v);
-			damage(FL_DAMAGE_CHILD);
+			damage(FLV_DAMAGE_CONTENTS);
 			if (v!=2 && v!=H-1)
 				anchor_top = ey;
 		} else
@@ -1185,7 +1304,7 @@ bool Flv_Table::check_resize(void)
 			}
 			if (v<2) v=2;
 			row_height(v,drag_row);
-			damage(FL_DAMAGE_CHILD);
+			damage(FLV_DAMAGE_CONTENTS);
 		}
 	}
 	return true;
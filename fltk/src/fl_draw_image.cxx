@@ -64,6 +64,24 @@
 #  include <FL/x.H>
 #  include "Fl_XColor.H"
 #  include "flstring.h"
+#  if HAVE_XSHM
+#    include <X11/extensions/XShm.h>
+#    include <sys/ipc.h>
+#    include <sys/shm.h>
+#  endif
+
+#  ifdef __SSE2__
+#    include <emmintrin.h>
+#    define USE_SSE2 1
+#  endif
+
+// The SSSE3 code is compiled for all x86 CPUs and only used by the ones
+// that have it, this needs GCC 4.9 or clang...
+#  if USE_SSE2 && (defined(__clang__) || (defined(__GNUC__) && \
+      (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#    include <tmmintrin.h>
+#    define USE_SSSE3 1
+#  endif
 
 static XImage xi;	// template used to pass info to X
 static int bytes_per_pixel;
@@ -311,15 +329,99 @@ static void rrr_converter(const uchar *from, uchar *to, int w, int delta) {
   U32 *t = (U32*)to; for (; w--; from += delta) *t++ = f
 #  endif
 
+#  if USE_SSSE3
+static int have_ssse3() {
+  static int ssse3 = -1;
+  if (ssse3 < 0) {
+    __builtin_cpu_init();
+    ssse3 = __builtin_cpu_supports("ssse3") ? 1 : 0;
+  }
+  return ssse3;
+}
+
+// RGB to R,G,B,0 (swap = 0) or B,G,R,0 (swap = 1) bytes, 4 pixels per
+// step.  Each load reads 16 bytes, so it stops before the last pixels:
+__attribute__((target("ssse3")))
+static int ssse3_rgb32(const uchar *from, uchar *to, int w, int swap) {
+  const __m128i order = swap ?
+    _mm_setr_epi8(2,1,0,-1, 5,4,3,-1, 8,7,6,-1, 11,10,9,-1) :
+    _mm_setr_epi8(0,1,2,-1, 3,4,5,-1, 6,7,8,-1, 9,10,11,-1);
+  int x = 0;
+  for (; x+6 <= w; x += 4) {
+    __m128i p = _mm_loadu_si128((const __m128i*)(from+x*3));
+    _mm_storeu_si128((__m128i*)(to+x*4), _mm_shuffle_epi8(p, order));
+  }
+  return x;
+}
+#  endif
+
+#  if USE_SSE2
+// The start of a line of 32 bit pixels in R,G,B,0 (swap = 0) or
+// B,G,R,0 (swap = 1) byte order, for the usual delta of 3 or 4.
+// Returns the number of pixels done, always even so INNARDS32 can
+// do the rest:
+static int sse2_rgb32(const uchar *from, uchar *to, int w, int delta, int swap) {
+  int x = 0;
+  if (delta == 4) {
+    const __m128i rgb = _mm_set1_epi32(0xffffff);
+    const __m128i lo = _mm_set1_epi32(0xff);
+    const __m128i mid = _mm_set1_epi32(0xff00);
+    if (swap) for (; x+4 <= w; x += 4) {
+      __m128i p = _mm_loadu_si128((const __m128i*)(from+x*4));
+      p = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(p, lo), 16),
+                                    _mm_and_si128(p, mid)),
+                       _mm_and_si128(_mm_srli_epi32(p, 16), lo));
+      _mm_storeu_si128((__m128i*)(to+x*4), p);
+    } else for (; x+4 <= w; x += 4) {
+      __m128i p = _mm_loadu_si128((const __m128i*)(from+x*4));
+      _mm_storeu_si128((__m128i*)(to+x*4), _mm_and_si128(p, rgb));
+    }
+  }
+#    if USE_SSSE3
+  else if (delta == 3 && have_ssse3()) x = ssse3_rgb32(from, to, w, swap);
+#    endif
+  return x;
+}
+
+// Gray to g,g,g,0 bytes, 16 pixels per step:
+static int sse2_mono32(const uchar *from, uchar *to, int w, int delta) {
+  int x = 0;
+  if (delta != 1) return 0;
+  const __m128i zero = _mm_setzero_si128();
+  for (; x+16 <= w; x += 16) {
+    __m128i p = _mm_loadu_si128((const __m128i*)(from+x));
+    __m128i gg = _mm_unpacklo_epi8(p, p), g0 = _mm_unpacklo_epi8(p, zero);
+    _mm_storeu_si128((__m128i*)(to+x*4), _mm_unpacklo_epi16(gg, g0));
+    _mm_storeu_si128((__m128i*)(to+x*4+16), _mm_unpackhi_epi16(gg, g0));
+    gg = _mm_unpackhi_epi8(p, p); g0 = _mm_unpackhi_epi8(p, zero);
+    _mm_storeu_si128((__m128i*)(to+x*4+32), _mm_unpacklo_epi16(gg, g0));
+    _mm_storeu_si128((__m128i*)(to+x*4+48), _mm_unpackhi_epi16(gg, g0));
+  }
+  return x;
+}
+
+// SSE2 is little-endian only, there xbgr and xrgb are the R,G,B,0 and
+// B,G,R,0 byte orders:
+#    define SSE2_RGB32(swap) \
+  {int x = sse2_rgb32(from, to, w, delta, swap); from += x*delta; to += x*4; w -= x;}
+#    define SSE2_MONO32() \
+  {int x = sse2_mono32(from, to, w, delta); from += x*delta; to += x*4; w -= x;}
+#  else
+#    define SSE2_RGB32(swap)
+#    define SSE2_MONO32()
+#  endif
+
 static void rgbx_converter(const uchar *from, uchar *to, int w, int delta) {
   INNARDS32((unsigned(from[0])<<24)+(from[1]<<16)+(from[2]<<8));
 }
 
 static void xbgr_converter(const uchar *from, uchar *to, int w, int delta) {
+  SSE2_RGB32(0);
   INNARDS32((from[0])+(from[1]<<8)+(from[2]<<16));
 }
 
 static void xrgb_converter(const uchar *from, uchar *to, int w, int delta) {
+  SSE2_RGB32(1);
   INNARDS32((from[0]<<16)+(from[1]<<8)+(from[2]));
 }
 
@@ -332,6 +434,7 @@ static void rrrx_converter(const uchar *from, uchar *to, int w, int delta) {
 }
 
 static void xrrr_converter(const uchar *from, uchar *to, int w, int delta) {
+  SSE2_MONO32();
   INNARDS32(*from * 0x10101U);
 }
 
@@ -456,6 +559,87 @@ static void figure_out_visual() {
 
 #  define MAXBUFFER 0x40000 // 256k
 
+#  if HAVE_XSHM
+////////////////////////////////////////////////////////////////
+// MIT-SHM: large images are converted into memory shared with a local
+// X server, so XShmPutImage() does not copy them through the socket.
+// The server reads the memory after the call returns, it must not be
+// written again before an XSync().
+
+#    define SHMMIN 0x10000	// bytes, smaller images use XPutImage()
+#    define SHMMAX 0x1000000	// bytes, 16M, larger ones are done in blocks
+
+static XShmSegmentInfo shm_info;
+static long shm_size;		// size of the attached segment, 0 if none
+static int shm_state;		// 1 = usable, -1 = not, 0 = not checked yet
+static int shm_busy;		// an XShmPutImage() may still be reading
+static int shm_error;
+
+static int shm_error_handler(Display *, XErrorEvent *) {
+  shm_error = 1;
+  return 0;
+}
+
+static void shm_wait() {
+  if (shm_busy) {
+    XSync(fl_display, False);
+    shm_busy = 0;
+  }
+}
+
+// Returns the shared memory to convert size bytes into, or NULL if
+// the server does not have MIT-SHM or is not on this machine:
+static STORETYPE *shm_buffer(long size) {
+  if (!shm_state) shm_state = XShmQueryExtension(fl_display) ? 1 : -1;
+  if (shm_state < 0) return 0;
+  shm_wait();
+  if (size <= shm_size) return (STORETYPE *)shm_info.shmaddr;
+  if (shm_size) {
+    XShmDetach(fl_display, &shm_info);
+    shmdt(shm_info.shmaddr);
+    shm_size = 0;
+  }
+  size = (size+SHMMIN-1) & -SHMMIN;
+  shm_info.shmid = shmget(IPC_PRIVATE, size, IPC_CREAT|0600);
+  if (shm_info.shmid < 0) return 0;
+  shm_info.shmaddr = (char *)shmat(shm_info.shmid, 0, 0);
+  if (shm_info.shmaddr == (char *)-1) {
+    shmctl(shm_info.shmid, IPC_RMID, 0);
+    return 0;
+  }
+  shm_info.readOnly = True;
+  // a remote server fails to attach, which is only known after a sync:
+  shm_error = 0;
+  XErrorHandler old_handler = XSetErrorHandler(shm_error_handler);
+  XShmAttach(fl_display, &shm_info);
+  XSync(fl_display, False);
+  XSetErrorHandler(old_handler);
+  // the segment is freed when both sides have detached it:
+  shmctl(shm_info.shmid, IPC_RMID, 0);
+  if (shm_error) {
+    shmdt(shm_info.shmaddr);
+    shm_state = -1;
+    return 0;
+  }
+  shm_size = size;
+  return (STORETYPE *)shm_info.shmaddr;
+}
+#  endif
+
+// Sends k lines of the converted image, more is true if other
+// blocks are converted into the buffer after this one:
+static void put_image(STORETYPE *buffer, int X, int Y, int w, int k, int more) {
+#  if HAVE_XSHM
+  if (shm_size && (char *)buffer == shm_info.shmaddr) {
+    XShmPutImage(fl_display, fl_window, fl_gc, &xi, 0, 0, X, Y, w, k, False);
+    shm_busy = 1;
+    if (more) shm_wait();
+    return;
+  }
+#  endif
+  XPutImage(fl_display,fl_window,fl_gc, &xi, 0, 0, X, Y, w, k);
+}
+
 static void innards(const uchar *buf, int X, int Y, int W, int H,
 		    int delta, int linedelta, int mono,
 		    Fl_Draw_Image_Cb cb, void* userdata)
@@ -475,42 +659,60 @@ static void innards(const uchar *buf, int X, int Y, int W, int H,
   void (*conv)(const uchar *from, uchar *to, int w, int delta) = converter;
   if (mono) conv = mono_converter;
 
-  // See if the data is already in the right format.  Unfortunately
-  // some 32-bit x servers (XFree86) care about the unknown 8 bits
-  // and they must be zero.  I can't confirm this for user-supplied
-  // data, so the 32-bit shortcut is disabled...
+  // See if the data is already in the right format.  Some 32-bit x
+  // servers (XFree86) care about the unknown 8 bits and they must be
+  // zero, so RGBA data is only passed as is when those bits are not
+  // part of the visual (depth 24, the usual TrueColor one).
   // This can set bytes_per_line negative if image is bottom-to-top
   // I tested it on Linux, but it may fail on other Xlib implementations:
   if (buf && (
-#  if 0	// set this to 1 to allow 32-bit shortcut
-      delta == 4 &&
-#    if WORDS_BIGENDIAN
-      conv == rgbx_converter
-#    else
-      conv == xbgr_converter
-#    endif
-      ||
+      (delta == 4 && xi.depth <= 24 &&
+#  if WORDS_BIGENDIAN
+       conv == rgbx_converter
+#  else
+       conv == xbgr_converter
 #  endif
-      conv == rgb_converter && delta==3
+      ) ||
+      (conv == rgb_converter && delta==3)
       ) && !(linedelta&scanline_add)) {
     xi.data = (char *)(buf+delta*dx+linedelta*dy);
     xi.bytes_per_line = linedelta;
+    XPutImage(fl_display,fl_window,fl_gc, &xi, 0, 0, X+dx, Y+dy, w, h);
 
   } else {
     int linesize = ((w*bytes_per_pixel+scanline_add)&scanline_mask)/sizeof(STORETYPE);
     int blocking = h;
-    static STORETYPE *buffer;	// our storage, always word aligned
-    static long buffer_size;
-    {int size = linesize*h;
-    if (size > MAXBUFFER) {
-      size = MAXBUFFER;
-      blocking = MAXBUFFER/linesize;
+    STORETYPE *buffer = 0;
+#  if HAVE_XSHM
+    // The server takes the line length from xi.width, so the padded
+    // lines must be a whole number of pixels:
+    long line_bytes = linesize*sizeof(STORETYPE);
+    if (line_bytes*h >= SHMMIN && !(line_bytes%bytes_per_pixel) &&
+        xi.byte_order == ImageByteOrder(fl_display)) {
+      if (line_bytes*h > SHMMAX) blocking = int(SHMMAX/line_bytes);
+      buffer = shm_buffer(line_bytes*blocking);
+      if (buffer) {
+        xi.width = int(line_bytes/bytes_per_pixel);
+        xi.height = blocking;
+        xi.obdata = (char *)&shm_info;
+      } else blocking = h;
+    }
+#  endif
+    if (!buffer) {
+      static STORETYPE *heap;	// our storage, always word aligned
+      static long heap_size;
+      int size = linesize*h;
+      if (size > MAXBUFFER) {
+        size = MAXBUFFER;
+        blocking = MAXBUFFER/linesize;
+      }
+      if (size > heap_size) {
+        delete[] heap;
+        heap_size = size;
+        heap = new STORETYPE[size];
+      }
+      buffer = heap;
     }
-    if (size > buffer_size) {
-      delete[] buffer;
-      buffer_size = size;
-      buffer = new STORETYPE[size];
-    }}
     xi.data = (char *)buffer;
     xi.bytes_per_line = linesize*sizeof(STORETYPE);
     if (buf) {
@@ -523,7 +725,7 @@ static void innards(const uchar *buf, int X, int Y, int W, int H,
 	  buf += linedelta;
 	  to += linesize;
 	}
-	XPutImage(fl_display,fl_window,fl_gc, &xi, 0, 0, X+dx, Y+dy+j-k, w, k);
+	put_image(buffer, X+dx, Y+dy+j-k, w, k, j<h);
       }
     } else {
       STORETYPE* linebuf = new STORETYPE[(W*delta+(sizeof(STORETYPE)-1))/sizeof(STORETYPE)];
@@ -535,7 +737,7 @@ static void innards(const uchar *buf, int X, int Y, int W, int H,
 	  conv((uchar*)linebuf, (uchar*)to, w, delta);
 	  to += linesize;
 	}
-	XPutImage(fl_display,fl_window,fl_gc, &xi, 0, 0, X+dx, Y+dy+j-k, w, k);
+	put_image(buffer, X+dx, Y+dy+j-k, w, k, j<h);
       }
 
       delete[] linebuf;
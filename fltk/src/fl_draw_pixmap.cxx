@@ -41,7 +41,15 @@
 #include <stdio.h>
 #include "flstring.h"
 
-static int ncolors, chars_per_pixel;
+// Parses the header of the XPM data, without using any global state
+// so that images can be measured by other threads while drawing:
+static int measure_pixmap(const char * const *cdata, int &w, int &h,
+                          int &ncolors, int &chars_per_pixel) {
+  int i = sscanf(cdata[0],"%d%d%d%d",&w,&h,&ncolors,&chars_per_pixel);
+  if (i<4 || w<=0 || h<=0 ||
+      (chars_per_pixel!=1 && chars_per_pixel!=2)) return w=0;
+  return 1;
+}
 
 /**
   Get the dimensions of a pixmap.
@@ -61,10 +69,8 @@ int fl_measure_pixmap(/*const*/ char* const* data, int &w, int &h) {
   \see fl_measure_pixmap(char* const* data, int &w, int &h)
   */
 int fl_measure_pixmap(const char * const *cdata, int &w, int &h) {
-  int i = sscanf(cdata[0],"%d%d%d%d",&w,&h,&ncolors,&chars_per_pixel);
-  if (i<4 || w<=0 || h<=0 ||
-      chars_per_pixel!=1 && chars_per_pixel!=2) return w=0;
-  return 1;
+  int ncolors, chars_per_pixel;
+  return measure_pixmap(cdata, w, h, ncolors, chars_per_pixel);
 }
 
 #ifdef U64
@@ -219,7 +225,8 @@ static void make_unused_color(uchar &r, uchar &g, uchar &b)
   */
 int fl_draw_pixmap(const char*const* cdata, int x, int y, Fl_Color bg) {
   pixmap_data d;
-  if (!fl_measure_pixmap(cdata, d.w, d.h)) return 0;
+  int ncolors, chars_per_pixel;
+  if (!measure_pixmap(cdata, d.w, d.h, ncolors, chars_per_pixel)) return 0;
   const uchar*const* data = (const uchar*const*)(cdata+1);
   int transparent_index = -1;
   uchar *transparent_c = (uchar *)0; // such that transparent_c[0,1,2] are the RGB of the transparent color
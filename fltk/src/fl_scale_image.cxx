@@ -0,0 +1,706 @@
+//
+// "$Id$"
+//
+// Image scaling and color routines for the Fast Light Tool Kit (FLTK).
+//
+// Copyright 1998-2010 by Bill Spitzak and others.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Library General Public
+// License as published by the Free Software Foundation; either
+// version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Library General Public License for more details.
+//
+// You should have received a copy of the GNU Library General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA.
+//
+// Please report all bugs and problems on the following page:
+//
+//     http://www.fltk.org/str.php
+//
+
+//
+// Images are resized with separable filters: each destination pixel is
+// a weighted sum of the source pixels around it, first along the lines
+// into a temporary image, then along the columns. The weights of each
+// column and line are computed once, in 14 bit fixed point.
+//
+// The inner loops have SSE2 versions, the vertical pass also an AVX2
+// one that is chosen at run time. Large images are cut in bands of
+// lines that are done by several threads.
+//
+
+#include <FL/Fl.H>
+#include <FL/Fl_Image.H>
+#include <FL/math.h>
+#include "flstring.h"
+
+#ifdef WIN32
+#  include <windows.h>
+#elif HAVE_PTHREAD
+#  include <pthread.h>
+#  include <unistd.h>
+#endif // WIN32
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define USE_SSE2 1
+#endif
+
+// The AVX2 code is compiled for all x86 CPUs and only used by the ones
+// that have it, this needs GCC 4.9 or clang...
+#if USE_SSE2 && (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__clang__) || (defined(__GNUC__) && \
+     (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#  include <immintrin.h>
+#  define USE_AVX2 1
+#endif
+
+#define PRECISION_BITS	14		// Fraction bits of the weights
+#define MAX_BANDS	8		// Most threads used by one call
+
+
+//
+// Filters, x is the distance in source pixels, stretched when
+// the image is reduced...
+//
+
+static double box_filter(double x) {
+  return (x > -0.5 && x <= 0.5) ? 1.0 : 0.0;
+}
+
+static double bilinear_filter(double x) {
+  if (x < 0.0) x = -x;
+  return x < 1.0 ? 1.0 - x : 0.0;
+}
+
+static double sinc(double x) {
+  if (x == 0.0) return 1.0;
+  x *= M_PI;
+  return sin(x) / x;
+}
+
+static double lanczos_filter(double x) {
+  // Sinc windowed by the central lobe of a 3 times wider sinc
+  if (x > -3.0 && x < 3.0) return sinc(x) * sinc(x / 3.0);
+  return 0.0;
+}
+
+
+//
+// Weights of the source pixels for each destination pixel...
+//
+
+struct Fl_Scale_Coeffs {
+  int	*bounds;			// First source pixel and count
+  short	*weights;			// ksize weights per destination pixel
+  int	ksize;				// Most source pixels per destination
+};
+
+static void compute_coeffs(Fl_Scale_Coeffs &c, int in, int out,
+                           Fl_RGB_Scaling filter) {
+  double	(*fn)(double);		// Filter function
+  double	support,		// Half width of the filter
+		scale,			// Source pixels per destination pixel
+		fscale;			// Stretch of the filter
+  double	*k;			// Weights of one pixel
+  int		xx, x;			// Looping vars
+
+  switch (filter) {
+    case FL_RGB_SCALING_BOX :
+      fn = box_filter;
+      support = 0.5;
+      break;
+    case FL_RGB_SCALING_LANCZOS :
+      fn = lanczos_filter;
+      support = 3.0;
+      break;
+    default :
+      fn = bilinear_filter;
+      support = 1.0;
+      break;
+  }
+
+  scale   = (double)in / out;
+  fscale  = scale < 1.0 ? 1.0 : scale;
+  support *= fscale;
+
+  c.ksize   = (int)ceil(support) * 2 + 1;
+  c.bounds  = new int[out * 2];
+  c.weights = new short[out * c.ksize];
+  k         = new double[c.ksize];
+
+  for (xx = 0; xx < out; xx ++) {
+    double	center = (xx + 0.5) * scale,
+		total = 0.0;
+    int		xmin = (int)(center - support + 0.5),
+		xmax = (int)(center + support + 0.5),
+		sum = 0, big = 0;
+    short	*w = c.weights + xx * c.ksize;
+
+    if (xmin < 0) xmin = 0;
+    if (xmax > in) xmax = in;
+    xmax -= xmin;
+
+    for (x = 0; x < xmax; x ++) {
+      k[x]  = fn((x + xmin - center + 0.5) / fscale);
+      total += k[x];
+    }
+
+    for (x = 0; x < xmax; x ++) {
+      w[x] = total ? (short)floor(k[x] / total * (1 << PRECISION_BITS) + 0.5) : 0;
+      sum  += w[x];
+      if (w[x] > w[big]) big = x;
+    }
+
+    if (xmax > 0) {
+      // Make the weights add up to exactly 1...
+      w[big] += (1 << PRECISION_BITS) - sum;
+    } else {
+      xmin = (int)center < in ? (int)center : in - 1;
+      xmax = 1;
+      w[0] = 1 << PRECISION_BITS;
+    }
+
+    for (x = xmax; x < c.ksize; x ++) w[x] = 0;
+
+    c.bounds[xx * 2]     = xmin;
+    c.bounds[xx * 2 + 1] = xmax;
+  }
+
+  delete[] k;
+}
+
+
+//
+// Running bands of lines in threads...
+//
+
+typedef void (*Fl_Band_Func)(void *job, int y0, int y1);
+
+struct Fl_Band {
+  Fl_Band_Func	fn;			// Function doing the lines
+  void		*job;			// What to do
+  int		y0, y1;			// Lines to do
+};
+
+#ifdef WIN32
+static DWORD WINAPI band_thread(LPVOID data) {
+  Fl_Band *b = (Fl_Band *)data;
+  (b->fn)(b->job, b->y0, b->y1);
+  return 0;
+}
+#elif HAVE_PTHREAD
+static void *band_thread(void *data) {
+  Fl_Band *b = (Fl_Band *)data;
+  (b->fn)(b->job, b->y0, b->y1);
+  return 0;
+}
+#endif // WIN32
+
+static int num_cpus() {
+  static int n = 0;
+
+  if (!n) {
+#ifdef WIN32
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    n = (int)si.dwNumberOfProcessors;
+#elif HAVE_PTHREAD && defined(_SC_NPROCESSORS_ONLN)
+    n = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif // WIN32
+
+    if (n < 1) n = 1;
+    else if (n > MAX_BANDS) n = MAX_BANDS;
+  }
+
+  return n;
+}
+
+// Calls fn for the lines 0 to lines - 1, in bands done by several
+// threads when there is enough work
+static void run_bands(Fl_Band_Func fn, void *job, int lines, double work) {
+  const double	MIN_WORK = 1 << 20;	// Work worth a thread
+  Fl_Band	band[MAX_BANDS];
+  int		n = num_cpus(), i;
+
+  if (n > work / MIN_WORK) n = (int)(work / MIN_WORK);
+  if (n > lines) n = lines;
+
+  if (n <= 1) {
+    fn(job, 0, lines);
+    return;
+  }
+
+  for (i = 0; i < n; i ++) {
+    band[i].fn  = fn;
+    band[i].job = job;
+    band[i].y0  = (int)((double)lines * i / n);
+    band[i].y1  = (int)((double)lines * (i + 1) / n);
+  }
+
+#ifdef WIN32
+  HANDLE	t[MAX_BANDS];
+
+  for (i = 1; i < n; i ++) t[i] = CreateThread(NULL, 0, band_thread, band + i, 0, NULL);
+
+  fn(job, band[0].y0, band[0].y1);
+
+  for (i = 1; i < n; i ++)
+    if (t[i]) {
+      WaitForSingleObject(t[i], INFINITE);
+      CloseHandle(t[i]);
+    } else fn(job, band[i].y0, band[i].y1);
+#elif HAVE_PTHREAD
+  pthread_t	t[MAX_BANDS];
+  int		started[MAX_BANDS];
+
+  for (i = 1; i < n; i ++) started[i] = !pthread_create(t + i, NULL, band_thread, band + i);
+
+  fn(job, band[0].y0, band[0].y1);
+
+  for (i = 1; i < n; i ++)
+    if (started[i]) pthread_join(t[i], NULL);
+    else fn(job, band[i].y0, band[i].y1);
+#else
+  for (i = 0; i < n; i ++) fn(job, band[i].y0, band[i].y1);
+#endif // WIN32
+}
+
+
+//
+// Resampling passes...
+//
+
+struct Fl_Scale_Job {
+  const uchar	*src;			// Source lines
+  int		sld;			// Bytes from one source line to the next
+  uchar		*dst;			// Destination lines
+  int		dld;			// Bytes from one destination line to the next
+  int		w;			// Destination width in pixels
+  int		d;			// Bytes per pixel
+  Fl_Scale_Coeffs *c;			// Weights
+};
+
+static inline uchar clip8(int v) {
+  v >>= PRECISION_BITS;
+  return v < 0 ? 0 : v > 255 ? 255 : (uchar)v;
+}
+
+#if USE_SSE2
+static inline __m128i load_pixel(const uchar *p, int d) {
+  int v;
+
+  switch (d) {
+    case 4 : memcpy(&v, p, 4); break;
+    case 3 : v = p[0] | (p[1] << 8) | (p[2] << 16); break;
+    case 2 : v = p[0] | (p[1] << 8); break;
+    default : v = p[0]; break;
+  }
+
+  return _mm_cvtsi32_si128(v);
+}
+
+// Two weights for _mm_madd_epi16()
+static inline int weight_pair(short w0, short w1) {
+  return (int)((unsigned short)w0 | ((unsigned)(unsigned short)w1 << 16));
+}
+#endif // USE_SSE2
+
+// Resizes the lines y0 to y1 - 1 horizontally
+static void scale_lines(void *data, int y0, int y1) {
+  Fl_Scale_Job	*j = (Fl_Scale_Job *)data;
+  int		d = j->d, ks = j->c->ksize;
+  int		y, xx, x, c;
+
+  for (y = y0; y < y1; y ++) {
+    const uchar	*s = j->src + y * j->sld;
+    uchar	*o = j->dst + y * j->dld;
+
+    for (xx = 0; xx < j->w; xx ++, o += d) {
+      const uchar	*p = s + j->c->bounds[xx * 2] * d;
+      int		n = j->c->bounds[xx * 2 + 1];
+      const short	*k = j->c->weights + xx * ks;
+
+#if USE_SSE2
+      // All channels at once, two source pixels per step...
+      __m128i	zero = _mm_setzero_si128(),
+		sum = _mm_set1_epi32(1 << (PRECISION_BITS - 1)),
+		pix;
+
+      for (x = 0; x + 1 < n; x += 2, p += 2 * d) {
+        pix = _mm_unpacklo_epi8(_mm_unpacklo_epi8(load_pixel(p, d),
+                                                  load_pixel(p + d, d)), zero);
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(pix, _mm_set1_epi32(weight_pair(k[x], k[x + 1]))));
+      }
+
+      if (x < n) {
+        pix = _mm_unpacklo_epi8(_mm_unpacklo_epi8(load_pixel(p, d), zero), zero);
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(pix, _mm_set1_epi32(weight_pair(k[x], 0))));
+      }
+
+      sum = _mm_srai_epi32(sum, PRECISION_BITS);
+      sum = _mm_packs_epi32(sum, sum);
+      sum = _mm_packus_epi16(sum, sum);
+
+      unsigned v = (unsigned)_mm_cvtsi128_si32(sum);
+
+      for (c = 0; c < d; c ++, v >>= 8) o[c] = (uchar)v;
+#else
+      for (c = 0; c < d; c ++) {
+        int sum = 1 << (PRECISION_BITS - 1);
+
+        for (x = 0; x < n; x ++) sum += p[x * d + c] * k[x];
+
+        o[c] = clip8(sum);
+      }
+#endif // USE_SSE2
+    }
+  }
+}
+
+#if USE_AVX2
+static int have_avx2() {
+  static int avx2 = -1;
+
+  if (avx2 < 0) {
+    __builtin_cpu_init();
+    avx2 = __builtin_cpu_supports("avx2") ? 1 : 0;
+  }
+
+  return avx2;
+}
+
+// Vertical pass of one line, 16 bytes per step, returns the bytes done
+__attribute__((target("avx2")))
+static int scale_column_avx2(const uchar *s, int sld, const short *k, int n,
+                             uchar *o, int bytes) {
+  int i, y;
+
+  for (i = 0; i + 16 <= bytes; i += 16) {
+    const uchar	*p = s + i;
+    __m256i	s0 = _mm256_set1_epi32(1 << (PRECISION_BITS - 1)),
+		s1 = s0, w, v;
+    __m128i	a, b;
+
+    for (y = 0; y + 1 < n; y += 2, p += 2 * sld) {
+      a  = _mm_loadu_si128((const __m128i *)p);
+      b  = _mm_loadu_si128((const __m128i *)(p + sld));
+      w  = _mm256_set1_epi32(weight_pair(k[y], k[y + 1]));
+      s0 = _mm256_add_epi32(s0, _mm256_madd_epi16(_mm256_cvtepu8_epi16(_mm_unpacklo_epi8(a, b)), w));
+      s1 = _mm256_add_epi32(s1, _mm256_madd_epi16(_mm256_cvtepu8_epi16(_mm_unpackhi_epi8(a, b)), w));
+    }
+
+    if (y < n) {
+      a  = _mm_loadu_si128((const __m128i *)p);
+      b  = _mm_setzero_si128();
+      w  = _mm256_set1_epi32(weight_pair(k[y], 0));
+      s0 = _mm256_add_epi32(s0, _mm256_madd_epi16(_mm256_cvtepu8_epi16(_mm_unpacklo_epi8(a, b)), w));
+      s1 = _mm256_add_epi32(s1, _mm256_madd_epi16(_mm256_cvtepu8_epi16(_mm_unpackhi_epi8(a, b)), w));
+    }
+
+    // s0 holds bytes 0-7 and s1 bytes 8-15, packing works per 128 bit
+    // lane so the 64 bit quarters are put back in order...
+    s0 = _mm256_srai_epi32(s0, PRECISION_BITS);
+    s1 = _mm256_srai_epi32(s1, PRECISION_BITS);
+    v  = _mm256_permute4x64_epi64(_mm256_packs_epi32(s0, s1), 0xd8);
+    v  = _mm256_permute4x64_epi64(_mm256_packus_epi16(v, v), 0x08);
+
+    _mm_storeu_si128((__m128i *)(o + i), _mm256_castsi256_si128(v));
+  }
+
+  return i;
+}
+#endif // USE_AVX2
+
+// Resizes the destination lines y0 to y1 - 1 vertically
+static void scale_columns(void *data, int y0, int y1) {
+  Fl_Scale_Job	*j = (Fl_Scale_Job *)data;
+  int		bytes = j->w * j->d, ks = j->c->ksize;
+  int		yy, y, i;
+
+  for (yy = y0; yy < y1; yy ++) {
+    const uchar	*s = j->src + j->c->bounds[yy * 2] * j->sld;
+    int		n = j->c->bounds[yy * 2 + 1];
+    const short	*k = j->c->weights + yy * ks;
+    uchar	*o = j->dst + yy * j->dld;
+
+    i = 0;
+
+#if USE_AVX2
+    if (have_avx2()) i = scale_column_avx2(s, j->sld, k, n, o, bytes);
+#endif // USE_AVX2
+
+#if USE_SSE2
+    // 8 bytes per step, the weights of two lines at once...
+    for (; i + 8 <= bytes; i += 8) {
+      const uchar	*p = s + i;
+      __m128i		zero = _mm_setzero_si128(),
+			s0 = _mm_set1_epi32(1 << (PRECISION_BITS - 1)),
+			s1 = s0, w, ab;
+
+      for (y = 0; y + 1 < n; y += 2, p += 2 * j->sld) {
+        ab = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)p),
+                               _mm_loadl_epi64((const __m128i *)(p + j->sld)));
+        w  = _mm_set1_epi32(weight_pair(k[y], k[y + 1]));
+        s0 = _mm_add_epi32(s0, _mm_madd_epi16(_mm_unpacklo_epi8(ab, zero), w));
+        s1 = _mm_add_epi32(s1, _mm_madd_epi16(_mm_unpackhi_epi8(ab, zero), w));
+      }
+
+      if (y < n) {
+        ab = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)p), zero);
+        w  = _mm_set1_epi32(weight_pair(k[y], 0));
+        s0 = _mm_add_epi32(s0, _mm_madd_epi16(_mm_unpacklo_epi8(ab, zero), w));
+        s1 = _mm_add_epi32(s1, _mm_madd_epi16(_mm_unpackhi_epi8(ab, zero), w));
+      }
+
+      s0 = _mm_packs_epi32(_mm_srai_epi32(s0, PRECISION_BITS),
+                           _mm_srai_epi32(s1, PRECISION_BITS));
+      _mm_storel_epi64((__m128i *)(o + i), _mm_packus_epi16(s0, s0));
+    }
+#endif // USE_SSE2
+
+    for (; i < bytes; i ++) {
+      const uchar	*p = s + i;
+      int		sum = 1 << (PRECISION_BITS - 1);
+
+      for (y = 0; y < n; y ++, p += j->sld) sum += *p * k[y];
+
+      o[i] = clip8(sum);
+    }
+  }
+}
+
+
+//
+// 'fl_scale_image()' - Resize image data with a filter.
+//
+// src has h lines of w pixels of d bytes, ld bytes apart; dst gets
+// H lines of W pixels without padding. Used by Fl_RGB_Image::copy().
+//
+
+void
+fl_scale_image(const uchar *src, int w, int h, int d, int ld,
+               uchar *dst, int W, int H, Fl_RGB_Scaling filter) {
+  Fl_Scale_Coeffs	c;		// Weights of a pass
+  Fl_Scale_Job		job;		// Work of a pass
+  uchar			*temp = 0;	// Lines resized horizontally
+
+#if USE_AVX2
+  have_avx2();				// Before the threads ask for it
+#endif // USE_AVX2
+
+  job.d = d;
+  job.c = &c;
+
+  if (W != w) {
+    compute_coeffs(c, w, W, filter);
+
+    job.src = src;
+    job.sld = ld;
+    job.dst = H != h ? (temp = new uchar[W * h * d]) : dst;
+    job.dld = W * d;
+    job.w   = W;
+
+    run_bands(scale_lines, &job, h, (double)W * h * d * c.ksize);
+
+    delete[] c.bounds;
+    delete[] c.weights;
+
+    src = job.dst;
+    ld  = W * d;
+  }
+
+  if (H != h) {
+    compute_coeffs(c, h, H, filter);
+
+    job.src = src;
+    job.sld = ld;
+    job.dst = dst;
+    job.dld = W * d;
+    job.w   = W;
+
+    run_bands(scale_columns, &job, H, (double)W * H * d * c.ksize);
+
+    delete[] c.bounds;
+    delete[] c.weights;
+  }
+
+  delete[] temp;
+}
+
+
+//
+// Color changes of whole images...
+//
+
+struct Fl_Average_Job {
+  const uchar	*src;			// Source lines
+  int		sld;			// Bytes from one source line to the next
+  uchar		*dst;			// Destination lines, may be src
+  int		dld;			// Bytes from one destination line to the next
+  int		bytes;			// Bytes per line
+  unsigned short mul[48], add[48];	// Factors for 48 bytes, any depth
+};
+
+static void average_lines(void *data, int y0, int y1) {
+  Fl_Average_Job	*j = (Fl_Average_Job *)data;
+  int			y, i;
+
+#if USE_SSE2
+  __m128i	zero = _mm_setzero_si128(),
+		mul[6], add[6];
+
+  for (i = 0; i < 6; i ++) {
+    mul[i] = _mm_loadu_si128((const __m128i *)(j->mul + i * 8));
+    add[i] = _mm_loadu_si128((const __m128i *)(j->add + i * 8));
+  }
+#endif // USE_SSE2
+
+  for (y = y0; y < y1; y ++) {
+    const uchar	*s = j->src + y * j->sld;
+    uchar	*o = j->dst + y * j->dld;
+
+    i = 0;
+
+#if USE_SSE2
+    for (; i + 48 <= j->bytes; i += 48)
+      for (int v = 0; v < 3; v ++) {
+        __m128i p  = _mm_loadu_si128((const __m128i *)(s + i + v * 16)),
+		lo = _mm_unpacklo_epi8(p, zero),
+		hi = _mm_unpackhi_epi8(p, zero);
+
+        lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(lo, mul[v * 2]), add[v * 2]), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(hi, mul[v * 2 + 1]), add[v * 2 + 1]), 8);
+
+        _mm_storeu_si128((__m128i *)(o + i + v * 16), _mm_packus_epi16(lo, hi));
+      }
+#endif // USE_SSE2
+
+    for (; i < j->bytes; i ++)
+      o[i] = (uchar)((s[i] * j->mul[i % 48] + j->add[i % 48]) >> 8);
+  }
+}
+
+//
+// 'fl_average_image()' - Blend image data with a color.
+//
+// Each byte of channel c becomes (value * mul[c] + add[c]) >> 8, which
+// must fit in 16 bits. dst may be src if dld is ld.
+//
+
+void
+fl_average_image(const uchar *src, int ld, uchar *dst, int dld,
+                 int w, int h, int d, const unsigned *mul,
+                 const unsigned *add) {
+  Fl_Average_Job	job;
+  int			i;
+
+  job.src   = src;
+  job.sld   = ld;
+  job.dst   = dst;
+  job.dld   = dld;
+  job.bytes = w * d;
+
+  for (i = 0; i < 48; i ++) {
+    job.mul[i] = (unsigned short)mul[i % d];
+    job.add[i] = (unsigned short)add[i % d];
+  }
+
+  run_bands(average_lines, &job, h, (double)w * h * d);
+}
+
+struct Fl_Desaturate_Job {
+  const uchar	*src;			// Source lines
+  int		sld;			// Bytes from one source line to the next
+  uchar		*dst;			// Destination lines
+  int		dld;			// Bytes from one destination line to the next
+  int		w;			// Pixels per line
+  int		d;			// Source bytes per pixel, 3 or 4
+};
+
+static void desaturate_lines(void *data, int y0, int y1) {
+  Fl_Desaturate_Job	*j = (Fl_Desaturate_Job *)data;
+  int			y, x;
+
+  for (y = y0; y < y1; y ++) {
+    const uchar	*s = j->src + y * j->sld;
+    uchar	*o = j->dst + y * j->dld;
+
+    x = 0;
+
+#if USE_SSE2
+    if (j->d == 4) {
+      // 4 pixels per step, x / 100 is (x * 41944) >> 22 for x <= 25500
+      __m128i	byte = _mm_set1_epi32(0xff),
+		div = _mm_set1_epi16((short)41944),
+		r, g, b, a, p;
+
+      for (; x + 4 <= j->w; x += 4) {
+        p = _mm_loadu_si128((const __m128i *)(s + x * 4));
+        r = _mm_and_si128(p, byte);
+        g = _mm_and_si128(_mm_srli_epi32(p, 8), byte);
+        b = _mm_and_si128(_mm_srli_epi32(p, 16), byte);
+        a = _mm_srli_epi32(p, 24);
+
+        p = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi32(31)),
+                                        _mm_mullo_epi16(g, _mm_set1_epi32(61))),
+                          _mm_mullo_epi16(b, _mm_set1_epi32(8)));
+        p = _mm_srli_epi16(_mm_mulhi_epu16(p, div), 6);
+        p = _mm_or_si128(p, _mm_slli_epi32(a, 8));
+
+        // Keep the low 16 bits of each pixel...
+        p = _mm_shufflelo_epi16(p, _MM_SHUFFLE(3, 3, 2, 0));
+        p = _mm_shufflehi_epi16(p, _MM_SHUFFLE(3, 3, 2, 0));
+        p = _mm_shuffle_epi32(p, _MM_SHUFFLE(3, 3, 2, 0));
+
+        _mm_storel_epi64((__m128i *)(o + x * 2), p);
+      }
+    }
+#endif // USE_SSE2
+
+    if (j->d == 3) {
+      // Same x / 100 trick, with a constant pixel size
+      for (s += x * 3, o += x; x < j->w; x ++, s += 3)
+        *o++ = (uchar)(((31 * s[0] + 61 * s[1] + 8 * s[2]) * 41944) >> 22);
+      continue;
+    }
+
+    for (o += x * (j->d - 2); x < j->w; x ++) {
+      const uchar *p = s + x * j->d;
+
+      *o++ = (uchar)((31 * p[0] + 61 * p[1] + 8 * p[2]) / 100);
+      if (j->d > 3) *o++ = p[3];
+    }
+  }
+}
+
+//
+// 'fl_desaturate_image()' - Convert RGB(A) image data to gray(+alpha).
+//
+
+void
+fl_desaturate_image(const uchar *src, int ld, uchar *dst, int dld,
+                    int w, int h, int d) {
+  Fl_Desaturate_Job	job;
+
+  job.src = src;
+  job.sld = ld;
+  job.dst = dst;
+  job.dld = dld;
+  job.w   = w;
+  job.d   = d;
+
+  run_bands(desaturate_lines, &job, h, (double)w * h * d);
+}
+
+
+//
+// End of "$Id$".
+//
@@ -560,21 +560,22 @@ int fl_open(const char* f, int oflags, ...)
 FILE *fl_fopen(const char* f, const char *mode)
 {
 #if  defined (WIN32) && !defined(__CYGWIN__)
+		// image files are also opened by the loader threads of
+		// Fl_Shared_Image::get_async(), so the names are not
+		// converted in the shared buffers
 		int l = strlen(f);
-//		wbuf = (xchar*)realloc(wbuf, sizeof(xchar) * (l+1));
-//		wbuf[fl_utf2unicode((const unsigned char*)f, l, wbuf)] = 0;
 		unsigned wn = fl_utf8toUtf16(f, l, NULL, 0) + 1; // Query length
-		wbuf = (xchar*)realloc(wbuf, sizeof(xchar)*wn);
-		wn = fl_utf8toUtf16(f, l, (unsigned short *)wbuf, wn); // Convert string
-		wbuf[wn] = 0;
+		xchar *fbuf = (xchar*)malloc(sizeof(xchar)*wn);
+		if (!fbuf) return NULL;
+		wn = fl_utf8toUtf16(f, l, (unsigned short *)fbuf, wn); // Convert string
+		fbuf[wn] = 0;
+		xchar mbuf[16];
 		l = strlen(mode);
-//		wbuf1 = (xchar*)realloc(wbuf1, sizeof(xchar) * (l+1));
-//		wbuf1[fl_utf2unicode((const unsigned char*)mode, l, wbuf1)] = 0;
-		wn = fl_utf8toUtf16(mode, l, NULL, 0) + 1; // Query length
-		wbuf1 = (xchar*)realloc(wbuf1, sizeof(xchar)*wn);
-		wn = fl_utf8toUtf16(mode, l, (unsigned short *)wbuf1, wn); // Convert string
-		wbuf1[wn] = 0;
-		return _wfopen(wbuf, wbuf1);
+		wn = fl_utf8toUtf16(mode, l, (unsigned short *)mbuf, 15); // Convert string
+		mbuf[wn < 15 ? wn : 15] = 0;
+		FILE *fp = _wfopen(fbuf, mbuf);
+		free(fbuf);
+		return fp;
 #else
 	return fopen(f, mode);
 #endif
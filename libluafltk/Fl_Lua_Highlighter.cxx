@@ -0,0 +1,164 @@
+#include "Fl_Lua_Highlighter.h"
+#include <stdlib.h>
+#include <string.h>
+
+static char *dup_str(const char *s)
+{
+	if (!s) return NULL;
+	size_t n = strlen(s) + 1;
+	char *d = (char*) malloc(n);
+	if (d) memcpy(d, s, n);
+	return d;
+}
+
+Fl_Lua_Highlighter::Fl_Lua_Highlighter()
+{
+	vL = NULL;
+	vfind = LUA_NOREF;
+	vrules = NULL;
+	vcount = 0;
+}
+
+Fl_Lua_Highlighter::~Fl_Lua_Highlighter()
+{
+	detach();
+	clear_rules();
+}
+
+void Fl_Lua_Highlighter::clear_rules()
+{
+	for (int i = 0; i < vcount; i++) {
+		free(vrules[i].open);
+		free(vrules[i].close);
+	}
+	free(vrules);
+	vrules = NULL;
+	vcount = 0;
+	if (vL && vfind != LUA_NOREF) luaL_unref(vL, LUA_REGISTRYINDEX, vfind);
+	vfind = LUA_NOREF;
+}
+
+int Fl_Lua_Highlighter::rules(lua_State *L, int tbl)
+{
+	clear_rules();
+	if (!lua_istable(L, tbl)) { restyle(); return 0; }
+	int n = lua_objlen(L, tbl);
+	vrules = (Rule*) calloc(n ? n : 1, sizeof(Rule));
+	if (!vrules) return 0;
+	for (int i = 1; i <= n; i++) {
+		lua_rawgeti(L, tbl, i);
+		if (lua_istable(L, -1)) {
+			int k = lua_objlen(L, -1);
+			Rule *r = &vrules[vcount];
+			lua_rawgeti(L, -1, 1);
+			r->open = dup_str(lua_tostring(L, -1));
+			lua_pop(L, 1);
+			if (k >= 3) {
+				lua_rawgeti(L, -1, 2);
+				r->close = dup_str(lua_tostring(L, -1));
+				lua_pop(L, 1);
+			}
+			lua_rawgeti(L, -1, k >= 3 ? 3 : 2);
+			int style = (int) lua_tointeger(L, -1);
+			lua_pop(L, 1);
+			r->style = (char) ('A' + (style > 0 && style < 64 ? style - 1 : 0));
+			if (r->open && *r->open && (k < 3 || r->close)) vcount++;
+			else { free(r->open); free(r->close); r->open = r->close = NULL; }
+		}
+		lua_pop(L, 1);
+	}
+	vL = L;
+	lua_getglobal(L, "string");
+	lua_getfield(L, -1, "find");
+	vfind = luaL_ref(L, LUA_REGISTRYINDEX);
+	lua_pop(L, 1);
+	restyle();
+	return vcount;
+}
+
+/* a rule whose pattern raised an error stays in place, so that the
+ * states of the lines already styled keep pointing at the same rules */
+void Fl_Lua_Highlighter::drop_rule(Rule *r)
+{
+	free(r->open);
+	free(r->close);
+	r->open = r->close = NULL;
+	r->next = -1;
+}
+
+/* string.find(line, pat, from + 1) on the line at the top of the stack:
+ * the 0-based start of the match and its end in *end, -1 if none or on
+ * an error */
+int Fl_Lua_Highlighter::find(const char *pat, int from, int *end)
+{
+	lua_rawgeti(vL, LUA_REGISTRYINDEX, vfind);
+	lua_pushvalue(vL, -2);
+	lua_pushstring(vL, pat);
+	lua_pushinteger(vL, from + 1);
+	if (lua_pcall(vL, 3, 2, 0)) {
+		lua_pop(vL, 1);
+		*end = -2;
+		return -1;
+	}
+	int s = -1;
+	if (!lua_isnil(vL, -2)) {
+		s = (int) lua_tointeger(vL, -2) - 1;
+		*end = (int) lua_tointeger(vL, -1);
+	}
+	lua_pop(vL, 2);
+	return s;
+}
+
+int Fl_Lua_Highlighter::style_line(const char *text, int len, char *style, int state)
+{
+	memset(style, 'A', len);
+	if (!vL || !vcount) return 0;
+	if (state > vcount) state = 0;
+
+	/* styles past those given to attach are drawn with the first one */
+	char last = (char) ('A' + styles() - 1);
+	lua_pushlstring(vL, text, len);
+	int pos = 0, e;
+	if (state) {
+		/* inside a block rule: look for its end */
+		Rule *r = &vrules[state - 1];
+		int s = -1;
+		e = len;
+		if (r->open) s = find(r->close, 0, &e);
+		if (e == -2) drop_rule(r);
+		if (!r->open) e = 0;	/* dropped, the block ends here */
+		if (s >= 0 || !r->open) state = 0;
+		memset(style, r->style <= last ? r->style : 'A', e);
+		pos = e;
+	}
+	for (int i = 0; i < vcount; i++)
+		vrules[i].next = vrules[i].open ? -2 : -1;
+	while (!state && pos < len) {
+		Rule *best = NULL;
+		for (int i = 0; i < vcount; i++) {
+			Rule *r = &vrules[i];
+			if (r->next == -1) continue;
+			if (r->next < pos) {
+				r->next = find(r->open, pos, &r->next_end);
+				if (r->next_end == -2) {	/* bad pattern */
+					drop_rule(r);
+					continue;
+				}
+			}
+			if (r->next >= 0 && (!best || r->next < best->next)) best = r;
+		}
+		if (!best) break;
+		int s = best->next;
+		e = best->next_end;
+		if (best->close) {
+			int c = find(best->close, e, &e);
+			if (e == -2) { drop_rule(best); continue; }	/* bad pattern */
+			if (c < 0) { e = len; state = (int) (best - vrules) + 1; }
+		}
+		if (e > len) e = len;
+		memset(style + s, best->style <= last ? best->style : 'A', e - s);
+		pos = e > s ? e : s + 1;
+	}
+	lua_pop(vL, 1);
+	return state;
+}
@@ -0,0 +1,47 @@
+#ifndef Fl_Lua_Highlighter_H
+#define Fl_Lua_Highlighter_H
+
+#include <FL/Fl_Text_Highlighter.H>
+#include <tolua++.h>
+
+/*
+ * Fl_Text_Highlighter driven by a table of Lua patterns. Each rule is
+ *   { pattern, style }             text matching pattern gets style
+ *   { open, close, style }         from open to close, across lines
+ * where style is the 1-based index of the style given to attach, styles
+ * past those are drawn with style 1.
+ * At each point of a line the earliest match wins, the first rule on a
+ * tie. Text matching no rule gets style 1.
+ *
+ * The rules are read once by rules(), lines are matched with
+ * string.find from the lua_State they were given in. A rule whose
+ * pattern raises an error is dropped, its place in the list is kept.
+ */
+class Fl_Lua_Highlighter : public Fl_Text_Highlighter
+{
+public:
+	Fl_Lua_Highlighter();
+	~Fl_Lua_Highlighter();
+
+	int rules(lua_State *L, int tbl);	/* returns the number of rules */
+	int style_line(const char *text, int len, char *style, int state);
+
+private:
+	struct Rule {
+		char *open;				/* NULL once the rule is dropped */
+		char *close;			/* NULL for one line rules */
+		char style;
+		int next, next_end;		/* next match in the line, -1 if none */
+	};
+
+	void clear_rules();
+	void drop_rule(Rule *r);
+	int find(const char *pat, int from, int *end);
+
+	lua_State *vL;
+	int vfind;					/* registry ref of string.find */
+	Rule *vrules;
+	int vcount;
+};
+
+#endif
@@ -0,0 +1,297 @@
+#include "Flv_Sqlite_Data_Source.h"
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+static char *dup_str(const char *s)
+{
+	if (!s) return NULL;
+	size_t n = strlen(s) + 1;
+	char *d = (char*) malloc(n);
+	if (d) memcpy(d, s, n);
+	return d;
+}
+
+/* column type from the declared type, -1 when there is none */
+static int decl_type(const char *decl)
+{
+	char up[32];
+	int i;
+	if (!decl) return -1;
+	for (i = 0; decl[i] && i < (int)sizeof(up) - 1; i++)
+		up[i] = (char) toupper((unsigned char) decl[i]);
+	up[i] = 0;
+	if (strstr(up, "INT")) return FLV_DS_INT;
+	if (strstr(up, "REAL") || strstr(up, "FLOA") || strstr(up, "DOUB") || strstr(up, "NUM"))
+		return FLV_DS_DOUBLE;
+	return FLV_DS_STRING;
+}
+
+Flv_Sqlite_Data_Source::Flv_Sqlite_Data_Source(sqlite3_stmt *stmt, const char *sql,
+	int page_rows, int max_pages)
+{
+	vstmt = NULL;
+	vsql = NULL;
+	verror = NULL;
+	vcols = 0;
+	vnames = NULL;
+	vtypes = NULL;
+	vrows = -1;
+	vcursor = 0;
+	vpage_rows = page_rows > 0 ? page_rows : 64;
+	vmax_pages = max_pages > 2 ? max_pages : 2;	/* the last two pages must both stay */
+	vclock = 0;
+	vpages = (Page*) calloc(vmax_pages, sizeof(Page));
+	if (!vpages) { set_error("out of memory"); return; }
+	for (int p = 0; p < vmax_pages; p++) vpages[p].first = -1;
+
+	if (!stmt) { set_error("no statement"); return; }
+	if (!sql) sql = sqlite3_sql(stmt);
+	if (!sql) { set_error("no sql text"); return; }
+	vsql = dup_str(sql);
+
+	sqlite3 *db = sqlite3_db_handle(stmt);
+	if (sqlite3_prepare_v2(db, sql, -1, &vstmt, NULL) != SQLITE_OK) {
+		set_error(sqlite3_errmsg(db));
+		vstmt = NULL;
+		return;
+	}
+	if (!vstmt) { set_error("empty statement"); return; }
+	if (sqlite3_bind_parameter_count(vstmt))
+		sqlite3_transfer_bindings(stmt, vstmt);
+
+	vcols = sqlite3_column_count(vstmt);
+	vnames = (char**) calloc(vcols ? vcols : 1, sizeof(char*));
+	vtypes = (int*) malloc((vcols ? vcols : 1) * sizeof(int));
+	if (!vnames || !vtypes) { set_error("out of memory"); vcols = 0; return; }
+	for (int c = 0; c < vcols; c++) {
+		vnames[c] = dup_str(sqlite3_column_name(vstmt, c));
+		vtypes[c] = decl_type(sqlite3_column_decltype(vstmt, c));
+	}
+}
+
+Flv_Sqlite_Data_Source::~Flv_Sqlite_Data_Source()
+{
+	clear_pages();
+	free(vpages);
+	if (vstmt) sqlite3_finalize(vstmt);
+	for (int c = 0; c < vcols; c++) free(vnames[c]);
+	free(vnames);
+	free(vtypes);
+	free(vsql);
+	free(verror);
+}
+
+void Flv_Sqlite_Data_Source::set_error(const char *msg)
+{
+	free(verror);
+	verror = dup_str(msg ? msg : "sqlite error");
+}
+
+void Flv_Sqlite_Data_Source::free_page(Page *pg)
+{
+	free(pg->num);
+	free(pg->text);
+	free(pg->pool);
+	memset(pg, 0, sizeof(Page));
+	pg->first = -1;
+}
+
+void Flv_Sqlite_Data_Source::clear_pages()
+{
+	if (!vpages) return;
+	for (int p = 0; p < vmax_pages; p++) free_page(&vpages[p]);
+}
+
+int Flv_Sqlite_Data_Source::cached_pages() const
+{
+	int n = 0;
+	for (int p = 0; p < vmax_pages; p++)
+		if (vpages[p].first >= 0) n++;
+	return n;
+}
+
+/* a step did not return a row: the end of the result, or an error */
+void Flv_Sqlite_Data_Source::step_done(int rc)
+{
+	if (rc == SQLITE_DONE) {
+		if (vrows < 0) vrows = vcursor;
+	} else {
+		set_error(sqlite3_errmsg(sqlite3_db_handle(vstmt)));
+	}
+	vcursor = -1;
+}
+
+/* position vstmt so the next step returns data row R */
+bool Flv_Sqlite_Data_Source::seek(int R)
+{
+	if (vcursor < 0 || vcursor > R) {
+		sqlite3_reset(vstmt);
+		vcursor = 0;
+	}
+	while (vcursor < R) {
+		int rc = sqlite3_step(vstmt);
+		if (rc != SQLITE_ROW) { step_done(rc); return false; }
+		vcursor++;
+	}
+	return true;
+}
+
+bool Flv_Sqlite_Data_Source::pool_add(Page *pg, int cell, const char *s, int len)
+{
+	if (pg->pool_used + len + 1 > pg->pool_size) {
+		int n = pg->pool_size ? pg->pool_size : 256;
+		while (n < pg->pool_used + len + 1) n *= 2;
+		char *p = (char*) realloc(pg->pool, n);
+		if (!p) return false;
+		pg->pool = p;
+		pg->pool_size = n;
+	}
+	memcpy(pg->pool + pg->pool_used, s, len);
+	pg->pool[pg->pool_used + len] = 0;
+	pg->text[cell] = pg->pool_used;
+	pg->pool_used += len + 1;
+	return true;
+}
+
+/* load the page starting at data row 'first' in the least recently used slot */
+Flv_Sqlite_Data_Source::Page *Flv_Sqlite_Data_Source::load_page(int first)
+{
+	Page *pg = &vpages[0];
+	for (int p = 1; p < vmax_pages && pg->first >= 0; p++)
+		if (vpages[p].first < 0 || vpages[p].used < pg->used) pg = &vpages[p];
+	free_page(pg);
+
+	int ncells = vpage_rows * (vcols ? vcols : 1);
+	pg->num = (double*) malloc(ncells * sizeof(double));
+	pg->text = (int*) malloc(ncells * sizeof(int));
+	if (!pg->num || !pg->text) { free_page(pg); return NULL; }
+	pg->first = first;
+	pg->used = ++vclock;
+
+	if (!seek(first)) return pg;
+	while (pg->count < vpage_rows) {
+		int rc = sqlite3_step(vstmt);
+		if (rc != SQLITE_ROW) { step_done(rc); break; }
+		vcursor++;
+		int cell = pg->count * vcols;
+		for (int c = 0; c < vcols; c++, cell++) {
+			int t = sqlite3_column_type(vstmt, c);
+			if (vtypes[c] < 0 && t != SQLITE_NULL)
+				vtypes[c] = t == SQLITE_INTEGER ? FLV_DS_INT :
+					(t == SQLITE_FLOAT ? FLV_DS_DOUBLE : FLV_DS_STRING);
+			if (t == SQLITE_NULL) {
+				pg->num[cell] = 0;
+				pg->text[cell] = -1;
+				continue;
+			}
+			pg->num[cell] = sqlite3_column_double(vstmt, c);
+			const char *s = (const char*) sqlite3_column_text(vstmt, c);
+			if (!pool_add(pg, cell, s ? s : "", sqlite3_column_bytes(vstmt, c)))
+				pg->text[cell] = -1;
+		}
+		pg->count++;
+	}
+	return pg;
+}
+
+Flv_Sqlite_Data_Source::Page *Flv_Sqlite_Data_Source::find_page(int R)
+{
+	if (!vstmt || R < 0) return NULL;
+	int first = R - R % vpage_rows;
+	for (int p = 0; p < vmax_pages; p++) {
+		if (vpages[p].first == first) {
+			vpages[p].used = ++vclock;
+			return &vpages[p];
+		}
+	}
+	if (vrows >= 0 && first >= vrows) return NULL;
+	return load_page(first);
+}
+
+/* count with a wrapping query, or by stepping through the result */
+void Flv_Sqlite_Data_Source::count_rows()
+{
+	if (!vstmt) { vrows = 0; return; }
+	sqlite3_reset(vstmt);
+	vcursor = 0;
+
+	size_t n = strlen(vsql);
+	while (n && (isspace((unsigned char) vsql[n-1]) || vsql[n-1] == ';')) n--;
+	char *sql = (char*) malloc(n + 40);
+	if (sql) {
+		sqlite3_stmt *cnt = NULL;
+		strcpy(sql, "SELECT count(*) FROM (");
+		strncat(sql, vsql, n);
+		strcat(sql, ")");
+		if (sqlite3_prepare_v2(sqlite3_db_handle(vstmt), sql, -1, &cnt, NULL) == SQLITE_OK && cnt &&
+			sqlite3_bind_parameter_count(cnt) == sqlite3_bind_parameter_count(vstmt)) {
+			if (sqlite3_bind_parameter_count(cnt)) sqlite3_transfer_bindings(vstmt, cnt);
+			if (sqlite3_step(cnt) == SQLITE_ROW) vrows = sqlite3_column_int(cnt, 0);
+			sqlite3_reset(cnt);
+			if (sqlite3_bind_parameter_count(cnt)) sqlite3_transfer_bindings(cnt, vstmt);
+		}
+		if (cnt) sqlite3_finalize(cnt);
+		free(sql);
+	}
+	if (vrows < 0) {
+		/* not a plain select: step through it */
+		seek(0x7fffffff);
+		if (vrows < 0) vrows = 0;
+	}
+}
+
+int Flv_Sqlite_Data_Source::data_rows()
+{
+	if (vrows < 0) count_rows();
+	return vrows;
+}
+
+const char *Flv_Sqlite_Data_Source::data_string(int R, int C, char *, int)
+{
+	if (C < 0 || C >= vcols) return NULL;
+	Page *pg = find_page(R);
+	if (!pg || R - pg->first >= pg->count) return NULL;
+	int off = pg->text[(R - pg->first) * vcols + C];
+	return off < 0 ? "" : pg->pool + off;
+}
+
+double Flv_Sqlite_Data_Source::data_number(int R, int C)
+{
+	if (C < 0 || C >= vcols) return 0;
+	Page *pg = find_page(R);
+	if (!pg || R - pg->first >= pg->count) return 0;
+	return pg->num[(R - pg->first) * vcols + C];
+}
+
+int Flv_Sqlite_Data_Source::data_type(int C)
+{
+	if (C < 0 || C >= vcols) return FLV_DS_STRING;
+	if (vtypes[C] < 0) find_page(0);
+	return vtypes[C] < 0 ? FLV_DS_STRING : vtypes[C];
+}
+
+const char *Flv_Sqlite_Data_Source::data_name(int C)
+{
+	return (C >= 0 && C < vcols) ? vnames[C] : NULL;
+}
+
+void Flv_Sqlite_Data_Source::data_changed()
+{
+	clear_pages();
+	vrows = -1;
+	vcursor = -1;
+	Flv_Data_Source::data_changed();
+}
+
+/* load the pages for rows R..R+n-1 and one page ahead, in order, so a
+ * forward scroll keeps stepping the statement without resetting it */
+void Flv_Sqlite_Data_Source::prefetch(int R, int n)
+{
+	if (vrow_map || !vstmt || n <= 0) return;
+	int first = R - R % vpage_rows;
+	int last = R + n + vpage_rows;
+	if (vrows >= 0 && last > vrows) last = vrows;
+	for (int p = 0; first < last && p < vmax_pages - 1; p++, first += vpage_rows)
+		find_page(first);
+}
@@ -0,0 +1,78 @@
+#ifndef Flv_Sqlite_Data_Source_H
+#define Flv_Sqlite_Data_Source_H
+
+#include <FL/Flv_Data_Source.H>
+#include "sqlite3.h"
+
+/*
+ * Flv_Table data source reading the rows of a sqlite query on demand.
+ * Rows are fetched one page at a time, pages are kept in a bounded LRU
+ * cache, so memory use does not depend on the size of the result.
+ * The total row count is computed the first time it is asked for.
+ *
+ * The source prepares its own copy of the statement and takes over the
+ * parameter bindings of the statement it is created from. It must be
+ * deleted before the database is closed.
+ *
+ * Strings returned by data_string stay valid until another page is
+ * loaded, i.e. at least until the next call.
+ */
+class Flv_Sqlite_Data_Source : public Flv_Data_Source
+{
+public:
+	Flv_Sqlite_Data_Source(sqlite3_stmt *stmt, const char *sql = 0,
+		int page_rows = 64, int max_pages = 32);
+	~Flv_Sqlite_Data_Source();
+
+	const char *error() const { return verror; }
+
+	int data_rows();
+	int data_cols() { return vcols; }
+	const char *data_string(int R, int C, char *buf, int len);
+	double data_number(int R, int C);
+	int data_type(int C);
+	const char *data_name(int C);
+
+	void data_changed();		/* run the query again */
+	void prefetch(int R, int n);
+
+	int page_rows() const { return vpage_rows; }
+	int max_pages() const { return vmax_pages; }
+	int cached_pages() const;
+
+private:
+	struct Page {
+		int first;				/* first data row, -1 when free */
+		int count;				/* rows in page */
+		unsigned long used;		/* LRU clock */
+		double *num;			/* count*vcols numeric values */
+		int *text;				/* offsets in pool, -1 for NULL */
+		char *pool;
+		int pool_used, pool_size;
+	};
+
+	Page *find_page(int R);
+	Page *load_page(int first);
+	bool pool_add(Page *pg, int cell, const char *s, int len);
+	void free_page(Page *pg);
+	void clear_pages();
+	bool seek(int R);
+	void step_done(int rc);
+	void count_rows();
+	void set_error(const char *msg);
+
+	sqlite3_stmt *vstmt;
+	char *vsql;
+	char *verror;
+	int vcols;
+	char **vnames;
+	int *vtypes;			/* FLV_DS_*, -1 until the first row is seen */
+	int vrows;				/* -1 until counted */
+	int vcursor;			/* next row vstmt returns, -1 when it must be reset */
+	int vpage_rows;
+	int vmax_pages;
+	Page *vpages;
+	unsigned long vclock;
+};
+
+#endif
@@ -22,129 +22,109 @@ void Fl_End(){
 	Fl_Group::current()->end();
 }
 
-int lua_set_cptr_luafunction(lua_State * __S__, char *key, int luaFunctionIndex) {
-	lua_pushstring(__S__, key); /* push the registry key */
-	lua_pushvalue(__S__, luaFunctionIndex);   /* push lua function index*/
-	/* registry[&ptr] = luaFunctionIndex */
-    lua_settable(__S__, LUA_REGISTRYINDEX);
-    return 0;
-}
-
-int lua_delete_cptr_luafunction(lua_State * __S__, char *key) {
-	lua_pushstring(__S__, key); /* push the registry key */
-	lua_pushnil(__S__);   /* push nil to delete the data */
-	lua_settable(__S__, LUA_REGISTRYINDEX);
-    return 0;
-}
+/*
+ * Lua functions bound to a widget live in a table per widget, kept in
+ * registry[fltk_widget_bindings_ref] under the widget pointer (light userdata).
+ * Each kind of binding has a fixed integer slot, so dispatching an event
+ * does not create any lua string. The entry is dropped when the widget
+ * is destroyed.
+ */
+enum {
+	WIDGET_BINDING_CALLBACK = 1,
+	WIDGET_BINDING_CALLBACK_DATA,
+	WIDGET_BINDING_LINK,
+	WIDGET_BINDING_USER_HANDLER,
+	WIDGET_BINDING_DATA,		/* keeps alive what the widget shows */
+	WIDGET_BINDING_SLOTS = WIDGET_BINDING_DATA
+};
 
-int lua_get_cptr_luafunction(lua_State * __S__, char *key) {
-	lua_pushstring(__S__, key); /* push the registry key */
-	//get the entry for this object pointer
-	lua_gettable(__S__, LUA_REGISTRYINDEX);  /* retrieve value */
+static int fltk_widget_bindings_ref = LUA_NOREF;
 
-	if (!lua_isfunction(__S__, -1)) {
-		return -1;
-	}
-  return 0;
-}
-
-static void lua_fltk_widget_callback(Fl_Widget * w, void *data)
+static void lua_fltk_widget_destroyed(Fl_Widget *w)
 {
-  CALLBACK_PTRSTR(w);
   lua_State* L = (lua_State*)Fl::user_data;
-  int savedTop = lua_gettop(L);
-  lua_checkstack(L, 20);
-  if(lua_get_cptr_luafunction(L, my_ptr_str) == 0) {
-    tolua_pushusertype(L, w, w->classId());
-    if(data) lua_rawgeti(L, LUA_REGISTRYINDEX, (int)data);
-    else lua_pushnil(L);
-	lua_call(L, 2, 0);
-  }
-  lua_settop(L, savedTop);
-}
-
-void set_fltk_widget_callback(Fl_Widget *w, lua_State* L, lua_Function luaFunc,
-		lua_Object data){
-	int ref_data;
-	CALLBACK_PTRSTR(w);
-	lua_set_cptr_luafunction(L, my_ptr_str, luaFunc);
-	int old_data = (int)w->user_data();
-	if(old_data) luaL_unref(L, LUA_REGISTRYINDEX, old_data);
-	if(lua_isnil(L, data)) ref_data = 0;
-	else ref_data = luaL_ref(L, LUA_REGISTRYINDEX);
-	w->callback(&lua_fltk_widget_callback, (void*)ref_data);
+  if(!L) return;
+  lua_rawgeti(L, LUA_REGISTRYINDEX, fltk_widget_bindings_ref);
+  lua_pushlightuserdata(L, w);
+  lua_pushnil(L);
+  lua_rawset(L, -3);
+  lua_pop(L, 1);
 }
 
-/*
-static void lua_fltk_widget_callback(Fl_Widget * w)
+/* push the bindings table of w, returns 0 and pushes nothing if there is none */
+static int lua_push_widget_bindings(lua_State* L, Fl_Widget *w, int create)
 {
-  CALLBACK_PTRSTR(w);
-  lua_State* L = (lua_State*)Fl::user_data;
-  int savedTop = lua_gettop(L);
-  lua_checkstack(L, 20);
-  if(lua_get_cptr_luafunction(L, my_ptr_str) == 0) {
-    tolua_pushusertype(L, w, w->classId());
-	lua_call(L, 1, 0);
+  if(fltk_widget_bindings_ref == LUA_NOREF) {
+	if(!create) return 0;
+	lua_newtable(L);
+	fltk_widget_bindings_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+	Fl::add_widget_destroy_handler(&lua_fltk_widget_destroyed);
   }
-  lua_settop(L, savedTop);
+  lua_rawgeti(L, LUA_REGISTRYINDEX, fltk_widget_bindings_ref);
+  lua_pushlightuserdata(L, w);
+  lua_rawget(L, -2);
+  if(!lua_istable(L, -1)) {
+	lua_pop(L, 1);
+	if(!create) {
+		lua_pop(L, 1);
+		return 0;
+	}
+	lua_createtable(L, WIDGET_BINDING_SLOTS, 0);
+	lua_pushlightuserdata(L, w);
+	lua_pushvalue(L, -2);
+	lua_rawset(L, -4);
+  }
+  lua_remove(L, -2);
+  return 1;
 }
 
-void set_fltk_widget_callback(Fl_Widget *w, lua_State* L, lua_Function luaFunc)
+/* bindings[slot] = value at stack index 'lo', nil if lo is 0 (argument not given) */
+static void lua_set_widget_binding(lua_State* L, Fl_Widget *w, int slot, int lo)
 {
-	CALLBACK_PTRSTR(w);
-	lua_set_cptr_luafunction(L, my_ptr_str, luaFunc);
-	w->callback(&lua_fltk_widget_callback);
+  lua_push_widget_bindings(L, w, 1);
+  if(lo) lua_pushvalue(L, lo);
+  else lua_pushnil(L);
+  lua_rawseti(L, -2, slot);
+  lua_pop(L, 1);
 }
 
-static void lua_fltk_widget_callback2wl(Fl_Widget * w, long ln)
+/* push the function bound to w in slot, returns 0 and pushes nothing if there is none */
+static int lua_push_widget_binding(lua_State* L, Fl_Widget *w, int slot)
 {
-  CALLBACK_PTRSTR(w);
-  lua_State* L = (lua_State*)Fl::user_data;
-  int savedTop = lua_gettop(L);
-  lua_checkstack(L, 20);
-  if(lua_get_cptr_luafunction(L, my_ptr_str) == 0) {
-    tolua_pushusertype(L, w, w->classId());
-    tolua_pushnumber(L, ln);
-	lua_call(L, 2, 0);
+  if(!lua_push_widget_bindings(L, w, 0)) return 0;
+  lua_rawgeti(L, -1, slot);
+  if(!lua_isfunction(L, -1)) {
+	lua_pop(L, 2);
+	return 0;
   }
-  lua_settop(L, savedTop);
-}
-
-void set_fltk_widget_callback2wl(Fl_Widget *w, lua_State* L, lua_Function luaFunc, long num)
-{
-	CALLBACK_PTRSTR(w);
-	lua_set_cptr_luafunction(L, my_ptr_str, luaFunc);
-	w->callback(&lua_fltk_widget_callback2wl, num);
+  return 1; /* stack: bindings function */
 }
 
-static void lua_fltk_widget_callback2ww(Fl_Widget * w, void *p)
+static void lua_fltk_widget_callback(Fl_Widget * w, void *data)
 {
-  CALLBACK_PTRSTR(w);
   lua_State* L = (lua_State*)Fl::user_data;
   int savedTop = lua_gettop(L);
   lua_checkstack(L, 20);
-  if(lua_get_cptr_luafunction(L, my_ptr_str) == 0) {
+  if(lua_push_widget_binding(L, w, WIDGET_BINDING_CALLBACK)) {
     tolua_pushusertype(L, w, w->classId());
-    tolua_pushusertype(L, p, ((Fl_Widget *)p)->classId());
+    lua_rawgeti(L, -3, WIDGET_BINDING_CALLBACK_DATA);
 	lua_call(L, 2, 0);
   }
   lua_settop(L, savedTop);
 }
 
-void set_fltk_widget_callback2ww(Fl_Widget *w, lua_State* L, lua_Function luaFunc, Fl_Widget *w2)
-{
-	CALLBACK_PTRSTR(w);
-	lua_set_cptr_luafunction(L, my_ptr_str, luaFunc);
-	w->callback(&lua_fltk_widget_callback2ww, w2);
+void set_fltk_widget_callback(Fl_Widget *w, lua_State* L, lua_Function luaFunc,
+		lua_Object data){
+	lua_set_widget_binding(L, w, WIDGET_BINDING_CALLBACK, luaFunc);
+	lua_set_widget_binding(L, w, WIDGET_BINDING_CALLBACK_DATA, data);
+	w->callback(&lua_fltk_widget_callback);
 }
-*/
 
 static const char* lua_fltk_help_view_link(Fl_Widget * w, const char *href)
 {
-  LINK_PTRSTR(w);
   lua_State* L = (lua_State*)Fl::user_data;
   int savedTop = lua_gettop(L);
-  if(lua_get_cptr_luafunction(L, my_ptr_str) == 0) {
+  if(lua_push_widget_binding(L, w, WIDGET_BINDING_LINK)) {
     tolua_pushusertype(L, w, w->classId());
 	lua_pushstring(L, href);
 	lua_call(L, 2, 1);
@@ -158,29 +138,27 @@ static const char* lua_fltk_help_view_link(Fl_Widget * w, const char *href)
 
 void set_fltk_help_view_link(Fl_Help_View *w, lua_State* L, lua_Function luaFunc)
 {
-	LINK_PTRSTR(w);
-	lua_set_cptr_luafunction(L, my_ptr_str, luaFunc);
+	lua_set_widget_binding(L, w, WIDGET_BINDING_LINK, luaFunc);
 	w->link(&lua_fltk_help_view_link);
 }
 
 static int lua_fltk_widget_user_handle(Fl_Widget *w, int event)
 {
-  LINK_PTRSTR(w);
   lua_State* L = (lua_State*)Fl::user_data;
   int savedTop = lua_gettop(L);
-  if(lua_get_cptr_luafunction(L, my_ptr_str) == 0) {
+  int result = 0;
+  if(lua_push_widget_binding(L, w, WIDGET_BINDING_USER_HANDLER)) {
     tolua_pushusertype(L, w, w->classId());
 	lua_pushnumber(L, event);
 	lua_call(L, 2, 1);
-	return lua_tointeger(L, -1);
+	result = lua_tointeger(L, -1);
   }
   lua_settop(L, savedTop);
-  return 0;
+  return result;
 }
 
 void set_fltk_fl_widget_user_handler(Fl_Group *w,lua_State* L, lua_Function luaFunc){
-	LINK_PTRSTR(w);
-	lua_set_cptr_luafunction(L, my_ptr_str, luaFunc);
+	lua_set_widget_binding(L, w, WIDGET_BINDING_USER_HANDLER, luaFunc);
 	w->user_handler(&lua_fltk_widget_user_handle);
 }
 
@@ -484,27 +462,25 @@ void fltk_fl_remove_focus_changing_handler(lua_State* L)
 	}
 }
 
-void fltk_Fl_Browser_set_column_widths(Fl_Browser* brw, lua_State* L, lua_Object tbl)
+/* zero terminated copy of a lua array of widths, NULL if tbl is not a table */
+static int *lua_fltk_column_widths(lua_State* L, lua_Object tbl)
 {
-  if(lua_istable(L, tbl)) {
-	int arr_size = lua_objlen(L, tbl);
-	int* arr_old = brw->column_widths_owned();
-  	int *arr = (int*) malloc((arr_size+1)*sizeof(int));
-	int i;
-	for(i=0; i<arr_size;i++){
-	  lua_pushnumber(L, i+1);
-	  lua_gettable(L, tbl);
-	  arr[i] = lua_tointeger(L,-1);
-	}
-	arr[i] = 0;
-  	brw->column_widths_owned(arr);
-  	if(arr_old) free(arr_old);
- }
+  if(!lua_istable(L, tbl)) return NULL;
+  int arr_size = lua_objlen(L, tbl);
+  int *arr = (int*) malloc((arr_size+1)*sizeof(int));
+  int i;
+  for(i=0; i<arr_size;i++){
+	lua_pushnumber(L, i+1);
+	lua_gettable(L, tbl);
+	arr[i] = lua_tointeger(L,-1);
+	lua_pop(L, 1);
+  }
+  arr[i] = 0;
+  return arr;
 }
 
-lua_Object fltk_Fl_Browser_get_column_widths(Fl_Browser* brw, lua_State* L)
+static void lua_fltk_push_column_widths(lua_State* L, const int* arr)
 {
-  	const int* arr = brw->column_widths();
 	int i;
 	lua_newtable(L);
 	for(i=1; *arr; i++, arr++){
@@ -512,9 +488,344 @@ lua_Object fltk_Fl_Browser_get_column_widths(Fl_Browser* brw, lua_State* L)
 	  lua_pushnumber(L, *arr);
 	  lua_settable(L, -3);
 	}
+}
+
+void fltk_Fl_Browser_set_column_widths(Fl_Browser* brw, lua_State* L, lua_Object tbl)
+{
+  int *arr = lua_fltk_column_widths(L, tbl);
+  if(arr) {
+	int* arr_old = brw->column_widths_owned();
+  	brw->column_widths_owned(arr);
+  	if(arr_old) free(arr_old);
+  }
+}
+
+lua_Object fltk_Fl_Browser_get_column_widths(Fl_Browser* brw, lua_State* L)
+{
+	lua_fltk_push_column_widths(L, brw->column_widths());
  	return -1;
 }
 
+/* add the strings of a lua array as lines at once, numbers are converted
+ * and anything else makes a blank line. Returns the number of lines added */
+int fltk_Fl_Browser_add_lines(Fl_Browser* brw, lua_State* L, lua_Object tbl)
+{
+	if(!lua_istable(L, tbl)) return 0;
+	int n = lua_objlen(L, tbl);
+	if(n <= 0) return 0;
+	const char **txt = (const char**) malloc(n*sizeof(char*));
+	if(!txt) return 0;
+	lua_newtable(L);	/* keeps the converted numbers alive */
+	int conv = lua_gettop(L), nconv = 0;
+	for(int i=0; i<n; i++){
+		lua_rawgeti(L, tbl, i+1);
+		if(lua_type(L, -1) == LUA_TNUMBER){
+			lua_tostring(L, -1);
+			lua_pushvalue(L, -1);
+			lua_rawseti(L, conv, ++nconv);
+		}
+		/* strings stay alive in tbl */
+		txt[i] = lua_isstring(L, -1) ? lua_tostring(L, -1) : NULL;
+		lua_pop(L, 1);
+	}
+	brw->add_lines(txt, n);
+	lua_pop(L, 1);
+	free(txt);
+	return n;
+}
+
+void fltk_Fl_Virtual_Browser_set_column_widths(Fl_Virtual_Browser* brw, lua_State* L, lua_Object tbl)
+{
+  int *arr = lua_fltk_column_widths(L, tbl);
+  if(arr) {
+	int* arr_old = brw->column_widths_owned();
+	brw->column_widths_owned(arr);
+	if(arr_old) free(arr_old);
+  }
+}
+
+lua_Object fltk_Fl_Virtual_Browser_get_column_widths(Fl_Virtual_Browser* brw, lua_State* L)
+{
+	lua_fltk_push_column_widths(L, brw->column_widths());
+	return -1;
+}
+
+/* show the lines of a lua string; the browser indexes the string in place,
+ * so it is kept with the widget until replaced or the widget is destroyed */
+void fltk_Fl_Virtual_Browser_lines(Fl_Virtual_Browser* brw, lua_State* L, lua_Object str)
+{
+	size_t len = 0;
+	const char *s = lua_type(L, str) == LUA_TSTRING ? lua_tolstring(L, str, &len) : NULL;
+	lua_set_widget_binding(L, brw, WIDGET_BINDING_DATA, s ? str : 0);
+	brw->lines(s, (int)len);
+}
+
+/* show column col of a data source, negative for all columns; the source
+ * is kept with the widget so lua does not collect it while it is shown */
+void fltk_Fl_Virtual_Browser_data_source(Fl_Virtual_Browser* brw, lua_State* L, lua_Object ds, int col)
+{
+	tolua_Error err;
+	Flv_Data_Source *src = NULL;
+	if(tolua_isusertype(L, ds, "Flv_Data_Source", 0, &err))
+		src = (Flv_Data_Source*) tolua_tousertype(L, ds, 0);
+	else if(!lua_isnil(L, ds))
+		luaL_typerror(L, ds, "Flv_Data_Source");
+	lua_set_widget_binding(L, brw, WIDGET_BINDING_DATA, src ? ds : 0);
+	brw->data_source(src, col);
+}
+
+/*
+ * Display list commands from a flat lua array: each Fl_Draw_List_Op is
+ * followed by its numbers, except that the text commands take the string
+ * itself in place of its pool offset and length:
+ *   FL_DL_TEXT, x, y, "text"   FL_DL_TEXT_BOX, x, y, w, h, align, "text"
+ * The whole array is checked first, a malformed one appends nothing and
+ * returns -1. Runs of numeric commands are appended in one block.
+ */
+static int draw_list_numbers(const char *kind, int i, int n)
+{
+	for(; n > 0; i++, n--)
+		if(kind[i] != LUA_TNUMBER) return 0;
+	return 1;
+}
+
+static int draw_list_walk(Fl_Draw_List* dl, lua_State* L, lua_Object tbl,
+		const int *v, const char *kind, int n)
+{
+	int count = 0, start = 0, i = 0, k;
+	while(i < n){
+		if(kind[i] != LUA_TNUMBER) return -1;
+		if(v[i] == FL_DL_TEXT || v[i] == FL_DL_TEXT_BOX){
+			int nargs = v[i] == FL_DL_TEXT ? 2 : 5;
+			if(i + nargs + 1 >= n || !draw_list_numbers(kind, i + 1, nargs)) return -1;
+			if(kind[i + nargs + 1] != LUA_TSTRING && kind[i + nargs + 1] != LUA_TNUMBER) return -1;
+			if(dl){
+				if(start < i){
+					k = dl->append(v + start, i - start);
+					if(k < 0) return -1;
+					count += k;
+				}
+				lua_rawgeti(L, tbl, i + nargs + 2);
+				const char *s = lua_tostring(L, -1);
+				if(nargs == 2) dl->text(s, v[i+1], v[i+2]);
+				else dl->text(s, v[i+1], v[i+2], v[i+3], v[i+4], (Fl_Align) v[i+5]);
+				lua_pop(L, 1);
+			}
+			count++;
+			i += nargs + 2;
+			start = i;
+			continue;
+		}
+		k = Fl_Draw_List::command_size(v + i, n - i);
+		if(k < 0 || !draw_list_numbers(kind, i + 1, k - 1)) return -1;
+		i += k;
+	}
+	if(dl && start < n){
+		k = dl->append(v + start, n - start);
+		if(k < 0) return -1;
+		count += k;
+	}
+	return count;
+}
+
+int fltk_Fl_Draw_List_append(Fl_Draw_List* dl, lua_State* L, lua_Object tbl)
+{
+	if(!lua_istable(L, tbl)) return -1;
+	int n = lua_objlen(L, tbl);
+	int *v = (int*) malloc((n ? n : 1) * (sizeof(int) + 1));
+	if(!v) return -1;
+	char *kind = (char*) (v + (n ? n : 1));
+	for(int i=0; i<n; i++){
+		lua_rawgeti(L, tbl, i+1);
+		kind[i] = (char) lua_type(L, -1);
+		v[i] = kind[i] == LUA_TNUMBER ? (int) lua_tointeger(L, -1) : 0;
+		lua_pop(L, 1);
+	}
+	int count = draw_list_walk(NULL, L, tbl, v, kind, n);
+	if(count >= 0) count = draw_list_walk(dl, L, tbl, v, kind, n);
+	free(v);
+	return count;
+}
+
+/* polygon or closed outline from a flat lua array {x1,y1, x2,y2, ...} */
+int fltk_Fl_Draw_List_polygon(Fl_Draw_List* dl, lua_State* L, lua_Object tbl, int filled)
+{
+	if(!lua_istable(L, tbl)) return 0;
+	int n = lua_objlen(L, tbl) / 2;
+	int *xy = (int*) malloc((n ? n : 1) * 2 * sizeof(int));
+	if(!xy) return 0;
+	for(int i=0; i<2*n; i++){
+		lua_rawgeti(L, tbl, i+1);
+		xy[i] = (int) lua_tointeger(L, -1);
+		lua_pop(L, 1);
+	}
+	if(filled) dl->polygon(xy, n);
+	else dl->loop(xy, n);
+	free(xy);
+	return n;
+}
+
+/* positions of all the matches between startPos and endPos, in one table */
+lua_Object fltk_Fl_Text_Buffer_search_all(Fl_Text_Buffer* buf, lua_State* L, int startPos, int endPos,
+		const char* searchString, int matchCase)
+{
+	int n = 0;
+	int *found = buf->search_all(startPos, endPos, searchString, &n, matchCase);
+	lua_createtable(L, n, 0);
+	for(int i=0; i<n; i++){
+		lua_pushinteger(L, found[i]);
+		lua_rawseti(L, -2, i+1);
+	}
+	free(found);
+	return -1;
+}
+
+/*
+ * Lua pattern matches between startPos and endPos, as a flat table
+ * {start1, end1, start2, end2, ...} of buffer positions, ends excluded.
+ */
+lua_Object fltk_Fl_Text_Buffer_search_pattern(Fl_Text_Buffer* buf, lua_State* L, int startPos, int endPos,
+		const char* pattern)
+{
+	if(startPos < 0) startPos = 0;
+	if(endPos > buf->length()) endPos = buf->length();
+	if(endPos < startPos) endPos = startPos;
+	char *text = buf->text_range(startPos, endPos);
+	lua_createtable(L, 0, 0);
+	int res = lua_gettop(L);
+	lua_pushlstring(L, text, endPos - startPos);
+	free(text);
+	int str = lua_gettop(L);
+	lua_getglobal(L, "string");
+	lua_getfield(L, -1, "find");
+	int find = lua_gettop(L);
+	int n = 0;
+	for(int init = 1; init <= endPos - startPos + 1; ){
+		lua_pushvalue(L, find);
+		lua_pushvalue(L, str);
+		lua_pushstring(L, pattern);
+		lua_pushinteger(L, init);
+		lua_call(L, 3, 2);
+		if(lua_isnil(L, -2)) { lua_pop(L, 2); break; }
+		int s = (int) lua_tointeger(L, -2), e = (int) lua_tointeger(L, -1);
+		lua_pop(L, 2);
+		lua_pushinteger(L, startPos + s - 1);
+		lua_rawseti(L, res, ++n);
+		lua_pushinteger(L, startPos + e);
+		lua_rawseti(L, res, ++n);
+		init = e >= s ? e + 1 : s + 1;
+	}
+	lua_settop(L, res);
+	return -1;
+}
+
+/* styles from a lua array of {color, font, size} tables */
+void fltk_Fl_Text_Highlighter_attach(Fl_Text_Highlighter* h, lua_State* L, Fl_Text_Display* d, lua_Object tbl)
+{
+	if(!lua_istable(L, tbl)) { h->detach(); return; }
+	int n = lua_objlen(L, tbl);
+	if(n <= 0) { h->detach(); return; }
+	Fl_Text_Display::Style_Table_Entry *st = new Fl_Text_Display::Style_Table_Entry[n];
+	for(int i=0; i<n; i++){
+		lua_rawgeti(L, tbl, i+1);
+		int v[3] = { FL_FOREGROUND_COLOR, d->textfont(), d->textsize() };
+		if(lua_istable(L, -1)){
+			for(int k=0; k<3; k++){
+				lua_rawgeti(L, -1, k+1);
+				if(lua_isnumber(L, -1)) v[k] = (int) lua_tointeger(L, -1);
+				lua_pop(L, 1);
+			}
+		}
+		lua_pop(L, 1);
+		st[i].color = (Fl_Color) v[0];
+		st[i].font = (Fl_Font) v[1];
+		st[i].size = v[2];
+		st[i].attr = 0;
+	}
+	h->attach(d, st, n);
+	delete[] st;
+}
+
+const char* flvw_Flv_Data_Source_as_string(Flv_Data_Source* ds, int R, int C)
+{
+	static char buf[64];
+	if (R<0 || R>=ds->rows() || C<0 || C>=ds->cols()) return NULL;
+	return ds->as_string(R, C, buf, sizeof(buf));
+}
+
+/* copy a lua array of numbers into a malloc'ed int array, NULL if not a table */
+static int *lua_int_array(lua_State* L, lua_Object tbl, int *n)
+{
+	if(!lua_istable(L, tbl)) return NULL;
+	*n = lua_objlen(L, tbl);
+	int *arr = (int*) malloc((*n+1)*sizeof(int));
+	if(!arr) return NULL;
+	for(int i=0; i<*n; i++){
+		lua_rawgeti(L, tbl, i+1);
+		arr[i] = lua_tointeger(L, -1);
+		lua_pop(L, 1);
+	}
+	return arr;
+}
+
+int flvw_Flv_Data_Source_row_map(Flv_Data_Source* ds, lua_State* L, lua_Object tbl)
+{
+	int n;
+	int *arr = lua_int_array(L, tbl, &n);
+	if(!arr) return ds->rows();
+	n = ds->row_map(arr, n);
+	free(arr);
+	return n;
+}
+
+int flvw_Flv_Data_Source_col_map(Flv_Data_Source* ds, lua_State* L, lua_Object tbl)
+{
+	int n;
+	int *arr = lua_int_array(L, tbl, &n);
+	if(!arr) return ds->cols();
+	n = ds->col_map(arr, n);
+	free(arr);
+	return n;
+}
+
+/* load a lua array into column C starting at data row R, growing the rows */
+int flvw_Flv_Array_Data_Source_set_column(Flv_Array_Data_Source* ds, lua_State* L, int C, lua_Object tbl, int R)
+{
+	if(!lua_istable(L, tbl) || C<0 || C>=ds->data_cols() || R<0) return 0;
+	int n = lua_objlen(L, tbl);
+	if(R+n > ds->data_rows() && ds->data_rows(R+n) != R+n) return 0;
+	int is_str = ds->data_type(C) == FLV_DS_STRING;
+	for(int i=0; i<n; i++){
+		lua_rawgeti(L, tbl, i+1);
+		if(lua_type(L, -1) == LUA_TNUMBER && !is_str)
+			ds->set_double(R+i, C, lua_tonumber(L, -1));
+		else
+			ds->set_string(R+i, C, lua_tostring(L, -1));
+		lua_pop(L, 1);
+	}
+	return n;
+}
+
+/* from lsqlite3.c */
+extern "C" {
+LUALIB_API sqlite3_stmt *lsqlite_tostmt(lua_State *L, int index, const char **sql);
+}
+
+lua_Object flvw_Flv_Sqlite_Data_Source_new(lua_State* L, lua_Object vm, int page_rows, int max_pages)
+{
+	const char *sql;
+	sqlite3_stmt *stmt = lsqlite_tostmt(L, vm, &sql);
+	if(!stmt) luaL_argerror(L, vm, "attempt to use closed sqlite virtual machine");
+	Flv_Sqlite_Data_Source *ds = new Flv_Sqlite_Data_Source(stmt, sql, page_rows, max_pages);
+	if(ds->error()){
+		lua_pushstring(L, ds->error());
+		delete ds;
+		lua_error(L);
+	}
+	tolua_pushusertype_and_takeownership(L, ds, "Flv_Sqlite_Data_Source");
+	return lua_gettop(L);
+}
+
 void fltk_Fl_Window_load_icon(Fl_Window* win, char *id){
 #ifdef WIN32
   void *icon = (void *)LoadIcon(fl_display, id);
@@ -117,6 +117,8 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S);
 #include <FL/Fl_Text_Buffer.H>
 #include <FL/Fl_Text_Display.H>
 #include <FL/Fl_Text_Editor.H>
+#include <FL/Fl_Text_Highlighter.H>
+#include "Fl_Lua_Highlighter.h"
 #include <FL/Fl_Tile.H>
 #include <FL/Fl_Tiled_Image.H>
 #include <FL/Fl_Toggle_Button.H>
@@ -131,6 +133,7 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S);
 #include <FL/Fl_Value_Input.H>
 #include <FL/Fl_Value_Output.H>
 #include <FL/Fl_Value_Slider.H>
+#include <FL/Fl_Virtual_Browser.H>
 #include <FL/Fl_Widget.H>
 #include <FL/Fl_Window.H>
 #include <FL/Fl_Wizard.H>
@@ -140,6 +143,7 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S);
 #include <FL/filename.H>
 #include <FL/fl_ask.H>
 #include <FL/fl_draw.H>
+#include <FL/Fl_Draw_List.H>
 #include <FL/fl_message.H>
 #include <FL/fl_show_colormap.H>
 #include <FL/fl_show_input.H>
@@ -163,6 +167,8 @@ typedef int lua_Function;
 #include <FL/Flv_List.H>
 #include <FL/Flv_Table.H>
 #include <FL/Flv_CStyle.H>
+#include <FL/Flv_Data_Source.H>
+#include "Flv_Sqlite_Data_Source.h"
 #include <FL/Flve_Input.H>
 #include <FL/Flve_Check_Button.H>
 
@@ -222,6 +228,13 @@ static int tolua_collect_Fl_Round_Clock (lua_State* tolua_S)
  return 0;
 }
 
+static int tolua_collect_Fl_Virtual_Browser (lua_State* tolua_S)
+{
+ Fl_Virtual_Browser* self = (Fl_Virtual_Browser*) tolua_tousertype(tolua_S,1,0);
+ Mtolua_delete(self);
+ return 0;
+}
+
 static int tolua_collect_Fl_Image (lua_State* tolua_S)
 {
  Fl_Image* self = (Fl_Image*) tolua_tousertype(tolua_S,1,0);
@@ -236,9 +249,9 @@ static int tolua_collect_Flv_CStyle (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Round_Button (lua_State* tolua_S)
+static int tolua_collect_Fl_RGB_Image (lua_State* tolua_S)
 {
- Fl_Round_Button* self = (Fl_Round_Button*) tolua_tousertype(tolua_S,1,0);
+ Fl_RGB_Image* self = (Fl_RGB_Image*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -278,6 +291,13 @@ static int tolua_collect_Fl_Text_Editor (lua_State* tolua_S)
  return 0;
 }
 
+static int tolua_collect_Flve_Input (lua_State* tolua_S)
+{
+ Flve_Input* self = (Flve_Input*) tolua_tousertype(tolua_S,1,0);
+ Mtolua_delete(self);
+ return 0;
+}
+
 static int tolua_collect_Fl_Value_Slider (lua_State* tolua_S)
 {
  Fl_Value_Slider* self = (Fl_Value_Slider*) tolua_tousertype(tolua_S,1,0);
@@ -299,44 +319,44 @@ static int tolua_collect_Fl_Input (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Flve_Input (lua_State* tolua_S)
+static int tolua_collect_Flve_Check_Button (lua_State* tolua_S)
 {
- Flve_Input* self = (Flve_Input*) tolua_tousertype(tolua_S,1,0);
+ Flve_Check_Button* self = (Flve_Check_Button*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
 
-static int tolua_collect_Fl_Preferences (lua_State* tolua_S)
+static int tolua_collect_Flv_Table (lua_State* tolua_S)
 {
- Fl_Preferences* self = (Fl_Preferences*) tolua_tousertype(tolua_S,1,0);
+ Flv_Table* self = (Flv_Table*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
 
-static int tolua_collect_Flve_Check_Button (lua_State* tolua_S)
+static int tolua_collect_Fl_Check_Browser (lua_State* tolua_S)
 {
- Flve_Check_Button* self = (Flve_Check_Button*) tolua_tousertype(tolua_S,1,0);
+ Fl_Check_Browser* self = (Fl_Check_Browser*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
 
-static int tolua_collect_Fl_Sys_Menu_Bar (lua_State* tolua_S)
+static int tolua_collect_Flv_Sqlite_Data_Source (lua_State* tolua_S)
 {
- Fl_Sys_Menu_Bar* self = (Fl_Sys_Menu_Bar*) tolua_tousertype(tolua_S,1,0);
+ Flv_Sqlite_Data_Source* self = (Flv_Sqlite_Data_Source*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
 
-static int tolua_collect_Flv_Table (lua_State* tolua_S)
+static int tolua_collect_Fl_Fill_Dial (lua_State* tolua_S)
 {
- Flv_Table* self = (Flv_Table*) tolua_tousertype(tolua_S,1,0);
+ Fl_Fill_Dial* self = (Fl_Fill_Dial*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
 
-static int tolua_collect_Fl_File_Chooser (lua_State* tolua_S)
+static int tolua_collect_Fl_Choice (lua_State* tolua_S)
 {
- Fl_File_Chooser* self = (Fl_File_Chooser*) tolua_tousertype(tolua_S,1,0);
+ Fl_Choice* self = (Fl_Choice*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -348,16 +368,44 @@ static int tolua_collect_Flv_Style (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Table (lua_State* tolua_S)
+static int tolua_collect_Fl_Sys_Menu_Bar (lua_State* tolua_S)
 {
- Fl_Table* self = (Fl_Table*) tolua_tousertype(tolua_S,1,0);
+ Fl_Sys_Menu_Bar* self = (Fl_Sys_Menu_Bar*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
 
-static int tolua_collect_Fl_Nice_Slider (lua_State* tolua_S)
+static int tolua_collect_Flv_Style_List (lua_State* tolua_S)
 {
- Fl_Nice_Slider* self = (Fl_Nice_Slider*) tolua_tousertype(tolua_S,1,0);
+ Flv_Style_List* self = (Flv_Style_List*) tolua_tousertype(tolua_S,1,0);
+ Mtolua_delete(self);
+ return 0;
+}
+
+static int tolua_collect_Fl_Chart (lua_State* tolua_S)
+{
+ Fl_Chart* self = (Fl_Chart*) tolua_tousertype(tolua_S,1,0);
+ Mtolua_delete(self);
+ return 0;
+}
+
+static int tolua_collect_Flv_Array_Data_Source (lua_State* tolua_S)
+{
+ Flv_Array_Data_Source* self = (Flv_Array_Data_Source*) tolua_tousertype(tolua_S,1,0);
+ Mtolua_delete(self);
+ return 0;
+}
+
+static int tolua_collect_Fl_Counter (lua_State* tolua_S)
+{
+ Fl_Counter* self = (Fl_Counter*) tolua_tousertype(tolua_S,1,0);
+ Mtolua_delete(self);
+ return 0;
+}
+
+static int tolua_collect_Fl_Window (lua_State* tolua_S)
+{
+ Fl_Window* self = (Fl_Window*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -383,9 +431,9 @@ static int tolua_collect_Fl_Check_Button (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Window (lua_State* tolua_S)
+static int tolua_collect_Fl_Nice_Slider (lua_State* tolua_S)
 {
- Fl_Window* self = (Fl_Window*) tolua_tousertype(tolua_S,1,0);
+ Fl_Nice_Slider* self = (Fl_Nice_Slider*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -425,9 +473,9 @@ static int tolua_collect_Fl_File_Input (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Flcc_ValueBox (lua_State* tolua_S)
+static int tolua_collect_Fl_Menu_Window (lua_State* tolua_S)
 {
- Flcc_ValueBox* self = (Flcc_ValueBox*) tolua_tousertype(tolua_S,1,0);
+ Fl_Menu_Window* self = (Fl_Menu_Window*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -474,16 +522,16 @@ static int tolua_collect_Fl_Region (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Menu_Window (lua_State* tolua_S)
+static int tolua_collect_Fl_Hor_Value_Slider (lua_State* tolua_S)
 {
- Fl_Menu_Window* self = (Fl_Menu_Window*) tolua_tousertype(tolua_S,1,0);
+ Fl_Hor_Value_Slider* self = (Fl_Hor_Value_Slider*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
 
-static int tolua_collect_Fl_Fill_Dial (lua_State* tolua_S)
+static int tolua_collect_Fl_Hor_Nice_Slider (lua_State* tolua_S)
 {
- Fl_Fill_Dial* self = (Fl_Fill_Dial*) tolua_tousertype(tolua_S,1,0);
+ Fl_Hor_Nice_Slider* self = (Fl_Hor_Nice_Slider*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -502,9 +550,9 @@ static int tolua_collect_Fl_Select_Browser (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Hor_Value_Slider (lua_State* tolua_S)
+static int tolua_collect_Fl_Hor_Slider (lua_State* tolua_S)
 {
- Fl_Hor_Value_Slider* self = (Fl_Hor_Value_Slider*) tolua_tousertype(tolua_S,1,0);
+ Fl_Hor_Slider* self = (Fl_Hor_Slider*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -523,9 +571,9 @@ static int tolua_collect_Fl_Multiline_Output (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Hor_Nice_Slider (lua_State* tolua_S)
+static int tolua_collect_Fl_Hor_Fill_Slider (lua_State* tolua_S)
 {
- Fl_Hor_Nice_Slider* self = (Fl_Hor_Nice_Slider*) tolua_tousertype(tolua_S,1,0);
+ Fl_Hor_Fill_Slider* self = (Fl_Hor_Fill_Slider*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -537,9 +585,9 @@ static int tolua_collect_Fl_Clock (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Hor_Slider (lua_State* tolua_S)
+static int tolua_collect_Fl_Slider (lua_State* tolua_S)
 {
- Fl_Hor_Slider* self = (Fl_Hor_Slider*) tolua_tousertype(tolua_S,1,0);
+ Fl_Slider* self = (Fl_Slider*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -579,9 +627,9 @@ static int tolua_collect_Fl_Progress (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Hor_Fill_Slider (lua_State* tolua_S)
+static int tolua_collect_Fl_Widget_Tracker (lua_State* tolua_S)
 {
- Fl_Hor_Fill_Slider* self = (Fl_Hor_Fill_Slider*) tolua_tousertype(tolua_S,1,0);
+ Fl_Widget_Tracker* self = (Fl_Widget_Tracker*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -600,16 +648,16 @@ static int tolua_collect_Fl_Dial (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Slider (lua_State* tolua_S)
+static int tolua_collect_Flcc_Value_Input (lua_State* tolua_S)
 {
- Fl_Slider* self = (Fl_Slider*) tolua_tousertype(tolua_S,1,0);
+ Flcc_Value_Input* self = (Flcc_Value_Input*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
 
-static int tolua_collect_Fl_Widget_Tracker (lua_State* tolua_S)
+static int tolua_collect_Flcc_ValueBox (lua_State* tolua_S)
 {
- Fl_Widget_Tracker* self = (Fl_Widget_Tracker*) tolua_tousertype(tolua_S,1,0);
+ Flcc_ValueBox* self = (Flcc_ValueBox*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -642,9 +690,9 @@ static int tolua_collect_Fl_Int_Input (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Flcc_Value_Input (lua_State* tolua_S)
+static int tolua_collect_Fl_Round_Button (lua_State* tolua_S)
 {
- Flcc_Value_Input* self = (Flcc_Value_Input*) tolua_tousertype(tolua_S,1,0);
+ Fl_Round_Button* self = (Fl_Round_Button*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -656,9 +704,9 @@ static int tolua_collect_Fl_PNG_Image (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Check_Browser (lua_State* tolua_S)
+static int tolua_collect_Fl_Wizard (lua_State* tolua_S)
 {
- Fl_Check_Browser* self = (Fl_Check_Browser*) tolua_tousertype(tolua_S,1,0);
+ Fl_Wizard* self = (Fl_Wizard*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -705,9 +753,9 @@ static int tolua_collect_Fl_PSfile_Device (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Wizard (lua_State* tolua_S)
+static int tolua_collect_Fl_Text_Buffer (lua_State* tolua_S)
 {
- Fl_Wizard* self = (Fl_Wizard*) tolua_tousertype(tolua_S,1,0);
+ Fl_Text_Buffer* self = (Fl_Text_Buffer*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -719,30 +767,30 @@ static int tolua_collect_Fl_XBM_Image (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_RGB_Image (lua_State* tolua_S)
+static int tolua_collect_Fl_Adjuster (lua_State* tolua_S)
 {
- Fl_RGB_Image* self = (Fl_RGB_Image*) tolua_tousertype(tolua_S,1,0);
+ Fl_Adjuster* self = (Fl_Adjuster*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
 
-static int tolua_collect_Fl_Counter (lua_State* tolua_S)
+static int tolua_collect_Fl_Tree_Prefs (lua_State* tolua_S)
 {
- Fl_Counter* self = (Fl_Counter*) tolua_tousertype(tolua_S,1,0);
+ Fl_Tree_Prefs* self = (Fl_Tree_Prefs*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
 
-static int tolua_collect_Fl_Adjuster (lua_State* tolua_S)
+static int tolua_collect_Fl_Tree_Item_Array (lua_State* tolua_S)
 {
- Fl_Adjuster* self = (Fl_Adjuster*) tolua_tousertype(tolua_S,1,0);
+ Fl_Tree_Item_Array* self = (Fl_Tree_Item_Array*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
 
-static int tolua_collect_Fl_Tree_Prefs (lua_State* tolua_S)
+static int tolua_collect_Fl_Tree (lua_State* tolua_S)
 {
- Fl_Tree_Prefs* self = (Fl_Tree_Prefs*) tolua_tousertype(tolua_S,1,0);
+ Fl_Tree* self = (Fl_Tree*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -768,9 +816,9 @@ static int tolua_collect_Fl_Scroll (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Tree_Item_Array (lua_State* tolua_S)
+static int tolua_collect_Fl_Toggle_Button (lua_State* tolua_S)
 {
- Fl_Tree_Item_Array* self = (Fl_Tree_Item_Array*) tolua_tousertype(tolua_S,1,0);
+ Fl_Toggle_Button* self = (Fl_Toggle_Button*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -782,16 +830,16 @@ static int tolua_collect_Fl_Multi_Browser (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Tree (lua_State* tolua_S)
+static int tolua_collect_Fl_Tile (lua_State* tolua_S)
 {
- Fl_Tree* self = (Fl_Tree*) tolua_tousertype(tolua_S,1,0);
+ Fl_Tile* self = (Fl_Tile*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
 
-static int tolua_collect_Fl_Toggle_Button (lua_State* tolua_S)
+static int tolua_collect_Fl_Table (lua_State* tolua_S)
 {
- Fl_Toggle_Button* self = (Fl_Toggle_Button*) tolua_tousertype(tolua_S,1,0);
+ Fl_Table* self = (Fl_Table*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -803,9 +851,9 @@ static int tolua_collect_Fl_Color_Chooser (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Printer (lua_State* tolua_S)
+static int tolua_collect_Fl_Text_Highlighter (lua_State* tolua_S)
 {
- Fl_Printer* self = (Fl_Printer*) tolua_tousertype(tolua_S,1,0);
+ Fl_Text_Highlighter* self = (Fl_Text_Highlighter*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -817,23 +865,23 @@ static int tolua_collect_Fl_Float_Input (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Tile (lua_State* tolua_S)
+static int tolua_collect_Fl_Printer (lua_State* tolua_S)
 {
- Fl_Tile* self = (Fl_Tile*) tolua_tousertype(tolua_S,1,0);
+ Fl_Printer* self = (Fl_Printer*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
 
-static int tolua_collect_Fl_Chart (lua_State* tolua_S)
+static int tolua_collect_Fl_Draw_List (lua_State* tolua_S)
 {
- Fl_Chart* self = (Fl_Chart*) tolua_tousertype(tolua_S,1,0);
+ Fl_Draw_List* self = (Fl_Draw_List*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
 
-static int tolua_collect_Fl_Light_Button (lua_State* tolua_S)
+static int tolua_collect_Fl_Preferences (lua_State* tolua_S)
 {
- Fl_Light_Button* self = (Fl_Light_Button*) tolua_tousertype(tolua_S,1,0);
+ Fl_Preferences* self = (Fl_Preferences*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -852,9 +900,9 @@ static int tolua_collect_Fl_Value_Output (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Text_Buffer (lua_State* tolua_S)
+static int tolua_collect_Fl_Light_Button (lua_State* tolua_S)
 {
- Fl_Text_Buffer* self = (Fl_Text_Buffer*) tolua_tousertype(tolua_S,1,0);
+ Fl_Light_Button* self = (Fl_Light_Button*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -880,9 +928,9 @@ static int tolua_collect_Fl_File_Browser (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Flv_Style_List (lua_State* tolua_S)
+static int tolua_collect_Fl_Lua_Highlighter (lua_State* tolua_S)
 {
- Flv_Style_List* self = (Flv_Style_List*) tolua_tousertype(tolua_S,1,0);
+ Fl_Lua_Highlighter* self = (Fl_Lua_Highlighter*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -908,9 +956,9 @@ static int tolua_collect_Flv_List (lua_State* tolua_S)
  return 0;
 }
 
-static int tolua_collect_Fl_Choice (lua_State* tolua_S)
+static int tolua_collect_Fl_File_Chooser (lua_State* tolua_S)
 {
- Fl_Choice* self = (Fl_Choice*) tolua_tousertype(tolua_S,1,0);
+ Fl_File_Chooser* self = (Fl_File_Chooser*) tolua_tousertype(tolua_S,1,0);
  Mtolua_delete(self);
  return 0;
 }
@@ -922,9 +970,10 @@ static void tolua_reg_types (lua_State* tolua_S)
 {
  tolua_usertype(tolua_S,"Fl_Roller");
  tolua_usertype(tolua_S,"Fl_Line_Dial");
- tolua_usertype(tolua_S,"Fl_Hor_Value_Slider");
+ tolua_usertype(tolua_S,"Lua__Fl_Virtual_Browser");
  tolua_usertype(tolua_S,"Lua__Fl_File_Input");
  tolua_usertype(tolua_S,"Lua__Fl_Light_Button");
+ tolua_usertype(tolua_S,"Fl_Virtual_Browser");
  tolua_usertype(tolua_S,"Fl_Menu_Item");
  tolua_usertype(tolua_S,"Fl_RGB_Image");
  tolua_usertype(tolua_S,"Fl_JPEG_Image");
@@ -940,6 +989,7 @@ static void tolua_reg_types (lua_State* tolua_S)
  tolua_usertype(tolua_S,"Fl_Preferences");
  tolua_usertype(tolua_S,"Fl_Table");
  tolua_usertype(tolua_S,"Fl_Text_Predelete_Cb");
+ tolua_usertype(tolua_S,"Flv_Array_Data_Source");
  tolua_usertype(tolua_S,"Fl_Idle_Handler");
  tolua_usertype(tolua_S,"Fl_Scrollbar");
  tolua_usertype(tolua_S,"Flcc_HueBox");
@@ -959,7 +1009,7 @@ static void tolua_reg_types (lua_State* tolua_S)
  tolua_usertype(tolua_S,"Fl_Clock");
  tolua_usertype(tolua_S,"Lua__Fl_Counter");
  tolua_usertype(tolua_S,"Fl_Menu_Bar");
- tolua_usertype(tolua_S,"Fl_Hor_Slider");
+ tolua_usertype(tolua_S,"Fl_Text_Highlighter");
  tolua_usertype(tolua_S,"Fl_GIF_Image");
  tolua_usertype(tolua_S,"Flcc_Value_Input");
  tolua_usertype(tolua_S,"Fl_Light_Button");
@@ -967,7 +1017,7 @@ static void tolua_reg_types (lua_State* tolua_S)
  tolua_usertype(tolua_S,"Fl_Box");
  tolua_usertype(tolua_S,"Lua__Fl_RGB_Image");
  tolua_usertype(tolua_S,"Lua__Fl_Pixmap");
- tolua_usertype(tolua_S,"Fl_Input_");
+ tolua_usertype(tolua_S,"Fl_Hold_Browser");
  tolua_usertype(tolua_S,"Fl_Radio_Round_Button");
  tolua_usertype(tolua_S,"Fl_PNM_Image");
  tolua_usertype(tolua_S,"Fl_Valuator");
@@ -997,64 +1047,70 @@ static void tolua_reg_types (lua_State* tolua_S)
  tolua_usertype(tolua_S,"Fl_Repeat_Button");
  tolua_usertype(tolua_S,"Lua__Fl_Menu_Bar");
  tolua_usertype(tolua_S,"Fl_Round_Clock");
- tolua_usertype(tolua_S,"Lua__Fl_Float_Input");
+ tolua_usertype(tolua_S,"Fl_Abstract_Printer");
+ tolua_usertype(tolua_S,"Flve_Input");
  tolua_usertype(tolua_S,"Lua__Fl_Scroll");
+ tolua_usertype(tolua_S,"Flve_Check_Button");
  tolua_usertype(tolua_S,"const");
+ tolua_usertype(tolua_S,"Flv_Table");
  tolua_usertype(tolua_S,"Fl_Group");
+ tolua_usertype(tolua_S,"Lua__Flv_List");
  tolua_usertype(tolua_S,"Lua__Fl_Value_Input");
- tolua_usertype(tolua_S,"Flve_Input");
+ tolua_usertype(tolua_S,"Flv_List");
+ tolua_usertype(tolua_S,"Flv_Sqlite_Data_Source");
+ tolua_usertype(tolua_S,"Flv_Data_Source");
  tolua_usertype(tolua_S,"Lua__Fl_Tree");
- tolua_usertype(tolua_S,"Flve_Check_Button");
- tolua_usertype(tolua_S,"Flv_Table");
- tolua_usertype(tolua_S,"Lua__Flv_List");
+ tolua_usertype(tolua_S,"Flv_CStyle");
+ tolua_usertype(tolua_S,"Flv_Style");
+ tolua_usertype(tolua_S,"Flv_Style_List");
  tolua_usertype(tolua_S,"Fl_Atclose_Handler");
  tolua_usertype(tolua_S,"Lua__Fl_Device");
- tolua_usertype(tolua_S,"Flv_List");
+ tolua_usertype(tolua_S,"wchar_t");
  tolua_usertype(tolua_S,"Lua__Fl_Bitmap");
  tolua_usertype(tolua_S,"Fl_Draw_Image_Cb");
- tolua_usertype(tolua_S,"Fl_Menu_");
- tolua_usertype(tolua_S,"Flv_CStyle");
+ tolua_usertype(tolua_S,"Lua__Fl_Box");
+ tolua_usertype(tolua_S,"stat");
  tolua_usertype(tolua_S,"Fl_Input");
- tolua_usertype(tolua_S,"Flv_Style");
+ tolua_usertype(tolua_S,"Lua__Fl_Shared_Image");
  tolua_usertype(tolua_S,"Fl_Label");
- tolua_usertype(tolua_S,"Fl_Chart");
- tolua_usertype(tolua_S,"wchar_t");
- tolua_usertype(tolua_S,"stat");
  tolua_usertype(tolua_S,"Fl_Region");
- tolua_usertype(tolua_S,"Fl_Image");
- tolua_usertype(tolua_S,"Lua__Fl_Positioner");
+ tolua_usertype(tolua_S,"Fl_Simple_Counter");
+ tolua_usertype(tolua_S,"Lua__Fl_Widget");
  tolua_usertype(tolua_S,"Fl_Nice_Slider");
  tolua_usertype(tolua_S,"Fl_Menu_Window");
+ tolua_usertype(tolua_S,"Fl_Hor_Value_Slider");
  tolua_usertype(tolua_S,"Fl_Hor_Nice_Slider");
+ tolua_usertype(tolua_S,"Fl_Hor_Slider");
  tolua_usertype(tolua_S,"Lua__Fl_Slider");
  tolua_usertype(tolua_S,"Fl_Slider");
  tolua_usertype(tolua_S,"Lua__Fl_Double_Window");
  tolua_usertype(tolua_S,"Fl_Widget_Tracker");
  tolua_usertype(tolua_S,"Fl_Old_Idle_Handler");
+ tolua_usertype(tolua_S,"Fl_Abort_Handler");
  tolua_usertype(tolua_S,"Lua__Fl_Tiled_Image");
  tolua_usertype(tolua_S,"Fl_Button");
  tolua_usertype(tolua_S,"Fl_Bitmap");
- tolua_usertype(tolua_S,"Lua__Fl_Widget");
- tolua_usertype(tolua_S,"Fl_Abort_Handler");
+ tolua_usertype(tolua_S,"Fl_File_Chooser");
+ tolua_usertype(tolua_S,"Fl_Value_Input");
  tolua_usertype(tolua_S,"Fl_File_Input");
- tolua_usertype(tolua_S,"Fl_Window");
  tolua_usertype(tolua_S,"Fl_FD_Handler");
+ tolua_usertype(tolua_S,"Fl_Timeout_Handler");
  tolua_usertype(tolua_S,"Fl_Menu_Button");
  tolua_usertype(tolua_S,"Fl_Wizard");
  tolua_usertype(tolua_S,"Fl_Clock_Output");
  tolua_usertype(tolua_S,"Lua__Fl_Menu_Button");
- tolua_usertype(tolua_S,"Fl_Timeout_Handler");
  tolua_usertype(tolua_S,"Fl");
  tolua_usertype(tolua_S,"Flcc_ValueBox");
  tolua_usertype(tolua_S,"Fl_Round_Button");
+ tolua_usertype(tolua_S,"Fl_Text_Editor");
  tolua_usertype(tolua_S,"Fl_Select_Browser");
- tolua_usertype(tolua_S,"Lua__Fl_Text_Display");
- tolua_usertype(tolua_S,"Fl_Pack");
  tolua_usertype(tolua_S,"Lua__Fl_Window");
+ tolua_usertype(tolua_S,"Fl_Pack");
+ tolua_usertype(tolua_S,"Fl_Window");
  tolua_usertype(tolua_S,"Fl_Box_Draw_F");
  tolua_usertype(tolua_S,"Fl_Toggle_Button");
  tolua_usertype(tolua_S,"Fl_Browser_");
- tolua_usertype(tolua_S,"Fl_Value_Input");
+ tolua_usertype(tolua_S,"Fl_Adjuster");
  tolua_usertype(tolua_S,"Fl_Spinner");
  tolua_usertype(tolua_S,"FILE");
  tolua_usertype(tolua_S,"Fl_Help_View");
@@ -1062,39 +1118,39 @@ static void tolua_reg_types (lua_State* tolua_S)
  tolua_usertype(tolua_S,"Fl_Counter");
  tolua_usertype(tolua_S,"Fl_Positioner");
  tolua_usertype(tolua_S,"Fl_Dial");
- tolua_usertype(tolua_S,"Fl_Callback");
- tolua_usertype(tolua_S,"Fl_Adjuster");
- tolua_usertype(tolua_S,"Fl_Hold_Browser");
+ tolua_usertype(tolua_S,"Lua__Fl_Positioner");
  tolua_usertype(tolua_S,"Fl_Tree_Prefs");
+ tolua_usertype(tolua_S,"Fl_Callback");
  tolua_usertype(tolua_S,"Fl_Tree_Item_Array");
- tolua_usertype(tolua_S,"Fl_Int_Input");
  tolua_usertype(tolua_S,"Fl_Tree_Item");
+ tolua_usertype(tolua_S,"Fl_Int_Input");
+ tolua_usertype(tolua_S,"Fl_Chart");
  tolua_usertype(tolua_S,"Fl_PNG_Image");
- tolua_usertype(tolua_S,"Fl_Tile");
+ tolua_usertype(tolua_S,"Lua__Fl_Float_Input");
  tolua_usertype(tolua_S,"Fl_Multi_Label");
- tolua_usertype(tolua_S,"Fl_File_Chooser");
+ tolua_usertype(tolua_S,"Fl_Image");
  tolua_usertype(tolua_S,"Fl_Tooltip");
  tolua_usertype(tolua_S,"Lua__Fl_Button");
  tolua_usertype(tolua_S,"Lua__Fl_Int_Input");
- tolua_usertype(tolua_S,"Fl_Text_Editor");
- tolua_usertype(tolua_S,"Lua__Fl_Input");
+ tolua_usertype(tolua_S,"Fl_Menu_");
+ tolua_usertype(tolua_S,"Fl_Tile");
  tolua_usertype(tolua_S,"Fl_XBM_Image");
- tolua_usertype(tolua_S,"Lua__Fl_Box");
+ tolua_usertype(tolua_S,"Lua__Fl_Text_Display");
+ tolua_usertype(tolua_S,"Lua__Fl_Input");
  tolua_usertype(tolua_S,"Fl_Text_Display::Style_Table_Entry");
- tolua_usertype(tolua_S,"Fl_Input_Choice");
  tolua_usertype(tolua_S,"Lua__Fl_Table_Row");
  tolua_usertype(tolua_S,"Fl_Return_Button");
- tolua_usertype(tolua_S,"Fl_Abstract_Printer");
+ tolua_usertype(tolua_S,"Fl_Input_Choice");
  tolua_usertype(tolua_S,"Lua__Fl_Group");
  tolua_usertype(tolua_S,"Fl_Choice");
  tolua_usertype(tolua_S,"Fl_Multi_Browser");
- tolua_usertype(tolua_S,"Fl_Sys_Menu_Bar");
  tolua_usertype(tolua_S,"Lua__Fl_Tabs");
+ tolua_usertype(tolua_S,"Fl_Sys_Menu_Bar");
  tolua_usertype(tolua_S,"Fl_Color_Chooser");
- tolua_usertype(tolua_S,"Lua__Fl_Shared_Image");
+ tolua_usertype(tolua_S,"Fl_Input_");
  tolua_usertype(tolua_S,"Lua__Fl_Choice");
  tolua_usertype(tolua_S,"Fl_File_Browser");
- tolua_usertype(tolua_S,"Fl_Simple_Counter");
+ tolua_usertype(tolua_S,"Fl_Draw_List");
  tolua_usertype(tolua_S,"Lua__Fl_Tile");
  tolua_usertype(tolua_S,"Fl_Check_Browser");
  tolua_usertype(tolua_S,"Lua__Fl_Multiline_Input");
@@ -1102,7 +1158,7 @@ static void tolua_reg_types (lua_State* tolua_S)
  tolua_usertype(tolua_S,"Fl_Printer");
  tolua_usertype(tolua_S,"Lua__Fl_Select_Browser");
  tolua_usertype(tolua_S,"Lua__Fl_Browser");
- tolua_usertype(tolua_S,"Flv_Style_List");
+ tolua_usertype(tolua_S,"Fl_Lua_Highlighter");
  tolua_usertype(tolua_S,"Fl_Text_Display");
  tolua_usertype(tolua_S,"Fl_XPM_Image");
  tolua_usertype(tolua_S,"Lua__Fl_Valuator");
@@ -3792,7 +3848,7 @@ static int tolua_fltk_fltk_Fl_Widget_y00(lua_State* tolua_S)
  class Lua__Fl_Widget : public Fl_Widget, public ToluaBase {
 public:
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(0, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -3802,7 +3858,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(1, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -3812,7 +3868,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(2, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -3821,14 +3877,14 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(3, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Widget:: draw();
 		};
 	};
 	 int  handle( int event) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Widget_handle00)) {
+		if (push_method(4, "handle",  tolua_fltk_fltk_Fl_Widget_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)event);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -3839,14 +3895,14 @@ public:
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Widget:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -3857,7 +3913,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Widget:: show();
@@ -4408,7 +4464,7 @@ static int tolua_fltk_fltk_Fl_Box_handle00(lua_State* tolua_S)
  class Lua__Fl_Box : public Fl_Box, public ToluaBase {
 public:
 	 int  handle( int tolua_var_10) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Box_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Box_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_10);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -4419,7 +4475,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -4429,7 +4485,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -4439,7 +4495,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -4448,21 +4504,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Box:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Box:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -4473,7 +4529,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Box:: show();
@@ -5445,7 +5501,7 @@ static int tolua_fltk_fltk_Fl_Group_resizefont00(lua_State* tolua_S)
  class Lua__Fl_Group : public Fl_Group, public ToluaBase {
 public:
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(0, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -5455,7 +5511,7 @@ public:
 		};
 	};
 	 int  handle( int tolua_var_17) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Group_handle00)) {
+		if (push_method(1, "handle",  tolua_fltk_fltk_Fl_Group_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_17);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -5466,7 +5522,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -5476,7 +5532,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -5485,21 +5541,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Group:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Group:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -5510,7 +5566,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Group:: show();
@@ -6431,6 +6487,40 @@ static int tolua_fltk_fltk_Fl_Browser_add00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: fltk_Fl_Browser_add_lines of class  Fl_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Browser_add_lines00
+static int tolua_fltk_fltk_Fl_Browser_add_lines00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Browser",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Browser* self = (Fl_Browser*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  lua_Object tbl = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'fltk_Fl_Browser_add_lines'", NULL);
+#endif
+ {
+  tolua_outside int tolua_ret = (tolua_outside int)  fltk_Fl_Browser_add_lines(self,L,tbl);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'add_lines'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: bottomline of class  Fl_Browser */
 #ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Browser_bottomline00
 static int tolua_fltk_fltk_Fl_Browser_bottomline00(lua_State* tolua_S)
@@ -7602,7 +7692,7 @@ static int tolua_fltk_fltk_Fl_Browser_handle00(lua_State* tolua_S)
  class Lua__Fl_Browser : public Fl_Browser, public ToluaBase {
 public:
 	 int  handle( int event) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Browser_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Browser_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)event);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -7613,7 +7703,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -7623,7 +7713,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -7633,7 +7723,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -7642,21 +7732,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Browser:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Browser:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -7667,7 +7757,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Browser:: show();
@@ -7828,14 +7918,14 @@ static int tolua_collect_Lua__Fl_Browser (lua_State* tolua_S)
 }
 #endif
 
-/* method: new of class  Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_new00
-static int tolua_fltk_fltk_Fl_Button_new00(lua_State* tolua_S)
+/* method: new of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_new00
+static int tolua_fltk_fltk_Fl_Virtual_Browser_new00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertable(tolua_S,1,"Fl_Button",0,&tolua_err) ||
+ !tolua_isusertable(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
@@ -7853,8 +7943,8 @@ static int tolua_fltk_fltk_Fl_Button_new00(lua_State* tolua_S)
   int H = ((int)  tolua_tonumber(tolua_S,5,0));
   const char* L = ((const char*)  tolua_tostring(tolua_S,6,0));
  {
-  Fl_Button* tolua_ret = (Fl_Button*)  Mtolua_new((Fl_Button)(X,Y,W,H,L));
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Button");
+  Fl_Virtual_Browser* tolua_ret = (Fl_Virtual_Browser*)  Mtolua_new((Fl_Virtual_Browser)(X,Y,W,H,L));
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Virtual_Browser");
  }
  }
  return 1;
@@ -7866,140 +7956,242 @@ static int tolua_fltk_fltk_Fl_Button_new00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new_local of class  Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_new00_local
-static int tolua_fltk_fltk_Fl_Button_new00_local(lua_State* tolua_S)
+/* method: new_local of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_new00_local
+static int tolua_fltk_fltk_Fl_Virtual_Browser_new00_local(lua_State* tolua_S)
 {
- int result = tolua_fltk_fltk_Fl_Button_new00(tolua_S);
+ int result = tolua_fltk_fltk_Fl_Virtual_Browser_new00(tolua_S);
  if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
  return result;
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear of class  Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_clear00
-static int tolua_fltk_fltk_Fl_Button_clear00(lua_State* tolua_S)
+/* method: delete of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_delete00
+static int tolua_fltk_fltk_Fl_Virtual_Browser_delete00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'delete'", NULL);
 #endif
- {
-  int tolua_ret = (int)  self->clear();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- }
+ Mtolua_delete(self);
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'delete'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: down_box of class  Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_down_box00
-static int tolua_fltk_fltk_Fl_Button_down_box00(lua_State* tolua_S)
+/* method: size of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_size00
+static int tolua_fltk_fltk_Fl_Virtual_Browser_size00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'down_box'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'size'", NULL);
 #endif
  {
- if(nparam < 2) {
-  Fl_Boxtype tolua_ret = (Fl_Boxtype)  self->down_box();
+  int tolua_ret = (int)  self->size();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
  return 1;
- } else {
 #ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'size'.",&tolua_err);
+ return 0;
 #endif
-  Fl_Boxtype opt = ((Fl_Boxtype) (int)  tolua_tonumber(tolua_S,2,0));
- self->down_box(opt);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: size of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_size01
+static int tolua_fltk_fltk_Fl_Virtual_Browser_size01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
+  int n = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'size'", NULL);
+#endif
+ {
+  self->size(n);
+ }
+ }
  return 0;
+tolua_lerror:
+ return tolua_fltk_fltk_Fl_Virtual_Browser_size00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: size of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_size02
+static int tolua_fltk_fltk_Fl_Virtual_Browser_size02(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
+  int W = ((int)  tolua_tonumber(tolua_S,2,0));
+  int H = ((int)  tolua_tonumber(tolua_S,3,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'size'", NULL);
+#endif
+ {
+  self->size(W,H);
  }
  }
+ return 0;
+tolua_lerror:
+ return tolua_fltk_fltk_Fl_Virtual_Browser_size01(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: fltk_Fl_Virtual_Browser_lines of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_lines00
+static int tolua_fltk_fltk_Fl_Virtual_Browser_lines00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  lua_Object str = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'fltk_Fl_Virtual_Browser_lines'", NULL);
+#endif
+ {
+  fltk_Fl_Virtual_Browser_lines(self,L,str);
+ }
  }
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'down_box'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'lines'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: down_color of class  Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_down_color00
-static int tolua_fltk_fltk_Fl_Button_down_color00(lua_State* tolua_S)
+/* method: fltk_Fl_Virtual_Browser_data_source of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_data_source00
+static int tolua_fltk_fltk_Fl_Virtual_Browser_data_source00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  lua_Object ds = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
+  int col = ((int)  tolua_tonumber(tolua_S,3,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'down_color'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'fltk_Fl_Virtual_Browser_data_source'", NULL);
 #endif
  {
- if(nparam < 2) {
-  unsigned int tolua_ret = ( unsigned int)  self->down_color();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
+  fltk_Fl_Virtual_Browser_data_source(self,L,ds,col);
+ }
+ }
+ return 0;
 #ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  unsigned int opt = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
- self->down_color(opt);
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'data_source'.",&tolua_err);
  return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: data_changed of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_data_changed00
+static int tolua_fltk_fltk_Fl_Virtual_Browser_data_changed00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'data_changed'", NULL);
+#endif
+ {
+  self->data_changed();
  }
  }
- }
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'down_color'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'data_changed'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: handle of class  Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_handle00
-static int tolua_fltk_fltk_Fl_Button_handle00(lua_State* tolua_S)
+/* method: text of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_text00
+static int tolua_fltk_fltk_Fl_Virtual_Browser_text00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
@@ -8007,191 +8199,255 @@ static int tolua_fltk_fltk_Fl_Button_handle00(lua_State* tolua_S)
  else
 #endif
  {
-  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
-  int tolua_var_23 = ((int)  tolua_tonumber(tolua_S,2,0));
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
+  int line = ((int)  tolua_tonumber(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'handle'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'text'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->handle(tolua_var_23);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  const char* tolua_ret = (const char*)  self->text(line);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'handle'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'text'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: set of class  Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_set00
-static int tolua_fltk_fltk_Fl_Button_set00(lua_State* tolua_S)
+/* method: line_height of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_line_height00
+static int tolua_fltk_fltk_Fl_Virtual_Browser_line_height00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'set'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'line_height'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->set();
+  int tolua_ret = (int)  self->line_height();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'set'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'line_height'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: setonly of class  Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_setonly00
-static int tolua_fltk_fltk_Fl_Button_setonly00(lua_State* tolua_S)
+/* method: column_char of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_column_char00
+static int tolua_fltk_fltk_Fl_Virtual_Browser_column_char00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'setonly'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'column_char'", NULL);
 #endif
  {
-  self->setonly();
+ if(nparam < 2) {
+  char tolua_ret = (char)  self->column_char();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  char opt = ((char)  tolua_tonumber(tolua_S,2,0));
+ self->column_char(opt);
+ return 0;
+ }
  }
  }
- return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'setonly'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'column_char'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: shortcut of class  Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_shortcut00
-static int tolua_fltk_fltk_Fl_Button_shortcut00(lua_State* tolua_S)
+/* method: fltk_Fl_Virtual_Browser_get_column_widths of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_get_column_widths00
+static int tolua_fltk_fltk_Fl_Virtual_Browser_get_column_widths00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'shortcut'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'fltk_Fl_Virtual_Browser_get_column_widths'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->shortcut();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  tolua_outside lua_Object tolua_ret = (tolua_outside lua_Object)  fltk_Fl_Virtual_Browser_get_column_widths(self,L);
+ tolua_pushvalue(tolua_S,(int)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'shortcut'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'get_column_widths'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: shortcut of class  Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_shortcut01
-static int tolua_fltk_fltk_Fl_Button_shortcut01(lua_State* tolua_S)
+/* method: fltk_Fl_Virtual_Browser_set_column_widths of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_set_column_widths00
+static int tolua_fltk_fltk_Fl_Virtual_Browser_set_column_widths00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
-  int s = ((int)  tolua_tonumber(tolua_S,2,0));
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  lua_Object tbl = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'shortcut'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'fltk_Fl_Virtual_Browser_set_column_widths'", NULL);
 #endif
  {
-  self->shortcut(s);
+  fltk_Fl_Virtual_Browser_set_column_widths(self,L,tbl);
  }
  }
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_Fl_Button_shortcut00(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_column_widths'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: shortcut of class  Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_shortcut02
-static int tolua_fltk_fltk_Fl_Button_shortcut02(lua_State* tolua_S)
+/* method: display of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_display00
+static int tolua_fltk_fltk_Fl_Virtual_Browser_display00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
-  const char* s = ((const char*)  tolua_tostring(tolua_S,2,0));
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
+  int line = ((int)  tolua_tonumber(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'shortcut'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'display'", NULL);
 #endif
  {
-  self->shortcut(s);
+  self->display(line);
  }
  }
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_Fl_Button_shortcut01(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'display'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: value of class  Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_value00
-static int tolua_fltk_fltk_Fl_Button_value00(lua_State* tolua_S)
+/* method: topline of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_topline00
+static int tolua_fltk_fltk_Fl_Virtual_Browser_topline00(lua_State* tolua_S)
 {
  int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'topline'", NULL);
+#endif
+ {
+ if(nparam < 2) {
+  int tolua_ret = (int)  self->topline();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
+ self->topline(opt);
+ return 0;
+ }
+ }
+ }
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'topline'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: value of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_value00
+static int tolua_fltk_fltk_Fl_Virtual_Browser_value00(lua_State* tolua_S)
+{
+ int nparam = lua_gettop(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
  if (!self) tolua_error(tolua_S,"invalid 'self' in function 'value'", NULL);
 #endif
@@ -8219,123 +8475,157 @@ static int tolua_fltk_fltk_Fl_Button_value00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
- class Lua__Fl_Button : public Fl_Button, public ToluaBase {
+/* method: handle of class  Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Virtual_Browser_handle00
+static int tolua_fltk_fltk_Fl_Virtual_Browser_handle00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Virtual_Browser",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Virtual_Browser* self = (Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
+  int event = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'handle'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->handle(event);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'handle'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+ class Lua__Fl_Virtual_Browser : public Fl_Virtual_Browser, public ToluaBase {
 public:
-	 void  draw( void ) {
-		if (push_method("draw",  NULL)) {
-			ToluaBase::dbcall(lua_state, 1, 0);
-		} else {
-			 Fl_Button:: draw();
-		};
-	};
-	 int  handle( int tolua_var_23) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Button_handle00)) {
-			tolua_pushnumber(lua_state, (lua_Number)tolua_var_23);
+	 int  handle( int event) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Virtual_Browser_handle00)) {
+			tolua_pushnumber(lua_state, (lua_Number)event);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
 			return tolua_ret;
 		} else {
-			return ( int ) Fl_Button:: handle(tolua_var_23);
+			return ( int ) Fl_Virtual_Browser:: handle(event);
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
 			return tolua_ret;
 		} else {
-			return ( Fl_Group* ) Fl_Button:: as_group();
+			return ( Fl_Group* ) Fl_Virtual_Browser:: as_group();
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
 			return tolua_ret;
 		} else {
-			return ( Fl_Window* ) Fl_Button:: as_window();
+			return ( Fl_Window* ) Fl_Virtual_Browser:: as_window();
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
 		} else {
-			 Fl_Button:: do_callback(o,arg);
+			 Fl_Virtual_Browser:: do_callback(o,arg);
+		};
+	};
+	 void  draw( void ) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+			ToluaBase::dbcall(lua_state, 1, 0);
+		} else {
+			 Fl_Virtual_Browser:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
-			 Fl_Button:: hide();
+			 Fl_Virtual_Browser:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
 			tolua_pushnumber(lua_state, (lua_Number)h);
 			ToluaBase::dbcall(lua_state, 5, 0);
 		} else {
-			 Fl_Button:: resize(x,y,w,h);
+			 Fl_Virtual_Browser:: resize(x,y,w,h);
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
-			 Fl_Button:: show();
+			 Fl_Virtual_Browser:: show();
 		};
 	};
 
-	 void Fl_Button__draw( void ) {
-		Fl_Button::draw();
+	 int Fl_Virtual_Browser__handle( int event) {
+		return ( int )Fl_Virtual_Browser::handle(event);
 	};
-	 int Fl_Button__handle( int tolua_var_23) {
-		return ( int )Fl_Button::handle(tolua_var_23);
+	 Fl_Group* Fl_Virtual_Browser__as_group( void ) {
+		return ( Fl_Group* )Fl_Virtual_Browser::as_group();
 	};
-	 Fl_Group* Fl_Button__as_group( void ) {
-		return ( Fl_Group* )Fl_Button::as_group();
+	 Fl_Window* Fl_Virtual_Browser__as_window( void ) {
+		return ( Fl_Window* )Fl_Virtual_Browser::as_window();
 	};
-	 Fl_Window* Fl_Button__as_window( void ) {
-		return ( Fl_Window* )Fl_Button::as_window();
+	 void Fl_Virtual_Browser__do_callback( Fl_Widget* o, void* arg = 0) {
+		Fl_Virtual_Browser::do_callback(o,arg);
 	};
-	 void Fl_Button__do_callback( Fl_Widget* o, void* arg = 0) {
-		Fl_Button::do_callback(o,arg);
+	 void Fl_Virtual_Browser__draw( void ) {
+		Fl_Virtual_Browser::draw();
 	};
-	 void Fl_Button__hide( void ) {
-		Fl_Button::hide();
+	 void Fl_Virtual_Browser__hide( void ) {
+		Fl_Virtual_Browser::hide();
 	};
-	 void Fl_Button__resize( int x, int y, int w, int h) {
-		Fl_Button::resize(x,y,w,h);
+	 void Fl_Virtual_Browser__resize( int x, int y, int w, int h) {
+		Fl_Virtual_Browser::resize(x,y,w,h);
 	};
-	 void Fl_Button__show( void ) {
-		Fl_Button::show();
+	 void Fl_Virtual_Browser__show( void ) {
+		Fl_Virtual_Browser::show();
 	};
-	 Lua__Fl_Button( int X, int Y, int W, int H, const char* L = 0): Fl_Button(X,Y,W,H,L){};
+	 Lua__Fl_Virtual_Browser( int X, int Y, int W, int H, const char* L = 0): Fl_Virtual_Browser(X,Y,W,H,L){};
 };
 
-/* method: tolua__set_instance of class  Lua__Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Button_tolua__set_instance00
-static int tolua_fltk_fltk_Lua__Fl_Button_tolua__set_instance00(lua_State* tolua_S)
+/* method: tolua__set_instance of class  Lua__Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Virtual_Browser_tolua__set_instance00
+static int tolua_fltk_fltk_Lua__Fl_Virtual_Browser_tolua__set_instance00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Lua__Fl_Button",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Lua__Fl_Virtual_Browser",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Lua__Fl_Button* self = (Lua__Fl_Button*)  tolua_tousertype(tolua_S,1,0);
+  Lua__Fl_Virtual_Browser* self = (Lua__Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
   lua_State* L =  tolua_S;
   lua_Object lo = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
@@ -8354,45 +8644,14 @@ static int tolua_fltk_fltk_Lua__Fl_Button_tolua__set_instance00(lua_State* tolua
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: Fl_Button__draw of class  Lua__Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Button_Fl_Button__draw00
-static int tolua_fltk_fltk_Lua__Fl_Button_Fl_Button__draw00(lua_State* tolua_S)
-{
-#ifndef TOLUA_RELEASE
- tolua_Error tolua_err;
- if (
- !tolua_isusertype(tolua_S,1,"Lua__Fl_Button",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
- )
- goto tolua_lerror;
- else
-#endif
- {
-  Lua__Fl_Button* self = (Lua__Fl_Button*)  tolua_tousertype(tolua_S,1,0);
-#ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'Fl_Button__draw'", NULL);
-#endif
- {
-  self->Fl_Button__draw();
- }
- }
- return 0;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'Fl_Button__draw'.",&tolua_err);
- return 0;
-#endif
-}
-#endif //#ifndef TOLUA_DISABLE
-
-/* method: Fl_Button__handle of class  Lua__Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Button_Fl_Button__handle00
-static int tolua_fltk_fltk_Lua__Fl_Button_Fl_Button__handle00(lua_State* tolua_S)
+/* method: Fl_Virtual_Browser__handle of class  Lua__Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Virtual_Browser_Fl_Virtual_Browser__handle00
+static int tolua_fltk_fltk_Lua__Fl_Virtual_Browser_Fl_Virtual_Browser__handle00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Lua__Fl_Button",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Lua__Fl_Virtual_Browser",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
@@ -8400,33 +8659,33 @@ static int tolua_fltk_fltk_Lua__Fl_Button_Fl_Button__handle00(lua_State* tolua_S
  else
 #endif
  {
-  Lua__Fl_Button* self = (Lua__Fl_Button*)  tolua_tousertype(tolua_S,1,0);
-  int tolua_var_23 = ((int)  tolua_tonumber(tolua_S,2,0));
+  Lua__Fl_Virtual_Browser* self = (Lua__Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
+  int event = ((int)  tolua_tonumber(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'Fl_Button__handle'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'Fl_Virtual_Browser__handle'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->Fl_Button__handle(tolua_var_23);
+  int tolua_ret = (int)  self->Fl_Virtual_Browser__handle(event);
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'Fl_Button__handle'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'Fl_Virtual_Browser__handle'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new of class  Lua__Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Button_new00
-static int tolua_fltk_fltk_Lua__Fl_Button_new00(lua_State* tolua_S)
+/* method: new of class  Lua__Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Virtual_Browser_new00
+static int tolua_fltk_fltk_Lua__Fl_Virtual_Browser_new00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertable(tolua_S,1,"Lua__Fl_Button",0,&tolua_err) ||
+ !tolua_isusertable(tolua_S,1,"Lua__Fl_Virtual_Browser",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
@@ -8444,8 +8703,8 @@ static int tolua_fltk_fltk_Lua__Fl_Button_new00(lua_State* tolua_S)
   int H = ((int)  tolua_tonumber(tolua_S,5,0));
   const char* L = ((const char*)  tolua_tostring(tolua_S,6,0));
  {
-  Lua__Fl_Button* tolua_ret = (Lua__Fl_Button*)  Mtolua_new((Lua__Fl_Button)(X,Y,W,H,L));
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Lua__Fl_Button");
+  Lua__Fl_Virtual_Browser* tolua_ret = (Lua__Fl_Virtual_Browser*)  Mtolua_new((Lua__Fl_Virtual_Browser)(X,Y,W,H,L));
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Lua__Fl_Virtual_Browser");
  }
  }
  return 1;
@@ -8457,36 +8716,65 @@ static int tolua_fltk_fltk_Lua__Fl_Button_new00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new_local of class  Lua__Fl_Button */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Button_new00_local
-static int tolua_fltk_fltk_Lua__Fl_Button_new00_local(lua_State* tolua_S)
+/* method: new_local of class  Lua__Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Virtual_Browser_new00_local
+static int tolua_fltk_fltk_Lua__Fl_Virtual_Browser_new00_local(lua_State* tolua_S)
 {
- int result = tolua_fltk_fltk_Lua__Fl_Button_new00(tolua_S);
+ int result = tolua_fltk_fltk_Lua__Fl_Virtual_Browser_new00(tolua_S);
  if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
  return result;
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: delete of class  Lua__Fl_Virtual_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Virtual_Browser_delete00
+static int tolua_fltk_fltk_Lua__Fl_Virtual_Browser_delete00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Lua__Fl_Virtual_Browser",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Lua__Fl_Virtual_Browser* self = (Lua__Fl_Virtual_Browser*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'delete'", NULL);
+#endif
+ Mtolua_delete(self);
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'delete'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 
 /* function to release collected object via destructor */
 #ifdef __cplusplus
 
-static int tolua_collect_Lua__Fl_Button (lua_State* tolua_S)
+static int tolua_collect_Lua__Fl_Virtual_Browser (lua_State* tolua_S)
 {
- Lua__Fl_Button* self = (Lua__Fl_Button*) tolua_tousertype(tolua_S,1,0);
+ Lua__Fl_Virtual_Browser* self = (Lua__Fl_Virtual_Browser*) tolua_tousertype(tolua_S,1,0);
 	delete self;
 	return 0;
 }
 #endif
 
-/* method: new of class  Fl_Chart */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_new00
-static int tolua_fltk_fltk_Fl_Chart_new00(lua_State* tolua_S)
+/* method: new of class  Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_new00
+static int tolua_fltk_fltk_Fl_Button_new00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertable(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
+ !tolua_isusertable(tolua_S,1,"Fl_Button",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
@@ -8504,8 +8792,8 @@ static int tolua_fltk_fltk_Fl_Chart_new00(lua_State* tolua_S)
   int H = ((int)  tolua_tonumber(tolua_S,5,0));
   const char* L = ((const char*)  tolua_tostring(tolua_S,6,0));
  {
-  Fl_Chart* tolua_ret = (Fl_Chart*)  Mtolua_new((Fl_Chart)(X,Y,W,H,L));
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Chart");
+  Fl_Button* tolua_ret = (Fl_Button*)  Mtolua_new((Fl_Button)(X,Y,W,H,L));
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Button");
  }
  }
  return 1;
@@ -8517,74 +8805,69 @@ static int tolua_fltk_fltk_Fl_Chart_new00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new_local of class  Fl_Chart */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_new00_local
-static int tolua_fltk_fltk_Fl_Chart_new00_local(lua_State* tolua_S)
+/* method: new_local of class  Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_new00_local
+static int tolua_fltk_fltk_Fl_Button_new00_local(lua_State* tolua_S)
 {
- int result = tolua_fltk_fltk_Fl_Chart_new00(tolua_S);
+ int result = tolua_fltk_fltk_Fl_Button_new00(tolua_S);
  if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
  return result;
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: add of class  Fl_Chart */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_add00
-static int tolua_fltk_fltk_Fl_Chart_add00(lua_State* tolua_S)
+/* method: clear of class  Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_clear00
+static int tolua_fltk_fltk_Fl_Button_clear00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isstring(tolua_S,3,1,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
-  double val = ((double)  tolua_tonumber(tolua_S,2,0));
-  const char* str = ((const char*)  tolua_tostring(tolua_S,3,0));
-  unsigned col = ((unsigned)  tolua_tonumber(tolua_S,4,0));
+  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'add'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear'", NULL);
 #endif
  {
-  self->add(val,str,col);
+  int tolua_ret = (int)  self->clear();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'add'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: autosize of class  Fl_Chart */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_autosize00
-static int tolua_fltk_fltk_Fl_Chart_autosize00(lua_State* tolua_S)
+/* method: down_box of class  Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_down_box00
+static int tolua_fltk_fltk_Fl_Button_down_box00(lua_State* tolua_S)
 {
  int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'autosize'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'down_box'", NULL);
 #endif
  {
  if(nparam < 2) {
-  unsigned char tolua_ret = ( unsigned char)  self->autosize();
+  Fl_Boxtype tolua_ret = (Fl_Boxtype)  self->down_box();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  return 1;
  } else {
@@ -8592,439 +8875,497 @@ static int tolua_fltk_fltk_Fl_Chart_autosize00(lua_State* tolua_S)
  if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
  ) goto tolua_lerror;
 #endif
-  unsigned char opt = (( unsigned char)  tolua_tonumber(tolua_S,2,0));
- self->autosize(opt);
- return 0;
+  Fl_Boxtype opt = ((Fl_Boxtype) (int)  tolua_tonumber(tolua_S,2,0));
+ self->down_box(opt);
+ return 0;
  }
  }
  }
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'autosize'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'down_box'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: bounds of class  Fl_Chart */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_get_bounds00
-static int tolua_fltk_fltk_Fl_Chart_get_bounds00(lua_State* tolua_S)
+/* method: down_color of class  Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_down_color00
+static int tolua_fltk_fltk_Fl_Button_down_color00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,1,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
-  double a = ((double)  tolua_tonumber(tolua_S,2,0));
-  double b = ((double)  tolua_tonumber(tolua_S,3,0));
+  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'bounds'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'down_color'", NULL);
 #endif
  {
-  self->bounds(&a,&b);
- tolua_pushnumber(tolua_S,(lua_Number)a);
- tolua_pushnumber(tolua_S,(lua_Number)b);
+ if(nparam < 2) {
+  unsigned int tolua_ret = ( unsigned int)  self->down_color();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  unsigned int opt = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
+ self->down_color(opt);
+ return 0;
+ }
  }
  }
- return 2;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'get_bounds'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'down_color'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: bounds of class  Fl_Chart */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_set_bounds00
-static int tolua_fltk_fltk_Fl_Chart_set_bounds00(lua_State* tolua_S)
+/* method: handle of class  Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_handle00
+static int tolua_fltk_fltk_Fl_Button_handle00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
-  double a = ((double)  tolua_tonumber(tolua_S,2,0));
-  double b = ((double)  tolua_tonumber(tolua_S,3,0));
+  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
+  int tolua_var_23 = ((int)  tolua_tonumber(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'bounds'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'handle'", NULL);
 #endif
  {
-  self->bounds(a,b);
+  int tolua_ret = (int)  self->handle(tolua_var_23);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'set_bounds'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'handle'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear of class  Fl_Chart */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_clear00
-static int tolua_fltk_fltk_Fl_Chart_clear00(lua_State* tolua_S)
+/* method: set of class  Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_set00
+static int tolua_fltk_fltk_Fl_Button_set00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'set'", NULL);
 #endif
  {
-  self->clear();
+  int tolua_ret = (int)  self->set();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'set'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: insert of class  Fl_Chart */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_insert00
-static int tolua_fltk_fltk_Fl_Chart_insert00(lua_State* tolua_S)
+/* method: setonly of class  Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_setonly00
+static int tolua_fltk_fltk_Fl_Button_setonly00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isstring(tolua_S,4,1,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,6,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
-  int ind = ((int)  tolua_tonumber(tolua_S,2,0));
-  double val = ((double)  tolua_tonumber(tolua_S,3,0));
-  const char* str = ((const char*)  tolua_tostring(tolua_S,4,0));
-  unsigned col = ((unsigned)  tolua_tonumber(tolua_S,5,0));
+  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'insert'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'setonly'", NULL);
 #endif
  {
-  self->insert(ind,val,str,col);
+  self->setonly();
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'insert'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'setonly'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: maxsize of class  Fl_Chart */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_maxsize00
-static int tolua_fltk_fltk_Fl_Chart_maxsize00(lua_State* tolua_S)
+/* method: shortcut of class  Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_shortcut00
+static int tolua_fltk_fltk_Fl_Button_shortcut00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'maxsize'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'shortcut'", NULL);
 #endif
  {
- if(nparam < 2) {
-  int tolua_ret = (int)  self->maxsize();
+  int tolua_ret = (int)  self->shortcut();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
- self->maxsize(opt);
- return 0;
- }
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'maxsize'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'shortcut'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: replace of class  Fl_Chart */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_replace00
-static int tolua_fltk_fltk_Fl_Chart_replace00(lua_State* tolua_S)
+/* method: shortcut of class  Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_shortcut01
+static int tolua_fltk_fltk_Fl_Button_shortcut01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isstring(tolua_S,4,1,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,6,&tolua_err)
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
-  int ind = ((int)  tolua_tonumber(tolua_S,2,0));
-  double val = ((double)  tolua_tonumber(tolua_S,3,0));
-  const char* str = ((const char*)  tolua_tostring(tolua_S,4,0));
-  unsigned col = ((unsigned)  tolua_tonumber(tolua_S,5,0));
+  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
+  int s = ((int)  tolua_tonumber(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'replace'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'shortcut'", NULL);
 #endif
  {
-  self->replace(ind,val,str,col);
+  self->shortcut(s);
  }
  }
  return 0;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'replace'.",&tolua_err);
- return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_Fl_Button_shortcut00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: size of class  Fl_Chart */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_size00
-static int tolua_fltk_fltk_Fl_Chart_size00(lua_State* tolua_S)
+/* method: shortcut of class  Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_shortcut02
+static int tolua_fltk_fltk_Fl_Button_shortcut02(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
+  const char* s = ((const char*)  tolua_tostring(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'size'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'shortcut'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->size();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->shortcut(s);
  }
  }
- return 1;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'size'.",&tolua_err);
  return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_Fl_Button_shortcut01(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: size of class  Fl_Chart */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_size01
-static int tolua_fltk_fltk_Fl_Chart_size01(lua_State* tolua_S)
+/* method: value of class  Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Button_value00
+static int tolua_fltk_fltk_Fl_Button_value00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Button",0,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
-  int W = ((int)  tolua_tonumber(tolua_S,2,0));
-  int H = ((int)  tolua_tonumber(tolua_S,3,0));
+  Fl_Button* self = (Fl_Button*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'size'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'value'", NULL);
 #endif
  {
-  self->size(W,H);
+ if(nparam < 2) {
+  int tolua_ret = (int)  self->value();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
+ self->value(opt);
+ return 0;
  }
  }
+ }
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'value'.",&tolua_err);
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_Fl_Chart_size00(tolua_S);
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: textcolor of class  Fl_Chart */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_textcolor00
-static int tolua_fltk_fltk_Fl_Chart_textcolor00(lua_State* tolua_S)
+ class Lua__Fl_Button : public Fl_Button, public ToluaBase {
+public:
+	 void  draw( void ) {
+		if (push_method(0, "draw",  NULL)) {
+			ToluaBase::dbcall(lua_state, 1, 0);
+		} else {
+			 Fl_Button:: draw();
+		};
+	};
+	 int  handle( int tolua_var_23) {
+		if (push_method(1, "handle",  tolua_fltk_fltk_Fl_Button_handle00)) {
+			tolua_pushnumber(lua_state, (lua_Number)tolua_var_23);
+			ToluaBase::dbcall(lua_state, 2, 1);
+			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
+			lua_pop(lua_state, 1);
+			return tolua_ret;
+		} else {
+			return ( int ) Fl_Button:: handle(tolua_var_23);
+		};
+	};
+	 Fl_Group*  as_group( void ) {
+		if (push_method(2, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+			ToluaBase::dbcall(lua_state, 1, 1);
+			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
+			lua_pop(lua_state, 1);
+			return tolua_ret;
+		} else {
+			return ( Fl_Group* ) Fl_Button:: as_group();
+		};
+	};
+	 Fl_Window*  as_window( void ) {
+		if (push_method(3, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+			ToluaBase::dbcall(lua_state, 1, 1);
+			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
+			lua_pop(lua_state, 1);
+			return tolua_ret;
+		} else {
+			return ( Fl_Window* ) Fl_Button:: as_window();
+		};
+	};
+	 void  do_callback( Fl_Widget* o, void* arg = 0) {
+		if (push_method(4, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
+			tolua_pushuserdata(lua_state, (void*)arg);
+			ToluaBase::dbcall(lua_state, 3, 0);
+		} else {
+			 Fl_Button:: do_callback(o,arg);
+		};
+	};
+	 void  hide( void ) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+			ToluaBase::dbcall(lua_state, 1, 0);
+		} else {
+			 Fl_Button:: hide();
+		};
+	};
+	 void  resize( int x, int y, int w, int h) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+			tolua_pushnumber(lua_state, (lua_Number)x);
+			tolua_pushnumber(lua_state, (lua_Number)y);
+			tolua_pushnumber(lua_state, (lua_Number)w);
+			tolua_pushnumber(lua_state, (lua_Number)h);
+			ToluaBase::dbcall(lua_state, 5, 0);
+		} else {
+			 Fl_Button:: resize(x,y,w,h);
+		};
+	};
+	 void  show( void ) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+			ToluaBase::dbcall(lua_state, 1, 0);
+		} else {
+			 Fl_Button:: show();
+		};
+	};
+
+	 void Fl_Button__draw( void ) {
+		Fl_Button::draw();
+	};
+	 int Fl_Button__handle( int tolua_var_23) {
+		return ( int )Fl_Button::handle(tolua_var_23);
+	};
+	 Fl_Group* Fl_Button__as_group( void ) {
+		return ( Fl_Group* )Fl_Button::as_group();
+	};
+	 Fl_Window* Fl_Button__as_window( void ) {
+		return ( Fl_Window* )Fl_Button::as_window();
+	};
+	 void Fl_Button__do_callback( Fl_Widget* o, void* arg = 0) {
+		Fl_Button::do_callback(o,arg);
+	};
+	 void Fl_Button__hide( void ) {
+		Fl_Button::hide();
+	};
+	 void Fl_Button__resize( int x, int y, int w, int h) {
+		Fl_Button::resize(x,y,w,h);
+	};
+	 void Fl_Button__show( void ) {
+		Fl_Button::show();
+	};
+	 Lua__Fl_Button( int X, int Y, int W, int H, const char* L = 0): Fl_Button(X,Y,W,H,L){};
+};
+
+/* method: tolua__set_instance of class  Lua__Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Button_tolua__set_instance00
+static int tolua_fltk_fltk_Lua__Fl_Button_tolua__set_instance00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Lua__Fl_Button",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
+  Lua__Fl_Button* self = (Lua__Fl_Button*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  lua_Object lo = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'textcolor'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'tolua__set_instance'", NULL);
 #endif
  {
- if(nparam < 2) {
-  unsigned int tolua_ret = ( unsigned int)  self->textcolor();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  unsigned int opt = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
- self->textcolor(opt);
- return 0;
- }
+  self->tolua__set_instance(L,lo);
  }
  }
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'textcolor'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'tolua__set_instance'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: textfont of class  Fl_Chart */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_textfont00
-static int tolua_fltk_fltk_Fl_Chart_textfont00(lua_State* tolua_S)
+/* method: Fl_Button__draw of class  Lua__Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Button_Fl_Button__draw00
+static int tolua_fltk_fltk_Lua__Fl_Button_Fl_Button__draw00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Lua__Fl_Button",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
+  Lua__Fl_Button* self = (Lua__Fl_Button*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'textfont'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'Fl_Button__draw'", NULL);
 #endif
  {
- if(nparam < 2) {
-   int tolua_ret = (  int)  self->textfont();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-   int opt = ((  int)  tolua_tonumber(tolua_S,2,0));
- self->textfont(opt);
- return 0;
- }
+  self->Fl_Button__draw();
  }
  }
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'textfont'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'Fl_Button__draw'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: textsize of class  Fl_Chart */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_textsize00
-static int tolua_fltk_fltk_Fl_Chart_textsize00(lua_State* tolua_S)
+/* method: Fl_Button__handle of class  Lua__Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Button_Fl_Button__handle00
+static int tolua_fltk_fltk_Lua__Fl_Button_Fl_Button__handle00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Lua__Fl_Button",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
+  Lua__Fl_Button* self = (Lua__Fl_Button*)  tolua_tousertype(tolua_S,1,0);
+  int tolua_var_23 = ((int)  tolua_tonumber(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'textsize'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'Fl_Button__handle'", NULL);
 #endif
  {
- if(nparam < 2) {
-   int tolua_ret = (  int)  self->textsize();
+  int tolua_ret = (int)  self->Fl_Button__handle(tolua_var_23);
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-   int opt = ((  int)  tolua_tonumber(tolua_S,2,0));
- self->textsize(opt);
- return 0;
- }
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'textsize'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'Fl_Button__handle'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new of class  Fl_Check_Browser */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_new00
-static int tolua_fltk_fltk_Fl_Check_Browser_new00(lua_State* tolua_S)
+/* method: new of class  Lua__Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Button_new00
+static int tolua_fltk_fltk_Lua__Fl_Button_new00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertable(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
+ !tolua_isusertable(tolua_S,1,"Lua__Fl_Button",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
@@ -9036,14 +9377,14 @@ static int tolua_fltk_fltk_Fl_Check_Browser_new00(lua_State* tolua_S)
  else
 #endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,2,0));
-  int y = ((int)  tolua_tonumber(tolua_S,3,0));
-  int w = ((int)  tolua_tonumber(tolua_S,4,0));
-  int h = ((int)  tolua_tonumber(tolua_S,5,0));
-  const char* l = ((const char*)  tolua_tostring(tolua_S,6,0));
+  int X = ((int)  tolua_tonumber(tolua_S,2,0));
+  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int W = ((int)  tolua_tonumber(tolua_S,4,0));
+  int H = ((int)  tolua_tonumber(tolua_S,5,0));
+  const char* L = ((const char*)  tolua_tostring(tolua_S,6,0));
  {
-  Fl_Check_Browser* tolua_ret = (Fl_Check_Browser*)  Mtolua_new((Fl_Check_Browser)(x,y,w,h,l));
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Check_Browser");
+  Lua__Fl_Button* tolua_ret = (Lua__Fl_Button*)  Mtolua_new((Lua__Fl_Button)(X,Y,W,H,L));
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Lua__Fl_Button");
  }
  }
  return 1;
@@ -9055,443 +9396,574 @@ static int tolua_fltk_fltk_Fl_Check_Browser_new00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new_local of class  Fl_Check_Browser */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_new00_local
-static int tolua_fltk_fltk_Fl_Check_Browser_new00_local(lua_State* tolua_S)
+/* method: new_local of class  Lua__Fl_Button */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Button_new00_local
+static int tolua_fltk_fltk_Lua__Fl_Button_new00_local(lua_State* tolua_S)
 {
- int result = tolua_fltk_fltk_Fl_Check_Browser_new00(tolua_S);
+ int result = tolua_fltk_fltk_Lua__Fl_Button_new00(tolua_S);
  if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
  return result;
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: add of class  Fl_Check_Browser */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_add00
-static int tolua_fltk_fltk_Fl_Check_Browser_add00(lua_State* tolua_S)
+
+/* function to release collected object via destructor */
+#ifdef __cplusplus
+
+static int tolua_collect_Lua__Fl_Button (lua_State* tolua_S)
+{
+ Lua__Fl_Button* self = (Lua__Fl_Button*) tolua_tousertype(tolua_S,1,0);
+	delete self;
+	return 0;
+}
+#endif
+
+/* method: new of class  Fl_Chart */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_new00
+static int tolua_fltk_fltk_Fl_Chart_new00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isusertable(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,6,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,7,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
-  char* s = ((char*)  tolua_tostring(tolua_S,2,0));
-#ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'add'", NULL);
-#endif
+  int X = ((int)  tolua_tonumber(tolua_S,2,0));
+  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int W = ((int)  tolua_tonumber(tolua_S,4,0));
+  int H = ((int)  tolua_tonumber(tolua_S,5,0));
+  const char* L = ((const char*)  tolua_tostring(tolua_S,6,0));
  {
-  int tolua_ret = (int)  self->add(s);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  Fl_Chart* tolua_ret = (Fl_Chart*)  Mtolua_new((Fl_Chart)(X,Y,W,H,L));
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Chart");
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'add'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: add of class  Fl_Check_Browser */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_add01
-static int tolua_fltk_fltk_Fl_Check_Browser_add01(lua_State* tolua_S)
-{
- tolua_Error tolua_err;
+/* method: new_local of class  Fl_Chart */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_new00_local
+static int tolua_fltk_fltk_Fl_Chart_new00_local(lua_State* tolua_S)
+{
+ int result = tolua_fltk_fltk_Fl_Chart_new00(tolua_S);
+ if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
+ return result;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: add of class  Fl_Chart */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_add00
+static int tolua_fltk_fltk_Fl_Chart_add00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,3,1,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
-  char* s = ((char*)  tolua_tostring(tolua_S,2,0));
-  int b = ((int)  tolua_tonumber(tolua_S,3,0));
+  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
+  double val = ((double)  tolua_tonumber(tolua_S,2,0));
+  const char* str = ((const char*)  tolua_tostring(tolua_S,3,0));
+  unsigned col = ((unsigned)  tolua_tonumber(tolua_S,4,0));
 #ifndef TOLUA_RELEASE
  if (!self) tolua_error(tolua_S,"invalid 'self' in function 'add'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->add(s,b);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->add(val,str,col);
  }
  }
- return 1;
-tolua_lerror:
- return tolua_fltk_fltk_Fl_Check_Browser_add00(tolua_S);
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'add'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: check_all of class  Fl_Check_Browser */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_check_all00
-static int tolua_fltk_fltk_Fl_Check_Browser_check_all00(lua_State* tolua_S)
+/* method: autosize of class  Fl_Chart */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_autosize00
+static int tolua_fltk_fltk_Fl_Chart_autosize00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'check_all'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'autosize'", NULL);
 #endif
  {
-  self->check_all();
+ if(nparam < 2) {
+  unsigned char tolua_ret = ( unsigned char)  self->autosize();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  unsigned char opt = (( unsigned char)  tolua_tonumber(tolua_S,2,0));
+ self->autosize(opt);
+ return 0;
+ }
  }
  }
- return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'check_all'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'autosize'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: check_none of class  Fl_Check_Browser */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_check_none00
-static int tolua_fltk_fltk_Fl_Check_Browser_check_none00(lua_State* tolua_S)
+/* method: bounds of class  Fl_Chart */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_get_bounds00
+static int tolua_fltk_fltk_Fl_Chart_get_bounds00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,1,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
+  double a = ((double)  tolua_tonumber(tolua_S,2,0));
+  double b = ((double)  tolua_tonumber(tolua_S,3,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'check_none'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'bounds'", NULL);
 #endif
  {
-  self->check_none();
+  self->bounds(&a,&b);
+ tolua_pushnumber(tolua_S,(lua_Number)a);
+ tolua_pushnumber(tolua_S,(lua_Number)b);
  }
  }
- return 0;
+ return 2;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'check_none'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'get_bounds'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: checked of class  Fl_Check_Browser */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_checked00
-static int tolua_fltk_fltk_Fl_Check_Browser_checked00(lua_State* tolua_S)
+/* method: bounds of class  Fl_Chart */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_set_bounds00
+static int tolua_fltk_fltk_Fl_Chart_set_bounds00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
-  int item = ((int)  tolua_tonumber(tolua_S,2,0));
+  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
+  double a = ((double)  tolua_tonumber(tolua_S,2,0));
+  double b = ((double)  tolua_tonumber(tolua_S,3,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'checked'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'bounds'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->checked(item);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->bounds(a,b);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'checked'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'set_bounds'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: checked of class  Fl_Check_Browser */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_checked01
-static int tolua_fltk_fltk_Fl_Check_Browser_checked01(lua_State* tolua_S)
+/* method: clear of class  Fl_Chart */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_clear00
+static int tolua_fltk_fltk_Fl_Chart_clear00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
-  int item = ((int)  tolua_tonumber(tolua_S,2,0));
-  int b = ((int)  tolua_tonumber(tolua_S,3,0));
+  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'checked'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear'", NULL);
 #endif
  {
-  self->checked(item,b);
+  self->clear();
  }
  }
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_Fl_Check_Browser_checked00(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'clear'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear of class  Fl_Check_Browser */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_clear00
-static int tolua_fltk_fltk_Fl_Check_Browser_clear00(lua_State* tolua_S)
+/* method: insert of class  Fl_Chart */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_insert00
+static int tolua_fltk_fltk_Fl_Chart_insert00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,4,1,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
+  int ind = ((int)  tolua_tonumber(tolua_S,2,0));
+  double val = ((double)  tolua_tonumber(tolua_S,3,0));
+  const char* str = ((const char*)  tolua_tostring(tolua_S,4,0));
+  unsigned col = ((unsigned)  tolua_tonumber(tolua_S,5,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'insert'", NULL);
 #endif
  {
-  self->clear();
+  self->insert(ind,val,str,col);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'insert'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: nchecked of class  Fl_Check_Browser */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_nchecked00
-static int tolua_fltk_fltk_Fl_Check_Browser_nchecked00(lua_State* tolua_S)
+/* method: maxsize of class  Fl_Chart */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_maxsize00
+static int tolua_fltk_fltk_Fl_Chart_maxsize00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'nchecked'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'maxsize'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->nchecked();
+ if(nparam < 2) {
+  int tolua_ret = (int)  self->maxsize();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
+ self->maxsize(opt);
+ return 0;
+ }
  }
  }
- return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'nchecked'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'maxsize'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: nitems of class  Fl_Check_Browser */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_nitems00
-static int tolua_fltk_fltk_Fl_Check_Browser_nitems00(lua_State* tolua_S)
+/* method: replace of class  Fl_Chart */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_replace00
+static int tolua_fltk_fltk_Fl_Chart_replace00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,4,1,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
+  int ind = ((int)  tolua_tonumber(tolua_S,2,0));
+  double val = ((double)  tolua_tonumber(tolua_S,3,0));
+  const char* str = ((const char*)  tolua_tostring(tolua_S,4,0));
+  unsigned col = ((unsigned)  tolua_tonumber(tolua_S,5,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'nitems'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'replace'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->nitems();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->replace(ind,val,str,col);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'nitems'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'replace'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: remove of class  Fl_Check_Browser */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_remove00
-static int tolua_fltk_fltk_Fl_Check_Browser_remove00(lua_State* tolua_S)
+/* method: size of class  Fl_Chart */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_size00
+static int tolua_fltk_fltk_Fl_Chart_size00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
-  int item = ((int)  tolua_tonumber(tolua_S,2,0));
+  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'remove'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'size'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->remove(item);
+  int tolua_ret = (int)  self->size();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'remove'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'size'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: set_checked of class  Fl_Check_Browser */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_set_checked00
-static int tolua_fltk_fltk_Fl_Check_Browser_set_checked00(lua_State* tolua_S)
+/* method: size of class  Fl_Chart */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_size01
+static int tolua_fltk_fltk_Fl_Chart_size01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
-  int item = ((int)  tolua_tonumber(tolua_S,2,0));
+  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
+  int W = ((int)  tolua_tonumber(tolua_S,2,0));
+  int H = ((int)  tolua_tonumber(tolua_S,3,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'set_checked'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'size'", NULL);
 #endif
  {
-  self->set_checked(item);
+  self->size(W,H);
  }
  }
  return 0;
+tolua_lerror:
+ return tolua_fltk_fltk_Fl_Chart_size00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: textcolor of class  Fl_Chart */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_textcolor00
+static int tolua_fltk_fltk_Fl_Chart_textcolor00(lua_State* tolua_S)
+{
+ int nparam = lua_gettop(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'textcolor'", NULL);
+#endif
+ {
+ if(nparam < 2) {
+  unsigned int tolua_ret = ( unsigned int)  self->textcolor();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  unsigned int opt = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
+ self->textcolor(opt);
+ return 0;
+ }
+ }
+ }
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'set_checked'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'textcolor'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: text of class  Fl_Check_Browser */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_text00
-static int tolua_fltk_fltk_Fl_Check_Browser_text00(lua_State* tolua_S)
+/* method: textfont of class  Fl_Chart */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_textfont00
+static int tolua_fltk_fltk_Fl_Chart_textfont00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
-  int item = ((int)  tolua_tonumber(tolua_S,2,0));
+  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'text'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'textfont'", NULL);
 #endif
  {
-  char* tolua_ret = (char*)  self->text(item);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+ if(nparam < 2) {
+   int tolua_ret = (  int)  self->textfont();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+   int opt = ((  int)  tolua_tonumber(tolua_S,2,0));
+ self->textfont(opt);
+ return 0;
+ }
  }
  }
- return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'text'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'textfont'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: value of class  Fl_Check_Browser */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_value00
-static int tolua_fltk_fltk_Fl_Check_Browser_value00(lua_State* tolua_S)
+/* method: textsize of class  Fl_Chart */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Chart_textsize00
+static int tolua_fltk_fltk_Fl_Chart_textsize00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Chart",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Chart* self = (Fl_Chart*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'value'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'textsize'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->value();
+ if(nparam < 2) {
+   int tolua_ret = (  int)  self->textsize();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+   int opt = ((  int)  tolua_tonumber(tolua_S,2,0));
+ self->textsize(opt);
+ return 0;
+ }
  }
  }
- return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'value'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'textsize'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new of class  Fl_Clock_Output */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Clock_Output_new00
-static int tolua_fltk_fltk_Fl_Clock_Output_new00(lua_State* tolua_S)
+/* method: new of class  Fl_Check_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_new00
+static int tolua_fltk_fltk_Fl_Check_Browser_new00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertable(tolua_S,1,"Fl_Clock_Output",0,&tolua_err) ||
+ !tolua_isusertable(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
@@ -9503,14 +9975,14 @@ static int tolua_fltk_fltk_Fl_Clock_Output_new00(lua_State* tolua_S)
  else
 #endif
  {
-  int X = ((int)  tolua_tonumber(tolua_S,2,0));
-  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
-  int W = ((int)  tolua_tonumber(tolua_S,4,0));
-  int H = ((int)  tolua_tonumber(tolua_S,5,0));
-  const char* L = ((const char*)  tolua_tostring(tolua_S,6,0));
+  int x = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int w = ((int)  tolua_tonumber(tolua_S,4,0));
+  int h = ((int)  tolua_tonumber(tolua_S,5,0));
+  const char* l = ((const char*)  tolua_tostring(tolua_S,6,0));
  {
-  Fl_Clock_Output* tolua_ret = (Fl_Clock_Output*)  Mtolua_new((Fl_Clock_Output)(X,Y,W,H,L));
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Clock_Output");
+  Fl_Check_Browser* tolua_ret = (Fl_Check_Browser*)  Mtolua_new((Fl_Check_Browser)(x,y,w,h,l));
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Check_Browser");
  }
  }
  return 1;
@@ -9522,140 +9994,607 @@ static int tolua_fltk_fltk_Fl_Clock_Output_new00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new_local of class  Fl_Clock_Output */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Clock_Output_new00_local
-static int tolua_fltk_fltk_Fl_Clock_Output_new00_local(lua_State* tolua_S)
+/* method: new_local of class  Fl_Check_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_new00_local
+static int tolua_fltk_fltk_Fl_Check_Browser_new00_local(lua_State* tolua_S)
 {
- int result = tolua_fltk_fltk_Fl_Clock_Output_new00(tolua_S);
+ int result = tolua_fltk_fltk_Fl_Check_Browser_new00(tolua_S);
  if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
  return result;
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: hour of class  Fl_Clock_Output */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Clock_Output_hour00
-static int tolua_fltk_fltk_Fl_Clock_Output_hour00(lua_State* tolua_S)
+/* method: add of class  Fl_Check_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_add00
+static int tolua_fltk_fltk_Fl_Check_Browser_add00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Clock_Output",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Clock_Output* self = (Fl_Clock_Output*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+  char* s = ((char*)  tolua_tostring(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'hour'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'add'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->hour();
+  int tolua_ret = (int)  self->add(s);
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'hour'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'add'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: minute of class  Fl_Clock_Output */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Clock_Output_minute00
-static int tolua_fltk_fltk_Fl_Clock_Output_minute00(lua_State* tolua_S)
+/* method: add of class  Fl_Check_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_add01
+static int tolua_fltk_fltk_Fl_Check_Browser_add01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Clock_Output",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  Fl_Clock_Output* self = (Fl_Clock_Output*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+  char* s = ((char*)  tolua_tostring(tolua_S,2,0));
+  int b = ((int)  tolua_tonumber(tolua_S,3,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'minute'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'add'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->minute();
+  int tolua_ret = (int)  self->add(s,b);
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'minute'.",&tolua_err);
- return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_Fl_Check_Browser_add00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: second of class  Fl_Clock_Output */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Clock_Output_second00
-static int tolua_fltk_fltk_Fl_Clock_Output_second00(lua_State* tolua_S)
+/* method: check_all of class  Fl_Check_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_check_all00
+static int tolua_fltk_fltk_Fl_Check_Browser_check_all00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Clock_Output",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Clock_Output* self = (Fl_Clock_Output*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'second'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'check_all'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->second();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->check_all();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'second'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'check_all'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: value of class  Fl_Clock_Output */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Clock_Output_value00
-static int tolua_fltk_fltk_Fl_Clock_Output_value00(lua_State* tolua_S)
+/* method: check_none of class  Fl_Check_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_check_none00
+static int tolua_fltk_fltk_Fl_Check_Browser_check_none00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Clock_Output",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Clock_Output* self = (Fl_Clock_Output*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'value'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'check_none'", NULL);
 #endif
  {
- if(nparam < 2) {
-  unsigned long tolua_ret = ( unsigned long)  self->value();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
+  self->check_none();
+ }
+ }
+ return 0;
 #ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'check_none'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: checked of class  Fl_Check_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_checked00
+static int tolua_fltk_fltk_Fl_Check_Browser_checked00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+  int item = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'checked'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->checked(item);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'checked'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: checked of class  Fl_Check_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_checked01
+static int tolua_fltk_fltk_Fl_Check_Browser_checked01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+  int item = ((int)  tolua_tonumber(tolua_S,2,0));
+  int b = ((int)  tolua_tonumber(tolua_S,3,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'checked'", NULL);
+#endif
+ {
+  self->checked(item,b);
+ }
+ }
+ return 0;
+tolua_lerror:
+ return tolua_fltk_fltk_Fl_Check_Browser_checked00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: clear of class  Fl_Check_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_clear00
+static int tolua_fltk_fltk_Fl_Check_Browser_clear00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear'", NULL);
+#endif
+ {
+  self->clear();
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'clear'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: nchecked of class  Fl_Check_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_nchecked00
+static int tolua_fltk_fltk_Fl_Check_Browser_nchecked00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'nchecked'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->nchecked();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'nchecked'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: nitems of class  Fl_Check_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_nitems00
+static int tolua_fltk_fltk_Fl_Check_Browser_nitems00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'nitems'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->nitems();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'nitems'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: remove of class  Fl_Check_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_remove00
+static int tolua_fltk_fltk_Fl_Check_Browser_remove00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+  int item = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'remove'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->remove(item);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'remove'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: set_checked of class  Fl_Check_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_set_checked00
+static int tolua_fltk_fltk_Fl_Check_Browser_set_checked00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+  int item = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'set_checked'", NULL);
+#endif
+ {
+  self->set_checked(item);
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_checked'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: text of class  Fl_Check_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_text00
+static int tolua_fltk_fltk_Fl_Check_Browser_text00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+  int item = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'text'", NULL);
+#endif
+ {
+  char* tolua_ret = (char*)  self->text(item);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'text'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: value of class  Fl_Check_Browser */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Check_Browser_value00
+static int tolua_fltk_fltk_Fl_Check_Browser_value00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Check_Browser",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Check_Browser* self = (Fl_Check_Browser*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'value'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->value();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'value'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: new of class  Fl_Clock_Output */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Clock_Output_new00
+static int tolua_fltk_fltk_Fl_Clock_Output_new00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertable(tolua_S,1,"Fl_Clock_Output",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,6,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,7,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  int X = ((int)  tolua_tonumber(tolua_S,2,0));
+  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int W = ((int)  tolua_tonumber(tolua_S,4,0));
+  int H = ((int)  tolua_tonumber(tolua_S,5,0));
+  const char* L = ((const char*)  tolua_tostring(tolua_S,6,0));
+ {
+  Fl_Clock_Output* tolua_ret = (Fl_Clock_Output*)  Mtolua_new((Fl_Clock_Output)(X,Y,W,H,L));
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Clock_Output");
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: new_local of class  Fl_Clock_Output */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Clock_Output_new00_local
+static int tolua_fltk_fltk_Fl_Clock_Output_new00_local(lua_State* tolua_S)
+{
+ int result = tolua_fltk_fltk_Fl_Clock_Output_new00(tolua_S);
+ if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
+ return result;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: hour of class  Fl_Clock_Output */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Clock_Output_hour00
+static int tolua_fltk_fltk_Fl_Clock_Output_hour00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Clock_Output",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Clock_Output* self = (Fl_Clock_Output*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'hour'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->hour();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'hour'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: minute of class  Fl_Clock_Output */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Clock_Output_minute00
+static int tolua_fltk_fltk_Fl_Clock_Output_minute00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Clock_Output",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Clock_Output* self = (Fl_Clock_Output*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'minute'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->minute();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'minute'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: second of class  Fl_Clock_Output */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Clock_Output_second00
+static int tolua_fltk_fltk_Fl_Clock_Output_second00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Clock_Output",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Clock_Output* self = (Fl_Clock_Output*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'second'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->second();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'second'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: value of class  Fl_Clock_Output */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Clock_Output_value00
+static int tolua_fltk_fltk_Fl_Clock_Output_value00(lua_State* tolua_S)
+{
+ int nparam = lua_gettop(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Clock_Output",0,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Clock_Output* self = (Fl_Clock_Output*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'value'", NULL);
+#endif
+ {
+ if(nparam < 2) {
+  unsigned long tolua_ret = ( unsigned long)  self->value();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
   unsigned long opt = (( unsigned long)  tolua_tonumber(tolua_S,2,0));
  self->value(opt);
  return 0;
@@ -10427,7 +11366,7 @@ static int tolua_fltk_fltk_Fl_Device_type00(lua_State* tolua_S)
  class Lua__Fl_Device : public Fl_Device, public ToluaBase {
 public:
 	 Fl_Device*  set_current( void ) {
-		if (push_method("set_current",  tolua_fltk_fltk_Fl_Device_set_current00)) {
+		if (push_method(0, "set_current",  tolua_fltk_fltk_Fl_Device_set_current00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Device*  tolua_ret = ( Fl_Device* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -11009,14 +11948,14 @@ static int tolua_fltk_fltk_Fl_Abstract_Printer_untranslate00(lua_State* tolua_S)
  class Lua__Fl_Abstract_Printer : public Fl_Abstract_Printer, public ToluaBase {
 public:
 	 void  end_job( void ) {
-		if (push_method("end_job",  tolua_fltk_fltk_Fl_Abstract_Printer_end_job00)) {
+		if (push_method(0, "end_job",  tolua_fltk_fltk_Fl_Abstract_Printer_end_job00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Abstract_Printer:: end_job();
 		};
 	};
 	 int  end_page( void ) {
-		if (push_method("end_page",  tolua_fltk_fltk_Fl_Abstract_Printer_end_page00)) {
+		if (push_method(1, "end_page",  tolua_fltk_fltk_Fl_Abstract_Printer_end_page00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -11026,7 +11965,7 @@ public:
 		};
 	};
 	 void  margins( int* left = 0, int* top = 0, int* right = 0, int* bottom = 0) {
-		if (push_method("margins",  tolua_fltk_fltk_Fl_Abstract_Printer_margins00)) {
+		if (push_method(2, "margins",  tolua_fltk_fltk_Fl_Abstract_Printer_margins00)) {
 			tolua_pushuserdata(lua_state, (void*)left);
 			tolua_pushuserdata(lua_state, (void*)top);
 			tolua_pushuserdata(lua_state, (void*)right);
@@ -11037,7 +11976,7 @@ public:
 		};
 	};
 	 void  origin( int x, int y) {
-		if (push_method("origin",  tolua_fltk_fltk_Fl_Abstract_Printer_origin00)) {
+		if (push_method(3, "origin",  tolua_fltk_fltk_Fl_Abstract_Printer_origin00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -11046,7 +11985,7 @@ public:
 		};
 	};
 	 int  printable_rect( int* w = 0, int* h = 0) {
-		if (push_method("printable_rect",  tolua_fltk_fltk_Fl_Abstract_Printer_printable_rect00)) {
+		if (push_method(4, "printable_rect",  tolua_fltk_fltk_Fl_Abstract_Printer_printable_rect00)) {
 			tolua_pushuserdata(lua_state, (void*)w);
 			tolua_pushuserdata(lua_state, (void*)h);
 			ToluaBase::dbcall(lua_state, 3, 1);
@@ -11058,7 +11997,7 @@ public:
 		};
 	};
 	 void  rotate( float angle) {
-		if (push_method("rotate",  tolua_fltk_fltk_Fl_Abstract_Printer_rotate00)) {
+		if (push_method(5, "rotate",  tolua_fltk_fltk_Fl_Abstract_Printer_rotate00)) {
 			tolua_pushnumber(lua_state, (lua_Number)angle);
 			ToluaBase::dbcall(lua_state, 2, 0);
 		} else {
@@ -11066,7 +12005,7 @@ public:
 		};
 	};
 	 void  scale( float scale_x, float scale_y) {
-		if (push_method("scale",  tolua_fltk_fltk_Fl_Abstract_Printer_scale00)) {
+		if (push_method(6, "scale",  tolua_fltk_fltk_Fl_Abstract_Printer_scale00)) {
 			tolua_pushnumber(lua_state, (lua_Number)scale_x);
 			tolua_pushnumber(lua_state, (lua_Number)scale_y);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -11075,7 +12014,7 @@ public:
 		};
 	};
 	 int  start_job( int pagecount, int* frompage = NULL, int* topage = NULL) {
-		if (push_method("start_job",  tolua_fltk_fltk_Fl_Abstract_Printer_start_job00)) {
+		if (push_method(7, "start_job",  tolua_fltk_fltk_Fl_Abstract_Printer_start_job00)) {
 			tolua_pushnumber(lua_state, (lua_Number)pagecount);
 			tolua_pushuserdata(lua_state, (void*)frompage);
 			tolua_pushuserdata(lua_state, (void*)topage);
@@ -11088,7 +12027,7 @@ public:
 		};
 	};
 	 int  start_page( void ) {
-		if (push_method("start_page",  tolua_fltk_fltk_Fl_Abstract_Printer_start_page00)) {
+		if (push_method(8, "start_page",  tolua_fltk_fltk_Fl_Abstract_Printer_start_page00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -11098,7 +12037,7 @@ public:
 		};
 	};
 	 void  translate( int x, int y) {
-		if (push_method("translate",  tolua_fltk_fltk_Fl_Abstract_Printer_translate00)) {
+		if (push_method(9, "translate",  tolua_fltk_fltk_Fl_Abstract_Printer_translate00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -11107,14 +12046,14 @@ public:
 		};
 	};
 	 void  untranslate( void ) {
-		if (push_method("untranslate",  tolua_fltk_fltk_Fl_Abstract_Printer_untranslate00)) {
+		if (push_method(10, "untranslate",  tolua_fltk_fltk_Fl_Abstract_Printer_untranslate00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Abstract_Printer:: untranslate();
 		};
 	};
 	 Fl_Device*  set_current( void ) {
-		if (push_method("set_current",  tolua_fltk_fltk_Fl_Device_set_current00)) {
+		if (push_method(11, "set_current",  tolua_fltk_fltk_Fl_Device_set_current00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Device*  tolua_ret = ( Fl_Device* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -15084,6 +16023,48 @@ static int tolua_fltk_fltk_Fl_Help_View_line3100(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: async_images of class  Fl_Help_View */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Help_View_async_images00
+static int tolua_fltk_fltk_Fl_Help_View_async_images00(lua_State* tolua_S)
+{
+ int nparam = lua_gettop(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Help_View",0,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Help_View* self = (Fl_Help_View*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'async_images'", NULL);
+#endif
+ {
+ if(nparam < 2) {
+  int tolua_ret = (int)  self->async_images();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
+ self->async_images(opt);
+ return 0;
+ }
+ }
+ }
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'async_images'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: new of class  Fl_Hold_Browser */
 #ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Hold_Browser_new00
 static int tolua_fltk_fltk_Fl_Hold_Browser_new00(lua_State* tolua_S)
@@ -15169,7 +16150,7 @@ static int tolua_fltk_fltk_Fl_Hold_Browser_handle00(lua_State* tolua_S)
  class Lua__Fl_Hold_Browser : public Fl_Hold_Browser, public ToluaBase {
 public:
 	 int  handle( int event) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Hold_Browser_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Hold_Browser_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)event);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -15180,7 +16161,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -15190,7 +16171,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -15200,7 +16181,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -15209,21 +16190,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Hold_Browser:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Hold_Browser:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -15234,7 +16215,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Hold_Browser:: show();
@@ -15439,6 +16420,35 @@ static int tolua_fltk_fltk_Fl_Image_new00_local(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: delete of class  Fl_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Image_delete00
+static int tolua_fltk_fltk_Fl_Image_delete00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Image",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Image* self = (Fl_Image*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'delete'", NULL);
+#endif
+ Mtolua_delete(self);
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'delete'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: color_average of class  Fl_Image */
 #ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Image_color_average00
 static int tolua_fltk_fltk_Fl_Image_color_average00(lua_State* tolua_S)
@@ -15927,7 +16937,7 @@ static int tolua_fltk_fltk_Fl_Image_w00(lua_State* tolua_S)
  class Lua__Fl_Image : public Fl_Image, public ToluaBase {
 public:
 	 void  color_average( unsigned int c, float i) {
-		if (push_method("color_average",  tolua_fltk_fltk_Fl_Image_color_average00)) {
+		if (push_method(0, "color_average",  tolua_fltk_fltk_Fl_Image_color_average00)) {
 			tolua_pushnumber(lua_state, (lua_Number)c);
 			tolua_pushnumber(lua_state, (lua_Number)i);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -15936,7 +16946,7 @@ public:
 		};
 	};
 	 Fl_Image*  copy( int W, int H) {
-		if (push_method("copy",  tolua_fltk_fltk_Fl_Image_copy00)) {
+		if (push_method(1, "copy",  tolua_fltk_fltk_Fl_Image_copy00)) {
 			tolua_pushnumber(lua_state, (lua_Number)W);
 			tolua_pushnumber(lua_state, (lua_Number)H);
 			ToluaBase::dbcall(lua_state, 3, 1);
@@ -15948,14 +16958,14 @@ public:
 		};
 	};
 	 void  desaturate( void ) {
-		if (push_method("desaturate",  tolua_fltk_fltk_Fl_Image_desaturate00)) {
+		if (push_method(2, "desaturate",  tolua_fltk_fltk_Fl_Image_desaturate00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Image:: desaturate();
 		};
 	};
 	 void  draw( int X, int Y, int W, int H, int cx = 0, int cy = 0) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Image_draw00)) {
+		if (push_method(3, "draw",  tolua_fltk_fltk_Fl_Image_draw00)) {
 			tolua_pushnumber(lua_state, (lua_Number)X);
 			tolua_pushnumber(lua_state, (lua_Number)Y);
 			tolua_pushnumber(lua_state, (lua_Number)W);
@@ -15968,7 +16978,7 @@ public:
 		};
 	};
 	 void  label( Fl_Widget* w) {
-		if (push_method("label",  tolua_fltk_fltk_Fl_Image_label00)) {
+		if (push_method(4, "label",  tolua_fltk_fltk_Fl_Image_label00)) {
 			tolua_pushusertype(lua_state, (void*)w, "Fl_Widget");
 			ToluaBase::dbcall(lua_state, 2, 0);
 		} else {
@@ -15976,7 +16986,7 @@ public:
 		};
 	};
 	 void  label( Fl_Menu_Item* m) {
-		if (push_method("label",  tolua_fltk_fltk_Fl_Image_label01)) {
+		if (push_method(5, "label",  tolua_fltk_fltk_Fl_Image_label01)) {
 			tolua_pushusertype(lua_state, (void*)m, "Fl_Menu_Item");
 			ToluaBase::dbcall(lua_state, 2, 0);
 		} else {
@@ -15984,7 +16994,7 @@ public:
 		};
 	};
 	 void  uncache( void ) {
-		if (push_method("uncache",  tolua_fltk_fltk_Fl_Image_uncache00)) {
+		if (push_method(6, "uncache",  tolua_fltk_fltk_Fl_Image_uncache00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Image:: uncache();
@@ -16329,6 +17339,35 @@ static int tolua_fltk_fltk_Lua__Fl_Image_new00_local(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: delete of class  Lua__Fl_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Image_delete00
+static int tolua_fltk_fltk_Lua__Fl_Image_delete00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Lua__Fl_Image",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Lua__Fl_Image* self = (Lua__Fl_Image*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'delete'", NULL);
+#endif
+ Mtolua_delete(self);
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'delete'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 
 /* function to release collected object via destructor */
 #ifdef __cplusplus
@@ -16668,7 +17707,7 @@ static int tolua_fltk_fltk_Fl_Pixmap_uncache00(lua_State* tolua_S)
  class Lua__Fl_Pixmap : public Fl_Pixmap, public ToluaBase {
 public:
 	 void  color_average( unsigned int c, float i) {
-		if (push_method("color_average",  tolua_fltk_fltk_Fl_Pixmap_color_average00)) {
+		if (push_method(0, "color_average",  tolua_fltk_fltk_Fl_Pixmap_color_average00)) {
 			tolua_pushnumber(lua_state, (lua_Number)c);
 			tolua_pushnumber(lua_state, (lua_Number)i);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -16677,7 +17716,7 @@ public:
 		};
 	};
 	 Fl_Image*  copy( int W, int H) {
-		if (push_method("copy",  tolua_fltk_fltk_Fl_Pixmap_copy00)) {
+		if (push_method(1, "copy",  tolua_fltk_fltk_Fl_Pixmap_copy00)) {
 			tolua_pushnumber(lua_state, (lua_Number)W);
 			tolua_pushnumber(lua_state, (lua_Number)H);
 			ToluaBase::dbcall(lua_state, 3, 1);
@@ -16689,14 +17728,14 @@ public:
 		};
 	};
 	 void  desaturate( void ) {
-		if (push_method("desaturate",  tolua_fltk_fltk_Fl_Pixmap_desaturate00)) {
+		if (push_method(2, "desaturate",  tolua_fltk_fltk_Fl_Pixmap_desaturate00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Pixmap:: desaturate();
 		};
 	};
 	 void  draw( int X, int Y, int W, int H, int cx = 0, int cy = 0) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Pixmap_draw00)) {
+		if (push_method(3, "draw",  tolua_fltk_fltk_Fl_Pixmap_draw00)) {
 			tolua_pushnumber(lua_state, (lua_Number)X);
 			tolua_pushnumber(lua_state, (lua_Number)Y);
 			tolua_pushnumber(lua_state, (lua_Number)W);
@@ -16709,7 +17748,7 @@ public:
 		};
 	};
 	 void  label( Fl_Widget* w) {
-		if (push_method("label",  tolua_fltk_fltk_Fl_Pixmap_label00)) {
+		if (push_method(4, "label",  tolua_fltk_fltk_Fl_Pixmap_label00)) {
 			tolua_pushusertype(lua_state, (void*)w, "Fl_Widget");
 			ToluaBase::dbcall(lua_state, 2, 0);
 		} else {
@@ -16717,7 +17756,7 @@ public:
 		};
 	};
 	 void  label( Fl_Menu_Item* m) {
-		if (push_method("label",  tolua_fltk_fltk_Fl_Pixmap_label01)) {
+		if (push_method(5, "label",  tolua_fltk_fltk_Fl_Pixmap_label01)) {
 			tolua_pushusertype(lua_state, (void*)m, "Fl_Menu_Item");
 			ToluaBase::dbcall(lua_state, 2, 0);
 		} else {
@@ -16725,7 +17764,7 @@ public:
 		};
 	};
 	 void  uncache( void ) {
-		if (push_method("uncache",  tolua_fltk_fltk_Fl_Pixmap_uncache00)) {
+		if (push_method(6, "uncache",  tolua_fltk_fltk_Fl_Pixmap_uncache00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Pixmap:: uncache();
@@ -18141,7 +19180,7 @@ static int tolua_fltk_fltk_Fl_Input_handle00(lua_State* tolua_S)
  class Lua__Fl_Input : public Fl_Input, public ToluaBase {
 public:
 	 int  handle( int tolua_var_49) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Input_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Input_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_49);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -18152,7 +19191,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -18162,7 +19201,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -18172,7 +19211,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -18181,21 +19220,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Input:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Input:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -18206,7 +19245,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Input:: show();
@@ -18664,7 +19703,7 @@ tolua_lerror:
  class Lua__Fl_File_Input : public Fl_File_Input, public ToluaBase {
 public:
 	 int  handle( int event) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_File_Input_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_File_Input_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)event);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -18675,7 +19714,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -18685,7 +19724,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -18695,7 +19734,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -18704,21 +19743,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_File_Input:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_File_Input:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -18729,7 +19768,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_File_Input:: show();
@@ -18975,7 +20014,7 @@ static int tolua_fltk_fltk_Fl_Float_Input_handle00(lua_State* tolua_S)
  class Lua__Fl_Float_Input : public Fl_Float_Input, public ToluaBase {
 public:
 	 int  handle( int tolua_var_50) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Float_Input_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Float_Input_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_50);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -18986,7 +20025,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -18996,7 +20035,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -19006,7 +20045,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -19015,21 +20054,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Float_Input:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Float_Input:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -19040,7 +20079,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Float_Input:: show();
@@ -19865,7 +20904,7 @@ static int tolua_fltk_fltk_Fl_Int_Input_handle00(lua_State* tolua_S)
  class Lua__Fl_Int_Input : public Fl_Int_Input, public ToluaBase {
 public:
 	 int  handle( int tolua_var_51) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Int_Input_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Int_Input_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_51);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -19876,7 +20915,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -19886,7 +20925,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -19896,7 +20935,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -19905,21 +20944,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Int_Input:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Int_Input:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -19930,7 +20969,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Int_Input:: show();
@@ -20254,7 +21293,7 @@ static int tolua_fltk_fltk_Fl_Light_Button_handle00(lua_State* tolua_S)
  class Lua__Fl_Light_Button : public Fl_Light_Button, public ToluaBase {
 public:
 	 int  handle( int tolua_var_57) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Light_Button_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Light_Button_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_57);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -20265,14 +21304,14 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  NULL)) {
+		if (push_method(1, "draw",  NULL)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Light_Button:: draw();
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(2, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -20282,7 +21321,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(3, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -20292,7 +21331,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(4, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -20301,14 +21340,14 @@ public:
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Light_Button:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -20319,7 +21358,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Light_Button:: show();
@@ -23312,7 +24351,7 @@ tolua_lerror:
  class Lua__Fl_Choice : public Fl_Choice, public ToluaBase {
 public:
 	 int  handle( int tolua_var_69) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Choice_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Choice_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_69);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -23323,7 +24362,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -23333,7 +24372,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -23343,7 +24382,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -23352,21 +24391,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Choice:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Choice:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -23377,7 +24416,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Choice:: show();
@@ -23623,7 +24662,7 @@ static int tolua_fltk_fltk_Fl_Menu_Bar_handle00(lua_State* tolua_S)
  class Lua__Fl_Menu_Bar : public Fl_Menu_Bar, public ToluaBase {
 public:
 	 int  handle( int tolua_var_70) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Menu_Bar_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Menu_Bar_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_70);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -23634,7 +24673,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -23644,7 +24683,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -23654,7 +24693,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -23663,21 +24702,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Menu_Bar:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Menu_Bar:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -23688,7 +24727,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Menu_Bar:: show();
@@ -23966,7 +25005,7 @@ static int tolua_fltk_fltk_Fl_Menu_Button_popup00(lua_State* tolua_S)
  class Lua__Fl_Menu_Button : public Fl_Menu_Button, public ToluaBase {
 public:
 	 int  handle( int tolua_var_76) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Menu_Button_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Menu_Button_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_76);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -23977,7 +25016,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -23987,7 +25026,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -23997,7 +25036,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -24006,21 +25045,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Menu_Button:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Menu_Button:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -24031,7 +25070,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Menu_Button:: show();
@@ -24277,7 +25316,7 @@ static int tolua_fltk_fltk_Fl_Multi_Browser_handle00(lua_State* tolua_S)
  class Lua__Fl_Multi_Browser : public Fl_Multi_Browser, public ToluaBase {
 public:
 	 int  handle( int tolua_var_77) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Multi_Browser_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Multi_Browser_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_77);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -24288,7 +25327,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -24298,7 +25337,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -24308,7 +25347,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -24317,21 +25356,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Multi_Browser:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Multi_Browser:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -24342,7 +25381,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Multi_Browser:: show();
@@ -24649,7 +25688,7 @@ static int tolua_fltk_fltk_Fl_Multiline_Input_handle00(lua_State* tolua_S)
  class Lua__Fl_Multiline_Input : public Fl_Multiline_Input, public ToluaBase {
 public:
 	 int  handle( int tolua_var_80) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Multiline_Input_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Multiline_Input_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_80);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -24660,7 +25699,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -24670,7 +25709,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -24680,7 +25719,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -24689,21 +25728,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Multiline_Input:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Multiline_Input:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -24714,7 +25753,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Multiline_Input:: show();
@@ -26239,7 +27278,7 @@ static int tolua_fltk_fltk_Fl_Positioner_yvalue00(lua_State* tolua_S)
  class Lua__Fl_Positioner : public Fl_Positioner, public ToluaBase {
 public:
 	 int  handle( int tolua_var_81) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Positioner_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Positioner_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_81);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -26250,7 +27289,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -26260,7 +27299,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -26270,7 +27309,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -26279,21 +27318,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Positioner:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Positioner:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -26304,7 +27343,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Positioner:: show();
@@ -28290,6 +29329,39 @@ static int tolua_fltk_fltk_Fl_RGB_Image_copy00(lua_State* tolua_S)
 /* method: copy of class  Fl_RGB_Image */
 #ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_RGB_Image_copy01
 static int tolua_fltk_fltk_Fl_RGB_Image_copy01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_RGB_Image",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  Fl_RGB_Image* self = (Fl_RGB_Image*)  tolua_tousertype(tolua_S,1,0);
+  int W = ((int)  tolua_tonumber(tolua_S,2,0));
+  int H = ((int)  tolua_tonumber(tolua_S,3,0));
+  Fl_RGB_Scaling filter = ((Fl_RGB_Scaling) (int)  tolua_tonumber(tolua_S,4,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'copy'", NULL);
+#endif
+ {
+  Fl_Image* tolua_ret = (Fl_Image*)  self->copy(W,H,filter);
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Image");
+ }
+ }
+ return 1;
+tolua_lerror:
+ return tolua_fltk_fltk_Fl_RGB_Image_copy00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: copy of class  Fl_RGB_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_RGB_Image_copy02
+static int tolua_fltk_fltk_Fl_RGB_Image_copy02(lua_State* tolua_S)
 {
  tolua_Error tolua_err;
  if (
@@ -28310,7 +29382,7 @@ static int tolua_fltk_fltk_Fl_RGB_Image_copy01(lua_State* tolua_S)
  }
  return 1;
 tolua_lerror:
- return tolua_fltk_fltk_Fl_RGB_Image_copy00(tolua_S);
+ return tolua_fltk_fltk_Fl_RGB_Image_copy01(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
@@ -28479,6 +29551,58 @@ tolua_lerror:
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: scaling of class  Fl_RGB_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_RGB_Image_scaling00
+static int tolua_fltk_fltk_Fl_RGB_Image_scaling00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertable(tolua_S,1,"Fl_RGB_Image",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+ {
+  Fl_RGB_Scaling tolua_ret = (Fl_RGB_Scaling)  Fl_RGB_Image::scaling();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'scaling'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: scaling of class  Fl_RGB_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_RGB_Image_scaling01
+static int tolua_fltk_fltk_Fl_RGB_Image_scaling01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertable(tolua_S,1,"Fl_RGB_Image",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  Fl_RGB_Scaling s = ((Fl_RGB_Scaling) (int)  tolua_tonumber(tolua_S,2,0));
+ {
+  Fl_RGB_Image::scaling(s);
+ }
+ }
+ return 0;
+tolua_lerror:
+ return tolua_fltk_fltk_Fl_RGB_Image_scaling00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: uncache of class  Fl_RGB_Image */
 #ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_RGB_Image_uncache00
 static int tolua_fltk_fltk_Fl_RGB_Image_uncache00(lua_State* tolua_S)
@@ -28513,7 +29637,7 @@ static int tolua_fltk_fltk_Fl_RGB_Image_uncache00(lua_State* tolua_S)
  class Lua__Fl_RGB_Image : public Fl_RGB_Image, public ToluaBase {
 public:
 	 void  color_average( unsigned int c, float i) {
-		if (push_method("color_average",  tolua_fltk_fltk_Fl_RGB_Image_color_average00)) {
+		if (push_method(0, "color_average",  tolua_fltk_fltk_Fl_RGB_Image_color_average00)) {
 			tolua_pushnumber(lua_state, (lua_Number)c);
 			tolua_pushnumber(lua_state, (lua_Number)i);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -28522,7 +29646,7 @@ public:
 		};
 	};
 	 Fl_Image*  copy( int W, int H) {
-		if (push_method("copy",  tolua_fltk_fltk_Fl_RGB_Image_copy00)) {
+		if (push_method(1, "copy",  tolua_fltk_fltk_Fl_RGB_Image_copy00)) {
 			tolua_pushnumber(lua_state, (lua_Number)W);
 			tolua_pushnumber(lua_state, (lua_Number)H);
 			ToluaBase::dbcall(lua_state, 3, 1);
@@ -28534,14 +29658,14 @@ public:
 		};
 	};
 	 void  desaturate( void ) {
-		if (push_method("desaturate",  tolua_fltk_fltk_Fl_RGB_Image_desaturate00)) {
+		if (push_method(2, "desaturate",  tolua_fltk_fltk_Fl_RGB_Image_desaturate00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_RGB_Image:: desaturate();
 		};
 	};
 	 void  draw( int X, int Y, int W, int H, int cx = 0, int cy = 0) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_RGB_Image_draw00)) {
+		if (push_method(3, "draw",  tolua_fltk_fltk_Fl_RGB_Image_draw00)) {
 			tolua_pushnumber(lua_state, (lua_Number)X);
 			tolua_pushnumber(lua_state, (lua_Number)Y);
 			tolua_pushnumber(lua_state, (lua_Number)W);
@@ -28554,7 +29678,7 @@ public:
 		};
 	};
 	 void  label( Fl_Widget* w) {
-		if (push_method("label",  tolua_fltk_fltk_Fl_RGB_Image_label00)) {
+		if (push_method(4, "label",  tolua_fltk_fltk_Fl_RGB_Image_label00)) {
 			tolua_pushusertype(lua_state, (void*)w, "Fl_Widget");
 			ToluaBase::dbcall(lua_state, 2, 0);
 		} else {
@@ -28562,7 +29686,7 @@ public:
 		};
 	};
 	 void  label( Fl_Menu_Item* m) {
-		if (push_method("label",  tolua_fltk_fltk_Fl_RGB_Image_label01)) {
+		if (push_method(5, "label",  tolua_fltk_fltk_Fl_RGB_Image_label01)) {
 			tolua_pushusertype(lua_state, (void*)m, "Fl_Menu_Item");
 			ToluaBase::dbcall(lua_state, 2, 0);
 		} else {
@@ -28570,7 +29694,7 @@ public:
 		};
 	};
 	 void  uncache( void ) {
-		if (push_method("uncache",  tolua_fltk_fltk_Fl_RGB_Image_uncache00)) {
+		if (push_method(6, "uncache",  tolua_fltk_fltk_Fl_RGB_Image_uncache00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_RGB_Image:: uncache();
@@ -29286,7 +30410,7 @@ static int tolua_fltk_fltk_Fl_Bitmap_uncache00(lua_State* tolua_S)
  class Lua__Fl_Bitmap : public Fl_Bitmap, public ToluaBase {
 public:
 	 Fl_Image*  copy( int W, int H) {
-		if (push_method("copy",  tolua_fltk_fltk_Fl_Bitmap_copy00)) {
+		if (push_method(0, "copy",  tolua_fltk_fltk_Fl_Bitmap_copy00)) {
 			tolua_pushnumber(lua_state, (lua_Number)W);
 			tolua_pushnumber(lua_state, (lua_Number)H);
 			ToluaBase::dbcall(lua_state, 3, 1);
@@ -29298,7 +30422,7 @@ public:
 		};
 	};
 	 void  draw( int X, int Y, int W, int H, int cx = 0, int cy = 0) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Bitmap_draw00)) {
+		if (push_method(1, "draw",  tolua_fltk_fltk_Fl_Bitmap_draw00)) {
 			tolua_pushnumber(lua_state, (lua_Number)X);
 			tolua_pushnumber(lua_state, (lua_Number)Y);
 			tolua_pushnumber(lua_state, (lua_Number)W);
@@ -29311,7 +30435,7 @@ public:
 		};
 	};
 	 void  label( Fl_Widget* w) {
-		if (push_method("label",  tolua_fltk_fltk_Fl_Bitmap_label00)) {
+		if (push_method(2, "label",  tolua_fltk_fltk_Fl_Bitmap_label00)) {
 			tolua_pushusertype(lua_state, (void*)w, "Fl_Widget");
 			ToluaBase::dbcall(lua_state, 2, 0);
 		} else {
@@ -29319,7 +30443,7 @@ public:
 		};
 	};
 	 void  label( Fl_Menu_Item* m) {
-		if (push_method("label",  tolua_fltk_fltk_Fl_Bitmap_label01)) {
+		if (push_method(3, "label",  tolua_fltk_fltk_Fl_Bitmap_label01)) {
 			tolua_pushusertype(lua_state, (void*)m, "Fl_Menu_Item");
 			ToluaBase::dbcall(lua_state, 2, 0);
 		} else {
@@ -29327,14 +30451,14 @@ public:
 		};
 	};
 	 void  uncache( void ) {
-		if (push_method("uncache",  tolua_fltk_fltk_Fl_Bitmap_uncache00)) {
+		if (push_method(4, "uncache",  tolua_fltk_fltk_Fl_Bitmap_uncache00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Bitmap:: uncache();
 		};
 	};
 	 void  color_average( unsigned int c, float i) {
-		if (push_method("color_average",  tolua_fltk_fltk_Fl_Image_color_average00)) {
+		if (push_method(5, "color_average",  tolua_fltk_fltk_Fl_Image_color_average00)) {
 			tolua_pushnumber(lua_state, (lua_Number)c);
 			tolua_pushnumber(lua_state, (lua_Number)i);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -29343,7 +30467,7 @@ public:
 		};
 	};
 	 void  desaturate( void ) {
-		if (push_method("desaturate",  tolua_fltk_fltk_Fl_Image_desaturate00)) {
+		if (push_method(6, "desaturate",  tolua_fltk_fltk_Fl_Image_desaturate00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Bitmap:: desaturate();
@@ -30482,7 +31606,7 @@ static int tolua_fltk_fltk_Fl_Scroll_yposition00(lua_State* tolua_S)
  class Lua__Fl_Scroll : public Fl_Scroll, public ToluaBase {
 public:
 	 int  handle( int tolua_var_93) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Scroll_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Scroll_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_93);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -30493,7 +31617,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -30503,7 +31627,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -30513,7 +31637,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -30522,21 +31646,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Scroll:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Scroll:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -30547,7 +31671,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Scroll:: show();
@@ -30841,7 +31965,7 @@ static int tolua_fltk_fltk_Fl_Select_Browser_handle00(lua_State* tolua_S)
  class Lua__Fl_Select_Browser : public Fl_Select_Browser, public ToluaBase {
 public:
 	 int  handle( int tolua_var_100) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Select_Browser_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Select_Browser_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_100);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -30852,7 +31976,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -30862,7 +31986,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -30872,7 +31996,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -30881,21 +32005,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Select_Browser:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Select_Browser:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -30906,7 +32030,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Select_Browser:: show();
@@ -31096,6 +32220,197 @@ static int tolua_fltk_fltk_Fl_Shared_Image_add_handler00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: cache_bytes of class  Fl_Shared_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Shared_Image_cache_bytes00
+static int tolua_fltk_fltk_Fl_Shared_Image_cache_bytes00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertable(tolua_S,1,"Fl_Shared_Image",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+ {
+  unsigned long tolua_ret = (unsigned long)  Fl_Shared_Image::cache_bytes();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cache_bytes'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: cache_evictions of class  Fl_Shared_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Shared_Image_cache_evictions00
+static int tolua_fltk_fltk_Fl_Shared_Image_cache_evictions00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertable(tolua_S,1,"Fl_Shared_Image",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+ {
+  int tolua_ret = (int)  Fl_Shared_Image::cache_evictions();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cache_evictions'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: cache_hits of class  Fl_Shared_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Shared_Image_cache_hits00
+static int tolua_fltk_fltk_Fl_Shared_Image_cache_hits00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertable(tolua_S,1,"Fl_Shared_Image",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+ {
+  int tolua_ret = (int)  Fl_Shared_Image::cache_hits();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cache_hits'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: cache_misses of class  Fl_Shared_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Shared_Image_cache_misses00
+static int tolua_fltk_fltk_Fl_Shared_Image_cache_misses00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertable(tolua_S,1,"Fl_Shared_Image",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+ {
+  int tolua_ret = (int)  Fl_Shared_Image::cache_misses();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cache_misses'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: cache_size of class  Fl_Shared_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Shared_Image_cache_size00
+static int tolua_fltk_fltk_Fl_Shared_Image_cache_size00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertable(tolua_S,1,"Fl_Shared_Image",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+ {
+  unsigned long tolua_ret = (unsigned long)  Fl_Shared_Image::cache_size();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cache_size'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: cache_size of class  Fl_Shared_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Shared_Image_cache_size01
+static int tolua_fltk_fltk_Fl_Shared_Image_cache_size01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertable(tolua_S,1,"Fl_Shared_Image",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  unsigned long bytes = ((unsigned long)  tolua_tonumber(tolua_S,2,0));
+ {
+  Fl_Shared_Image::cache_size(bytes);
+ }
+ }
+ return 0;
+tolua_lerror:
+ return tolua_fltk_fltk_Fl_Shared_Image_cache_size00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: clear_cache_stats of class  Fl_Shared_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Shared_Image_clear_cache_stats00
+static int tolua_fltk_fltk_Fl_Shared_Image_clear_cache_stats00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertable(tolua_S,1,"Fl_Shared_Image",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+ {
+  Fl_Shared_Image::clear_cache_stats();
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'clear_cache_stats'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: color_average of class  Fl_Shared_Image */
 #ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Shared_Image_color_average00
 static int tolua_fltk_fltk_Fl_Shared_Image_color_average00(lua_State* tolua_S)
@@ -31366,6 +32681,38 @@ static int tolua_fltk_fltk_Fl_Shared_Image_get00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: loading of class  Fl_Shared_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Shared_Image_loading00
+static int tolua_fltk_fltk_Fl_Shared_Image_loading00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Shared_Image",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Shared_Image* self = (Fl_Shared_Image*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'loading'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->loading();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'loading'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: name of class  Fl_Shared_Image */
 #ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Shared_Image_name00
 static int tolua_fltk_fltk_Fl_Shared_Image_name00(lua_State* tolua_S)
@@ -31426,6 +32773,42 @@ static int tolua_fltk_fltk_Fl_Shared_Image_num_images00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: probe of class  Fl_Shared_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Shared_Image_probe00
+static int tolua_fltk_fltk_Fl_Shared_Image_probe00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertable(tolua_S,1,"Fl_Shared_Image",0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  const char* n = ((const char*)  tolua_tostring(tolua_S,2,0));
+  int W = ((int)  tolua_tonumber(tolua_S,3,0));
+  int H = ((int)  tolua_tonumber(tolua_S,4,0));
+ {
+  int tolua_ret = (int)  Fl_Shared_Image::probe(n,W,H);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ tolua_pushnumber(tolua_S,(lua_Number)W);
+ tolua_pushnumber(tolua_S,(lua_Number)H);
+ }
+ }
+ return 3;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'probe'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: refcount of class  Fl_Shared_Image */
 #ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Shared_Image_refcount00
 static int tolua_fltk_fltk_Fl_Shared_Image_refcount00(lua_State* tolua_S)
@@ -31583,7 +32966,7 @@ static int tolua_fltk_fltk_Fl_Shared_Image_uncache00(lua_State* tolua_S)
  class Lua__Fl_Shared_Image : public Fl_Shared_Image, public ToluaBase {
 public:
 	 void  color_average( unsigned int c, float i) {
-		if (push_method("color_average",  tolua_fltk_fltk_Fl_Shared_Image_color_average00)) {
+		if (push_method(0, "color_average",  tolua_fltk_fltk_Fl_Shared_Image_color_average00)) {
 			tolua_pushnumber(lua_state, (lua_Number)c);
 			tolua_pushnumber(lua_state, (lua_Number)i);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -31592,7 +32975,7 @@ public:
 		};
 	};
 	 Fl_Image*  copy( int W, int H) {
-		if (push_method("copy",  tolua_fltk_fltk_Fl_Shared_Image_copy00)) {
+		if (push_method(1, "copy",  tolua_fltk_fltk_Fl_Shared_Image_copy00)) {
 			tolua_pushnumber(lua_state, (lua_Number)W);
 			tolua_pushnumber(lua_state, (lua_Number)H);
 			ToluaBase::dbcall(lua_state, 3, 1);
@@ -31604,14 +32987,14 @@ public:
 		};
 	};
 	 void  desaturate( void ) {
-		if (push_method("desaturate",  tolua_fltk_fltk_Fl_Shared_Image_desaturate00)) {
+		if (push_method(2, "desaturate",  tolua_fltk_fltk_Fl_Shared_Image_desaturate00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Shared_Image:: desaturate();
 		};
 	};
 	 void  draw( int X, int Y, int W, int H, int cx, int cy) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Shared_Image_draw00)) {
+		if (push_method(3, "draw",  tolua_fltk_fltk_Fl_Shared_Image_draw00)) {
 			tolua_pushnumber(lua_state, (lua_Number)X);
 			tolua_pushnumber(lua_state, (lua_Number)Y);
 			tolua_pushnumber(lua_state, (lua_Number)W);
@@ -31624,14 +33007,14 @@ public:
 		};
 	};
 	 void  uncache( void ) {
-		if (push_method("uncache",  tolua_fltk_fltk_Fl_Shared_Image_uncache00)) {
+		if (push_method(4, "uncache",  tolua_fltk_fltk_Fl_Shared_Image_uncache00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Shared_Image:: uncache();
 		};
 	};
 	 void  label( Fl_Widget* w) {
-		if (push_method("label",  tolua_fltk_fltk_Fl_Image_label00)) {
+		if (push_method(5, "label",  tolua_fltk_fltk_Fl_Image_label00)) {
 			tolua_pushusertype(lua_state, (void*)w, "Fl_Widget");
 			ToluaBase::dbcall(lua_state, 2, 0);
 		} else {
@@ -32479,7 +33862,7 @@ static int tolua_fltk_fltk_Fl_Spinner_value00(lua_State* tolua_S)
  class Lua__Fl_Spinner : public Fl_Spinner, public ToluaBase {
 public:
 	 int  handle( int event) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Spinner_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Spinner_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)event);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -32490,7 +33873,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -32500,7 +33883,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -32510,7 +33893,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -32519,21 +33902,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Spinner:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Spinner:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -32544,7 +33927,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Spinner:: show();
@@ -34745,7 +36128,7 @@ static int tolua_fltk_fltk_Fl_Table_visible_cells00(lua_State* tolua_S)
  class Lua__Fl_Table : public Fl_Table, public ToluaBase {
 public:
 	 void  draw_cell( Fl_Table::TableContext context, int R = 0, int C = 0, int X = 0, int Y = 0, int W = 0, int H = 0) {
-		if (push_method("draw_cell",  NULL)) {
+		if (push_method(0, "draw_cell",  NULL)) {
 			tolua_pushnumber(lua_state, (lua_Number)context);
 			tolua_pushnumber(lua_state, (lua_Number)R);
 			tolua_pushnumber(lua_state, (lua_Number)C);
@@ -34759,14 +36142,14 @@ public:
 		};
 	};
 	 void  clear( void ) {
-		if (push_method("clear",  tolua_fltk_fltk_Fl_Table_clear00)) {
+		if (push_method(1, "clear",  tolua_fltk_fltk_Fl_Table_clear00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Table:: clear();
 		};
 	};
 	 void  cols( int val) {
-		if (push_method("cols",  tolua_fltk_fltk_Fl_Table_cols00)) {
+		if (push_method(2, "cols",  tolua_fltk_fltk_Fl_Table_cols00)) {
 			tolua_pushnumber(lua_state, (lua_Number)val);
 			ToluaBase::dbcall(lua_state, 2, 0);
 		} else {
@@ -34774,7 +36157,7 @@ public:
 		};
 	};
 	 void  rows( int val) {
-		if (push_method("rows",  tolua_fltk_fltk_Fl_Table_rows00)) {
+		if (push_method(3, "rows",  tolua_fltk_fltk_Fl_Table_rows00)) {
 			tolua_pushnumber(lua_state, (lua_Number)val);
 			ToluaBase::dbcall(lua_state, 2, 0);
 		} else {
@@ -34782,7 +36165,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(4, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -34792,7 +36175,7 @@ public:
 		};
 	};
 	 int  handle( int tolua_var_17) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Group_handle00)) {
+		if (push_method(5, "handle",  tolua_fltk_fltk_Fl_Group_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_17);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -34803,7 +36186,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(6, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -34813,7 +36196,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(7, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -34822,21 +36205,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(8, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Table:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(9, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Table:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(10, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -34847,7 +36230,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(11, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Table:: show();
@@ -35415,7 +36798,7 @@ tolua_lerror:
  class Lua__Fl_Table_Row : public Fl_Table_Row, public ToluaBase {
 public:
 	 void  draw_cell( Fl_Table::TableContext context, int R = 0, int C = 0, int X = 0, int Y = 0, int W = 0, int H = 0) {
-		if (push_method("draw_cell",  NULL)) {
+		if (push_method(0, "draw_cell",  NULL)) {
 			tolua_pushnumber(lua_state, (lua_Number)context);
 			tolua_pushnumber(lua_state, (lua_Number)R);
 			tolua_pushnumber(lua_state, (lua_Number)C);
@@ -35429,14 +36812,14 @@ public:
 		};
 	};
 	 void  clear( void ) {
-		if (push_method("clear",  tolua_fltk_fltk_Fl_Table_clear00)) {
+		if (push_method(1, "clear",  tolua_fltk_fltk_Fl_Table_clear00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Table_Row:: clear();
 		};
 	};
 	 void  cols( int val) {
-		if (push_method("cols",  tolua_fltk_fltk_Fl_Table_cols00)) {
+		if (push_method(2, "cols",  tolua_fltk_fltk_Fl_Table_cols00)) {
 			tolua_pushnumber(lua_state, (lua_Number)val);
 			ToluaBase::dbcall(lua_state, 2, 0);
 		} else {
@@ -35444,7 +36827,7 @@ public:
 		};
 	};
 	 void  rows( int val) {
-		if (push_method("rows",  tolua_fltk_fltk_Fl_Table_rows00)) {
+		if (push_method(3, "rows",  tolua_fltk_fltk_Fl_Table_rows00)) {
 			tolua_pushnumber(lua_state, (lua_Number)val);
 			ToluaBase::dbcall(lua_state, 2, 0);
 		} else {
@@ -35452,7 +36835,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(4, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -35462,7 +36845,7 @@ public:
 		};
 	};
 	 int  handle( int tolua_var_17) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Group_handle00)) {
+		if (push_method(5, "handle",  tolua_fltk_fltk_Fl_Group_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_17);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -35473,7 +36856,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(6, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -35483,7 +36866,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(7, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -35492,21 +36875,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(8, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Table_Row:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(9, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Table_Row:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(10, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -35517,7 +36900,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(11, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Table_Row:: show();
@@ -35899,7 +37282,7 @@ static int tolua_fltk_fltk_Fl_Tabs_which00(lua_State* tolua_S)
  class Lua__Fl_Tabs : public Fl_Tabs, public ToluaBase {
 public:
 	 int  handle( int tolua_var_107) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Tabs_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Tabs_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_107);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -35910,7 +37293,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -35920,7 +37303,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -35930,7 +37313,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -35939,21 +37322,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Tabs:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Tabs:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -35964,7 +37347,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Tabs:: show();
@@ -37334,6 +38717,40 @@ static int tolua_fltk_fltk_Fl_Text_Buffer_line_end00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: line_of of class  Fl_Text_Buffer */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_line_of00
+static int tolua_fltk_fltk_Fl_Text_Buffer_line_of00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Buffer",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Text_Buffer* self = (Fl_Text_Buffer*)  tolua_tousertype(tolua_S,1,0);
+  int pos = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'line_of'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->line_of(pos);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'line_of'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: line_start of class  Fl_Text_Buffer */
 #ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_line_start00
 static int tolua_fltk_fltk_Fl_Text_Buffer_line_start00(lua_State* tolua_S)
@@ -37438,6 +38855,38 @@ static int tolua_fltk_fltk_Fl_Text_Buffer_loadfile00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: newline_count of class  Fl_Text_Buffer */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_newline_count00
+static int tolua_fltk_fltk_Fl_Text_Buffer_newline_count00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Buffer",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Text_Buffer* self = (Fl_Text_Buffer*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'newline_count'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->newline_count();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'newline_count'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: outputfile of class  Fl_Text_Buffer */
 #ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_outputfile00
 static int tolua_fltk_fltk_Fl_Text_Buffer_outputfile00(lua_State* tolua_S)
@@ -37523,6 +38972,40 @@ static int tolua_fltk_fltk_Fl_Text_Buffer_overlay_rectangular00(lua_State* tolua
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: pos_of_line of class  Fl_Text_Buffer */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_pos_of_line00
+static int tolua_fltk_fltk_Fl_Text_Buffer_pos_of_line00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Buffer",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Text_Buffer* self = (Fl_Text_Buffer*)  tolua_tousertype(tolua_S,1,0);
+  int line = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'pos_of_line'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->pos_of_line(line);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'pos_of_line'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: primary_selection of class  Fl_Text_Buffer */
 #ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_primary_selection00
 static int tolua_fltk_fltk_Fl_Text_Buffer_primary_selection00(lua_State* tolua_S)
@@ -37555,6 +39038,73 @@ static int tolua_fltk_fltk_Fl_Text_Buffer_primary_selection00(lua_State* tolua_S
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: redo of class  Fl_Text_Buffer */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_redo00
+static int tolua_fltk_fltk_Fl_Text_Buffer_redo00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Buffer",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Text_Buffer* self = (Fl_Text_Buffer*)  tolua_tousertype(tolua_S,1,0);
+  int cp = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'redo'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->redo(&cp);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ tolua_pushnumber(tolua_S,(lua_Number)cp);
+ }
+ }
+ return 2;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'redo'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: redo_count of class  Fl_Text_Buffer */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_redo_count00
+static int tolua_fltk_fltk_Fl_Text_Buffer_redo_count00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Buffer",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Text_Buffer* self = (Fl_Text_Buffer*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'redo_count'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->redo_count();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'redo_count'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: remove of class  Fl_Text_Buffer */
 #ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_remove00
 static int tolua_fltk_fltk_Fl_Text_Buffer_remove00(lua_State* tolua_S)
@@ -38059,6 +39609,86 @@ static int tolua_fltk_fltk_Fl_Text_Buffer_search_forward00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: fltk_Fl_Text_Buffer_search_all of class  Fl_Text_Buffer */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_search_all00
+static int tolua_fltk_fltk_Fl_Text_Buffer_search_all00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Buffer",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Text_Buffer* self = (Fl_Text_Buffer*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  int startPos = ((int)  tolua_tonumber(tolua_S,2,0));
+  int endPos = ((int)  tolua_tonumber(tolua_S,3,0));
+  const char* searchString = ((const char*)  tolua_tostring(tolua_S,4,0));
+  int matchCase = ((int)  tolua_tonumber(tolua_S,5,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'fltk_Fl_Text_Buffer_search_all'", NULL);
+#endif
+ {
+  tolua_outside lua_Object tolua_ret = (tolua_outside lua_Object)  fltk_Fl_Text_Buffer_search_all(self,L,startPos,endPos,searchString,matchCase);
+ tolua_pushvalue(tolua_S,(int)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'search_all'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: fltk_Fl_Text_Buffer_search_pattern of class  Fl_Text_Buffer */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_search_pattern00
+static int tolua_fltk_fltk_Fl_Text_Buffer_search_pattern00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Buffer",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Text_Buffer* self = (Fl_Text_Buffer*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  int startPos = ((int)  tolua_tonumber(tolua_S,2,0));
+  int endPos = ((int)  tolua_tonumber(tolua_S,3,0));
+  const char* pattern = ((const char*)  tolua_tostring(tolua_S,4,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'fltk_Fl_Text_Buffer_search_pattern'", NULL);
+#endif
+ {
+  tolua_outside lua_Object tolua_ret = (tolua_outside lua_Object)  fltk_Fl_Text_Buffer_search_pattern(self,L,startPos,endPos,pattern);
+ tolua_pushvalue(tolua_S,(int)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'search_pattern'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: secondary_select of class  Fl_Text_Buffer */
 #ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_secondary_select00
 static int tolua_fltk_fltk_Fl_Text_Buffer_secondary_select00(lua_State* tolua_S)
@@ -38825,6 +40455,160 @@ static int tolua_fltk_fltk_Fl_Text_Buffer_undo00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: undo_checkpoint of class  Fl_Text_Buffer */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_undo_checkpoint00
+static int tolua_fltk_fltk_Fl_Text_Buffer_undo_checkpoint00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Buffer",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Text_Buffer* self = (Fl_Text_Buffer*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'undo_checkpoint'", NULL);
+#endif
+ {
+  self->undo_checkpoint();
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'undo_checkpoint'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: undo_clear of class  Fl_Text_Buffer */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_undo_clear00
+static int tolua_fltk_fltk_Fl_Text_Buffer_undo_clear00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Buffer",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Text_Buffer* self = (Fl_Text_Buffer*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'undo_clear'", NULL);
+#endif
+ {
+  self->undo_clear();
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'undo_clear'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: undo_count of class  Fl_Text_Buffer */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_undo_count00
+static int tolua_fltk_fltk_Fl_Text_Buffer_undo_count00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Buffer",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Text_Buffer* self = (Fl_Text_Buffer*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'undo_count'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->undo_count();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'undo_count'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: undo_limit of class  Fl_Text_Buffer */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_undo_limit00
+static int tolua_fltk_fltk_Fl_Text_Buffer_undo_limit00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Buffer",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Text_Buffer* self = (Fl_Text_Buffer*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'undo_limit'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->undo_limit();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'undo_limit'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: undo_limit of class  Fl_Text_Buffer */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_undo_limit01
+static int tolua_fltk_fltk_Fl_Text_Buffer_undo_limit01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Buffer",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  Fl_Text_Buffer* self = (Fl_Text_Buffer*)  tolua_tousertype(tolua_S,1,0);
+  int bytes = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'undo_limit'", NULL);
+#endif
+ {
+  self->undo_limit(bytes);
+ }
+ }
+ return 0;
+tolua_lerror:
+ return tolua_fltk_fltk_Fl_Text_Buffer_undo_limit00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: unhighlight of class  Fl_Text_Buffer */
 #ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Buffer_unhighlight00
 static int tolua_fltk_fltk_Fl_Text_Buffer_unhighlight00(lua_State* tolua_S)
@@ -40480,7 +42264,7 @@ static int tolua_fltk_fltk_Fl_Text_Display_wrapped_row00(lua_State* tolua_S)
  class Lua__Fl_Text_Display : public Fl_Text_Display, public ToluaBase {
 public:
 	 int  handle( int e) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Text_Display_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Text_Display_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)e);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -40491,7 +42275,7 @@ public:
 		};
 	};
 	 void  resize( int X, int Y, int W, int H) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Text_Display_resize00)) {
+		if (push_method(1, "resize",  tolua_fltk_fltk_Fl_Text_Display_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)X);
 			tolua_pushnumber(lua_state, (lua_Number)Y);
 			tolua_pushnumber(lua_state, (lua_Number)W);
@@ -40502,7 +42286,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(2, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -40512,7 +42296,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(3, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -40522,7 +42306,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(4, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -40531,21 +42315,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(5, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Text_Display:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(6, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Text_Display:: hide();
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Text_Display:: show();
@@ -41527,6 +43311,38 @@ static int tolua_fltk_fltk_Fl_Text_Editor_kf_paste00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: kf_redo of class  Fl_Text_Editor */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Editor_kf_redo00
+static int tolua_fltk_fltk_Fl_Text_Editor_kf_redo00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertable(tolua_S,1,"Fl_Text_Editor",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,3,"Fl_Text_Editor",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  int c = ((int)  tolua_tonumber(tolua_S,2,0));
+  Fl_Text_Editor* e = ((Fl_Text_Editor*)  tolua_tousertype(tolua_S,3,0));
+ {
+  int tolua_ret = (int)  Fl_Text_Editor::kf_redo(c,e);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'kf_redo'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: kf_right of class  Fl_Text_Editor */
 #ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Editor_kf_right00
 static int tolua_fltk_fltk_Fl_Text_Editor_kf_right00(lua_State* tolua_S)
@@ -41756,7 +43572,7 @@ static int tolua_fltk_fltk_Fl_Text_Editor_remove_key_binding00(lua_State* tolua_
  class Lua__Fl_Text_Editor : public Fl_Text_Editor, public ToluaBase {
 public:
 	 int  handle( int e) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Text_Editor_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Text_Editor_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)e);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -41767,7 +43583,7 @@ public:
 		};
 	};
 	 void  resize( int X, int Y, int W, int H) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Text_Display_resize00)) {
+		if (push_method(1, "resize",  tolua_fltk_fltk_Fl_Text_Display_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)X);
 			tolua_pushnumber(lua_state, (lua_Number)Y);
 			tolua_pushnumber(lua_state, (lua_Number)W);
@@ -41778,7 +43594,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(2, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -41788,7 +43604,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(3, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -41798,7 +43614,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(4, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -41807,21 +43623,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(5, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Text_Editor:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(6, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Text_Editor:: hide();
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Text_Editor:: show();
@@ -41982,464 +43798,408 @@ static int tolua_collect_Lua__Fl_Text_Editor (lua_State* tolua_S)
 }
 #endif
 
-/* method: end of class  Fl_Text_Selection */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_endd00
-static int tolua_fltk_fltk_Fl_Text_Selection_endd00(lua_State* tolua_S)
+/* method: new of class  Fl_Text_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Highlighter_new00
+static int tolua_fltk_fltk_Fl_Text_Highlighter_new00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
+ !tolua_isusertable(tolua_S,1,"Fl_Text_Highlighter",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
-#ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'end'", NULL);
-#endif
  {
-  int tolua_ret = (int)  self->end();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  Fl_Text_Highlighter* tolua_ret = (Fl_Text_Highlighter*)  Mtolua_new((Fl_Text_Highlighter)());
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Text_Highlighter");
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'endd'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: includes of class  Fl_Text_Selection */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_includes00
-static int tolua_fltk_fltk_Fl_Text_Selection_includes00(lua_State* tolua_S)
+/* method: new_local of class  Fl_Text_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Highlighter_new00_local
+static int tolua_fltk_fltk_Fl_Text_Highlighter_new00_local(lua_State* tolua_S)
+{
+ int result = tolua_fltk_fltk_Fl_Text_Highlighter_new00(tolua_S);
+ if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
+ return result;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: delete of class  Fl_Text_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Highlighter_delete00
+static int tolua_fltk_fltk_Fl_Text_Highlighter_delete00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Highlighter",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
-  int pos = ((int)  tolua_tonumber(tolua_S,2,0));
-  int lineStartPos = ((int)  tolua_tonumber(tolua_S,3,0));
-  int dispIndex = ((int)  tolua_tonumber(tolua_S,4,0));
+  Fl_Text_Highlighter* self = (Fl_Text_Highlighter*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'includes'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'delete'", NULL);
 #endif
- {
-  int tolua_ret = (int)  self->includes(pos,lineStartPos,dispIndex);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- }
+ Mtolua_delete(self);
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'includes'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'delete'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: position of class  Fl_Text_Selection */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_position00
-static int tolua_fltk_fltk_Fl_Text_Selection_position00(lua_State* tolua_S)
+/* method: fltk_Fl_Text_Highlighter_attach of class  Fl_Text_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Highlighter_attach00
+static int tolua_fltk_fltk_Fl_Text_Highlighter_attach00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Highlighter",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,2,"Fl_Text_Display",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
-  int start = ((int)  tolua_tonumber(tolua_S,2,0));
-  int end = ((int)  tolua_tonumber(tolua_S,3,0));
+  Fl_Text_Highlighter* self = (Fl_Text_Highlighter*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  Fl_Text_Display* d = ((Fl_Text_Display*)  tolua_tousertype(tolua_S,2,0));
+  lua_Object styles = ((lua_Object)  tolua_tovalue(tolua_S,3,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'position'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'fltk_Fl_Text_Highlighter_attach'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->position(&start,&end);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- tolua_pushnumber(tolua_S,(lua_Number)start);
- tolua_pushnumber(tolua_S,(lua_Number)end);
+  fltk_Fl_Text_Highlighter_attach(self,L,d,styles);
  }
  }
- return 3;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'position'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'attach'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: position of class  Fl_Text_Selection */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_position01
-static int tolua_fltk_fltk_Fl_Text_Selection_position01(lua_State* tolua_S)
+/* method: detach of class  Fl_Text_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Highlighter_detach00
+static int tolua_fltk_fltk_Fl_Text_Highlighter_detach00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,7,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Highlighter",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
-  int start = ((int)  tolua_tonumber(tolua_S,2,0));
-  int end = ((int)  tolua_tonumber(tolua_S,3,0));
-  int isRect = ((int)  tolua_tonumber(tolua_S,4,0));
-  int rectStart = ((int)  tolua_tonumber(tolua_S,5,0));
-  int rectEnd = ((int)  tolua_tonumber(tolua_S,6,0));
+  Fl_Text_Highlighter* self = (Fl_Text_Highlighter*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'position'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'detach'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->position(&start,&end,&isRect,&rectStart,&rectEnd);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- tolua_pushnumber(tolua_S,(lua_Number)start);
- tolua_pushnumber(tolua_S,(lua_Number)end);
- tolua_pushnumber(tolua_S,(lua_Number)isRect);
- tolua_pushnumber(tolua_S,(lua_Number)rectStart);
- tolua_pushnumber(tolua_S,(lua_Number)rectEnd);
+  self->detach();
  }
  }
- return 6;
-tolua_lerror:
- return tolua_fltk_fltk_Fl_Text_Selection_position00(tolua_S);
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'detach'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: rect_end of class  Fl_Text_Selection */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_rect_end00
-static int tolua_fltk_fltk_Fl_Text_Selection_rect_end00(lua_State* tolua_S)
+/* method: restyle of class  Fl_Text_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Highlighter_restyle00
+static int tolua_fltk_fltk_Fl_Text_Highlighter_restyle00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Highlighter",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Text_Highlighter* self = (Fl_Text_Highlighter*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'rect_end'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'restyle'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->rect_end();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->restyle();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'rect_end'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'restyle'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: rect_start of class  Fl_Text_Selection */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_rect_start00
-static int tolua_fltk_fltk_Fl_Text_Selection_rect_start00(lua_State* tolua_S)
+/* method: style_to of class  Fl_Text_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Highlighter_style_to00
+static int tolua_fltk_fltk_Fl_Text_Highlighter_style_to00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Highlighter",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Text_Highlighter* self = (Fl_Text_Highlighter*)  tolua_tousertype(tolua_S,1,0);
+  int pos = ((int)  tolua_tonumber(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'rect_start'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'style_to'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->rect_start();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->style_to(pos);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'rect_start'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'style_to'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: rectangular of class  Fl_Text_Selection */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_rectangular00
-static int tolua_fltk_fltk_Fl_Text_Selection_rectangular00(lua_State* tolua_S)
+/* method: styles of class  Fl_Text_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Highlighter_styles00
+static int tolua_fltk_fltk_Fl_Text_Highlighter_styles00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Highlighter",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Text_Highlighter* self = (Fl_Text_Highlighter*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'rectangular'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'styles'", NULL);
 #endif
  {
-  char tolua_ret = (char)  self->rectangular();
+  int tolua_ret = (int)  self->styles();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'rectangular'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'styles'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: selected of class  Fl_Text_Selection */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_selected00
-static int tolua_fltk_fltk_Fl_Text_Selection_selected00(lua_State* tolua_S)
+/* method: display of class  Fl_Text_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Highlighter_display00
+static int tolua_fltk_fltk_Fl_Text_Highlighter_display00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Highlighter",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Text_Highlighter* self = (Fl_Text_Highlighter*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'selected'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'display'", NULL);
 #endif
  {
- if(nparam < 2) {
-  char tolua_ret = (char)  self->selected();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  char opt = ((char)  tolua_tonumber(tolua_S,2,0));
- self->selected(opt);
- return 0;
- }
+  Fl_Text_Display* tolua_ret = (Fl_Text_Display*)  self->display();
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Text_Display");
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'selected'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'display'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: set of class  Fl_Text_Selection */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_set00
-static int tolua_fltk_fltk_Fl_Text_Selection_set00(lua_State* tolua_S)
+/* method: style_buffer of class  Fl_Text_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Highlighter_style_buffer00
+static int tolua_fltk_fltk_Fl_Text_Highlighter_style_buffer00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Highlighter",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
-  int start = ((int)  tolua_tonumber(tolua_S,2,0));
-  int end = ((int)  tolua_tonumber(tolua_S,3,0));
+  Fl_Text_Highlighter* self = (Fl_Text_Highlighter*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'set'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'style_buffer'", NULL);
 #endif
  {
-  self->set(start,end);
+  Fl_Text_Buffer* tolua_ret = (Fl_Text_Buffer*)  self->style_buffer();
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Text_Buffer");
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'set'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'style_buffer'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: set_rectangular of class  Fl_Text_Selection */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_set_rectangular00
-static int tolua_fltk_fltk_Fl_Text_Selection_set_rectangular00(lua_State* tolua_S)
+/* method: styled_lines of class  Fl_Text_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Highlighter_styled_lines00
+static int tolua_fltk_fltk_Fl_Text_Highlighter_styled_lines00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,6,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Highlighter",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
-  int start = ((int)  tolua_tonumber(tolua_S,2,0));
-  int end = ((int)  tolua_tonumber(tolua_S,3,0));
-  int rectStart = ((int)  tolua_tonumber(tolua_S,4,0));
-  int rectEnd = ((int)  tolua_tonumber(tolua_S,5,0));
+  Fl_Text_Highlighter* self = (Fl_Text_Highlighter*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'set_rectangular'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'styled_lines'", NULL);
 #endif
  {
-  self->set_rectangular(start,end,rectStart,rectEnd);
+  int tolua_ret = (int)  self->styled_lines();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'set_rectangular'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'styled_lines'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: start of class  Fl_Text_Selection */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_start00
-static int tolua_fltk_fltk_Fl_Text_Selection_start00(lua_State* tolua_S)
+/* method: lines_per_pass of class  Fl_Text_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Highlighter_lines_per_pass00
+static int tolua_fltk_fltk_Fl_Text_Highlighter_lines_per_pass00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Highlighter",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Text_Highlighter* self = (Fl_Text_Highlighter*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'start'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'lines_per_pass'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->start();
+  int tolua_ret = (int)  self->lines_per_pass();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'start'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'lines_per_pass'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: update of class  Fl_Text_Selection */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_update00
-static int tolua_fltk_fltk_Fl_Text_Selection_update00(lua_State* tolua_S)
+/* method: lines_per_pass of class  Fl_Text_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Highlighter_lines_per_pass01
+static int tolua_fltk_fltk_Fl_Text_Highlighter_lines_per_pass01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Highlighter",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
-  int pos = ((int)  tolua_tonumber(tolua_S,2,0));
-  int nDeleted = ((int)  tolua_tonumber(tolua_S,3,0));
-  int nInserted = ((int)  tolua_tonumber(tolua_S,4,0));
+  Fl_Text_Highlighter* self = (Fl_Text_Highlighter*)  tolua_tousertype(tolua_S,1,0);
+  int n = ((int)  tolua_tonumber(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'update'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'lines_per_pass'", NULL);
 #endif
  {
-  self->update(pos,nDeleted,nInserted);
+  self->lines_per_pass(n);
  }
  }
  return 0;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'update'.",&tolua_err);
- return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_Fl_Text_Highlighter_lines_per_pass00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new of class  Fl_Tile */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tile_new00
-static int tolua_fltk_fltk_Fl_Tile_new00(lua_State* tolua_S)
+/* method: new of class  Fl_Lua_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Lua_Highlighter_new00
+static int tolua_fltk_fltk_Fl_Lua_Highlighter_new00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertable(tolua_S,1,"Fl_Tile",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isstring(tolua_S,6,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,7,&tolua_err)
+ !tolua_isusertable(tolua_S,1,"Fl_Lua_Highlighter",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int X = ((int)  tolua_tonumber(tolua_S,2,0));
-  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
-  int W = ((int)  tolua_tonumber(tolua_S,4,0));
-  int H = ((int)  tolua_tonumber(tolua_S,5,0));
-  const char* l = ((const char*)  tolua_tostring(tolua_S,6,0));
  {
-  Fl_Tile* tolua_ret = (Fl_Tile*)  Mtolua_new((Fl_Tile)(X,Y,W,H,l));
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Tile");
+  Fl_Lua_Highlighter* tolua_ret = (Fl_Lua_Highlighter*)  Mtolua_new((Fl_Lua_Highlighter)());
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Lua_Highlighter");
  }
  }
  return 1;
@@ -42451,409 +44211,375 @@ static int tolua_fltk_fltk_Fl_Tile_new00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new_local of class  Fl_Tile */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tile_new00_local
-static int tolua_fltk_fltk_Fl_Tile_new00_local(lua_State* tolua_S)
+/* method: new_local of class  Fl_Lua_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Lua_Highlighter_new00_local
+static int tolua_fltk_fltk_Fl_Lua_Highlighter_new00_local(lua_State* tolua_S)
 {
- int result = tolua_fltk_fltk_Fl_Tile_new00(tolua_S);
+ int result = tolua_fltk_fltk_Fl_Lua_Highlighter_new00(tolua_S);
  if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
  return result;
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: handle of class  Fl_Tile */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tile_handle00
-static int tolua_fltk_fltk_Fl_Tile_handle00(lua_State* tolua_S)
+/* method: delete of class  Fl_Lua_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Lua_Highlighter_delete00
+static int tolua_fltk_fltk_Fl_Lua_Highlighter_delete00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Tile",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Lua_Highlighter",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Lua_Highlighter* self = (Fl_Lua_Highlighter*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'delete'", NULL);
+#endif
+ Mtolua_delete(self);
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'delete'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: rules of class  Fl_Lua_Highlighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Lua_Highlighter_rules00
+static int tolua_fltk_fltk_Fl_Lua_Highlighter_rules00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Lua_Highlighter",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Tile* self = (Fl_Tile*)  tolua_tousertype(tolua_S,1,0);
-  int tolua_var_111 = ((int)  tolua_tonumber(tolua_S,2,0));
+  Fl_Lua_Highlighter* self = (Fl_Lua_Highlighter*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  lua_Object tbl = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'handle'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'rules'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->handle(tolua_var_111);
+  int tolua_ret = (int)  self->rules(L,tbl);
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'handle'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'rules'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: position of class  Fl_Tile */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tile_position00
-static int tolua_fltk_fltk_Fl_Tile_position00(lua_State* tolua_S)
+/* method: end of class  Fl_Text_Selection */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_endd00
+static int tolua_fltk_fltk_Fl_Text_Selection_endd00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Tile",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,6,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Tile* self = (Fl_Tile*)  tolua_tousertype(tolua_S,1,0);
-  int tolua_var_112 = ((int)  tolua_tonumber(tolua_S,2,0));
-  int tolua_var_113 = ((int)  tolua_tonumber(tolua_S,3,0));
-  int tolua_var_114 = ((int)  tolua_tonumber(tolua_S,4,0));
-  int tolua_var_115 = ((int)  tolua_tonumber(tolua_S,5,0));
+  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'position'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'end'", NULL);
 #endif
  {
-  self->position(tolua_var_112,tolua_var_113,tolua_var_114,tolua_var_115);
+  int tolua_ret = (int)  self->end();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'position'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'endd'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: resize of class  Fl_Tile */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tile_resize00
-static int tolua_fltk_fltk_Fl_Tile_resize00(lua_State* tolua_S)
+/* method: includes of class  Fl_Text_Selection */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_includes00
+static int tolua_fltk_fltk_Fl_Text_Selection_includes00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Tile",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,6,&tolua_err)
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Tile* self = (Fl_Tile*)  tolua_tousertype(tolua_S,1,0);
-  int tolua_var_116 = ((int)  tolua_tonumber(tolua_S,2,0));
-  int tolua_var_117 = ((int)  tolua_tonumber(tolua_S,3,0));
-  int tolua_var_118 = ((int)  tolua_tonumber(tolua_S,4,0));
-  int tolua_var_119 = ((int)  tolua_tonumber(tolua_S,5,0));
+  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
+  int pos = ((int)  tolua_tonumber(tolua_S,2,0));
+  int lineStartPos = ((int)  tolua_tonumber(tolua_S,3,0));
+  int dispIndex = ((int)  tolua_tonumber(tolua_S,4,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'resize'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'includes'", NULL);
 #endif
  {
-  self->resize(tolua_var_116,tolua_var_117,tolua_var_118,tolua_var_119);
+  int tolua_ret = (int)  self->includes(pos,lineStartPos,dispIndex);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'resize'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'includes'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
- class Lua__Fl_Tile : public Fl_Tile, public ToluaBase {
-public:
-	 int  handle( int tolua_var_111) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Tile_handle00)) {
-			tolua_pushnumber(lua_state, (lua_Number)tolua_var_111);
-			ToluaBase::dbcall(lua_state, 2, 1);
-			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
-			lua_pop(lua_state, 1);
-			return tolua_ret;
-		} else {
-			return ( int ) Fl_Tile:: handle(tolua_var_111);
-		};
-	};
-	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
-			ToluaBase::dbcall(lua_state, 1, 1);
-			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
-			lua_pop(lua_state, 1);
-			return tolua_ret;
-		} else {
-			return ( Fl_Group* ) Fl_Tile:: as_group();
-		};
-	};
-	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
-			ToluaBase::dbcall(lua_state, 1, 1);
-			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
-			lua_pop(lua_state, 1);
-			return tolua_ret;
-		} else {
-			return ( Fl_Window* ) Fl_Tile:: as_window();
-		};
-	};
-	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
-			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
-			tolua_pushuserdata(lua_state, (void*)arg);
-			ToluaBase::dbcall(lua_state, 3, 0);
-		} else {
-			 Fl_Tile:: do_callback(o,arg);
-		};
-	};
-	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
-			ToluaBase::dbcall(lua_state, 1, 0);
-		} else {
-			 Fl_Tile:: draw();
-		};
-	};
-	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
-			ToluaBase::dbcall(lua_state, 1, 0);
-		} else {
-			 Fl_Tile:: hide();
-		};
-	};
-	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
-			tolua_pushnumber(lua_state, (lua_Number)x);
-			tolua_pushnumber(lua_state, (lua_Number)y);
-			tolua_pushnumber(lua_state, (lua_Number)w);
-			tolua_pushnumber(lua_state, (lua_Number)h);
-			ToluaBase::dbcall(lua_state, 5, 0);
-		} else {
-			 Fl_Tile:: resize(x,y,w,h);
-		};
-	};
-	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
-			ToluaBase::dbcall(lua_state, 1, 0);
-		} else {
-			 Fl_Tile:: show();
-		};
-	};
-
-	 int Fl_Tile__handle( int tolua_var_111) {
-		return ( int )Fl_Tile::handle(tolua_var_111);
-	};
-	 Fl_Group* Fl_Tile__as_group( void ) {
-		return ( Fl_Group* )Fl_Tile::as_group();
-	};
-	 Fl_Window* Fl_Tile__as_window( void ) {
-		return ( Fl_Window* )Fl_Tile::as_window();
-	};
-	 void Fl_Tile__do_callback( Fl_Widget* o, void* arg = 0) {
-		Fl_Tile::do_callback(o,arg);
-	};
-	 void Fl_Tile__draw( void ) {
-		Fl_Tile::draw();
-	};
-	 void Fl_Tile__hide( void ) {
-		Fl_Tile::hide();
-	};
-	 void Fl_Tile__resize( int x, int y, int w, int h) {
-		Fl_Tile::resize(x,y,w,h);
-	};
-	 void Fl_Tile__show( void ) {
-		Fl_Tile::show();
-	};
-	 Lua__Fl_Tile( int X, int Y, int W, int H, const char* l = 0): Fl_Tile(X,Y,W,H,l){};
-};
-
-/* method: tolua__set_instance of class  Lua__Fl_Tile */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Tile_tolua__set_instance00
-static int tolua_fltk_fltk_Lua__Fl_Tile_tolua__set_instance00(lua_State* tolua_S)
+/* method: position of class  Fl_Text_Selection */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_position00
+static int tolua_fltk_fltk_Fl_Text_Selection_position00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Lua__Fl_Tile",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Lua__Fl_Tile* self = (Lua__Fl_Tile*)  tolua_tousertype(tolua_S,1,0);
-  lua_State* L =  tolua_S;
-  lua_Object lo = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
+  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
+  int start = ((int)  tolua_tonumber(tolua_S,2,0));
+  int end = ((int)  tolua_tonumber(tolua_S,3,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'tolua__set_instance'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'position'", NULL);
 #endif
  {
-  self->tolua__set_instance(L,lo);
+  int tolua_ret = (int)  self->position(&start,&end);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ tolua_pushnumber(tolua_S,(lua_Number)start);
+ tolua_pushnumber(tolua_S,(lua_Number)end);
  }
  }
- return 0;
+ return 3;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'tolua__set_instance'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'position'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: Fl_Tile__handle of class  Lua__Fl_Tile */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Tile_Fl_Tile__handle00
-static int tolua_fltk_fltk_Lua__Fl_Tile_Fl_Tile__handle00(lua_State* tolua_S)
+/* method: position of class  Fl_Text_Selection */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_position01
+static int tolua_fltk_fltk_Fl_Text_Selection_position01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Lua__Fl_Tile",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,7,&tolua_err)
  )
  goto tolua_lerror;
  else
+ {
+  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
+  int start = ((int)  tolua_tonumber(tolua_S,2,0));
+  int end = ((int)  tolua_tonumber(tolua_S,3,0));
+  int isRect = ((int)  tolua_tonumber(tolua_S,4,0));
+  int rectStart = ((int)  tolua_tonumber(tolua_S,5,0));
+  int rectEnd = ((int)  tolua_tonumber(tolua_S,6,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'position'", NULL);
 #endif
  {
-  Lua__Fl_Tile* self = (Lua__Fl_Tile*)  tolua_tousertype(tolua_S,1,0);
-  int tolua_var_111 = ((int)  tolua_tonumber(tolua_S,2,0));
+  int tolua_ret = (int)  self->position(&start,&end,&isRect,&rectStart,&rectEnd);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ tolua_pushnumber(tolua_S,(lua_Number)start);
+ tolua_pushnumber(tolua_S,(lua_Number)end);
+ tolua_pushnumber(tolua_S,(lua_Number)isRect);
+ tolua_pushnumber(tolua_S,(lua_Number)rectStart);
+ tolua_pushnumber(tolua_S,(lua_Number)rectEnd);
+ }
+ }
+ return 6;
+tolua_lerror:
+ return tolua_fltk_fltk_Fl_Text_Selection_position00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: rect_end of class  Fl_Text_Selection */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_rect_end00
+static int tolua_fltk_fltk_Fl_Text_Selection_rect_end00(lua_State* tolua_S)
+{
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'Fl_Tile__handle'", NULL);
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
 #endif
  {
-  int tolua_ret = (int)  self->Fl_Tile__handle(tolua_var_111);
+  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'rect_end'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->rect_end();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'Fl_Tile__handle'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'rect_end'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new of class  Lua__Fl_Tile */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Tile_new00
-static int tolua_fltk_fltk_Lua__Fl_Tile_new00(lua_State* tolua_S)
+/* method: rect_start of class  Fl_Text_Selection */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_rect_start00
+static int tolua_fltk_fltk_Fl_Text_Selection_rect_start00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertable(tolua_S,1,"Lua__Fl_Tile",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isstring(tolua_S,6,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,7,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int X = ((int)  tolua_tonumber(tolua_S,2,0));
-  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
-  int W = ((int)  tolua_tonumber(tolua_S,4,0));
-  int H = ((int)  tolua_tonumber(tolua_S,5,0));
-  const char* l = ((const char*)  tolua_tostring(tolua_S,6,0));
+  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'rect_start'", NULL);
+#endif
  {
-  Lua__Fl_Tile* tolua_ret = (Lua__Fl_Tile*)  Mtolua_new((Lua__Fl_Tile)(X,Y,W,H,l));
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Lua__Fl_Tile");
+  int tolua_ret = (int)  self->rect_start();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'rect_start'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new_local of class  Lua__Fl_Tile */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Tile_new00_local
-static int tolua_fltk_fltk_Lua__Fl_Tile_new00_local(lua_State* tolua_S)
-{
- int result = tolua_fltk_fltk_Lua__Fl_Tile_new00(tolua_S);
- if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
- return result;
-}
-#endif //#ifndef TOLUA_DISABLE
-
-
-/* function to release collected object via destructor */
-#ifdef __cplusplus
-
-static int tolua_collect_Lua__Fl_Tile (lua_State* tolua_S)
-{
- Lua__Fl_Tile* self = (Lua__Fl_Tile*) tolua_tousertype(tolua_S,1,0);
-	delete self;
-	return 0;
-}
-#endif
-
-/* method: new of class  Fl_Tiled_Image */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_new00
-static int tolua_fltk_fltk_Fl_Tiled_Image_new00(lua_State* tolua_S)
+/* method: rectangular of class  Fl_Text_Selection */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_rectangular00
+static int tolua_fltk_fltk_Fl_Text_Selection_rectangular00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertable(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
- !tolua_isusertype(tolua_S,2,"Fl_Image",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,1,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Image* i = ((Fl_Image*)  tolua_tousertype(tolua_S,2,0));
-  int W = ((int)  tolua_tonumber(tolua_S,3,0));
-  int H = ((int)  tolua_tonumber(tolua_S,4,0));
+  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'rectangular'", NULL);
+#endif
  {
-  Fl_Tiled_Image* tolua_ret = (Fl_Tiled_Image*)  Mtolua_new((Fl_Tiled_Image)(i,W,H));
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Tiled_Image");
+  char tolua_ret = (char)  self->rectangular();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'rectangular'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new_local of class  Fl_Tiled_Image */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_new00_local
-static int tolua_fltk_fltk_Fl_Tiled_Image_new00_local(lua_State* tolua_S)
+/* method: selected of class  Fl_Text_Selection */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_selected00
+static int tolua_fltk_fltk_Fl_Text_Selection_selected00(lua_State* tolua_S)
 {
- int result = tolua_fltk_fltk_Fl_Tiled_Image_new00(tolua_S);
- if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
- return result;
+ int nparam = lua_gettop(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'selected'", NULL);
+#endif
+ {
+ if(nparam < 2) {
+  char tolua_ret = (char)  self->selected();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  char opt = ((char)  tolua_tonumber(tolua_S,2,0));
+ self->selected(opt);
+ return 0;
+ }
+ }
+ }
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'selected'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: color_average of class  Fl_Tiled_Image */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_color_average00
-static int tolua_fltk_fltk_Fl_Tiled_Image_color_average00(lua_State* tolua_S)
+/* method: set of class  Fl_Text_Selection */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_set00
+static int tolua_fltk_fltk_Fl_Text_Selection_set00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,4,&tolua_err)
@@ -42862,219 +44588,795 @@ static int tolua_fltk_fltk_Fl_Tiled_Image_color_average00(lua_State* tolua_S)
  else
 #endif
  {
-  Fl_Tiled_Image* self = (Fl_Tiled_Image*)  tolua_tousertype(tolua_S,1,0);
-  unsigned int c = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
-  float i = ((float)  tolua_tonumber(tolua_S,3,0));
+  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
+  int start = ((int)  tolua_tonumber(tolua_S,2,0));
+  int end = ((int)  tolua_tonumber(tolua_S,3,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'color_average'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'set'", NULL);
 #endif
  {
-  self->color_average(c,i);
+  self->set(start,end);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'color_average'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'set'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: copy of class  Fl_Tiled_Image */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_copy00
-static int tolua_fltk_fltk_Fl_Tiled_Image_copy00(lua_State* tolua_S)
+/* method: set_rectangular of class  Fl_Text_Selection */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_set_rectangular00
+static int tolua_fltk_fltk_Fl_Text_Selection_set_rectangular00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Tiled_Image* self = (Fl_Tiled_Image*)  tolua_tousertype(tolua_S,1,0);
-  int W = ((int)  tolua_tonumber(tolua_S,2,0));
-  int H = ((int)  tolua_tonumber(tolua_S,3,0));
+  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
+  int start = ((int)  tolua_tonumber(tolua_S,2,0));
+  int end = ((int)  tolua_tonumber(tolua_S,3,0));
+  int rectStart = ((int)  tolua_tonumber(tolua_S,4,0));
+  int rectEnd = ((int)  tolua_tonumber(tolua_S,5,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'copy'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'set_rectangular'", NULL);
 #endif
  {
-  Fl_Image* tolua_ret = (Fl_Image*)  self->copy(W,H);
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Image");
+  self->set_rectangular(start,end,rectStart,rectEnd);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'copy'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'set_rectangular'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: copy of class  Fl_Tiled_Image */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_copy01
-static int tolua_fltk_fltk_Fl_Tiled_Image_copy01(lua_State* tolua_S)
+/* method: start of class  Fl_Text_Selection */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_start00
+static int tolua_fltk_fltk_Fl_Text_Selection_start00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  Fl_Tiled_Image* self = (Fl_Tiled_Image*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'copy'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'start'", NULL);
 #endif
  {
-  Fl_Image* tolua_ret = (Fl_Image*)  self->copy();
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Image");
+  int tolua_ret = (int)  self->start();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
-tolua_lerror:
- return tolua_fltk_fltk_Fl_Tiled_Image_copy00(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'start'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: desaturate of class  Fl_Tiled_Image */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_desaturate00
-static int tolua_fltk_fltk_Fl_Tiled_Image_desaturate00(lua_State* tolua_S)
+/* method: update of class  Fl_Text_Selection */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Text_Selection_update00
+static int tolua_fltk_fltk_Fl_Text_Selection_update00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Text_Selection",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Tiled_Image* self = (Fl_Tiled_Image*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Text_Selection* self = (Fl_Text_Selection*)  tolua_tousertype(tolua_S,1,0);
+  int pos = ((int)  tolua_tonumber(tolua_S,2,0));
+  int nDeleted = ((int)  tolua_tonumber(tolua_S,3,0));
+  int nInserted = ((int)  tolua_tonumber(tolua_S,4,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'desaturate'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'update'", NULL);
 #endif
  {
-  self->desaturate();
+  self->update(pos,nDeleted,nInserted);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'desaturate'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'update'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: draw of class  Fl_Tiled_Image */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_draw00
-static int tolua_fltk_fltk_Fl_Tiled_Image_draw00(lua_State* tolua_S)
+/* method: new of class  Fl_Tile */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tile_new00
+static int tolua_fltk_fltk_Fl_Tile_new00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
+ !tolua_isusertable(tolua_S,1,"Fl_Tile",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,7,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,8,&tolua_err)
+ !tolua_isstring(tolua_S,6,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,7,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Tiled_Image* self = (Fl_Tiled_Image*)  tolua_tousertype(tolua_S,1,0);
   int X = ((int)  tolua_tonumber(tolua_S,2,0));
   int Y = ((int)  tolua_tonumber(tolua_S,3,0));
   int W = ((int)  tolua_tonumber(tolua_S,4,0));
   int H = ((int)  tolua_tonumber(tolua_S,5,0));
-  int cx = ((int)  tolua_tonumber(tolua_S,6,0));
-  int cy = ((int)  tolua_tonumber(tolua_S,7,0));
+  const char* l = ((const char*)  tolua_tostring(tolua_S,6,0));
+ {
+  Fl_Tile* tolua_ret = (Fl_Tile*)  Mtolua_new((Fl_Tile)(X,Y,W,H,l));
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Tile");
+ }
+ }
+ return 1;
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'draw'", NULL);
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: new_local of class  Fl_Tile */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tile_new00_local
+static int tolua_fltk_fltk_Fl_Tile_new00_local(lua_State* tolua_S)
+{
+ int result = tolua_fltk_fltk_Fl_Tile_new00(tolua_S);
+ if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
+ return result;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: handle of class  Fl_Tile */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tile_handle00
+static int tolua_fltk_fltk_Fl_Tile_handle00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Tile",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
 #endif
  {
-  self->draw(X,Y,W,H,cx,cy);
+  Fl_Tile* self = (Fl_Tile*)  tolua_tousertype(tolua_S,1,0);
+  int tolua_var_111 = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'handle'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->handle(tolua_var_111);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'draw'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'handle'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: draw of class  Fl_Tiled_Image */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_draw01
-static int tolua_fltk_fltk_Fl_Tiled_Image_draw01(lua_State* tolua_S)
+/* method: position of class  Fl_Tile */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tile_position00
+static int tolua_fltk_fltk_Fl_Tile_position00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Tile",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  Fl_Tiled_Image* self = (Fl_Tiled_Image*)  tolua_tousertype(tolua_S,1,0);
-  int X = ((int)  tolua_tonumber(tolua_S,2,0));
-  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
+  Fl_Tile* self = (Fl_Tile*)  tolua_tousertype(tolua_S,1,0);
+  int tolua_var_112 = ((int)  tolua_tonumber(tolua_S,2,0));
+  int tolua_var_113 = ((int)  tolua_tonumber(tolua_S,3,0));
+  int tolua_var_114 = ((int)  tolua_tonumber(tolua_S,4,0));
+  int tolua_var_115 = ((int)  tolua_tonumber(tolua_S,5,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'draw'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'position'", NULL);
 #endif
  {
-  self->draw(X,Y);
+  self->position(tolua_var_112,tolua_var_113,tolua_var_114,tolua_var_115);
  }
  }
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_Fl_Tiled_Image_draw00(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'position'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: image of class  Fl_Tiled_Image */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_image00
-static int tolua_fltk_fltk_Fl_Tiled_Image_image00(lua_State* tolua_S)
+/* method: resize of class  Fl_Tile */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tile_resize00
+static int tolua_fltk_fltk_Fl_Tile_resize00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Tile",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Tiled_Image* self = (Fl_Tiled_Image*)  tolua_tousertype(tolua_S,1,0);
+  Fl_Tile* self = (Fl_Tile*)  tolua_tousertype(tolua_S,1,0);
+  int tolua_var_116 = ((int)  tolua_tonumber(tolua_S,2,0));
+  int tolua_var_117 = ((int)  tolua_tonumber(tolua_S,3,0));
+  int tolua_var_118 = ((int)  tolua_tonumber(tolua_S,4,0));
+  int tolua_var_119 = ((int)  tolua_tonumber(tolua_S,5,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'image'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'resize'", NULL);
 #endif
  {
-  Fl_Image* tolua_ret = (Fl_Image*)  self->image();
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Image");
+  self->resize(tolua_var_116,tolua_var_117,tolua_var_118,tolua_var_119);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'image'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'resize'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+ class Lua__Fl_Tile : public Fl_Tile, public ToluaBase {
+public:
+	 int  handle( int tolua_var_111) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Tile_handle00)) {
+			tolua_pushnumber(lua_state, (lua_Number)tolua_var_111);
+			ToluaBase::dbcall(lua_state, 2, 1);
+			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
+			lua_pop(lua_state, 1);
+			return tolua_ret;
+		} else {
+			return ( int ) Fl_Tile:: handle(tolua_var_111);
+		};
+	};
+	 Fl_Group*  as_group( void ) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+			ToluaBase::dbcall(lua_state, 1, 1);
+			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
+			lua_pop(lua_state, 1);
+			return tolua_ret;
+		} else {
+			return ( Fl_Group* ) Fl_Tile:: as_group();
+		};
+	};
+	 Fl_Window*  as_window( void ) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+			ToluaBase::dbcall(lua_state, 1, 1);
+			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
+			lua_pop(lua_state, 1);
+			return tolua_ret;
+		} else {
+			return ( Fl_Window* ) Fl_Tile:: as_window();
+		};
+	};
+	 void  do_callback( Fl_Widget* o, void* arg = 0) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
+			tolua_pushuserdata(lua_state, (void*)arg);
+			ToluaBase::dbcall(lua_state, 3, 0);
+		} else {
+			 Fl_Tile:: do_callback(o,arg);
+		};
+	};
+	 void  draw( void ) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+			ToluaBase::dbcall(lua_state, 1, 0);
+		} else {
+			 Fl_Tile:: draw();
+		};
+	};
+	 void  hide( void ) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+			ToluaBase::dbcall(lua_state, 1, 0);
+		} else {
+			 Fl_Tile:: hide();
+		};
+	};
+	 void  resize( int x, int y, int w, int h) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+			tolua_pushnumber(lua_state, (lua_Number)x);
+			tolua_pushnumber(lua_state, (lua_Number)y);
+			tolua_pushnumber(lua_state, (lua_Number)w);
+			tolua_pushnumber(lua_state, (lua_Number)h);
+			ToluaBase::dbcall(lua_state, 5, 0);
+		} else {
+			 Fl_Tile:: resize(x,y,w,h);
+		};
+	};
+	 void  show( void ) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+			ToluaBase::dbcall(lua_state, 1, 0);
+		} else {
+			 Fl_Tile:: show();
+		};
+	};
+
+	 int Fl_Tile__handle( int tolua_var_111) {
+		return ( int )Fl_Tile::handle(tolua_var_111);
+	};
+	 Fl_Group* Fl_Tile__as_group( void ) {
+		return ( Fl_Group* )Fl_Tile::as_group();
+	};
+	 Fl_Window* Fl_Tile__as_window( void ) {
+		return ( Fl_Window* )Fl_Tile::as_window();
+	};
+	 void Fl_Tile__do_callback( Fl_Widget* o, void* arg = 0) {
+		Fl_Tile::do_callback(o,arg);
+	};
+	 void Fl_Tile__draw( void ) {
+		Fl_Tile::draw();
+	};
+	 void Fl_Tile__hide( void ) {
+		Fl_Tile::hide();
+	};
+	 void Fl_Tile__resize( int x, int y, int w, int h) {
+		Fl_Tile::resize(x,y,w,h);
+	};
+	 void Fl_Tile__show( void ) {
+		Fl_Tile::show();
+	};
+	 Lua__Fl_Tile( int X, int Y, int W, int H, const char* l = 0): Fl_Tile(X,Y,W,H,l){};
+};
+
+/* method: tolua__set_instance of class  Lua__Fl_Tile */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Tile_tolua__set_instance00
+static int tolua_fltk_fltk_Lua__Fl_Tile_tolua__set_instance00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Lua__Fl_Tile",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Lua__Fl_Tile* self = (Lua__Fl_Tile*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  lua_Object lo = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'tolua__set_instance'", NULL);
+#endif
+ {
+  self->tolua__set_instance(L,lo);
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'tolua__set_instance'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: Fl_Tile__handle of class  Lua__Fl_Tile */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Tile_Fl_Tile__handle00
+static int tolua_fltk_fltk_Lua__Fl_Tile_Fl_Tile__handle00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Lua__Fl_Tile",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Lua__Fl_Tile* self = (Lua__Fl_Tile*)  tolua_tousertype(tolua_S,1,0);
+  int tolua_var_111 = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'Fl_Tile__handle'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->Fl_Tile__handle(tolua_var_111);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'Fl_Tile__handle'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: new of class  Lua__Fl_Tile */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Tile_new00
+static int tolua_fltk_fltk_Lua__Fl_Tile_new00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertable(tolua_S,1,"Lua__Fl_Tile",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,6,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,7,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  int X = ((int)  tolua_tonumber(tolua_S,2,0));
+  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int W = ((int)  tolua_tonumber(tolua_S,4,0));
+  int H = ((int)  tolua_tonumber(tolua_S,5,0));
+  const char* l = ((const char*)  tolua_tostring(tolua_S,6,0));
+ {
+  Lua__Fl_Tile* tolua_ret = (Lua__Fl_Tile*)  Mtolua_new((Lua__Fl_Tile)(X,Y,W,H,l));
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Lua__Fl_Tile");
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: new_local of class  Lua__Fl_Tile */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Tile_new00_local
+static int tolua_fltk_fltk_Lua__Fl_Tile_new00_local(lua_State* tolua_S)
+{
+ int result = tolua_fltk_fltk_Lua__Fl_Tile_new00(tolua_S);
+ if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
+ return result;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+
+/* function to release collected object via destructor */
+#ifdef __cplusplus
+
+static int tolua_collect_Lua__Fl_Tile (lua_State* tolua_S)
+{
+ Lua__Fl_Tile* self = (Lua__Fl_Tile*) tolua_tousertype(tolua_S,1,0);
+	delete self;
+	return 0;
+}
+#endif
+
+/* method: new of class  Fl_Tiled_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_new00
+static int tolua_fltk_fltk_Fl_Tiled_Image_new00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertable(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,2,"Fl_Image",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,1,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Image* i = ((Fl_Image*)  tolua_tousertype(tolua_S,2,0));
+  int W = ((int)  tolua_tonumber(tolua_S,3,0));
+  int H = ((int)  tolua_tonumber(tolua_S,4,0));
+ {
+  Fl_Tiled_Image* tolua_ret = (Fl_Tiled_Image*)  Mtolua_new((Fl_Tiled_Image)(i,W,H));
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Tiled_Image");
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: new_local of class  Fl_Tiled_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_new00_local
+static int tolua_fltk_fltk_Fl_Tiled_Image_new00_local(lua_State* tolua_S)
+{
+ int result = tolua_fltk_fltk_Fl_Tiled_Image_new00(tolua_S);
+ if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
+ return result;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: color_average of class  Fl_Tiled_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_color_average00
+static int tolua_fltk_fltk_Fl_Tiled_Image_color_average00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Tiled_Image* self = (Fl_Tiled_Image*)  tolua_tousertype(tolua_S,1,0);
+  unsigned int c = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
+  float i = ((float)  tolua_tonumber(tolua_S,3,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'color_average'", NULL);
+#endif
+ {
+  self->color_average(c,i);
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'color_average'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: copy of class  Fl_Tiled_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_copy00
+static int tolua_fltk_fltk_Fl_Tiled_Image_copy00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Tiled_Image* self = (Fl_Tiled_Image*)  tolua_tousertype(tolua_S,1,0);
+  int W = ((int)  tolua_tonumber(tolua_S,2,0));
+  int H = ((int)  tolua_tonumber(tolua_S,3,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'copy'", NULL);
+#endif
+ {
+  Fl_Image* tolua_ret = (Fl_Image*)  self->copy(W,H);
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Image");
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'copy'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: copy of class  Fl_Tiled_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_copy01
+static int tolua_fltk_fltk_Fl_Tiled_Image_copy01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  Fl_Tiled_Image* self = (Fl_Tiled_Image*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'copy'", NULL);
+#endif
+ {
+  Fl_Image* tolua_ret = (Fl_Image*)  self->copy();
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Image");
+ }
+ }
+ return 1;
+tolua_lerror:
+ return tolua_fltk_fltk_Fl_Tiled_Image_copy00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: desaturate of class  Fl_Tiled_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_desaturate00
+static int tolua_fltk_fltk_Fl_Tiled_Image_desaturate00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Tiled_Image* self = (Fl_Tiled_Image*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'desaturate'", NULL);
+#endif
+ {
+  self->desaturate();
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'desaturate'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: draw of class  Fl_Tiled_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_draw00
+static int tolua_fltk_fltk_Fl_Tiled_Image_draw00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,7,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,8,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Tiled_Image* self = (Fl_Tiled_Image*)  tolua_tousertype(tolua_S,1,0);
+  int X = ((int)  tolua_tonumber(tolua_S,2,0));
+  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int W = ((int)  tolua_tonumber(tolua_S,4,0));
+  int H = ((int)  tolua_tonumber(tolua_S,5,0));
+  int cx = ((int)  tolua_tonumber(tolua_S,6,0));
+  int cy = ((int)  tolua_tonumber(tolua_S,7,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'draw'", NULL);
+#endif
+ {
+  self->draw(X,Y,W,H,cx,cy);
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'draw'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: draw of class  Fl_Tiled_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_draw01
+static int tolua_fltk_fltk_Fl_Tiled_Image_draw01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  Fl_Tiled_Image* self = (Fl_Tiled_Image*)  tolua_tousertype(tolua_S,1,0);
+  int X = ((int)  tolua_tonumber(tolua_S,2,0));
+  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'draw'", NULL);
+#endif
+ {
+  self->draw(X,Y);
+ }
+ }
+ return 0;
+tolua_lerror:
+ return tolua_fltk_fltk_Fl_Tiled_Image_draw00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: image of class  Fl_Tiled_Image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Tiled_Image_image00
+static int tolua_fltk_fltk_Fl_Tiled_Image_image00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Tiled_Image",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Tiled_Image* self = (Fl_Tiled_Image*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'image'", NULL);
+#endif
+ {
+  Fl_Image* tolua_ret = (Fl_Image*)  self->image();
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Image");
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'image'.",&tolua_err);
  return 0;
 #endif
 }
@@ -43083,7 +45385,7 @@ static int tolua_fltk_fltk_Fl_Tiled_Image_image00(lua_State* tolua_S)
  class Lua__Fl_Tiled_Image : public Fl_Tiled_Image, public ToluaBase {
 public:
 	 void  color_average( unsigned int c, float i) {
-		if (push_method("color_average",  tolua_fltk_fltk_Fl_Tiled_Image_color_average00)) {
+		if (push_method(0, "color_average",  tolua_fltk_fltk_Fl_Tiled_Image_color_average00)) {
 			tolua_pushnumber(lua_state, (lua_Number)c);
 			tolua_pushnumber(lua_state, (lua_Number)i);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -43092,7 +45394,7 @@ public:
 		};
 	};
 	 Fl_Image*  copy( int W, int H) {
-		if (push_method("copy",  tolua_fltk_fltk_Fl_Tiled_Image_copy00)) {
+		if (push_method(1, "copy",  tolua_fltk_fltk_Fl_Tiled_Image_copy00)) {
 			tolua_pushnumber(lua_state, (lua_Number)W);
 			tolua_pushnumber(lua_state, (lua_Number)H);
 			ToluaBase::dbcall(lua_state, 3, 1);
@@ -43104,14 +45406,14 @@ public:
 		};
 	};
 	 void  desaturate( void ) {
-		if (push_method("desaturate",  tolua_fltk_fltk_Fl_Tiled_Image_desaturate00)) {
+		if (push_method(2, "desaturate",  tolua_fltk_fltk_Fl_Tiled_Image_desaturate00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Tiled_Image:: desaturate();
 		};
 	};
 	 void  draw( int X, int Y, int W, int H, int cx, int cy) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Tiled_Image_draw00)) {
+		if (push_method(3, "draw",  tolua_fltk_fltk_Fl_Tiled_Image_draw00)) {
 			tolua_pushnumber(lua_state, (lua_Number)X);
 			tolua_pushnumber(lua_state, (lua_Number)Y);
 			tolua_pushnumber(lua_state, (lua_Number)W);
@@ -43124,7 +45426,7 @@ public:
 		};
 	};
 	 void  label( Fl_Widget* w) {
-		if (push_method("label",  tolua_fltk_fltk_Fl_Image_label00)) {
+		if (push_method(4, "label",  tolua_fltk_fltk_Fl_Image_label00)) {
 			tolua_pushusertype(lua_state, (void*)w, "Fl_Widget");
 			ToluaBase::dbcall(lua_state, 2, 0);
 		} else {
@@ -43132,7 +45434,7 @@ public:
 		};
 	};
 	 void  uncache( void ) {
-		if (push_method("uncache",  tolua_fltk_fltk_Fl_Image_uncache00)) {
+		if (push_method(5, "uncache",  tolua_fltk_fltk_Fl_Image_uncache00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Tiled_Image:: uncache();
@@ -45699,7 +48001,7 @@ static int tolua_fltk_fltk_Fl_Tree_usericon00(lua_State* tolua_S)
  class Lua__Fl_Tree : public Fl_Tree, public ToluaBase {
 public:
 	 int  handle( int e) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Tree_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Tree_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)e);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -45710,7 +48012,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -45720,7 +48022,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -45730,7 +48032,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -45739,21 +48041,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Tree:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(5, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Tree:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(6, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -45764,7 +48066,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(7, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Tree:: show();
@@ -49471,7 +51773,7 @@ static int tolua_fltk_fltk_Fl_Valuator_value00(lua_State* tolua_S)
  class Lua__Fl_Valuator : public Fl_Valuator, public ToluaBase {
 public:
 	 int  format( char* tolua_var_121) {
-		if (push_method("format",  tolua_fltk_fltk_Fl_Valuator_format00)) {
+		if (push_method(0, "format",  tolua_fltk_fltk_Fl_Valuator_format00)) {
 			tolua_pushstring(lua_state, (const char*)tolua_var_121);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -49482,7 +51784,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(1, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -49492,7 +51794,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(2, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -49502,7 +51804,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(3, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -49511,14 +51813,14 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(4, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Valuator:: draw();
 		};
 	};
 	 int  handle( int event) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Widget_handle00)) {
+		if (push_method(5, "handle",  tolua_fltk_fltk_Fl_Widget_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)event);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -49529,14 +51831,14 @@ public:
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(6, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Valuator:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(7, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -49547,7 +51849,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(8, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Valuator:: show();
@@ -50092,7 +52394,7 @@ static int tolua_fltk_fltk_Fl_Counter_textsize00(lua_State* tolua_S)
  class Lua__Fl_Counter : public Fl_Counter, public ToluaBase {
 public:
 	 int  handle( int tolua_var_126) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Counter_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Counter_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_126);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -50103,7 +52405,7 @@ public:
 		};
 	};
 	 int  format( char* tolua_var_121) {
-		if (push_method("format",  tolua_fltk_fltk_Fl_Valuator_format00)) {
+		if (push_method(1, "format",  tolua_fltk_fltk_Fl_Valuator_format00)) {
 			tolua_pushstring(lua_state, (const char*)tolua_var_121);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -50114,7 +52416,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(2, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -50124,7 +52426,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(3, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -50134,7 +52436,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(4, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -50143,21 +52445,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(5, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Counter:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(6, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Counter:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(7, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -50168,7 +52470,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(8, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Counter:: show();
@@ -50536,7 +52838,7 @@ static int tolua_fltk_fltk_Fl_Dial_handle00(lua_State* tolua_S)
  class Lua__Fl_Dial : public Fl_Dial, public ToluaBase {
 public:
 	 int  handle( int tolua_var_127) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Dial_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Dial_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_127);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -50547,7 +52849,7 @@ public:
 		};
 	};
 	 int  format( char* tolua_var_121) {
-		if (push_method("format",  tolua_fltk_fltk_Fl_Valuator_format00)) {
+		if (push_method(1, "format",  tolua_fltk_fltk_Fl_Valuator_format00)) {
 			tolua_pushstring(lua_state, (const char*)tolua_var_121);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -50558,7 +52860,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(2, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -50568,7 +52870,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(3, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -50578,7 +52880,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(4, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -50587,21 +52889,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(5, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Dial:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(6, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Dial:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(7, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -50612,7 +52914,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(8, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Dial:: show();
@@ -51170,7 +53472,7 @@ static int tolua_fltk_fltk_Fl_Value_Input_textsize00(lua_State* tolua_S)
  class Lua__Fl_Value_Input : public Fl_Value_Input, public ToluaBase {
 public:
 	 int  handle( int tolua_var_128) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Value_Input_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Value_Input_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_128);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -51181,7 +53483,7 @@ public:
 		};
 	};
 	 int  format( char* tolua_var_121) {
-		if (push_method("format",  tolua_fltk_fltk_Fl_Valuator_format00)) {
+		if (push_method(1, "format",  tolua_fltk_fltk_Fl_Valuator_format00)) {
 			tolua_pushstring(lua_state, (const char*)tolua_var_121);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -51192,7 +53494,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(2, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -51202,7 +53504,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(3, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -51212,7 +53514,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(4, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -51221,21 +53523,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(5, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Value_Input:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(6, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Value_Input:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(7, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -51246,7 +53548,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(8, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Value_Input:: show();
@@ -53075,7 +55377,7 @@ static int tolua_fltk_fltk_Fl_Window_y_root00(lua_State* tolua_S)
  class Lua__Fl_Window : public Fl_Window, public ToluaBase {
 public:
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Window_as_window00)) {
+		if (push_method(0, "as_window",  tolua_fltk_fltk_Fl_Window_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -53085,7 +55387,7 @@ public:
 		};
 	};
 	 int  handle( int tolua_var_145) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Window_handle00)) {
+		if (push_method(1, "handle",  tolua_fltk_fltk_Fl_Window_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_145);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -53096,14 +55398,14 @@ public:
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Window_hide00)) {
+		if (push_method(2, "hide",  tolua_fltk_fltk_Fl_Window_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Window:: hide();
 		};
 	};
 	 void  resize( int tolua_var_147, int tolua_var_148, int tolua_var_149, int tolua_var_150) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Window_resize00)) {
+		if (push_method(3, "resize",  tolua_fltk_fltk_Fl_Window_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_147);
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_148);
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_149);
@@ -53114,14 +55416,14 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Window_show00)) {
+		if (push_method(4, "show",  tolua_fltk_fltk_Fl_Window_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Window:: show();
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(5, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -53131,7 +55433,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(6, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -53140,7 +55442,7 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(7, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Window:: draw();
@@ -58828,7 +61130,7 @@ static int tolua_fltk_fltk_Fl_Double_Window_handle00(lua_State* tolua_S)
  class Lua__Fl_Double_Window : public Fl_Double_Window, public ToluaBase {
 public:
 	 int  handle( int event) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Double_Window_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Double_Window_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)event);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -58839,7 +61141,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Window_as_window00)) {
+		if (push_method(1, "as_window",  tolua_fltk_fltk_Fl_Window_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -58849,14 +61151,14 @@ public:
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Window_hide00)) {
+		if (push_method(2, "hide",  tolua_fltk_fltk_Fl_Window_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Double_Window:: hide();
 		};
 	};
 	 void  resize( int tolua_var_147, int tolua_var_148, int tolua_var_149, int tolua_var_150) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Window_resize00)) {
+		if (push_method(3, "resize",  tolua_fltk_fltk_Fl_Window_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_147);
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_148);
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_149);
@@ -58867,14 +61169,14 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Window_show00)) {
+		if (push_method(4, "show",  tolua_fltk_fltk_Fl_Window_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Double_Window:: show();
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(5, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -58884,7 +61186,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(6, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -58893,7 +61195,7 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(7, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Double_Window:: draw();
@@ -59598,7 +61900,7 @@ static int tolua_fltk_fltk_Fl_Slider_slider_size00(lua_State* tolua_S)
  class Lua__Fl_Slider : public Fl_Slider, public ToluaBase {
 public:
 	 int  handle( int tolua_var_238) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Slider_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Slider_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_238);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -59609,7 +61911,7 @@ public:
 		};
 	};
 	 int  format( char* tolua_var_121) {
-		if (push_method("format",  tolua_fltk_fltk_Fl_Valuator_format00)) {
+		if (push_method(1, "format",  tolua_fltk_fltk_Fl_Valuator_format00)) {
 			tolua_pushstring(lua_state, (const char*)tolua_var_121);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -59620,7 +61922,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(2, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -59630,7 +61932,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(3, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -59640,7 +61942,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(4, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -59649,21 +61951,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(5, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Slider:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(6, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Slider:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(7, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -59674,7 +61976,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(8, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Slider:: show();
@@ -60095,7 +62397,7 @@ static int tolua_fltk_fltk_Fl_Value_Slider_textsize00(lua_State* tolua_S)
  class Lua__Fl_Value_Slider : public Fl_Value_Slider, public ToluaBase {
 public:
 	 int  handle( int tolua_var_239) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Value_Slider_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Value_Slider_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_239);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -60106,7 +62408,7 @@ public:
 		};
 	};
 	 int  format( char* tolua_var_121) {
-		if (push_method("format",  tolua_fltk_fltk_Fl_Valuator_format00)) {
+		if (push_method(1, "format",  tolua_fltk_fltk_Fl_Valuator_format00)) {
 			tolua_pushstring(lua_state, (const char*)tolua_var_121);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -60117,7 +62419,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(2, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -60127,7 +62429,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(3, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -60137,7 +62439,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(4, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -60146,21 +62448,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(5, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Value_Slider:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(6, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Value_Slider:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(7, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -60171,7 +62473,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(8, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Value_Slider:: show();
@@ -61574,7 +63876,7 @@ tolua_lerror:
  class Lua__Fl_Scrollbar : public Fl_Scrollbar, public ToluaBase {
 public:
 	 int  handle( int tolua_var_245) {
-		if (push_method("handle",  tolua_fltk_fltk_Fl_Scrollbar_handle00)) {
+		if (push_method(0, "handle",  tolua_fltk_fltk_Fl_Scrollbar_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)tolua_var_245);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -61585,7 +63887,7 @@ public:
 		};
 	};
 	 int  format( char* tolua_var_121) {
-		if (push_method("format",  tolua_fltk_fltk_Fl_Valuator_format00)) {
+		if (push_method(1, "format",  tolua_fltk_fltk_Fl_Valuator_format00)) {
 			tolua_pushstring(lua_state, (const char*)tolua_var_121);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -61596,7 +63898,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
+		if (push_method(2, "as_group",  tolua_fltk_fltk_Fl_Widget_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -61606,7 +63908,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(3, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -61616,7 +63918,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(4, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -61625,21 +63927,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(5, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Scrollbar:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(6, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Scrollbar:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(7, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -61650,7 +63952,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(8, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Fl_Scrollbar:: show();
@@ -61687,138 +63989,1888 @@ public:
 	 Lua__Fl_Scrollbar( int X, int Y, int W, int H, const char* L = 0): Fl_Scrollbar(X,Y,W,H,L){};
 };
 
-/* method: tolua__set_instance of class  Lua__Fl_Scrollbar */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Scrollbar_tolua__set_instance00
-static int tolua_fltk_fltk_Lua__Fl_Scrollbar_tolua__set_instance00(lua_State* tolua_S)
+/* method: tolua__set_instance of class  Lua__Fl_Scrollbar */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Scrollbar_tolua__set_instance00
+static int tolua_fltk_fltk_Lua__Fl_Scrollbar_tolua__set_instance00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Lua__Fl_Scrollbar",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Lua__Fl_Scrollbar* self = (Lua__Fl_Scrollbar*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  lua_Object lo = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'tolua__set_instance'", NULL);
+#endif
+ {
+  self->tolua__set_instance(L,lo);
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'tolua__set_instance'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: Fl_Scrollbar__handle of class  Lua__Fl_Scrollbar */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Scrollbar_Fl_Scrollbar__handle00
+static int tolua_fltk_fltk_Lua__Fl_Scrollbar_Fl_Scrollbar__handle00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Lua__Fl_Scrollbar",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Lua__Fl_Scrollbar* self = (Lua__Fl_Scrollbar*)  tolua_tousertype(tolua_S,1,0);
+  int tolua_var_245 = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'Fl_Scrollbar__handle'", NULL);
+#endif
+ {
+  int tolua_ret = (int)  self->Fl_Scrollbar__handle(tolua_var_245);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'Fl_Scrollbar__handle'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: new of class  Lua__Fl_Scrollbar */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Scrollbar_new00
+static int tolua_fltk_fltk_Lua__Fl_Scrollbar_new00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertable(tolua_S,1,"Lua__Fl_Scrollbar",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,6,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,7,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  int X = ((int)  tolua_tonumber(tolua_S,2,0));
+  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int W = ((int)  tolua_tonumber(tolua_S,4,0));
+  int H = ((int)  tolua_tonumber(tolua_S,5,0));
+  const char* L = ((const char*)  tolua_tostring(tolua_S,6,0));
+ {
+  Lua__Fl_Scrollbar* tolua_ret = (Lua__Fl_Scrollbar*)  Mtolua_new((Lua__Fl_Scrollbar)(X,Y,W,H,L));
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Lua__Fl_Scrollbar");
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: new_local of class  Lua__Fl_Scrollbar */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Scrollbar_new00_local
+static int tolua_fltk_fltk_Lua__Fl_Scrollbar_new00_local(lua_State* tolua_S)
+{
+ int result = tolua_fltk_fltk_Lua__Fl_Scrollbar_new00(tolua_S);
+ if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
+ return result;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+
+/* function to release collected object via destructor */
+#ifdef __cplusplus
+
+static int tolua_collect_Lua__Fl_Scrollbar (lua_State* tolua_S)
+{
+ Lua__Fl_Scrollbar* self = (Lua__Fl_Scrollbar*) tolua_tousertype(tolua_S,1,0);
+	delete self;
+	return 0;
+}
+#endif
+
+/* function: fl_box */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_box00
+static int tolua_fltk_fltk_fl_box00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Boxtype b = ((Fl_Boxtype) (int)  tolua_tonumber(tolua_S,1,0));
+ {
+  Fl_Boxtype tolua_ret = (Fl_Boxtype)  fl_box(b);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_box'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_down */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_down00
+static int tolua_fltk_fltk_fl_down00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Boxtype b = ((Fl_Boxtype) (int)  tolua_tonumber(tolua_S,1,0));
+ {
+  Fl_Boxtype tolua_ret = (Fl_Boxtype)  fl_down(b);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_down'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_frame */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_frame00
+static int tolua_fltk_fltk_fl_frame00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Boxtype b = ((Fl_Boxtype) (int)  tolua_tonumber(tolua_S,1,0));
+ {
+  Fl_Boxtype tolua_ret = (Fl_Boxtype)  fl_frame(b);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_frame'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_color_average */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_color_average00
+static int tolua_fltk_fltk_fl_color_average00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  unsigned int c1 = (( unsigned int)  tolua_tonumber(tolua_S,1,0));
+  unsigned int c2 = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
+  float weight = ((float)  tolua_tonumber(tolua_S,3,0));
+ {
+  unsigned int tolua_ret = ( unsigned int)  fl_color_average(c1,c2,weight);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_color_average'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_color_cube */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_color_cube00
+static int tolua_fltk_fltk_fl_color_cube00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  int r = ((int)  tolua_tonumber(tolua_S,1,0));
+  int g = ((int)  tolua_tonumber(tolua_S,2,0));
+  int b = ((int)  tolua_tonumber(tolua_S,3,0));
+ {
+  unsigned int tolua_ret = ( unsigned int)  fl_color_cube(r,g,b);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_color_cube'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_contrast */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_contrast00
+static int tolua_fltk_fltk_fl_contrast00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  unsigned int fg = (( unsigned int)  tolua_tonumber(tolua_S,1,0));
+  unsigned int bg = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
+ {
+  unsigned int tolua_ret = ( unsigned int)  fl_contrast(fg,bg);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_contrast'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_darker */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_darker00
+static int tolua_fltk_fltk_fl_darker00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  unsigned int c = (( unsigned int)  tolua_tonumber(tolua_S,1,0));
+ {
+  unsigned int tolua_ret = ( unsigned int)  fl_darker(c);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_darker'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_gray_ramp */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_gray_ramp00
+static int tolua_fltk_fltk_fl_gray_ramp00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  int i = ((int)  tolua_tonumber(tolua_S,1,0));
+ {
+  unsigned int tolua_ret = ( unsigned int)  fl_gray_ramp(i);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_gray_ramp'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_inactive */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_inactive00
+static int tolua_fltk_fltk_fl_inactive00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  unsigned int c = (( unsigned int)  tolua_tonumber(tolua_S,1,0));
+ {
+  unsigned int tolua_ret = ( unsigned int)  fl_inactive(c);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_inactive'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_lighter */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_lighter00
+static int tolua_fltk_fltk_fl_lighter00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  unsigned int c = (( unsigned int)  tolua_tonumber(tolua_S,1,0));
+ {
+  unsigned int tolua_ret = ( unsigned int)  fl_lighter(c);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_lighter'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_rgb_color */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rgb_color00
+static int tolua_fltk_fltk_fl_rgb_color00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  unsigned char g = (( unsigned char)  tolua_tonumber(tolua_S,1,0));
+ {
+  unsigned int tolua_ret = ( unsigned int)  fl_rgb_color(g);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_rgb_color'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_rgb_color */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rgb_color01
+static int tolua_fltk_fltk_fl_rgb_color01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  unsigned char r = (( unsigned char)  tolua_tonumber(tolua_S,1,0));
+  unsigned char g = (( unsigned char)  tolua_tonumber(tolua_S,2,0));
+  unsigned char b = (( unsigned char)  tolua_tonumber(tolua_S,3,0));
+ {
+  unsigned int tolua_ret = ( unsigned int)  fl_rgb_color(r,g,b);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ return tolua_fltk_fltk_fl_rgb_color00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: exit */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_exit00
+static int tolua_fltk_fltk_exit00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  int result = ((int)  tolua_tonumber(tolua_S,1,0));
+ {
+  exit(result);
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'exit'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_message_icon */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_message_icon00
+static int tolua_fltk_fltk_fl_message_icon00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+ {
+  Fl_Widget* tolua_ret = (Fl_Widget*)  fl_message_icon();
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Widget");
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_message_icon'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_input */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_input00
+static int tolua_fltk_fltk_fl_input00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  const char* label = ((const char*)  tolua_tostring(tolua_S,1,0));
+  const char* deflt = ((const char*)  tolua_tostring(tolua_S,2,0));
+ {
+  char* tolua_ret = (char*)  fl_input(label,deflt);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_input'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_password */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_password00
+static int tolua_fltk_fltk_fl_password00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  const char* label = ((const char*)  tolua_tostring(tolua_S,1,0));
+  const char* deflt = ((const char*)  tolua_tostring(tolua_S,2,0));
+ {
+  char* tolua_ret = (char*)  fl_password(label,deflt);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_password'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_ask */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_ask00
+static int tolua_fltk_fltk_fl_ask00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  const char* tolua_var_246 = ((const char*)  tolua_tostring(tolua_S,1,0));
+ {
+  int tolua_ret = (int)  fl_ask(tolua_var_246);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_ask'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_choice */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_choice00
+static int tolua_fltk_fltk_fl_choice00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,3,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  const char* q = ((const char*)  tolua_tostring(tolua_S,1,0));
+  const char* b0 = ((const char*)  tolua_tostring(tolua_S,2,0));
+  const char* b1 = ((const char*)  tolua_tostring(tolua_S,3,0));
+  const char* b2 = ((const char*)  tolua_tostring(tolua_S,4,0));
+ {
+  int tolua_ret = (int)  fl_choice(q,b0,b1,b2);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_choice'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_alert */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_alert00
+static int tolua_fltk_fltk_fl_alert00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  const char* tolua_var_247 = ((const char*)  tolua_tostring(tolua_S,1,0));
+ {
+  fl_alert(tolua_var_247);
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_alert'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_beep */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_beep00
+static int tolua_fltk_fltk_fl_beep00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  int type = ((int)  tolua_tonumber(tolua_S,1,FL_BEEP_DEFAULT));
+ {
+  fl_beep(type);
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_beep'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_message */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_message00
+static int tolua_fltk_fltk_fl_message00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  const char* tolua_var_248 = ((const char*)  tolua_tostring(tolua_S,1,0));
+ {
+  fl_message(tolua_var_248);
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_message'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_message_font */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_message_font00
+static int tolua_fltk_fltk_fl_message_font00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+   int f = ((  int)  tolua_tonumber(tolua_S,1,0));
+   int s = ((  int)  tolua_tonumber(tolua_S,2,0));
+ {
+  fl_message_font(f,s);
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_message_font'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_input */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_input01
+static int tolua_fltk_fltk_fl_input01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  const char* label = ((const char*)  tolua_tostring(tolua_S,1,0));
+  const char* deflt = ((const char*)  tolua_tostring(tolua_S,2,0));
+ {
+  const char* tolua_ret = (const char*)  fl_input(label,deflt);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ return tolua_fltk_fltk_fl_input00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_password */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_password01
+static int tolua_fltk_fltk_fl_password01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  const char* label = ((const char*)  tolua_tostring(tolua_S,1,0));
+  const char* deflt = ((const char*)  tolua_tostring(tolua_S,2,0));
+ {
+  const char* tolua_ret = (const char*)  fl_password(label,deflt);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ return tolua_fltk_fltk_fl_password00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_message_font */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_message_font01
+static int tolua_fltk_fltk_fl_message_font01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+   int f = ((  int)  tolua_tonumber(tolua_S,1,0));
+   int s = ((  int)  tolua_tonumber(tolua_S,2,0));
+ {
+  fl_message_font(f,s);
+ }
+ }
+ return 0;
+tolua_lerror:
+ return tolua_fltk_fltk_fl_message_font00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* get function: fl_no */
+#ifndef TOLUA_DISABLE_tolua_get_fltk_fl_no
+static int tolua_get_fltk_fl_no(lua_State* tolua_S)
+{
+ tolua_pushstring(tolua_S,(const char*)fl_no);
+ return 1;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* get function: fl_yes */
+#ifndef TOLUA_DISABLE_tolua_get_fltk_fl_yes
+static int tolua_get_fltk_fl_yes(lua_State* tolua_S)
+{
+ tolua_pushstring(tolua_S,(const char*)fl_yes);
+ return 1;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* get function: fl_ok */
+#ifndef TOLUA_DISABLE_tolua_get_fltk_fl_ok
+static int tolua_get_fltk_fl_ok(lua_State* tolua_S)
+{
+ tolua_pushstring(tolua_S,(const char*)fl_ok);
+ return 1;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* get function: fl_cancel */
+#ifndef TOLUA_DISABLE_tolua_get_fltk_fl_cancel
+static int tolua_get_fltk_fl_cancel(lua_State* tolua_S)
+{
+ tolua_pushstring(tolua_S,(const char*)fl_cancel);
+ return 1;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* get function: fl_close */
+#ifndef TOLUA_DISABLE_tolua_get_fltk_fl_close
+static int tolua_get_fltk_fl_close(lua_State* tolua_S)
+{
+ tolua_pushstring(tolua_S,(const char*)fl_close);
+ return 1;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_color */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_color00
+static int tolua_fltk_fltk_fl_color00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+ {
+  unsigned int tolua_ret = ( unsigned int)  fl_color();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_color'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_font */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_font00
+static int tolua_fltk_fltk_fl_font00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+ {
+   int tolua_ret = (  int)  fl_font();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_font'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_size */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_size00
+static int tolua_fltk_fltk_fl_size00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+ {
+   int tolua_ret = (  int)  fl_size();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_size'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_clip_region */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_clip_region00
+static int tolua_fltk_fltk_fl_clip_region00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+ {
+  Fl_Region tolua_ret = (Fl_Region)  fl_clip_region();
+ {
+#ifdef __cplusplus
+ void* tolua_obj = Mtolua_new((Fl_Region)(tolua_ret));
+  tolua_pushusertype(tolua_S,tolua_obj,"Fl_Region");
+ tolua_register_gc(tolua_S,lua_gettop(tolua_S));
+#else
+ void* tolua_obj = tolua_copy(tolua_S,(void*)&tolua_ret,sizeof(Fl_Region));
+  tolua_pushusertype(tolua_S,tolua_obj,"Fl_Region");
+ tolua_register_gc(tolua_S,lua_gettop(tolua_S));
+#endif
+ }
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_clip_region'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_latin1_to_local */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_latin1_to_local00
+static int tolua_fltk_fltk_fl_latin1_to_local00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  const char* t = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int n = ((int)  tolua_tonumber(tolua_S,2,-1));
+ {
+  char* tolua_ret = (char*)  fl_latin1_to_local(t,n);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_latin1_to_local'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_local_to_latin1 */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_local_to_latin100
+static int tolua_fltk_fltk_fl_local_to_latin100(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  const char* t = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int n = ((int)  tolua_tonumber(tolua_S,2,-1));
+ {
+  char* tolua_ret = (char*)  fl_local_to_latin1(t,n);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_local_to_latin1'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_local_to_mac_roman */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_local_to_mac_roman00
+static int tolua_fltk_fltk_fl_local_to_mac_roman00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  const char* t = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int n = ((int)  tolua_tonumber(tolua_S,2,-1));
+ {
+  char* tolua_ret = (char*)  fl_local_to_mac_roman(t,n);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_local_to_mac_roman'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_mac_roman_to_local */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_mac_roman_to_local00
+static int tolua_fltk_fltk_fl_mac_roman_to_local00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  const char* t = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int n = ((int)  tolua_tonumber(tolua_S,2,-1));
+ {
+  char* tolua_ret = (char*)  fl_mac_roman_to_local(t,n);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_mac_roman_to_local'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_can_do_alpha_blending */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_can_do_alpha_blending00
+static int tolua_fltk_fltk_fl_can_do_alpha_blending00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+ {
+  char tolua_ret = (char)  fl_can_do_alpha_blending();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_can_do_alpha_blending'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_expand_text */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_expand_text00
+static int tolua_fltk_fltk_fl_expand_text00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,7,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,8,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,9,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  const char* from = ((const char*)  tolua_tostring(tolua_S,1,0));
+  char* buf = ((char*)  tolua_tostring(tolua_S,2,0));
+  int maxbuf = ((int)  tolua_tonumber(tolua_S,3,0));
+  double maxw = ((double)  tolua_tonumber(tolua_S,4,0));
+  int n = ((int)  tolua_tonumber(tolua_S,5,0));
+  double width = ((double)  tolua_tonumber(tolua_S,6,0));
+  int wrap = ((int)  tolua_tonumber(tolua_S,7,0));
+  int draw_symbols = ((int)  tolua_tonumber(tolua_S,8,0));
+ {
+  char* tolua_ret = (char*)  fl_expand_text(from,buf,maxbuf,maxw,n,width,wrap,draw_symbols);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
+ tolua_pushnumber(tolua_S,(lua_Number)n);
+ tolua_pushnumber(tolua_S,(lua_Number)width);
+ }
+ }
+ return 3;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_expand_text'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_shortcut_label */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_shortcut_label00
+static int tolua_fltk_fltk_fl_shortcut_label00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  unsigned int shortcut = ((unsigned int)  tolua_tonumber(tolua_S,1,0));
+ {
+  char* tolua_ret = (char*)  fl_shortcut_label(shortcut);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_shortcut_label'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_shortcut_label */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_shortcut_label01
+static int tolua_fltk_fltk_fl_shortcut_label01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  unsigned int shortcut = ((unsigned int)  tolua_tonumber(tolua_S,1,0));
+  const char* eom = ((const char*)  tolua_tostring(tolua_S,2,0));
+ {
+  char* tolua_ret = (char*)  fl_shortcut_label(shortcut,&eom);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
+ tolua_pushstring(tolua_S,(const char*)eom);
+ }
+ }
+ return 2;
+tolua_lerror:
+ return tolua_fltk_fltk_fl_shortcut_label00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_transform_dx */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_transform_dx00
+static int tolua_fltk_fltk_fl_transform_dx00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  double x = ((double)  tolua_tonumber(tolua_S,1,0));
+  double y = ((double)  tolua_tonumber(tolua_S,2,0));
+ {
+  double tolua_ret = (double)  fl_transform_dx(x,y);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_transform_dx'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_transform_dy */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_transform_dy00
+static int tolua_fltk_fltk_fl_transform_dy00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  double x = ((double)  tolua_tonumber(tolua_S,1,0));
+  double y = ((double)  tolua_tonumber(tolua_S,2,0));
+ {
+  double tolua_ret = (double)  fl_transform_dy(x,y);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_transform_dy'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_transform_x */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_transform_x00
+static int tolua_fltk_fltk_fl_transform_x00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  double x = ((double)  tolua_tonumber(tolua_S,1,0));
+  double y = ((double)  tolua_tonumber(tolua_S,2,0));
+ {
+  double tolua_ret = (double)  fl_transform_x(x,y);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_transform_x'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_transform_y */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_transform_y00
+static int tolua_fltk_fltk_fl_transform_y00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  double x = ((double)  tolua_tonumber(tolua_S,1,0));
+  double y = ((double)  tolua_tonumber(tolua_S,2,0));
+ {
+  double tolua_ret = (double)  fl_transform_y(x,y);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_transform_y'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_width */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_width00
+static int tolua_fltk_fltk_fl_width00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  const char* txt = ((const char*)  tolua_tostring(tolua_S,1,0));
+ {
+  double tolua_ret = (double)  fl_width(txt);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_width'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_width */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_width01
+static int tolua_fltk_fltk_fl_width01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  const char* txt = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int n = ((int)  tolua_tonumber(tolua_S,2,0));
+ {
+  double tolua_ret = (double)  fl_width(txt,n);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ return tolua_fltk_fltk_fl_width00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_width */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_width02
+static int tolua_fltk_fltk_fl_width02(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  unsigned int tolua_var_249 = ((unsigned int)  tolua_tonumber(tolua_S,1,0));
+ {
+  double tolua_ret = (double)  fl_width(tolua_var_249);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ return tolua_fltk_fltk_fl_width01(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_descent */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_descent00
+static int tolua_fltk_fltk_fl_descent00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+ {
+  int tolua_ret = (int)  fl_descent();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_descent'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_height */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_height00
+static int tolua_fltk_fltk_fl_height00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+ {
+  int tolua_ret = (int)  fl_height();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_height'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_clip_box */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_clip_box00
+static int tolua_fltk_fltk_fl_clip_box00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,7,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,8,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,9,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int w = ((int)  tolua_tonumber(tolua_S,3,0));
+  int h = ((int)  tolua_tonumber(tolua_S,4,0));
+  int X = ((int)  tolua_tonumber(tolua_S,5,0));
+  int Y = ((int)  tolua_tonumber(tolua_S,6,0));
+  int W = ((int)  tolua_tonumber(tolua_S,7,0));
+  int H = ((int)  tolua_tonumber(tolua_S,8,0));
+ {
+  int tolua_ret = (int)  fl_clip_box(x,y,w,h,X,Y,W,H);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ tolua_pushnumber(tolua_S,(lua_Number)X);
+ tolua_pushnumber(tolua_S,(lua_Number)Y);
+ tolua_pushnumber(tolua_S,(lua_Number)W);
+ tolua_pushnumber(tolua_S,(lua_Number)H);
+ }
+ }
+ return 5;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_clip_box'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_draw_pixmap */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw_pixmap00
+static int tolua_fltk_fltk_fl_draw_pixmap00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  char* data = ((char*)  tolua_tostring(tolua_S,1,0));
+  int x = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y = ((int)  tolua_tonumber(tolua_S,3,0));
+  unsigned int tolua_var_250 = (( unsigned int)  tolua_tonumber(tolua_S,4,FL_GRAY));
+ {
+  int tolua_ret = (int)  fl_draw_pixmap(&data,x,y,tolua_var_250);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ tolua_pushstring(tolua_S,(const char*)data);
+ }
+ }
+ return 2;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_draw_pixmap'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_draw_pixmap */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw_pixmap01
+static int tolua_fltk_fltk_fl_draw_pixmap01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  const char* cdata = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int x = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y = ((int)  tolua_tonumber(tolua_S,3,0));
+  unsigned int tolua_var_251 = (( unsigned int)  tolua_tonumber(tolua_S,4,FL_GRAY));
+ {
+  int tolua_ret = (int)  fl_draw_pixmap(&cdata,x,y,tolua_var_251);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ tolua_pushstring(tolua_S,(const char*)cdata);
+ }
+ }
+ return 2;
+tolua_lerror:
+ return tolua_fltk_fltk_fl_draw_pixmap00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_draw_symbol */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw_symbol00
+static int tolua_fltk_fltk_fl_draw_symbol00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,7,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  const char* label = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int x = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int w = ((int)  tolua_tonumber(tolua_S,4,0));
+  int h = ((int)  tolua_tonumber(tolua_S,5,0));
+  unsigned int tolua_var_252 = (( unsigned int)  tolua_tonumber(tolua_S,6,0));
+ {
+  int tolua_ret = (int)  fl_draw_symbol(label,x,y,w,h,tolua_var_252);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_draw_symbol'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_height */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_height01
+static int tolua_fltk_fltk_fl_height01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int font = ((int)  tolua_tonumber(tolua_S,1,0));
+  int size = ((int)  tolua_tonumber(tolua_S,2,0));
+ {
+  int tolua_ret = (int)  fl_height(font,size);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ return tolua_fltk_fltk_fl_height00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_measure_pixmap */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_measure_pixmap00
+static int tolua_fltk_fltk_fl_measure_pixmap00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  char* data = ((char*)  tolua_tostring(tolua_S,1,0));
+  int w = ((int)  tolua_tonumber(tolua_S,2,0));
+  int h = ((int)  tolua_tonumber(tolua_S,3,0));
+ {
+  int tolua_ret = (int)  fl_measure_pixmap(&data,w,h);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ tolua_pushstring(tolua_S,(const char*)data);
+ tolua_pushnumber(tolua_S,(lua_Number)w);
+ tolua_pushnumber(tolua_S,(lua_Number)h);
+ }
+ }
+ return 4;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_measure_pixmap'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_measure_pixmap */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_measure_pixmap01
+static int tolua_fltk_fltk_fl_measure_pixmap01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  const char* cdata = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int w = ((int)  tolua_tonumber(tolua_S,2,0));
+  int h = ((int)  tolua_tonumber(tolua_S,3,0));
+ {
+  int tolua_ret = (int)  fl_measure_pixmap(&cdata,w,h);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ tolua_pushstring(tolua_S,(const char*)cdata);
+ tolua_pushnumber(tolua_S,(lua_Number)w);
+ tolua_pushnumber(tolua_S,(lua_Number)h);
+ }
+ }
+ return 4;
+tolua_lerror:
+ return tolua_fltk_fltk_fl_measure_pixmap00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_not_clipped */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_not_clipped00
+static int tolua_fltk_fltk_fl_not_clipped00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Lua__Fl_Scrollbar",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Lua__Fl_Scrollbar* self = (Lua__Fl_Scrollbar*)  tolua_tousertype(tolua_S,1,0);
-  lua_State* L =  tolua_S;
-  lua_Object lo = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
-#ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'tolua__set_instance'", NULL);
-#endif
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int w = ((int)  tolua_tonumber(tolua_S,3,0));
+  int h = ((int)  tolua_tonumber(tolua_S,4,0));
  {
-  self->tolua__set_instance(L,lo);
+  int tolua_ret = (int)  fl_not_clipped(x,y,w,h);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'tolua__set_instance'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_not_clipped'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: Fl_Scrollbar__handle of class  Lua__Fl_Scrollbar */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Scrollbar_Fl_Scrollbar__handle00
-static int tolua_fltk_fltk_Lua__Fl_Scrollbar_Fl_Scrollbar__handle00(lua_State* tolua_S)
+/* function: fl_old_shortcut */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_old_shortcut00
+static int tolua_fltk_fltk_fl_old_shortcut00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Lua__Fl_Scrollbar",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Lua__Fl_Scrollbar* self = (Lua__Fl_Scrollbar*)  tolua_tousertype(tolua_S,1,0);
-  int tolua_var_245 = ((int)  tolua_tonumber(tolua_S,2,0));
-#ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'Fl_Scrollbar__handle'", NULL);
-#endif
+  const char* s = ((const char*)  tolua_tostring(tolua_S,1,0));
  {
-  int tolua_ret = (int)  self->Fl_Scrollbar__handle(tolua_var_245);
+  int tolua_ret = (int)  fl_old_shortcut(s);
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'Fl_Scrollbar__handle'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_old_shortcut'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new of class  Lua__Fl_Scrollbar */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Scrollbar_new00
-static int tolua_fltk_fltk_Lua__Fl_Scrollbar_new00(lua_State* tolua_S)
+/* function: fl_read_image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_read_image00
+static int tolua_fltk_fltk_fl_read_image00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertable(tolua_S,1,"Lua__Fl_Scrollbar",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isstring(tolua_S,6,1,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,1,&tolua_err) ||
  !tolua_isnoobj(tolua_S,7,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  unsigned char p = (( unsigned char)  tolua_tonumber(tolua_S,1,0));
   int X = ((int)  tolua_tonumber(tolua_S,2,0));
   int Y = ((int)  tolua_tonumber(tolua_S,3,0));
   int W = ((int)  tolua_tonumber(tolua_S,4,0));
   int H = ((int)  tolua_tonumber(tolua_S,5,0));
-  const char* L = ((const char*)  tolua_tostring(tolua_S,6,0));
+  int alpha = ((int)  tolua_tonumber(tolua_S,6,0));
  {
-  Lua__Fl_Scrollbar* tolua_ret = (Lua__Fl_Scrollbar*)  Mtolua_new((Lua__Fl_Scrollbar)(X,Y,W,H,L));
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Lua__Fl_Scrollbar");
+  void* tolua_ret = (void*)  fl_read_image(&p,X,Y,W,H,alpha);
+ tolua_pushuserdata(tolua_S,(void*)tolua_ret);
+ tolua_pushnumber(tolua_S,(lua_Number)p);
  }
  }
- return 1;
+ return 2;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_read_image'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new_local of class  Lua__Fl_Scrollbar */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Lua__Fl_Scrollbar_new00_local
-static int tolua_fltk_fltk_Lua__Fl_Scrollbar_new00_local(lua_State* tolua_S)
-{
- int result = tolua_fltk_fltk_Lua__Fl_Scrollbar_new00(tolua_S);
- if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
- return result;
-}
-#endif //#ifndef TOLUA_DISABLE
-
-
-/* function to release collected object via destructor */
-#ifdef __cplusplus
-
-static int tolua_collect_Lua__Fl_Scrollbar (lua_State* tolua_S)
-{
- Lua__Fl_Scrollbar* self = (Lua__Fl_Scrollbar*) tolua_tousertype(tolua_S,1,0);
-	delete self;
-	return 0;
-}
-#endif
-
-/* function: fl_box */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_box00
-static int tolua_fltk_fltk_fl_box00(lua_State* tolua_S)
+/* function: fl_color */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_color01
+static int tolua_fltk_fltk_fl_color01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
@@ -61826,771 +65878,816 @@ static int tolua_fltk_fltk_fl_box00(lua_State* tolua_S)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  Fl_Boxtype b = ((Fl_Boxtype) (int)  tolua_tonumber(tolua_S,1,0));
+  unsigned int c = (( unsigned int)  tolua_tonumber(tolua_S,1,0));
  {
-  Fl_Boxtype tolua_ret = (Fl_Boxtype)  fl_box(b);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_color(c);
  }
  }
- return 1;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_box'.",&tolua_err);
  return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_fl_color00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_down */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_down00
-static int tolua_fltk_fltk_fl_down00(lua_State* tolua_S)
+/* function: fl_color */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_color02
+static int tolua_fltk_fltk_fl_color02(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  Fl_Boxtype b = ((Fl_Boxtype) (int)  tolua_tonumber(tolua_S,1,0));
+  unsigned char r = (( unsigned char)  tolua_tonumber(tolua_S,1,0));
+  unsigned char g = (( unsigned char)  tolua_tonumber(tolua_S,2,0));
+  unsigned char b = (( unsigned char)  tolua_tonumber(tolua_S,3,0));
  {
-  Fl_Boxtype tolua_ret = (Fl_Boxtype)  fl_down(b);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_color(r,g,b);
  }
  }
- return 1;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_down'.",&tolua_err);
  return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_fl_color01(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_frame */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_frame00
-static int tolua_fltk_fltk_fl_frame00(lua_State* tolua_S)
+/* function: fl_arc */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_arc00
+static int tolua_fltk_fltk_fl_arc00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Boxtype b = ((Fl_Boxtype) (int)  tolua_tonumber(tolua_S,1,0));
+  double x = ((double)  tolua_tonumber(tolua_S,1,0));
+  double y = ((double)  tolua_tonumber(tolua_S,2,0));
+  double r = ((double)  tolua_tonumber(tolua_S,3,0));
+  double start = ((double)  tolua_tonumber(tolua_S,4,0));
+  double end = ((double)  tolua_tonumber(tolua_S,5,0));
  {
-  Fl_Boxtype tolua_ret = (Fl_Boxtype)  fl_frame(b);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_arc(x,y,r,start,end);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_frame'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_arc'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_color_average */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_color_average00
-static int tolua_fltk_fltk_fl_color_average00(lua_State* tolua_S)
+/* function: fl_arc */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_arc01
+static int tolua_fltk_fltk_fl_arc01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,7,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  unsigned int c1 = (( unsigned int)  tolua_tonumber(tolua_S,1,0));
-  unsigned int c2 = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
-  float weight = ((float)  tolua_tonumber(tolua_S,3,0));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int w = ((int)  tolua_tonumber(tolua_S,3,0));
+  int h = ((int)  tolua_tonumber(tolua_S,4,0));
+  double a1 = ((double)  tolua_tonumber(tolua_S,5,0));
+  double a2 = ((double)  tolua_tonumber(tolua_S,6,0));
  {
-  unsigned int tolua_ret = ( unsigned int)  fl_color_average(c1,c2,weight);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_arc(x,y,w,h,a1,a2);
  }
  }
- return 1;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_color_average'.",&tolua_err);
  return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_fl_arc00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_color_cube */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_color_cube00
-static int tolua_fltk_fltk_fl_color_cube00(lua_State* tolua_S)
+/* function: fl_begin_complex_polygon */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_begin_complex_polygon00
+static int tolua_fltk_fltk_fl_begin_complex_polygon00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int r = ((int)  tolua_tonumber(tolua_S,1,0));
-  int g = ((int)  tolua_tonumber(tolua_S,2,0));
-  int b = ((int)  tolua_tonumber(tolua_S,3,0));
  {
-  unsigned int tolua_ret = ( unsigned int)  fl_color_cube(r,g,b);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_begin_complex_polygon();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_color_cube'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_begin_complex_polygon'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_contrast */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_contrast00
-static int tolua_fltk_fltk_fl_contrast00(lua_State* tolua_S)
+/* function: fl_begin_line */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_begin_line00
+static int tolua_fltk_fltk_fl_begin_line00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned int fg = (( unsigned int)  tolua_tonumber(tolua_S,1,0));
-  unsigned int bg = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
  {
-  unsigned int tolua_ret = ( unsigned int)  fl_contrast(fg,bg);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_begin_line();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_contrast'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_begin_line'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_darker */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_darker00
-static int tolua_fltk_fltk_fl_darker00(lua_State* tolua_S)
+/* function: fl_begin_loop */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_begin_loop00
+static int tolua_fltk_fltk_fl_begin_loop00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned int c = (( unsigned int)  tolua_tonumber(tolua_S,1,0));
  {
-  unsigned int tolua_ret = ( unsigned int)  fl_darker(c);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_begin_loop();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_darker'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_begin_loop'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_gray_ramp */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_gray_ramp00
-static int tolua_fltk_fltk_fl_gray_ramp00(lua_State* tolua_S)
+/* function: fl_begin_points */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_begin_points00
+static int tolua_fltk_fltk_fl_begin_points00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int i = ((int)  tolua_tonumber(tolua_S,1,0));
  {
-  unsigned int tolua_ret = ( unsigned int)  fl_gray_ramp(i);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_begin_points();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_gray_ramp'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_begin_points'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_inactive */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_inactive00
-static int tolua_fltk_fltk_fl_inactive00(lua_State* tolua_S)
+/* function: fl_begin_polygon */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_begin_polygon00
+static int tolua_fltk_fltk_fl_begin_polygon00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned int c = (( unsigned int)  tolua_tonumber(tolua_S,1,0));
  {
-  unsigned int tolua_ret = ( unsigned int)  fl_inactive(c);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_begin_polygon();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_inactive'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_begin_polygon'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_lighter */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_lighter00
-static int tolua_fltk_fltk_fl_lighter00(lua_State* tolua_S)
+/* function: fl_circle */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_circle00
+static int tolua_fltk_fltk_fl_circle00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned int c = (( unsigned int)  tolua_tonumber(tolua_S,1,0));
+  double x = ((double)  tolua_tonumber(tolua_S,1,0));
+  double y = ((double)  tolua_tonumber(tolua_S,2,0));
+  double r = ((double)  tolua_tonumber(tolua_S,3,0));
  {
-  unsigned int tolua_ret = ( unsigned int)  fl_lighter(c);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_circle(x,y,r);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_lighter'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_circle'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_rgb_color */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rgb_color00
-static int tolua_fltk_fltk_fl_rgb_color00(lua_State* tolua_S)
+/* function: fl_clip_region */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_clip_region01
+static int tolua_fltk_fltk_fl_clip_region01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ (tolua_isvaluenil(tolua_S,1,&tolua_err) || !tolua_isusertype(tolua_S,1,"Fl_Region",0,&tolua_err)) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  unsigned char g = (( unsigned char)  tolua_tonumber(tolua_S,1,0));
+  Fl_Region r = *((Fl_Region*)  tolua_tousertype(tolua_S,1,0));
  {
-  unsigned int tolua_ret = ( unsigned int)  fl_rgb_color(g);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_clip_region(r);
  }
  }
- return 1;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_rgb_color'.",&tolua_err);
  return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_fl_clip_region00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_rgb_color */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rgb_color01
-static int tolua_fltk_fltk_fl_rgb_color01(lua_State* tolua_S)
+/* function: fl_color */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_color03
+static int tolua_fltk_fltk_fl_color03(lua_State* tolua_S)
 {
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
  {
-  unsigned char r = (( unsigned char)  tolua_tonumber(tolua_S,1,0));
-  unsigned char g = (( unsigned char)  tolua_tonumber(tolua_S,2,0));
-  unsigned char b = (( unsigned char)  tolua_tonumber(tolua_S,3,0));
+  int c = ((int)  tolua_tonumber(tolua_S,1,0));
  {
-  unsigned int tolua_ret = ( unsigned int)  fl_rgb_color(r,g,b);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_color(c);
  }
  }
- return 1;
+ return 0;
 tolua_lerror:
- return tolua_fltk_fltk_fl_rgb_color00(tolua_S);
+ return tolua_fltk_fltk_fl_color02(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: exit */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_exit00
-static int tolua_fltk_fltk_exit00(lua_State* tolua_S)
+/* function: fl_cursor */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_cursor00
+static int tolua_fltk_fltk_fl_cursor00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnumber(tolua_S,2,1,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int result = ((int)  tolua_tonumber(tolua_S,1,0));
+  Fl_Cursor tolua_var_253 = ((Fl_Cursor) (int)  tolua_tonumber(tolua_S,1,0));
+  unsigned int fg = (( unsigned int)  tolua_tonumber(tolua_S,2,FL_BLACK));
+  unsigned int bg = (( unsigned int)  tolua_tonumber(tolua_S,3,FL_WHITE));
  {
-  exit(result);
+  fl_cursor(tolua_var_253,fg,bg);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'exit'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_cursor'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_message_icon */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_message_icon00
-static int tolua_fltk_fltk_fl_message_icon00(lua_State* tolua_S)
+/* function: fl_curve */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_curve00
+static int tolua_fltk_fltk_fl_curve00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,7,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,8,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,9,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  double X0 = ((double)  tolua_tonumber(tolua_S,1,0));
+  double Y0 = ((double)  tolua_tonumber(tolua_S,2,0));
+  double X1 = ((double)  tolua_tonumber(tolua_S,3,0));
+  double Y1 = ((double)  tolua_tonumber(tolua_S,4,0));
+  double X2 = ((double)  tolua_tonumber(tolua_S,5,0));
+  double Y2 = ((double)  tolua_tonumber(tolua_S,6,0));
+  double X3 = ((double)  tolua_tonumber(tolua_S,7,0));
+  double Y3 = ((double)  tolua_tonumber(tolua_S,8,0));
  {
-  Fl_Widget* tolua_ret = (Fl_Widget*)  fl_message_icon();
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Widget");
+  fl_curve(X0,Y0,X1,Y1,X2,Y2,X3,Y3);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_message_icon'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_curve'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_input */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_input00
-static int tolua_fltk_fltk_fl_input00(lua_State* tolua_S)
+/* function: fl_draw */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw00
+static int tolua_fltk_fltk_fl_draw00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* label = ((const char*)  tolua_tostring(tolua_S,1,0));
-  const char* deflt = ((const char*)  tolua_tostring(tolua_S,2,0));
+  const char* str = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int n = ((int)  tolua_tonumber(tolua_S,2,0));
+  int x = ((int)  tolua_tonumber(tolua_S,3,0));
+  int y = ((int)  tolua_tonumber(tolua_S,4,0));
  {
-  char* tolua_ret = (char*)  fl_input(label,deflt);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  fl_draw(str,n,x,y);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_input'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_draw'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_password */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_password00
-static int tolua_fltk_fltk_fl_password00(lua_State* tolua_S)
+/* function: fl_draw */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw01
+static int tolua_fltk_fltk_fl_draw01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  const char* str = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int x = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y = ((int)  tolua_tonumber(tolua_S,3,0));
+ {
+  fl_draw(str,x,y);
+ }
+ }
+ return 0;
+tolua_lerror:
+ return tolua_fltk_fltk_fl_draw00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_draw */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw02
+static int tolua_fltk_fltk_fl_draw02(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,7,"Fl_Image",1,&tolua_err) ||
+ !tolua_isnumber(tolua_S,8,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,9,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  const char* str = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int x = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int w = ((int)  tolua_tonumber(tolua_S,4,0));
+  int h = ((int)  tolua_tonumber(tolua_S,5,0));
+   unsigned align = ((  unsigned)  tolua_tonumber(tolua_S,6,0));
+  Fl_Image* img = ((Fl_Image*)  tolua_tousertype(tolua_S,7,0));
+  int draw_symbols = ((int)  tolua_tonumber(tolua_S,8,1));
+ {
+  fl_draw(str,x,y,w,h,align,img,draw_symbols);
+ }
+ }
+ return 0;
+tolua_lerror:
+ return tolua_fltk_fltk_fl_draw01(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_draw */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw03
+static int tolua_fltk_fltk_fl_draw03(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  const char* label = ((const char*)  tolua_tostring(tolua_S,1,0));
-  const char* deflt = ((const char*)  tolua_tostring(tolua_S,2,0));
+  int angle = ((int)  tolua_tonumber(tolua_S,1,0));
+  const char* str = ((const char*)  tolua_tostring(tolua_S,2,0));
+  int x = ((int)  tolua_tonumber(tolua_S,3,0));
+  int y = ((int)  tolua_tonumber(tolua_S,4,0));
  {
-  char* tolua_ret = (char*)  fl_password(label,deflt);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  fl_draw(angle,str,x,y);
  }
  }
- return 1;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_password'.",&tolua_err);
  return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_fl_draw02(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_ask */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_ask00
-static int tolua_fltk_fltk_fl_ask00(lua_State* tolua_S)
+/* function: fl_draw */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw04
+static int tolua_fltk_fltk_fl_draw04(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  const char* tolua_var_246 = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int angle = ((int)  tolua_tonumber(tolua_S,1,0));
+  const char* str = ((const char*)  tolua_tostring(tolua_S,2,0));
+  int n = ((int)  tolua_tonumber(tolua_S,3,0));
+  int x = ((int)  tolua_tonumber(tolua_S,4,0));
+  int y = ((int)  tolua_tonumber(tolua_S,5,0));
  {
-  int tolua_ret = (int)  fl_ask(tolua_var_246);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_draw(angle,str,n,x,y);
  }
  }
- return 1;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_ask'.",&tolua_err);
  return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_fl_draw03(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_choice */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_choice00
-static int tolua_fltk_fltk_fl_choice00(lua_State* tolua_S)
+/* function: fl_draw_box */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw_box00
+static int tolua_fltk_fltk_fl_draw_box00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
- !tolua_isstring(tolua_S,3,0,&tolua_err) ||
- !tolua_isstring(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,7,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* q = ((const char*)  tolua_tostring(tolua_S,1,0));
-  const char* b0 = ((const char*)  tolua_tostring(tolua_S,2,0));
-  const char* b1 = ((const char*)  tolua_tostring(tolua_S,3,0));
-  const char* b2 = ((const char*)  tolua_tostring(tolua_S,4,0));
+  Fl_Boxtype tolua_var_254 = ((Fl_Boxtype) (int)  tolua_tonumber(tolua_S,1,0));
+  int x = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int w = ((int)  tolua_tonumber(tolua_S,4,0));
+  int h = ((int)  tolua_tonumber(tolua_S,5,0));
+  unsigned int tolua_var_255 = (( unsigned int)  tolua_tonumber(tolua_S,6,0));
  {
-  int tolua_ret = (int)  fl_choice(q,b0,b1,b2);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_draw_box(tolua_var_254,x,y,w,h,tolua_var_255);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_choice'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_draw_box'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_alert */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_alert00
-static int tolua_fltk_fltk_fl_alert00(lua_State* tolua_S)
+/* function: fl_draw_image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw_image00
+static int tolua_fltk_fltk_fl_draw_image00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ (tolua_isvaluenil(tolua_S,1,&tolua_err) || !tolua_isusertype(tolua_S,1,"Fl_Draw_Image_Cb",0,&tolua_err)) ||
+ !tolua_isuserdata(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,7,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,8,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* tolua_var_247 = ((const char*)  tolua_tostring(tolua_S,1,0));
+  Fl_Draw_Image_Cb cb = *((Fl_Draw_Image_Cb*)  tolua_tousertype(tolua_S,1,0));
+  void* data = ((void*)  tolua_touserdata(tolua_S,2,0));
+  int X = ((int)  tolua_tonumber(tolua_S,3,0));
+  int Y = ((int)  tolua_tonumber(tolua_S,4,0));
+  int W = ((int)  tolua_tonumber(tolua_S,5,0));
+  int H = ((int)  tolua_tonumber(tolua_S,6,0));
+  int D = ((int)  tolua_tonumber(tolua_S,7,3));
  {
-  fl_alert(tolua_var_247);
+  fl_draw_image(cb,data,X,Y,W,H,D);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_alert'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_draw_image'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_beep */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_beep00
-static int tolua_fltk_fltk_fl_beep00(lua_State* tolua_S)
+/* function: fl_draw_image */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw_image01
+static int tolua_fltk_fltk_fl_draw_image01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,1,&tolua_err) ||
+ !tolua_isnumber(tolua_S,7,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,8,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  int type = ((int)  tolua_tonumber(tolua_S,1,FL_BEEP_DEFAULT));
+  unsigned const char buf = ((unsigned const char)  tolua_tonumber(tolua_S,1,0));
+  int X = ((int)  tolua_tonumber(tolua_S,2,0));
+  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int W = ((int)  tolua_tonumber(tolua_S,4,0));
+  int H = ((int)  tolua_tonumber(tolua_S,5,0));
+  int D = ((int)  tolua_tonumber(tolua_S,6,3));
+  int L = ((int)  tolua_tonumber(tolua_S,7,0));
  {
-  fl_beep(type);
+  fl_draw_image(&buf,X,Y,W,H,D,L);
+ tolua_pushnumber(tolua_S,(lua_Number)buf);
  }
  }
- return 0;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_beep'.",&tolua_err);
- return 0;
-#endif
+ return 1;
+tolua_lerror:
+ return tolua_fltk_fltk_fl_draw_image00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_message */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_message00
-static int tolua_fltk_fltk_fl_message00(lua_State* tolua_S)
+/* function: fl_draw_image_mono */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw_image_mono00
+static int tolua_fltk_fltk_fl_draw_image_mono00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,1,&tolua_err) ||
+ !tolua_isnumber(tolua_S,7,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,8,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* tolua_var_248 = ((const char*)  tolua_tostring(tolua_S,1,0));
+  unsigned const char buf = ((unsigned const char)  tolua_tonumber(tolua_S,1,0));
+  int X = ((int)  tolua_tonumber(tolua_S,2,0));
+  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int W = ((int)  tolua_tonumber(tolua_S,4,0));
+  int H = ((int)  tolua_tonumber(tolua_S,5,0));
+  int D = ((int)  tolua_tonumber(tolua_S,6,1));
+  int L = ((int)  tolua_tonumber(tolua_S,7,0));
  {
-  fl_message(tolua_var_248);
+  fl_draw_image_mono(&buf,X,Y,W,H,D,L);
+ tolua_pushnumber(tolua_S,(lua_Number)buf);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_message'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_draw_image_mono'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_message_font */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_message_font00
-static int tolua_fltk_fltk_fl_message_font00(lua_State* tolua_S)
+/* function: fl_end_complex_polygon */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_end_complex_polygon00
+static int tolua_fltk_fltk_fl_end_complex_polygon00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-   int f = ((  int)  tolua_tonumber(tolua_S,1,0));
-   int s = ((  int)  tolua_tonumber(tolua_S,2,0));
  {
-  fl_message_font(f,s);
+  fl_end_complex_polygon();
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_message_font'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_end_complex_polygon'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_input */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_input01
-static int tolua_fltk_fltk_fl_input01(lua_State* tolua_S)
+/* function: fl_end_line */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_end_line00
+static int tolua_fltk_fltk_fl_end_line00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  const char* label = ((const char*)  tolua_tostring(tolua_S,1,0));
-  const char* deflt = ((const char*)  tolua_tostring(tolua_S,2,0));
  {
-  const char* tolua_ret = (const char*)  fl_input(label,deflt);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  fl_end_line();
  }
  }
- return 1;
-tolua_lerror:
- return tolua_fltk_fltk_fl_input00(tolua_S);
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_end_line'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_password */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_password01
-static int tolua_fltk_fltk_fl_password01(lua_State* tolua_S)
+/* function: fl_end_loop */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_end_loop00
+static int tolua_fltk_fltk_fl_end_loop00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  const char* label = ((const char*)  tolua_tostring(tolua_S,1,0));
-  const char* deflt = ((const char*)  tolua_tostring(tolua_S,2,0));
  {
-  const char* tolua_ret = (const char*)  fl_password(label,deflt);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  fl_end_loop();
  }
  }
- return 1;
-tolua_lerror:
- return tolua_fltk_fltk_fl_password00(tolua_S);
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_end_loop'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_message_font */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_message_font01
-static int tolua_fltk_fltk_fl_message_font01(lua_State* tolua_S)
+/* function: fl_end_points */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_end_points00
+static int tolua_fltk_fltk_fl_end_points00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-   int f = ((  int)  tolua_tonumber(tolua_S,1,0));
-   int s = ((  int)  tolua_tonumber(tolua_S,2,0));
  {
-  fl_message_font(f,s);
+  fl_end_points();
  }
  }
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_message_font00(tolua_S);
-}
-#endif //#ifndef TOLUA_DISABLE
-
-/* get function: fl_no */
-#ifndef TOLUA_DISABLE_tolua_get_fltk_fl_no
-static int tolua_get_fltk_fl_no(lua_State* tolua_S)
-{
- tolua_pushstring(tolua_S,(const char*)fl_no);
- return 1;
-}
-#endif //#ifndef TOLUA_DISABLE
-
-/* get function: fl_yes */
-#ifndef TOLUA_DISABLE_tolua_get_fltk_fl_yes
-static int tolua_get_fltk_fl_yes(lua_State* tolua_S)
-{
- tolua_pushstring(tolua_S,(const char*)fl_yes);
- return 1;
-}
-#endif //#ifndef TOLUA_DISABLE
-
-/* get function: fl_ok */
-#ifndef TOLUA_DISABLE_tolua_get_fltk_fl_ok
-static int tolua_get_fltk_fl_ok(lua_State* tolua_S)
-{
- tolua_pushstring(tolua_S,(const char*)fl_ok);
- return 1;
-}
-#endif //#ifndef TOLUA_DISABLE
-
-/* get function: fl_cancel */
-#ifndef TOLUA_DISABLE_tolua_get_fltk_fl_cancel
-static int tolua_get_fltk_fl_cancel(lua_State* tolua_S)
-{
- tolua_pushstring(tolua_S,(const char*)fl_cancel);
- return 1;
-}
-#endif //#ifndef TOLUA_DISABLE
-
-/* get function: fl_close */
-#ifndef TOLUA_DISABLE_tolua_get_fltk_fl_close
-static int tolua_get_fltk_fl_close(lua_State* tolua_S)
-{
- tolua_pushstring(tolua_S,(const char*)fl_close);
- return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_end_points'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_color */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_color00
-static int tolua_fltk_fltk_fl_color00(lua_State* tolua_S)
+/* function: fl_end_polygon */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_end_polygon00
+static int tolua_fltk_fltk_fl_end_polygon00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -62602,458 +66699,485 @@ static int tolua_fltk_fltk_fl_color00(lua_State* tolua_S)
 #endif
  {
  {
-  unsigned int tolua_ret = ( unsigned int)  fl_color();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_end_polygon();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_color'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_end_polygon'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
 /* function: fl_font */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_font00
-static int tolua_fltk_fltk_fl_font00(lua_State* tolua_S)
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_font01
+static int tolua_fltk_fltk_fl_font01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
+   int face = ((  int)  tolua_tonumber(tolua_S,1,0));
+   int size = ((  int)  tolua_tonumber(tolua_S,2,0));
  {
-   int tolua_ret = (  int)  fl_font();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_font(face,size);
  }
  }
- return 1;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_font'.",&tolua_err);
  return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_fl_font00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_size */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_size00
-static int tolua_fltk_fltk_fl_size00(lua_State* tolua_S)
+/* function: fl_frame */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_frame01
+static int tolua_fltk_fltk_fl_frame01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
+  const char* s = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int x = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int w = ((int)  tolua_tonumber(tolua_S,4,0));
+  int h = ((int)  tolua_tonumber(tolua_S,5,0));
  {
-   int tolua_ret = (  int)  fl_size();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_frame(s,x,y,w,h);
  }
  }
- return 1;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_size'.",&tolua_err);
  return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_fl_frame00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_clip_region */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_clip_region00
-static int tolua_fltk_fltk_fl_clip_region00(lua_State* tolua_S)
+/* function: fl_frame2 */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_frame200
+static int tolua_fltk_fltk_fl_frame200(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  const char* s = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int x = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int w = ((int)  tolua_tonumber(tolua_S,4,0));
+  int h = ((int)  tolua_tonumber(tolua_S,5,0));
  {
-  Fl_Region tolua_ret = (Fl_Region)  fl_clip_region();
- {
-#ifdef __cplusplus
- void* tolua_obj = Mtolua_new((Fl_Region)(tolua_ret));
-  tolua_pushusertype(tolua_S,tolua_obj,"Fl_Region");
- tolua_register_gc(tolua_S,lua_gettop(tolua_S));
-#else
- void* tolua_obj = tolua_copy(tolua_S,(void*)&tolua_ret,sizeof(Fl_Region));
-  tolua_pushusertype(tolua_S,tolua_obj,"Fl_Region");
- tolua_register_gc(tolua_S,lua_gettop(tolua_S));
-#endif
- }
+  fl_frame2(s,x,y,w,h);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_clip_region'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_frame2'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_latin1_to_local */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_latin1_to_local00
-static int tolua_fltk_fltk_fl_latin1_to_local00(lua_State* tolua_S)
+/* function: fl_gap */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_gap00
+static int tolua_fltk_fltk_fl_gap00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* t = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int n = ((int)  tolua_tonumber(tolua_S,2,-1));
  {
-  char* tolua_ret = (char*)  fl_latin1_to_local(t,n);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  fl_gap();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_latin1_to_local'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_gap'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_local_to_latin1 */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_local_to_latin100
-static int tolua_fltk_fltk_fl_local_to_latin100(lua_State* tolua_S)
+/* function: fl_line */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_line00
+static int tolua_fltk_fltk_fl_line00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* t = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int n = ((int)  tolua_tonumber(tolua_S,2,-1));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
+  int y1 = ((int)  tolua_tonumber(tolua_S,4,0));
  {
-  char* tolua_ret = (char*)  fl_local_to_latin1(t,n);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  fl_line(x,y,x1,y1);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_local_to_latin1'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_line'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_local_to_mac_roman */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_local_to_mac_roman00
-static int tolua_fltk_fltk_fl_local_to_mac_roman00(lua_State* tolua_S)
+/* function: fl_line */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_line01
+static int tolua_fltk_fltk_fl_line01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,7,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  const char* t = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int n = ((int)  tolua_tonumber(tolua_S,2,-1));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
+  int y1 = ((int)  tolua_tonumber(tolua_S,4,0));
+  int x2 = ((int)  tolua_tonumber(tolua_S,5,0));
+  int y2 = ((int)  tolua_tonumber(tolua_S,6,0));
  {
-  char* tolua_ret = (char*)  fl_local_to_mac_roman(t,n);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  fl_line(x,y,x1,y1,x2,y2);
  }
  }
- return 1;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_local_to_mac_roman'.",&tolua_err);
  return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_fl_line00(tolua_S);
 }
-#endif //#ifndef TOLUA_DISABLE
-
-/* function: fl_mac_roman_to_local */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_mac_roman_to_local00
-static int tolua_fltk_fltk_fl_mac_roman_to_local00(lua_State* tolua_S)
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_line_style */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_line_style00
+static int tolua_fltk_fltk_fl_line_style00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isstring(tolua_S,3,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* t = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int n = ((int)  tolua_tonumber(tolua_S,2,-1));
+  int style = ((int)  tolua_tonumber(tolua_S,1,0));
+  int width = ((int)  tolua_tonumber(tolua_S,2,0));
+  char* dashes = ((char*)  tolua_tostring(tolua_S,3,0));
  {
-  char* tolua_ret = (char*)  fl_mac_roman_to_local(t,n);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  fl_line_style(style,width,dashes);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_mac_roman_to_local'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_line_style'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_can_do_alpha_blending */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_can_do_alpha_blending00
-static int tolua_fltk_fltk_fl_can_do_alpha_blending00(lua_State* tolua_S)
+/* function: fl_loop */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_loop00
+static int tolua_fltk_fltk_fl_loop00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,7,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
+  int y1 = ((int)  tolua_tonumber(tolua_S,4,0));
+  int x2 = ((int)  tolua_tonumber(tolua_S,5,0));
+  int y2 = ((int)  tolua_tonumber(tolua_S,6,0));
  {
-  char tolua_ret = (char)  fl_can_do_alpha_blending();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_loop(x,y,x1,y1,x2,y2);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_can_do_alpha_blending'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_loop'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_expand_text */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_expand_text00
-static int tolua_fltk_fltk_fl_expand_text00(lua_State* tolua_S)
+/* function: fl_loop */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_loop01
+static int tolua_fltk_fltk_fl_loop01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,7,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,8,1,&tolua_err) ||
+ !tolua_isnumber(tolua_S,8,0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,9,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  const char* from = ((const char*)  tolua_tostring(tolua_S,1,0));
-  char* buf = ((char*)  tolua_tostring(tolua_S,2,0));
-  int maxbuf = ((int)  tolua_tonumber(tolua_S,3,0));
-  double maxw = ((double)  tolua_tonumber(tolua_S,4,0));
-  int n = ((int)  tolua_tonumber(tolua_S,5,0));
-  double width = ((double)  tolua_tonumber(tolua_S,6,0));
-  int wrap = ((int)  tolua_tonumber(tolua_S,7,0));
-  int draw_symbols = ((int)  tolua_tonumber(tolua_S,8,0));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
+  int y1 = ((int)  tolua_tonumber(tolua_S,4,0));
+  int x2 = ((int)  tolua_tonumber(tolua_S,5,0));
+  int y2 = ((int)  tolua_tonumber(tolua_S,6,0));
+  int x3 = ((int)  tolua_tonumber(tolua_S,7,0));
+  int y3 = ((int)  tolua_tonumber(tolua_S,8,0));
  {
-  char* tolua_ret = (char*)  fl_expand_text(from,buf,maxbuf,maxw,n,width,wrap,draw_symbols);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
- tolua_pushnumber(tolua_S,(lua_Number)n);
- tolua_pushnumber(tolua_S,(lua_Number)width);
+  fl_loop(x,y,x1,y1,x2,y2,x3,y3);
  }
  }
- return 3;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_expand_text'.",&tolua_err);
  return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_fl_loop00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_shortcut_label */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_shortcut_label00
-static int tolua_fltk_fltk_fl_shortcut_label00(lua_State* tolua_S)
+/* function: fl_measure */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_measure00
+static int tolua_fltk_fltk_fl_measure00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned int shortcut = ((unsigned int)  tolua_tonumber(tolua_S,1,0));
+  const char* str = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int x = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int draw_symbols = ((int)  tolua_tonumber(tolua_S,4,1));
  {
-  char* tolua_ret = (char*)  fl_shortcut_label(shortcut);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  fl_measure(str,x,y,draw_symbols);
+ tolua_pushnumber(tolua_S,(lua_Number)x);
+ tolua_pushnumber(tolua_S,(lua_Number)y);
  }
  }
- return 1;
+ return 2;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_shortcut_label'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_measure'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_shortcut_label */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_shortcut_label01
-static int tolua_fltk_fltk_fl_shortcut_label01(lua_State* tolua_S)
+/* function: fl_mult_matrix */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_mult_matrix00
+static int tolua_fltk_fltk_fl_mult_matrix00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,7,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  unsigned int shortcut = ((unsigned int)  tolua_tonumber(tolua_S,1,0));
-  const char* eom = ((const char*)  tolua_tostring(tolua_S,2,0));
+  double a = ((double)  tolua_tonumber(tolua_S,1,0));
+  double b = ((double)  tolua_tonumber(tolua_S,2,0));
+  double c = ((double)  tolua_tonumber(tolua_S,3,0));
+  double d = ((double)  tolua_tonumber(tolua_S,4,0));
+  double x = ((double)  tolua_tonumber(tolua_S,5,0));
+  double y = ((double)  tolua_tonumber(tolua_S,6,0));
  {
-  char* tolua_ret = (char*)  fl_shortcut_label(shortcut,&eom);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
- tolua_pushstring(tolua_S,(const char*)eom);
+  fl_mult_matrix(a,b,c,d,x,y);
  }
  }
- return 2;
-tolua_lerror:
- return tolua_fltk_fltk_fl_shortcut_label00(tolua_S);
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_mult_matrix'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_transform_dx */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_transform_dx00
-static int tolua_fltk_fltk_fl_transform_dx00(lua_State* tolua_S)
+/* function: fl_overlay_clear */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_overlay_clear00
+static int tolua_fltk_fltk_fl_overlay_clear00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  double x = ((double)  tolua_tonumber(tolua_S,1,0));
-  double y = ((double)  tolua_tonumber(tolua_S,2,0));
  {
-  double tolua_ret = (double)  fl_transform_dx(x,y);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_overlay_clear();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_transform_dx'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_overlay_clear'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_transform_dy */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_transform_dy00
-static int tolua_fltk_fltk_fl_transform_dy00(lua_State* tolua_S)
+/* function: fl_overlay_rect */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_overlay_rect00
+static int tolua_fltk_fltk_fl_overlay_rect00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  double x = ((double)  tolua_tonumber(tolua_S,1,0));
-  double y = ((double)  tolua_tonumber(tolua_S,2,0));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int w = ((int)  tolua_tonumber(tolua_S,3,0));
+  int h = ((int)  tolua_tonumber(tolua_S,4,0));
  {
-  double tolua_ret = (double)  fl_transform_dy(x,y);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_overlay_rect(x,y,w,h);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_transform_dy'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_overlay_rect'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_transform_x */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_transform_x00
-static int tolua_fltk_fltk_fl_transform_x00(lua_State* tolua_S)
+/* function: fl_pie */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_pie00
+static int tolua_fltk_fltk_fl_pie00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,7,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  double x = ((double)  tolua_tonumber(tolua_S,1,0));
-  double y = ((double)  tolua_tonumber(tolua_S,2,0));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int w = ((int)  tolua_tonumber(tolua_S,3,0));
+  int h = ((int)  tolua_tonumber(tolua_S,4,0));
+  double a1 = ((double)  tolua_tonumber(tolua_S,5,0));
+  double a2 = ((double)  tolua_tonumber(tolua_S,6,0));
  {
-  double tolua_ret = (double)  fl_transform_x(x,y);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_pie(x,y,w,h,a1,a2);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_transform_x'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_pie'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_transform_y */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_transform_y00
-static int tolua_fltk_fltk_fl_transform_y00(lua_State* tolua_S)
+/* function: fl_point */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_point00
+static int tolua_fltk_fltk_fl_point00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -63066,104 +67190,99 @@ static int tolua_fltk_fltk_fl_transform_y00(lua_State* tolua_S)
  else
 #endif
  {
-  double x = ((double)  tolua_tonumber(tolua_S,1,0));
-  double y = ((double)  tolua_tonumber(tolua_S,2,0));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
  {
-  double tolua_ret = (double)  fl_transform_y(x,y);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_point(x,y);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_transform_y'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_point'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_width */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_width00
-static int tolua_fltk_fltk_fl_width00(lua_State* tolua_S)
+/* function: fl_polygon */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_polygon00
+static int tolua_fltk_fltk_fl_polygon00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,7,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* txt = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
+  int y1 = ((int)  tolua_tonumber(tolua_S,4,0));
+  int x2 = ((int)  tolua_tonumber(tolua_S,5,0));
+  int y2 = ((int)  tolua_tonumber(tolua_S,6,0));
  {
-  double tolua_ret = (double)  fl_width(txt);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_polygon(x,y,x1,y1,x2,y2);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_width'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_polygon'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_width */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_width01
-static int tolua_fltk_fltk_fl_width01(lua_State* tolua_S)
-{
- tolua_Error tolua_err;
- if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
- )
- goto tolua_lerror;
- else
- {
-  const char* txt = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int n = ((int)  tolua_tonumber(tolua_S,2,0));
- {
-  double tolua_ret = (double)  fl_width(txt,n);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- }
- }
- return 1;
-tolua_lerror:
- return tolua_fltk_fltk_fl_width00(tolua_S);
-}
-#endif //#ifndef TOLUA_DISABLE
-
-/* function: fl_width */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_width02
-static int tolua_fltk_fltk_fl_width02(lua_State* tolua_S)
+/* function: fl_polygon */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_polygon01
+static int tolua_fltk_fltk_fl_polygon01(lua_State* tolua_S)
 {
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,7,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,8,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,9,&tolua_err)
  )
  goto tolua_lerror;
  else
  {
-  unsigned int tolua_var_249 = ((unsigned int)  tolua_tonumber(tolua_S,1,0));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
+  int y1 = ((int)  tolua_tonumber(tolua_S,4,0));
+  int x2 = ((int)  tolua_tonumber(tolua_S,5,0));
+  int y2 = ((int)  tolua_tonumber(tolua_S,6,0));
+  int x3 = ((int)  tolua_tonumber(tolua_S,7,0));
+  int y3 = ((int)  tolua_tonumber(tolua_S,8,0));
  {
-  double tolua_ret = (double)  fl_width(tolua_var_249);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_polygon(x,y,x1,y1,x2,y2,x3,y3);
  }
  }
- return 1;
+ return 0;
 tolua_lerror:
- return tolua_fltk_fltk_fl_width01(tolua_S);
+ return tolua_fltk_fltk_fl_polygon00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_descent */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_descent00
-static int tolua_fltk_fltk_fl_descent00(lua_State* tolua_S)
+/* function: fl_pop_clip */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_pop_clip00
+static int tolua_fltk_fltk_fl_pop_clip00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -63175,22 +67294,21 @@ static int tolua_fltk_fltk_fl_descent00(lua_State* tolua_S)
 #endif
  {
  {
-  int tolua_ret = (int)  fl_descent();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_pop_clip();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_descent'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_pop_clip'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_height */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_height00
-static int tolua_fltk_fltk_fl_height00(lua_State* tolua_S)
+/* function: fl_pop_matrix */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_pop_matrix00
+static int tolua_fltk_fltk_fl_pop_matrix00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -63202,22 +67320,21 @@ static int tolua_fltk_fltk_fl_height00(lua_State* tolua_S)
 #endif
  {
  {
-  int tolua_ret = (int)  fl_height();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_pop_matrix();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_height'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_pop_matrix'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_clip_box */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_clip_box00
-static int tolua_fltk_fltk_fl_clip_box00(lua_State* tolua_S)
+/* function: fl_push_clip */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_push_clip00
+static int tolua_fltk_fltk_fl_push_clip00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -63226,11 +67343,7 @@ static int tolua_fltk_fltk_fl_clip_box00(lua_State* tolua_S)
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,7,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,8,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,9,&tolua_err)
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
@@ -63240,335 +67353,293 @@ static int tolua_fltk_fltk_fl_clip_box00(lua_State* tolua_S)
   int y = ((int)  tolua_tonumber(tolua_S,2,0));
   int w = ((int)  tolua_tonumber(tolua_S,3,0));
   int h = ((int)  tolua_tonumber(tolua_S,4,0));
-  int X = ((int)  tolua_tonumber(tolua_S,5,0));
-  int Y = ((int)  tolua_tonumber(tolua_S,6,0));
-  int W = ((int)  tolua_tonumber(tolua_S,7,0));
-  int H = ((int)  tolua_tonumber(tolua_S,8,0));
  {
-  int tolua_ret = (int)  fl_clip_box(x,y,w,h,X,Y,W,H);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- tolua_pushnumber(tolua_S,(lua_Number)X);
- tolua_pushnumber(tolua_S,(lua_Number)Y);
- tolua_pushnumber(tolua_S,(lua_Number)W);
- tolua_pushnumber(tolua_S,(lua_Number)H);
+  fl_push_clip(x,y,w,h);
  }
  }
- return 5;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_clip_box'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_push_clip'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_draw_pixmap */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw_pixmap00
-static int tolua_fltk_fltk_fl_draw_pixmap00(lua_State* tolua_S)
+/* function: fl_push_matrix */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_push_matrix00
+static int tolua_fltk_fltk_fl_push_matrix00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  char* data = ((char*)  tolua_tostring(tolua_S,1,0));
-  int x = ((int)  tolua_tonumber(tolua_S,2,0));
-  int y = ((int)  tolua_tonumber(tolua_S,3,0));
-  unsigned int tolua_var_250 = (( unsigned int)  tolua_tonumber(tolua_S,4,FL_GRAY));
  {
-  int tolua_ret = (int)  fl_draw_pixmap(&data,x,y,tolua_var_250);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- tolua_pushstring(tolua_S,(const char*)data);
+  fl_push_matrix();
  }
  }
- return 2;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_draw_pixmap'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_push_matrix'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_draw_pixmap */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw_pixmap01
-static int tolua_fltk_fltk_fl_draw_pixmap01(lua_State* tolua_S)
+/* function: fl_push_no_clip */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_push_no_clip00
+static int tolua_fltk_fltk_fl_push_no_clip00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  const char* cdata = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int x = ((int)  tolua_tonumber(tolua_S,2,0));
-  int y = ((int)  tolua_tonumber(tolua_S,3,0));
-  unsigned int tolua_var_251 = (( unsigned int)  tolua_tonumber(tolua_S,4,FL_GRAY));
  {
-  int tolua_ret = (int)  fl_draw_pixmap(&cdata,x,y,tolua_var_251);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- tolua_pushstring(tolua_S,(const char*)cdata);
+  fl_push_no_clip();
  }
  }
- return 2;
-tolua_lerror:
- return tolua_fltk_fltk_fl_draw_pixmap00(tolua_S);
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_push_no_clip'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_draw_symbol */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw_symbol00
-static int tolua_fltk_fltk_fl_draw_symbol00(lua_State* tolua_S)
+/* function: fl_rect */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rect00
+static int tolua_fltk_fltk_fl_rect00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,7,&tolua_err)
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* label = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int x = ((int)  tolua_tonumber(tolua_S,2,0));
-  int y = ((int)  tolua_tonumber(tolua_S,3,0));
-  int w = ((int)  tolua_tonumber(tolua_S,4,0));
-  int h = ((int)  tolua_tonumber(tolua_S,5,0));
-  unsigned int tolua_var_252 = (( unsigned int)  tolua_tonumber(tolua_S,6,0));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int w = ((int)  tolua_tonumber(tolua_S,3,0));
+  int h = ((int)  tolua_tonumber(tolua_S,4,0));
  {
-  int tolua_ret = (int)  fl_draw_symbol(label,x,y,w,h,tolua_var_252);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_rect(x,y,w,h);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_draw_symbol'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_rect'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_height */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_height01
-static int tolua_fltk_fltk_fl_height01(lua_State* tolua_S)
+/* function: fl_rect */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rect01
+static int tolua_fltk_fltk_fl_rect01(lua_State* tolua_S)
 {
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
  {
-  int font = ((int)  tolua_tonumber(tolua_S,1,0));
-  int size = ((int)  tolua_tonumber(tolua_S,2,0));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int w = ((int)  tolua_tonumber(tolua_S,3,0));
+  int h = ((int)  tolua_tonumber(tolua_S,4,0));
+  unsigned int c = (( unsigned int)  tolua_tonumber(tolua_S,5,0));
  {
-  int tolua_ret = (int)  fl_height(font,size);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_rect(x,y,w,h,c);
  }
  }
- return 1;
+ return 0;
 tolua_lerror:
- return tolua_fltk_fltk_fl_height00(tolua_S);
+ return tolua_fltk_fltk_fl_rect00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_measure_pixmap */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_measure_pixmap00
-static int tolua_fltk_fltk_fl_measure_pixmap00(lua_State* tolua_S)
+/* function: fl_rectf */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rectf00
+static int tolua_fltk_fltk_fl_rectf00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  char* data = ((char*)  tolua_tostring(tolua_S,1,0));
-  int w = ((int)  tolua_tonumber(tolua_S,2,0));
-  int h = ((int)  tolua_tonumber(tolua_S,3,0));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int w = ((int)  tolua_tonumber(tolua_S,3,0));
+  int h = ((int)  tolua_tonumber(tolua_S,4,0));
  {
-  int tolua_ret = (int)  fl_measure_pixmap(&data,w,h);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- tolua_pushstring(tolua_S,(const char*)data);
- tolua_pushnumber(tolua_S,(lua_Number)w);
- tolua_pushnumber(tolua_S,(lua_Number)h);
+  fl_rectf(x,y,w,h);
  }
  }
- return 4;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_measure_pixmap'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_rectf'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_measure_pixmap */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_measure_pixmap01
-static int tolua_fltk_fltk_fl_measure_pixmap01(lua_State* tolua_S)
+/* function: fl_rectf */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rectf01
+static int tolua_fltk_fltk_fl_rectf01(lua_State* tolua_S)
 {
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
  {
-  const char* cdata = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int w = ((int)  tolua_tonumber(tolua_S,2,0));
-  int h = ((int)  tolua_tonumber(tolua_S,3,0));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int w = ((int)  tolua_tonumber(tolua_S,3,0));
+  int h = ((int)  tolua_tonumber(tolua_S,4,0));
+  unsigned int c = (( unsigned int)  tolua_tonumber(tolua_S,5,0));
  {
-  int tolua_ret = (int)  fl_measure_pixmap(&cdata,w,h);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- tolua_pushstring(tolua_S,(const char*)cdata);
- tolua_pushnumber(tolua_S,(lua_Number)w);
- tolua_pushnumber(tolua_S,(lua_Number)h);
+  fl_rectf(x,y,w,h,c);
  }
  }
- return 4;
+ return 0;
 tolua_lerror:
- return tolua_fltk_fltk_fl_measure_pixmap00(tolua_S);
+ return tolua_fltk_fltk_fl_rectf00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_not_clipped */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_not_clipped00
-static int tolua_fltk_fltk_fl_not_clipped00(lua_State* tolua_S)
+/* function: fl_rectf */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rectf02
+static int tolua_fltk_fltk_fl_rectf02(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,7,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,8,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
   int x = ((int)  tolua_tonumber(tolua_S,1,0));
   int y = ((int)  tolua_tonumber(tolua_S,2,0));
   int w = ((int)  tolua_tonumber(tolua_S,3,0));
   int h = ((int)  tolua_tonumber(tolua_S,4,0));
+  unsigned char r = (( unsigned char)  tolua_tonumber(tolua_S,5,0));
+  unsigned char g = (( unsigned char)  tolua_tonumber(tolua_S,6,0));
+  unsigned char b = (( unsigned char)  tolua_tonumber(tolua_S,7,0));
  {
-  int tolua_ret = (int)  fl_not_clipped(x,y,w,h);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_rectf(x,y,w,h,r,g,b);
  }
  }
- return 1;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_not_clipped'.",&tolua_err);
  return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_fl_rectf01(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_old_shortcut */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_old_shortcut00
-static int tolua_fltk_fltk_fl_old_shortcut00(lua_State* tolua_S)
+/* function: fl_reset_spot */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_reset_spot00
+static int tolua_fltk_fltk_fl_reset_spot00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* s = ((const char*)  tolua_tostring(tolua_S,1,0));
  {
-  int tolua_ret = (int)  fl_old_shortcut(s);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_reset_spot();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_old_shortcut'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_reset_spot'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_read_image */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_read_image00
-static int tolua_fltk_fltk_fl_read_image00(lua_State* tolua_S)
+/* function: fl_restore_clip */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_restore_clip00
+static int tolua_fltk_fltk_fl_restore_clip00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,7,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned char p = (( unsigned char)  tolua_tonumber(tolua_S,1,0));
-  int X = ((int)  tolua_tonumber(tolua_S,2,0));
-  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
-  int W = ((int)  tolua_tonumber(tolua_S,4,0));
-  int H = ((int)  tolua_tonumber(tolua_S,5,0));
-  int alpha = ((int)  tolua_tonumber(tolua_S,6,0));
  {
-  void* tolua_ret = (void*)  fl_read_image(&p,X,Y,W,H,alpha);
- tolua_pushuserdata(tolua_S,(void*)tolua_ret);
- tolua_pushnumber(tolua_S,(lua_Number)p);
+  fl_restore_clip();
  }
  }
- return 2;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_read_image'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_restore_clip'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_color */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_color01
-static int tolua_fltk_fltk_fl_color01(lua_State* tolua_S)
+/* function: fl_rotate */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rotate00
+static int tolua_fltk_fltk_fl_rotate00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
@@ -63576,255 +67647,300 @@ static int tolua_fltk_fltk_fl_color01(lua_State* tolua_S)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  unsigned int c = (( unsigned int)  tolua_tonumber(tolua_S,1,0));
+  double d = ((double)  tolua_tonumber(tolua_S,1,0));
  {
-  fl_color(c);
+  fl_rotate(d);
  }
  }
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_color00(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_rotate'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_color */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_color02
-static int tolua_fltk_fltk_fl_color02(lua_State* tolua_S)
+/* function: fl_rtl_draw */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rtl_draw00
+static int tolua_fltk_fltk_fl_rtl_draw00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  unsigned char r = (( unsigned char)  tolua_tonumber(tolua_S,1,0));
-  unsigned char g = (( unsigned char)  tolua_tonumber(tolua_S,2,0));
-  unsigned char b = (( unsigned char)  tolua_tonumber(tolua_S,3,0));
+  const char* tolua_var_256 = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int n = ((int)  tolua_tonumber(tolua_S,2,0));
+  int x = ((int)  tolua_tonumber(tolua_S,3,0));
+  int y = ((int)  tolua_tonumber(tolua_S,4,0));
  {
-  fl_color(r,g,b);
+  fl_rtl_draw(tolua_var_256,n,x,y);
  }
  }
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_color01(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_rtl_draw'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_arc */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_arc00
-static int tolua_fltk_fltk_fl_arc00(lua_State* tolua_S)
+/* function: fl_scale */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_scale00
+static int tolua_fltk_fltk_fl_scale00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,6,&tolua_err)
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
   double x = ((double)  tolua_tonumber(tolua_S,1,0));
-  double y = ((double)  tolua_tonumber(tolua_S,2,0));
-  double r = ((double)  tolua_tonumber(tolua_S,3,0));
-  double start = ((double)  tolua_tonumber(tolua_S,4,0));
-  double end = ((double)  tolua_tonumber(tolua_S,5,0));
  {
-  fl_arc(x,y,r,start,end);
+  fl_scale(x);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_arc'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_scale'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_arc */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_arc01
-static int tolua_fltk_fltk_fl_arc01(lua_State* tolua_S)
+/* function: fl_scale */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_scale01
+static int tolua_fltk_fltk_fl_scale01(lua_State* tolua_S)
 {
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,7,&tolua_err)
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int w = ((int)  tolua_tonumber(tolua_S,3,0));
-  int h = ((int)  tolua_tonumber(tolua_S,4,0));
-  double a1 = ((double)  tolua_tonumber(tolua_S,5,0));
-  double a2 = ((double)  tolua_tonumber(tolua_S,6,0));
+  double x = ((double)  tolua_tonumber(tolua_S,1,0));
+  double y = ((double)  tolua_tonumber(tolua_S,2,0));
  {
-  fl_arc(x,y,w,h,a1,a2);
+  fl_scale(x,y);
  }
  }
  return 0;
 tolua_lerror:
- return tolua_fltk_fltk_fl_arc00(tolua_S);
+ return tolua_fltk_fltk_fl_scale00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_begin_complex_polygon */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_begin_complex_polygon00
-static int tolua_fltk_fltk_fl_begin_complex_polygon00(lua_State* tolua_S)
+/* function: fl_set_spot */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_set_spot00
+static int tolua_fltk_fltk_fl_set_spot00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,7,"Fl_Window",1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,8,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  int font = ((int)  tolua_tonumber(tolua_S,1,0));
+  int size = ((int)  tolua_tonumber(tolua_S,2,0));
+  int X = ((int)  tolua_tonumber(tolua_S,3,0));
+  int Y = ((int)  tolua_tonumber(tolua_S,4,0));
+  int W = ((int)  tolua_tonumber(tolua_S,5,0));
+  int H = ((int)  tolua_tonumber(tolua_S,6,0));
+  Fl_Window* win = ((Fl_Window*)  tolua_tousertype(tolua_S,7,0));
  {
-  fl_begin_complex_polygon();
+  fl_set_spot(font,size,X,Y,W,H,win);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_begin_complex_polygon'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_set_spot'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_begin_line */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_begin_line00
-static int tolua_fltk_fltk_fl_begin_line00(lua_State* tolua_S)
+/* function: fl_set_status */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_set_status00
+static int tolua_fltk_fltk_fl_set_status00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  int X = ((int)  tolua_tonumber(tolua_S,1,0));
+  int Y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int W = ((int)  tolua_tonumber(tolua_S,3,0));
+  int H = ((int)  tolua_tonumber(tolua_S,4,0));
  {
-  fl_begin_line();
+  fl_set_status(X,Y,W,H);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_begin_line'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_set_status'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_begin_loop */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_begin_loop00
-static int tolua_fltk_fltk_fl_begin_loop00(lua_State* tolua_S)
+/* function: fl_text_extents */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_text_extents00
+static int tolua_fltk_fltk_fl_text_extents00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,7,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  const char* tolua_var_257 = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int n = ((int)  tolua_tonumber(tolua_S,2,0));
+  int dx = ((int)  tolua_tonumber(tolua_S,3,0));
+  int dy = ((int)  tolua_tonumber(tolua_S,4,0));
+  int w = ((int)  tolua_tonumber(tolua_S,5,0));
+  int h = ((int)  tolua_tonumber(tolua_S,6,0));
  {
-  fl_begin_loop();
+  fl_text_extents(tolua_var_257,n,dx,dy,w,h);
+ tolua_pushnumber(tolua_S,(lua_Number)dx);
+ tolua_pushnumber(tolua_S,(lua_Number)dy);
+ tolua_pushnumber(tolua_S,(lua_Number)w);
+ tolua_pushnumber(tolua_S,(lua_Number)h);
  }
  }
- return 0;
+ return 4;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_begin_loop'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_text_extents'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_begin_points */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_begin_points00
-static int tolua_fltk_fltk_fl_begin_points00(lua_State* tolua_S)
+/* function: fl_text_extents */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_text_extents01
+static int tolua_fltk_fltk_fl_text_extents01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
+  const char* tolua_var_258 = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int dx = ((int)  tolua_tonumber(tolua_S,2,0));
+  int dy = ((int)  tolua_tonumber(tolua_S,3,0));
+  int w = ((int)  tolua_tonumber(tolua_S,4,0));
+  int h = ((int)  tolua_tonumber(tolua_S,5,0));
  {
-  fl_begin_points();
+  fl_text_extents(tolua_var_258,dx,dy,w,h);
+ tolua_pushnumber(tolua_S,(lua_Number)dx);
+ tolua_pushnumber(tolua_S,(lua_Number)dy);
+ tolua_pushnumber(tolua_S,(lua_Number)w);
+ tolua_pushnumber(tolua_S,(lua_Number)h);
  }
  }
- return 0;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_begin_points'.",&tolua_err);
- return 0;
-#endif
+ return 4;
+tolua_lerror:
+ return tolua_fltk_fltk_fl_text_extents00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_begin_polygon */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_begin_polygon00
-static int tolua_fltk_fltk_fl_begin_polygon00(lua_State* tolua_S)
+/* function: fl_transformed_vertex */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_transformed_vertex00
+static int tolua_fltk_fltk_fl_transformed_vertex00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  double xf = ((double)  tolua_tonumber(tolua_S,1,0));
+  double yf = ((double)  tolua_tonumber(tolua_S,2,0));
  {
-  fl_begin_polygon();
+  fl_transformed_vertex(xf,yf);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_begin_polygon'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_transformed_vertex'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_circle */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_circle00
-static int tolua_fltk_fltk_fl_circle00(lua_State* tolua_S)
+/* function: fl_translate */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_translate00
+static int tolua_fltk_fltk_fl_translate00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
@@ -63832,103 +67948,114 @@ static int tolua_fltk_fltk_fl_circle00(lua_State* tolua_S)
  {
   double x = ((double)  tolua_tonumber(tolua_S,1,0));
   double y = ((double)  tolua_tonumber(tolua_S,2,0));
-  double r = ((double)  tolua_tonumber(tolua_S,3,0));
  {
-  fl_circle(x,y,r);
+  fl_translate(x,y);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_circle'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_translate'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_clip_region */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_clip_region01
-static int tolua_fltk_fltk_fl_clip_region01(lua_State* tolua_S)
+/* function: fl_vertex */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_vertex00
+static int tolua_fltk_fltk_fl_vertex00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- (tolua_isvaluenil(tolua_S,1,&tolua_err) || !tolua_isusertype(tolua_S,1,"Fl_Region",0,&tolua_err)) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  Fl_Region r = *((Fl_Region*)  tolua_tousertype(tolua_S,1,0));
+  double x = ((double)  tolua_tonumber(tolua_S,1,0));
+  double y = ((double)  tolua_tonumber(tolua_S,2,0));
  {
-  fl_clip_region(r);
+  fl_vertex(x,y);
  }
  }
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_clip_region00(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_vertex'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_color */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_color03
-static int tolua_fltk_fltk_fl_color03(lua_State* tolua_S)
+/* function: fl_xyline */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_xyline00
+static int tolua_fltk_fltk_fl_xyline00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  int c = ((int)  tolua_tonumber(tolua_S,1,0));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
  {
-  fl_color(c);
+  fl_xyline(x,y,x1);
  }
  }
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_color02(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_xyline'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_cursor */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_cursor00
-static int tolua_fltk_fltk_fl_cursor00(lua_State* tolua_S)
+/* function: fl_xyline */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_xyline01
+static int tolua_fltk_fltk_fl_xyline01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,1,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  Fl_Cursor tolua_var_253 = ((Fl_Cursor) (int)  tolua_tonumber(tolua_S,1,0));
-  unsigned int fg = (( unsigned int)  tolua_tonumber(tolua_S,2,FL_BLACK));
-  unsigned int bg = (( unsigned int)  tolua_tonumber(tolua_S,3,FL_WHITE));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
+  int y2 = ((int)  tolua_tonumber(tolua_S,4,0));
  {
-  fl_cursor(tolua_var_253,fg,bg);
+  fl_xyline(x,y,x1,y2);
  }
  }
  return 0;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_cursor'.",&tolua_err);
- return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_fl_xyline00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_curve */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_curve00
-static int tolua_fltk_fltk_fl_curve00(lua_State* tolua_S)
+/* function: fl_xyline */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_xyline02
+static int tolua_fltk_fltk_fl_xyline02(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
@@ -63936,543 +68063,579 @@ static int tolua_fltk_fltk_fl_curve00(lua_State* tolua_S)
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,7,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,8,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,9,&tolua_err)
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  double X0 = ((double)  tolua_tonumber(tolua_S,1,0));
-  double Y0 = ((double)  tolua_tonumber(tolua_S,2,0));
-  double X1 = ((double)  tolua_tonumber(tolua_S,3,0));
-  double Y1 = ((double)  tolua_tonumber(tolua_S,4,0));
-  double X2 = ((double)  tolua_tonumber(tolua_S,5,0));
-  double Y2 = ((double)  tolua_tonumber(tolua_S,6,0));
-  double X3 = ((double)  tolua_tonumber(tolua_S,7,0));
-  double Y3 = ((double)  tolua_tonumber(tolua_S,8,0));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
+  int y2 = ((int)  tolua_tonumber(tolua_S,4,0));
+  int x3 = ((int)  tolua_tonumber(tolua_S,5,0));
  {
-  fl_curve(X0,Y0,X1,Y1,X2,Y2,X3,Y3);
+  fl_xyline(x,y,x1,y2,x3);
  }
  }
  return 0;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_curve'.",&tolua_err);
- return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_fltk_fl_xyline01(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_draw */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw00
-static int tolua_fltk_fltk_fl_draw00(lua_State* tolua_S)
+/* function: fl_yxline */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_yxline00
+static int tolua_fltk_fltk_fl_yxline00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* str = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int n = ((int)  tolua_tonumber(tolua_S,2,0));
-  int x = ((int)  tolua_tonumber(tolua_S,3,0));
-  int y = ((int)  tolua_tonumber(tolua_S,4,0));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y1 = ((int)  tolua_tonumber(tolua_S,3,0));
  {
-  fl_draw(str,n,x,y);
+  fl_yxline(x,y,y1);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_draw'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_yxline'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_draw */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw01
-static int tolua_fltk_fltk_fl_draw01(lua_State* tolua_S)
+/* function: fl_yxline */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_yxline01
+static int tolua_fltk_fltk_fl_yxline01(lua_State* tolua_S)
 {
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
  {
-  const char* str = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int x = ((int)  tolua_tonumber(tolua_S,2,0));
-  int y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y1 = ((int)  tolua_tonumber(tolua_S,3,0));
+  int x2 = ((int)  tolua_tonumber(tolua_S,4,0));
  {
-  fl_draw(str,x,y);
+  fl_yxline(x,y,y1,x2);
  }
  }
  return 0;
 tolua_lerror:
- return tolua_fltk_fltk_fl_draw00(tolua_S);
+ return tolua_fltk_fltk_fl_yxline00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_draw */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw02
-static int tolua_fltk_fltk_fl_draw02(lua_State* tolua_S)
+/* function: fl_yxline */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_yxline02
+static int tolua_fltk_fltk_fl_yxline02(lua_State* tolua_S)
 {
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isusertype(tolua_S,7,"Fl_Image",1,&tolua_err) ||
- !tolua_isnumber(tolua_S,8,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,9,&tolua_err)
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
  {
-  const char* str = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int x = ((int)  tolua_tonumber(tolua_S,2,0));
-  int y = ((int)  tolua_tonumber(tolua_S,3,0));
-  int w = ((int)  tolua_tonumber(tolua_S,4,0));
-  int h = ((int)  tolua_tonumber(tolua_S,5,0));
-   unsigned align = ((  unsigned)  tolua_tonumber(tolua_S,6,0));
-  Fl_Image* img = ((Fl_Image*)  tolua_tousertype(tolua_S,7,0));
-  int draw_symbols = ((int)  tolua_tonumber(tolua_S,8,1));
+  int x = ((int)  tolua_tonumber(tolua_S,1,0));
+  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y1 = ((int)  tolua_tonumber(tolua_S,3,0));
+  int x2 = ((int)  tolua_tonumber(tolua_S,4,0));
+  int y3 = ((int)  tolua_tonumber(tolua_S,5,0));
  {
-  fl_draw(str,x,y,w,h,align,img,draw_symbols);
+  fl_yxline(x,y,y1,x2,y3);
  }
  }
  return 0;
 tolua_lerror:
- return tolua_fltk_fltk_fl_draw01(tolua_S);
+ return tolua_fltk_fltk_fl_yxline01(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_draw */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw03
-static int tolua_fltk_fltk_fl_draw03(lua_State* tolua_S)
+/* method: new of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_new00
+static int tolua_fltk_fltk_Fl_Draw_List_new00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isusertable(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  int angle = ((int)  tolua_tonumber(tolua_S,1,0));
-  const char* str = ((const char*)  tolua_tostring(tolua_S,2,0));
-  int x = ((int)  tolua_tonumber(tolua_S,3,0));
-  int y = ((int)  tolua_tonumber(tolua_S,4,0));
  {
-  fl_draw(angle,str,x,y);
+  Fl_Draw_List* tolua_ret = (Fl_Draw_List*)  Mtolua_new((Fl_Draw_List)());
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Draw_List");
  }
  }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_draw02(tolua_S);
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_draw */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw04
-static int tolua_fltk_fltk_fl_draw04(lua_State* tolua_S)
+/* method: new_local of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_new00_local
+static int tolua_fltk_fltk_Fl_Draw_List_new00_local(lua_State* tolua_S)
+{
+ int result = tolua_fltk_fltk_Fl_Draw_List_new00(tolua_S);
+ if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
+ return result;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: delete of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_delete00
+static int tolua_fltk_fltk_Fl_Draw_List_delete00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,6,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  int angle = ((int)  tolua_tonumber(tolua_S,1,0));
-  const char* str = ((const char*)  tolua_tostring(tolua_S,2,0));
-  int n = ((int)  tolua_tonumber(tolua_S,3,0));
-  int x = ((int)  tolua_tonumber(tolua_S,4,0));
-  int y = ((int)  tolua_tonumber(tolua_S,5,0));
- {
-  fl_draw(angle,str,n,x,y);
- }
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'delete'", NULL);
+#endif
+ Mtolua_delete(self);
  }
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_draw03(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'delete'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_draw_box */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw_box00
-static int tolua_fltk_fltk_fl_draw_box00(lua_State* tolua_S)
+/* method: clear of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_clear00
+static int tolua_fltk_fltk_Fl_Draw_List_clear00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,7,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Boxtype tolua_var_254 = ((Fl_Boxtype) (int)  tolua_tonumber(tolua_S,1,0));
-  int x = ((int)  tolua_tonumber(tolua_S,2,0));
-  int y = ((int)  tolua_tonumber(tolua_S,3,0));
-  int w = ((int)  tolua_tonumber(tolua_S,4,0));
-  int h = ((int)  tolua_tonumber(tolua_S,5,0));
-  unsigned int tolua_var_255 = (( unsigned int)  tolua_tonumber(tolua_S,6,0));
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear'", NULL);
+#endif
  {
-  fl_draw_box(tolua_var_254,x,y,w,h,tolua_var_255);
+  self->clear();
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_draw_box'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_draw_image */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw_image00
-static int tolua_fltk_fltk_fl_draw_image00(lua_State* tolua_S)
+/* method: commands of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_commands00
+static int tolua_fltk_fltk_Fl_Draw_List_commands00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- (tolua_isvaluenil(tolua_S,1,&tolua_err) || !tolua_isusertype(tolua_S,1,"Fl_Draw_Image_Cb",0,&tolua_err)) ||
- !tolua_isuserdata(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,7,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,8,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Fl_Draw_Image_Cb cb = *((Fl_Draw_Image_Cb*)  tolua_tousertype(tolua_S,1,0));
-  void* data = ((void*)  tolua_touserdata(tolua_S,2,0));
-  int X = ((int)  tolua_tonumber(tolua_S,3,0));
-  int Y = ((int)  tolua_tonumber(tolua_S,4,0));
-  int W = ((int)  tolua_tonumber(tolua_S,5,0));
-  int H = ((int)  tolua_tonumber(tolua_S,6,0));
-  int D = ((int)  tolua_tonumber(tolua_S,7,3));
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'commands'", NULL);
+#endif
  {
-  fl_draw_image(cb,data,X,Y,W,H,D);
+  int tolua_ret = (int)  self->commands();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_draw_image'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'commands'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_draw_image */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw_image01
-static int tolua_fltk_fltk_fl_draw_image01(lua_State* tolua_S)
+/* method: size of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_size00
+static int tolua_fltk_fltk_Fl_Draw_List_size00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,1,&tolua_err) ||
- !tolua_isnumber(tolua_S,7,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,8,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  unsigned const char buf = ((unsigned const char)  tolua_tonumber(tolua_S,1,0));
-  int X = ((int)  tolua_tonumber(tolua_S,2,0));
-  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
-  int W = ((int)  tolua_tonumber(tolua_S,4,0));
-  int H = ((int)  tolua_tonumber(tolua_S,5,0));
-  int D = ((int)  tolua_tonumber(tolua_S,6,3));
-  int L = ((int)  tolua_tonumber(tolua_S,7,0));
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'size'", NULL);
+#endif
  {
-  fl_draw_image(&buf,X,Y,W,H,D,L);
- tolua_pushnumber(tolua_S,(lua_Number)buf);
+  int tolua_ret = (int)  self->size();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
-tolua_lerror:
- return tolua_fltk_fltk_fl_draw_image00(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'size'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_draw_image_mono */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_draw_image_mono00
-static int tolua_fltk_fltk_fl_draw_image_mono00(lua_State* tolua_S)
+/* method: color of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_color00
+static int tolua_fltk_fltk_Fl_Draw_List_color00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,1,&tolua_err) ||
- !tolua_isnumber(tolua_S,7,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,8,&tolua_err)
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned const char buf = ((unsigned const char)  tolua_tonumber(tolua_S,1,0));
-  int X = ((int)  tolua_tonumber(tolua_S,2,0));
-  int Y = ((int)  tolua_tonumber(tolua_S,3,0));
-  int W = ((int)  tolua_tonumber(tolua_S,4,0));
-  int H = ((int)  tolua_tonumber(tolua_S,5,0));
-  int D = ((int)  tolua_tonumber(tolua_S,6,1));
-  int L = ((int)  tolua_tonumber(tolua_S,7,0));
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+  unsigned int c = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'color'", NULL);
+#endif
  {
-  fl_draw_image_mono(&buf,X,Y,W,H,D,L);
- tolua_pushnumber(tolua_S,(lua_Number)buf);
+  self->color(c);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_draw_image_mono'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'color'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_end_complex_polygon */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_end_complex_polygon00
-static int tolua_fltk_fltk_fl_end_complex_polygon00(lua_State* tolua_S)
+/* method: rectf of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_rectf00
+static int tolua_fltk_fltk_Fl_Draw_List_rectf00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+  int x = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int w = ((int)  tolua_tonumber(tolua_S,4,0));
+  int h = ((int)  tolua_tonumber(tolua_S,5,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'rectf'", NULL);
+#endif
  {
-  fl_end_complex_polygon();
+  self->rectf(x,y,w,h);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_end_complex_polygon'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'rectf'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_end_line */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_end_line00
-static int tolua_fltk_fltk_fl_end_line00(lua_State* tolua_S)
+/* method: rect of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_rect00
+static int tolua_fltk_fltk_Fl_Draw_List_rect00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+  int x = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int w = ((int)  tolua_tonumber(tolua_S,4,0));
+  int h = ((int)  tolua_tonumber(tolua_S,5,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'rect'", NULL);
+#endif
  {
-  fl_end_line();
+  self->rect(x,y,w,h);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_end_line'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'rect'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_end_loop */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_end_loop00
-static int tolua_fltk_fltk_fl_end_loop00(lua_State* tolua_S)
+/* method: line of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_line00
+static int tolua_fltk_fltk_Fl_Draw_List_line00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+  int x = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y = ((int)  tolua_tonumber(tolua_S,3,0));
+  int x1 = ((int)  tolua_tonumber(tolua_S,4,0));
+  int y1 = ((int)  tolua_tonumber(tolua_S,5,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'line'", NULL);
+#endif
  {
-  fl_end_loop();
+  self->line(x,y,x1,y1);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_end_loop'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'line'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_end_points */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_end_points00
-static int tolua_fltk_fltk_fl_end_points00(lua_State* tolua_S)
+/* method: point of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_point00
+static int tolua_fltk_fltk_Fl_Draw_List_point00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+  int x = ((int)  tolua_tonumber(tolua_S,2,0));
+  int y = ((int)  tolua_tonumber(tolua_S,3,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'point'", NULL);
+#endif
  {
-  fl_end_points();
+  self->point(x,y);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_end_points'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'point'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_end_polygon */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_end_polygon00
-static int tolua_fltk_fltk_fl_end_polygon00(lua_State* tolua_S)
+/* method: fltk_Fl_Draw_List_polygon of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_polygon00
+static int tolua_fltk_fltk_Fl_Draw_List_polygon00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  lua_Object tbl = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
+  int filled = ((int)  tolua_tonumber(tolua_S,3,1));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'fltk_Fl_Draw_List_polygon'", NULL);
+#endif
  {
-  fl_end_polygon();
+  tolua_outside int tolua_ret = (tolua_outside int)  fltk_Fl_Draw_List_polygon(self,L,tbl,filled);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_end_polygon'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'polygon'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_font */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_font01
-static int tolua_fltk_fltk_fl_font01(lua_State* tolua_S)
+/* method: line_style of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_line_style00
+static int tolua_fltk_fltk_Fl_Draw_List_line_style00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnumber(tolua_S,3,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-   int face = ((  int)  tolua_tonumber(tolua_S,1,0));
-   int size = ((  int)  tolua_tonumber(tolua_S,2,0));
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+  int style = ((int)  tolua_tonumber(tolua_S,2,0));
+  int width = ((int)  tolua_tonumber(tolua_S,3,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'line_style'", NULL);
+#endif
  {
-  fl_font(face,size);
+  self->line_style(style,width);
  }
  }
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_font00(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'line_style'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_frame */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_frame01
-static int tolua_fltk_fltk_fl_frame01(lua_State* tolua_S)
+/* method: font of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_font00
+static int tolua_fltk_fltk_Fl_Draw_List_font00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,6,&tolua_err)
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  const char* s = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int x = ((int)  tolua_tonumber(tolua_S,2,0));
-  int y = ((int)  tolua_tonumber(tolua_S,3,0));
-  int w = ((int)  tolua_tonumber(tolua_S,4,0));
-  int h = ((int)  tolua_tonumber(tolua_S,5,0));
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+   int face = ((  int)  tolua_tonumber(tolua_S,2,0));
+   int size = ((  int)  tolua_tonumber(tolua_S,3,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'font'", NULL);
+#endif
  {
-  fl_frame(s,x,y,w,h);
+  self->font(face,size);
  }
  }
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_frame00(tolua_S);
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'font'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_frame2 */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_frame200
-static int tolua_fltk_fltk_fl_frame200(lua_State* tolua_S)
+/* method: push_clip of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_push_clip00
+static int tolua_fltk_fltk_Fl_Draw_List_push_clip00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
@@ -64483,59 +68646,67 @@ static int tolua_fltk_fltk_fl_frame200(lua_State* tolua_S)
  else
 #endif
  {
-  const char* s = ((const char*)  tolua_tostring(tolua_S,1,0));
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
   int x = ((int)  tolua_tonumber(tolua_S,2,0));
   int y = ((int)  tolua_tonumber(tolua_S,3,0));
   int w = ((int)  tolua_tonumber(tolua_S,4,0));
   int h = ((int)  tolua_tonumber(tolua_S,5,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'push_clip'", NULL);
+#endif
  {
-  fl_frame2(s,x,y,w,h);
+  self->push_clip(x,y,w,h);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_frame2'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'push_clip'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_gap */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_gap00
-static int tolua_fltk_fltk_fl_gap00(lua_State* tolua_S)
+/* method: pop_clip of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_pop_clip00
+static int tolua_fltk_fltk_Fl_Draw_List_pop_clip00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'pop_clip'", NULL);
+#endif
  {
-  fl_gap();
+  self->pop_clip();
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_gap'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'pop_clip'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_line */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_line00
-static int tolua_fltk_fltk_fl_line00(lua_State* tolua_S)
+/* method: text of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_text00
+static int tolua_fltk_fltk_Fl_Draw_List_text00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,5,&tolua_err)
@@ -64544,166 +68715,229 @@ static int tolua_fltk_fltk_fl_line00(lua_State* tolua_S)
  else
 #endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
-  int y1 = ((int)  tolua_tonumber(tolua_S,4,0));
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+  const char* s = ((const char*)  tolua_tostring(tolua_S,2,0));
+  int x = ((int)  tolua_tonumber(tolua_S,3,0));
+  int y = ((int)  tolua_tonumber(tolua_S,4,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'text'", NULL);
+#endif
  {
-  fl_line(x,y,x1,y1);
+  self->text(s,x,y);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_line'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'text'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_line */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_line01
-static int tolua_fltk_fltk_fl_line01(lua_State* tolua_S)
+/* method: text of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_text01
+static int tolua_fltk_fltk_Fl_Draw_List_text01(lua_State* tolua_S)
 {
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,7,&tolua_err)
+ !tolua_isnumber(tolua_S,7,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,8,&tolua_err)
  )
  goto tolua_lerror;
  else
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
-  int y1 = ((int)  tolua_tonumber(tolua_S,4,0));
-  int x2 = ((int)  tolua_tonumber(tolua_S,5,0));
-  int y2 = ((int)  tolua_tonumber(tolua_S,6,0));
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+  const char* s = ((const char*)  tolua_tostring(tolua_S,2,0));
+  int x = ((int)  tolua_tonumber(tolua_S,3,0));
+  int y = ((int)  tolua_tonumber(tolua_S,4,0));
+  int w = ((int)  tolua_tonumber(tolua_S,5,0));
+  int h = ((int)  tolua_tonumber(tolua_S,6,0));
+   unsigned align = ((  unsigned)  tolua_tonumber(tolua_S,7,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'text'", NULL);
+#endif
  {
-  fl_line(x,y,x1,y1,x2,y2);
+  self->text(s,x,y,w,h,align);
  }
  }
  return 0;
 tolua_lerror:
- return tolua_fltk_fltk_fl_line00(tolua_S);
+ return tolua_fltk_fltk_Fl_Draw_List_text00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_line_style */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_line_style00
-static int tolua_fltk_fltk_fl_line_style00(lua_State* tolua_S)
+/* method: fltk_Fl_Draw_List_append of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_append00
+static int tolua_fltk_fltk_Fl_Draw_List_append00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  lua_Object tbl = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'fltk_Fl_Draw_List_append'", NULL);
+#endif
+ {
+  tolua_outside int tolua_ret = (tolua_outside int)  fltk_Fl_Draw_List_append(self,L,tbl);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'append'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: draw of class  Fl_Draw_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_Fl_Draw_List_draw00
+static int tolua_fltk_fltk_Fl_Draw_List_draw00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Fl_Draw_List",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,1,&tolua_err) ||
- !tolua_isstring(tolua_S,3,1,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,1,&tolua_err) ||
  !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int style = ((int)  tolua_tonumber(tolua_S,1,0));
-  int width = ((int)  tolua_tonumber(tolua_S,2,0));
-  char* dashes = ((char*)  tolua_tostring(tolua_S,3,0));
+  Fl_Draw_List* self = (Fl_Draw_List*)  tolua_tousertype(tolua_S,1,0);
+  int dx = ((int)  tolua_tonumber(tolua_S,2,0));
+  int dy = ((int)  tolua_tonumber(tolua_S,3,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'draw'", NULL);
+#endif
  {
-  fl_line_style(style,width,dashes);
+  self->draw(dx,dy);
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_line_style'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'draw'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_loop */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_loop00
-static int tolua_fltk_fltk_fl_loop00(lua_State* tolua_S)
+/* function: fl_show_colormap */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_show_colormap00
+static int tolua_fltk_fltk_fl_show_colormap00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,7,&tolua_err)
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
-  int y1 = ((int)  tolua_tonumber(tolua_S,4,0));
-  int x2 = ((int)  tolua_tonumber(tolua_S,5,0));
-  int y2 = ((int)  tolua_tonumber(tolua_S,6,0));
+  unsigned int oldcol = (( unsigned int)  tolua_tonumber(tolua_S,1,0));
  {
-  fl_loop(x,y,x1,y1,x2,y2);
+  unsigned int tolua_ret = ( unsigned int)  fl_show_colormap(oldcol);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_show_colormap'.",&tolua_err);
  return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* function: fl_fopen */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_fopen00
+static int tolua_fltk_fltk_fl_fopen00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
+  const char* mode = ((const char*)  tolua_tostring(tolua_S,2,0));
+ {
+  FILE* tolua_ret = (FILE*)  fl_fopen(f,mode);
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"FILE");
+ }
+ }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_loop'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_fopen'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_loop */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_loop01
-static int tolua_fltk_fltk_fl_loop01(lua_State* tolua_S)
+/* function: fl_locale_to_utf8 */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_locale_to_utf800
+static int tolua_fltk_fltk_fl_locale_to_utf800(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,7,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,8,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,9,&tolua_err)
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
-  int y1 = ((int)  tolua_tonumber(tolua_S,4,0));
-  int x2 = ((int)  tolua_tonumber(tolua_S,5,0));
-  int y2 = ((int)  tolua_tonumber(tolua_S,6,0));
-  int x3 = ((int)  tolua_tonumber(tolua_S,7,0));
-  int y3 = ((int)  tolua_tonumber(tolua_S,8,0));
+  const char* s = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int len = ((int)  tolua_tonumber(tolua_S,2,0));
+  unsigned int codepage = ((unsigned int)  tolua_tonumber(tolua_S,3,0));
  {
-  fl_loop(x,y,x1,y1,x2,y2,x3,y3);
+  char* tolua_ret = (char*)  fl_locale_to_utf8(s,len,codepage);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
  }
  }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_locale_to_utf8'.",&tolua_err);
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_loop00(tolua_S);
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_measure */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_measure00
-static int tolua_fltk_fltk_fl_measure00(lua_State* tolua_S)
+/* function: fl_utf8_to_locale */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8_to_locale00
+static int tolua_fltk_fltk_fl_utf8_to_locale00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -64711,631 +68945,608 @@ static int tolua_fltk_fltk_fl_measure00(lua_State* tolua_S)
  !tolua_isstring(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* str = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int x = ((int)  tolua_tonumber(tolua_S,2,0));
-  int y = ((int)  tolua_tonumber(tolua_S,3,0));
-  int draw_symbols = ((int)  tolua_tonumber(tolua_S,4,1));
+  const char* s = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int len = ((int)  tolua_tonumber(tolua_S,2,0));
+  unsigned int codepage = ((unsigned int)  tolua_tonumber(tolua_S,3,0));
  {
-  fl_measure(str,x,y,draw_symbols);
- tolua_pushnumber(tolua_S,(lua_Number)x);
- tolua_pushnumber(tolua_S,(lua_Number)y);
+  char* tolua_ret = (char*)  fl_utf8_to_locale(s,len,codepage);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
  }
  }
- return 2;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_measure'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8_to_locale'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_mult_matrix */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_mult_matrix00
-static int tolua_fltk_fltk_fl_mult_matrix00(lua_State* tolua_S)
+/* function: fl_make_path */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_make_path00
+static int tolua_fltk_fltk_fl_make_path00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,7,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  double a = ((double)  tolua_tonumber(tolua_S,1,0));
-  double b = ((double)  tolua_tonumber(tolua_S,2,0));
-  double c = ((double)  tolua_tonumber(tolua_S,3,0));
-  double d = ((double)  tolua_tonumber(tolua_S,4,0));
-  double x = ((double)  tolua_tonumber(tolua_S,5,0));
-  double y = ((double)  tolua_tonumber(tolua_S,6,0));
+  const char* path = ((const char*)  tolua_tostring(tolua_S,1,0));
  {
-  fl_mult_matrix(a,b,c,d,x,y);
+  char tolua_ret = (char)  fl_make_path(path);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_mult_matrix'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_make_path'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_overlay_clear */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_overlay_clear00
-static int tolua_fltk_fltk_fl_overlay_clear00(lua_State* tolua_S)
+/* function: fl_getcwd */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_getcwd00
+static int tolua_fltk_fltk_fl_getcwd00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  char* buf = ((char*)  tolua_tostring(tolua_S,1,0));
+  int maxlen = ((int)  tolua_tonumber(tolua_S,2,0));
  {
-  fl_overlay_clear();
+  char* tolua_ret = (char*)  fl_getcwd(buf,maxlen);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_overlay_clear'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_getcwd'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_overlay_rect */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_overlay_rect00
-static int tolua_fltk_fltk_fl_overlay_rect00(lua_State* tolua_S)
+/* function: fl_getenv */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_getenv00
+static int tolua_fltk_fltk_fl_getenv00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int w = ((int)  tolua_tonumber(tolua_S,3,0));
-  int h = ((int)  tolua_tonumber(tolua_S,4,0));
+  const char* name = ((const char*)  tolua_tostring(tolua_S,1,0));
  {
-  fl_overlay_rect(x,y,w,h);
+  char* tolua_ret = (char*)  fl_getenv(name);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_overlay_rect'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_getenv'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_pie */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_pie00
-static int tolua_fltk_fltk_fl_pie00(lua_State* tolua_S)
+/* function: fl_utf2mbcs */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf2mbcs00
+static int tolua_fltk_fltk_fl_utf2mbcs00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,7,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int w = ((int)  tolua_tonumber(tolua_S,3,0));
-  int h = ((int)  tolua_tonumber(tolua_S,4,0));
-  double a1 = ((double)  tolua_tonumber(tolua_S,5,0));
-  double a2 = ((double)  tolua_tonumber(tolua_S,6,0));
+  const char* src = ((const char*)  tolua_tostring(tolua_S,1,0));
  {
-  fl_pie(x,y,w,h,a1,a2);
+  char* tolua_ret = (char*)  fl_utf2mbcs(src);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_pie'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf2mbcs'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_point */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_point00
-static int tolua_fltk_fltk_fl_point00(lua_State* tolua_S)
+/* function: fl_utf8back */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8back00
+static int tolua_fltk_fltk_fl_utf8back00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
+  const char* p = ((const char*)  tolua_tostring(tolua_S,1,0));
+  const char* start = ((const char*)  tolua_tostring(tolua_S,2,0));
+  const char* end = ((const char*)  tolua_tostring(tolua_S,3,0));
  {
-  fl_point(x,y);
+  char* tolua_ret = (char*)  fl_utf8back(p,start,end);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_point'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8back'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_polygon */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_polygon00
-static int tolua_fltk_fltk_fl_polygon00(lua_State* tolua_S)
+/* function: fl_utf8fwd */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8fwd00
+static int tolua_fltk_fltk_fl_utf8fwd00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,7,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
-  int y1 = ((int)  tolua_tonumber(tolua_S,4,0));
-  int x2 = ((int)  tolua_tonumber(tolua_S,5,0));
-  int y2 = ((int)  tolua_tonumber(tolua_S,6,0));
+  const char* p = ((const char*)  tolua_tostring(tolua_S,1,0));
+  const char* start = ((const char*)  tolua_tostring(tolua_S,2,0));
+  const char* end = ((const char*)  tolua_tostring(tolua_S,3,0));
  {
-  fl_polygon(x,y,x1,y1,x2,y2);
+  char* tolua_ret = (char*)  fl_utf8fwd(p,start,end);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_polygon'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8fwd'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_polygon */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_polygon01
-static int tolua_fltk_fltk_fl_polygon01(lua_State* tolua_S)
+/* function: fl_access */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_access00
+static int tolua_fltk_fltk_fl_access00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,7,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,8,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,9,&tolua_err)
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
-  int y1 = ((int)  tolua_tonumber(tolua_S,4,0));
-  int x2 = ((int)  tolua_tonumber(tolua_S,5,0));
-  int y2 = ((int)  tolua_tonumber(tolua_S,6,0));
-  int x3 = ((int)  tolua_tonumber(tolua_S,7,0));
-  int y3 = ((int)  tolua_tonumber(tolua_S,8,0));
+  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int mode = ((int)  tolua_tonumber(tolua_S,2,0));
  {
-  fl_polygon(x,y,x1,y1,x2,y2,x3,y3);
+  int tolua_ret = (int)  fl_access(f,mode);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_access'.",&tolua_err);
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_polygon00(tolua_S);
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_pop_clip */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_pop_clip00
-static int tolua_fltk_fltk_fl_pop_clip00(lua_State* tolua_S)
+/* function: fl_chmod */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_chmod00
+static int tolua_fltk_fltk_fl_chmod00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int mode = ((int)  tolua_tonumber(tolua_S,2,0));
  {
-  fl_pop_clip();
+  int tolua_ret = (int)  fl_chmod(f,mode);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_pop_clip'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_chmod'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_pop_matrix */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_pop_matrix00
-static int tolua_fltk_fltk_fl_pop_matrix00(lua_State* tolua_S)
+/* function: fl_execvp */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_execvp00
+static int tolua_fltk_fltk_fl_execvp00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  const char* file = ((const char*)  tolua_tostring(tolua_S,1,0));
+  char* argv = ((char*)  tolua_tostring(tolua_S,2,0));
  {
-  fl_pop_matrix();
+  int tolua_ret = (int)  fl_execvp(file,&argv);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ tolua_pushstring(tolua_S,(const char*)argv);
  }
  }
- return 0;
+ return 2;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_pop_matrix'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_execvp'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_push_clip */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_push_clip00
-static int tolua_fltk_fltk_fl_push_clip00(lua_State* tolua_S)
+/* function: fl_mkdir */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_mkdir00
+static int tolua_fltk_fltk_fl_mkdir00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int w = ((int)  tolua_tonumber(tolua_S,3,0));
-  int h = ((int)  tolua_tonumber(tolua_S,4,0));
+  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int mode = ((int)  tolua_tonumber(tolua_S,2,0));
  {
-  fl_push_clip(x,y,w,h);
+  int tolua_ret = (int)  fl_mkdir(f,mode);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_push_clip'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_mkdir'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_push_matrix */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_push_matrix00
-static int tolua_fltk_fltk_fl_push_matrix00(lua_State* tolua_S)
+/* function: fl_nonspacing */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_nonspacing00
+static int tolua_fltk_fltk_fl_nonspacing00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  unsigned int ucs = ((unsigned int)  tolua_tonumber(tolua_S,1,0));
  {
-  fl_push_matrix();
+  int tolua_ret = (int)  fl_nonspacing(ucs);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_push_matrix'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_nonspacing'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_push_no_clip */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_push_no_clip00
-static int tolua_fltk_fltk_fl_push_no_clip00(lua_State* tolua_S)
+/* function: fl_open */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_open00
+static int tolua_fltk_fltk_fl_open00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
+  int o = ((int)  tolua_tonumber(tolua_S,2,0));
  {
-  fl_push_no_clip();
+  int tolua_ret = (int)  fl_open(f,o);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_push_no_clip'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_open'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_rect */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rect00
-static int tolua_fltk_fltk_fl_rect00(lua_State* tolua_S)
+/* function: fl_rename */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rename00
+static int tolua_fltk_fltk_fl_rename00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int w = ((int)  tolua_tonumber(tolua_S,3,0));
-  int h = ((int)  tolua_tonumber(tolua_S,4,0));
+  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
+  const char* t = ((const char*)  tolua_tostring(tolua_S,2,0));
  {
-  fl_rect(x,y,w,h);
+  int tolua_ret = (int)  fl_rename(f,t);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_rect'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_rename'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_rect */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rect01
-static int tolua_fltk_fltk_fl_rect01(lua_State* tolua_S)
+/* function: fl_rmdir */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rmdir00
+static int tolua_fltk_fltk_fl_rmdir00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,6,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int w = ((int)  tolua_tonumber(tolua_S,3,0));
-  int h = ((int)  tolua_tonumber(tolua_S,4,0));
-  unsigned int c = (( unsigned int)  tolua_tonumber(tolua_S,5,0));
+  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
  {
-  fl_rect(x,y,w,h,c);
+  int tolua_ret = (int)  fl_rmdir(f);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_rmdir'.",&tolua_err);
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_rect00(tolua_S);
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_rectf */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rectf00
-static int tolua_fltk_fltk_fl_rectf00(lua_State* tolua_S)
+/* function: fl_stat */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_stat00
+static int tolua_fltk_fltk_fl_stat00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,2,"stat",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int w = ((int)  tolua_tonumber(tolua_S,3,0));
-  int h = ((int)  tolua_tonumber(tolua_S,4,0));
+  const char* path = ((const char*)  tolua_tostring(tolua_S,1,0));
+  struct stat* buffer = ((struct stat*)  tolua_tousertype(tolua_S,2,0));
  {
-  fl_rectf(x,y,w,h);
+  int tolua_ret = (int)  fl_stat(path,buffer);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_rectf'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_stat'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_rectf */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rectf01
-static int tolua_fltk_fltk_fl_rectf01(lua_State* tolua_S)
+/* function: fl_system */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_system00
+static int tolua_fltk_fltk_fl_system00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,6,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int w = ((int)  tolua_tonumber(tolua_S,3,0));
-  int h = ((int)  tolua_tonumber(tolua_S,4,0));
-  unsigned int c = (( unsigned int)  tolua_tonumber(tolua_S,5,0));
+  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
  {
-  fl_rectf(x,y,w,h,c);
+  int tolua_ret = (int)  fl_system(f);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_system'.",&tolua_err);
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_rectf00(tolua_S);
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_rectf */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rectf02
-static int tolua_fltk_fltk_fl_rectf02(lua_State* tolua_S)
+/* function: fl_tolower */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_tolower00
+static int tolua_fltk_fltk_fl_tolower00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,7,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,8,&tolua_err)
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int w = ((int)  tolua_tonumber(tolua_S,3,0));
-  int h = ((int)  tolua_tonumber(tolua_S,4,0));
-  unsigned char r = (( unsigned char)  tolua_tonumber(tolua_S,5,0));
-  unsigned char g = (( unsigned char)  tolua_tonumber(tolua_S,6,0));
-  unsigned char b = (( unsigned char)  tolua_tonumber(tolua_S,7,0));
+  unsigned int ucs = ((unsigned int)  tolua_tonumber(tolua_S,1,0));
  {
-  fl_rectf(x,y,w,h,r,g,b);
+  int tolua_ret = (int)  fl_tolower(ucs);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_tolower'.",&tolua_err);
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_rectf01(tolua_S);
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_reset_spot */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_reset_spot00
-static int tolua_fltk_fltk_fl_reset_spot00(lua_State* tolua_S)
+/* function: fl_toupper */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_toupper00
+static int tolua_fltk_fltk_fl_toupper00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  unsigned int ucs = ((unsigned int)  tolua_tonumber(tolua_S,1,0));
  {
-  fl_reset_spot();
+  int tolua_ret = (int)  fl_toupper(ucs);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_reset_spot'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_toupper'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_restore_clip */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_restore_clip00
-static int tolua_fltk_fltk_fl_restore_clip00(lua_State* tolua_S)
+/* function: fl_unlink */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_unlink00
+static int tolua_fltk_fltk_fl_unlink00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
  {
-  fl_restore_clip();
+  int tolua_ret = (int)  fl_unlink(f);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_restore_clip'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_unlink'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_rotate */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rotate00
-static int tolua_fltk_fltk_fl_rotate00(lua_State* tolua_S)
+/* function: fl_utf8bytes */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8bytes00
+static int tolua_fltk_fltk_fl_utf8bytes00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -65347,57 +69558,55 @@ static int tolua_fltk_fltk_fl_rotate00(lua_State* tolua_S)
  else
 #endif
  {
-  double d = ((double)  tolua_tonumber(tolua_S,1,0));
+  unsigned ucs = ((unsigned)  tolua_tonumber(tolua_S,1,0));
  {
-  fl_rotate(d);
+  int tolua_ret = (int)  fl_utf8bytes(ucs);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_rotate'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8bytes'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_rtl_draw */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rtl_draw00
-static int tolua_fltk_fltk_fl_rtl_draw00(lua_State* tolua_S)
+/* function: fl_utf8encode */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8encode00
+static int tolua_fltk_fltk_fl_utf8encode00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* tolua_var_256 = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int n = ((int)  tolua_tonumber(tolua_S,2,0));
-  int x = ((int)  tolua_tonumber(tolua_S,3,0));
-  int y = ((int)  tolua_tonumber(tolua_S,4,0));
+  unsigned ucs = ((unsigned)  tolua_tonumber(tolua_S,1,0));
+  char* buf = ((char*)  tolua_tostring(tolua_S,2,0));
  {
-  fl_rtl_draw(tolua_var_256,n,x,y);
+  int tolua_ret = (int)  fl_utf8encode(ucs,buf);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_rtl_draw'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8encode'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_scale */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_scale00
-static int tolua_fltk_fltk_fl_scale00(lua_State* tolua_S)
+/* function: fl_utf8len */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8len00
+static int tolua_fltk_fltk_fl_utf8len00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -65409,599 +69618,581 @@ static int tolua_fltk_fltk_fl_scale00(lua_State* tolua_S)
  else
 #endif
  {
-  double x = ((double)  tolua_tonumber(tolua_S,1,0));
+  char c = ((char)  tolua_tonumber(tolua_S,1,0));
  {
-  fl_scale(x);
+  int tolua_ret = (int)  fl_utf8len(c);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_scale'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8len'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_scale */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_scale01
-static int tolua_fltk_fltk_fl_scale01(lua_State* tolua_S)
+/* function: fl_utf8locale */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8locale00
+static int tolua_fltk_fltk_fl_utf8locale00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  double x = ((double)  tolua_tonumber(tolua_S,1,0));
-  double y = ((double)  tolua_tonumber(tolua_S,2,0));
  {
-  fl_scale(x,y);
+  int tolua_ret = (int)  fl_utf8locale();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8locale'.",&tolua_err);
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_scale00(tolua_S);
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_set_spot */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_set_spot00
-static int tolua_fltk_fltk_fl_set_spot00(lua_State* tolua_S)
+/* function: fl_utf8test */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8test00
+static int tolua_fltk_fltk_fl_utf8test00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isusertype(tolua_S,7,"Fl_Window",1,&tolua_err) ||
- !tolua_isnoobj(tolua_S,8,&tolua_err)
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int font = ((int)  tolua_tonumber(tolua_S,1,0));
-  int size = ((int)  tolua_tonumber(tolua_S,2,0));
-  int X = ((int)  tolua_tonumber(tolua_S,3,0));
-  int Y = ((int)  tolua_tonumber(tolua_S,4,0));
-  int W = ((int)  tolua_tonumber(tolua_S,5,0));
-  int H = ((int)  tolua_tonumber(tolua_S,6,0));
-  Fl_Window* win = ((Fl_Window*)  tolua_tousertype(tolua_S,7,0));
+  const char* src = ((const char*)  tolua_tostring(tolua_S,1,0));
+  unsigned len = ((unsigned)  tolua_tonumber(tolua_S,2,0));
  {
-  fl_set_spot(font,size,X,Y,W,H,win);
+  int tolua_ret = (int)  fl_utf8test(src,len);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_set_spot'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8test'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_set_status */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_set_status00
-static int tolua_fltk_fltk_fl_set_status00(lua_State* tolua_S)
+/* function: fl_utf_nb_char */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf_nb_char00
+static int tolua_fltk_fltk_fl_utf_nb_char00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int X = ((int)  tolua_tonumber(tolua_S,1,0));
-  int Y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int W = ((int)  tolua_tonumber(tolua_S,3,0));
-  int H = ((int)  tolua_tonumber(tolua_S,4,0));
+  unsigned const char* buf = ((unsigned const char*)  tolua_tostring(tolua_S,1,0));
+  int len = ((int)  tolua_tonumber(tolua_S,2,0));
  {
-  fl_set_status(X,Y,W,H);
+  int tolua_ret = (int)  fl_utf_nb_char(buf,len);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_set_status'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf_nb_char'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_text_extents */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_text_extents00
-static int tolua_fltk_fltk_fl_text_extents00(lua_State* tolua_S)
+/* function: fl_utf_strcasecmp */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf_strcasecmp00
+static int tolua_fltk_fltk_fl_utf_strcasecmp00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,6,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,7,&tolua_err)
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* tolua_var_257 = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int n = ((int)  tolua_tonumber(tolua_S,2,0));
-  int dx = ((int)  tolua_tonumber(tolua_S,3,0));
-  int dy = ((int)  tolua_tonumber(tolua_S,4,0));
-  int w = ((int)  tolua_tonumber(tolua_S,5,0));
-  int h = ((int)  tolua_tonumber(tolua_S,6,0));
+  const char* s1 = ((const char*)  tolua_tostring(tolua_S,1,0));
+  const char* s2 = ((const char*)  tolua_tostring(tolua_S,2,0));
  {
-  fl_text_extents(tolua_var_257,n,dx,dy,w,h);
- tolua_pushnumber(tolua_S,(lua_Number)dx);
- tolua_pushnumber(tolua_S,(lua_Number)dy);
- tolua_pushnumber(tolua_S,(lua_Number)w);
- tolua_pushnumber(tolua_S,(lua_Number)h);
+  int tolua_ret = (int)  fl_utf_strcasecmp(s1,s2);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 4;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_text_extents'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf_strcasecmp'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_text_extents */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_text_extents01
-static int tolua_fltk_fltk_fl_text_extents01(lua_State* tolua_S)
+/* function: fl_utf_strncasecmp */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf_strncasecmp00
+static int tolua_fltk_fltk_fl_utf_strncasecmp00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,6,&tolua_err)
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  const char* tolua_var_258 = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int dx = ((int)  tolua_tonumber(tolua_S,2,0));
-  int dy = ((int)  tolua_tonumber(tolua_S,3,0));
-  int w = ((int)  tolua_tonumber(tolua_S,4,0));
-  int h = ((int)  tolua_tonumber(tolua_S,5,0));
+  const char* s1 = ((const char*)  tolua_tostring(tolua_S,1,0));
+  const char* s2 = ((const char*)  tolua_tostring(tolua_S,2,0));
+  int n = ((int)  tolua_tonumber(tolua_S,3,0));
  {
-  fl_text_extents(tolua_var_258,dx,dy,w,h);
- tolua_pushnumber(tolua_S,(lua_Number)dx);
- tolua_pushnumber(tolua_S,(lua_Number)dy);
- tolua_pushnumber(tolua_S,(lua_Number)w);
- tolua_pushnumber(tolua_S,(lua_Number)h);
+  int tolua_ret = (int)  fl_utf_strncasecmp(s1,s2,n);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 4;
-tolua_lerror:
- return tolua_fltk_fltk_fl_text_extents00(tolua_S);
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_utf_strncasecmp'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_transformed_vertex */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_transformed_vertex00
-static int tolua_fltk_fltk_fl_transformed_vertex00(lua_State* tolua_S)
+/* function: fl_utf_tolower */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf_tolower00
+static int tolua_fltk_fltk_fl_utf_tolower00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isstring(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  double xf = ((double)  tolua_tonumber(tolua_S,1,0));
-  double yf = ((double)  tolua_tonumber(tolua_S,2,0));
+  unsigned const char* str = ((unsigned const char*)  tolua_tostring(tolua_S,1,0));
+  int len = ((int)  tolua_tonumber(tolua_S,2,0));
+  char* buf = ((char*)  tolua_tostring(tolua_S,3,0));
  {
-  fl_transformed_vertex(xf,yf);
+  int tolua_ret = (int)  fl_utf_tolower(str,len,buf);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_transformed_vertex'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf_tolower'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_translate */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_translate00
-static int tolua_fltk_fltk_fl_translate00(lua_State* tolua_S)
+/* function: fl_utf_toupper */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf_toupper00
+static int tolua_fltk_fltk_fl_utf_toupper00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isstring(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  double x = ((double)  tolua_tonumber(tolua_S,1,0));
-  double y = ((double)  tolua_tonumber(tolua_S,2,0));
+  unsigned const char* str = ((unsigned const char*)  tolua_tostring(tolua_S,1,0));
+  int len = ((int)  tolua_tonumber(tolua_S,2,0));
+  char* buf = ((char*)  tolua_tostring(tolua_S,3,0));
  {
-  fl_translate(x,y);
+  int tolua_ret = (int)  fl_utf_toupper(str,len,buf);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_translate'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf_toupper'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_vertex */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_vertex00
-static int tolua_fltk_fltk_fl_vertex00(lua_State* tolua_S)
+/* function: fl_wcwidth */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_wcwidth00
+static int tolua_fltk_fltk_fl_wcwidth00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  double x = ((double)  tolua_tonumber(tolua_S,1,0));
-  double y = ((double)  tolua_tonumber(tolua_S,2,0));
+  const char* src = ((const char*)  tolua_tostring(tolua_S,1,0));
  {
-  fl_vertex(x,y);
+  int tolua_ret = (int)  fl_wcwidth(src);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_vertex'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_wcwidth'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_xyline */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_xyline00
-static int tolua_fltk_fltk_fl_xyline00(lua_State* tolua_S)
+/* function: fl_wcwidth_ */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_wcwidth_00
+static int tolua_fltk_fltk_fl_wcwidth_00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
+  unsigned int ucs = ((unsigned int)  tolua_tonumber(tolua_S,1,0));
  {
-  fl_xyline(x,y,x1);
+  int tolua_ret = (int)  fl_wcwidth_(ucs);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_xyline'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_wcwidth_'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_xyline */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_xyline01
-static int tolua_fltk_fltk_fl_xyline01(lua_State* tolua_S)
+/* function: fl_utf8decode */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8decode00
+static int tolua_fltk_fltk_fl_utf8decode00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
-  int y2 = ((int)  tolua_tonumber(tolua_S,4,0));
+  const char* p = ((const char*)  tolua_tostring(tolua_S,1,0));
+  const char* end = ((const char*)  tolua_tostring(tolua_S,2,0));
+  int len = ((int)  tolua_tonumber(tolua_S,3,0));
  {
-  fl_xyline(x,y,x1,y2);
+  unsigned tolua_ret = (unsigned)  fl_utf8decode(p,end,&len);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ tolua_pushnumber(tolua_S,(lua_Number)len);
  }
  }
+ return 2;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8decode'.",&tolua_err);
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_xyline00(tolua_S);
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_xyline */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_xyline02
-static int tolua_fltk_fltk_fl_xyline02(lua_State* tolua_S)
+/* function: fl_utf8from_mb */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8from_mb00
+static int tolua_fltk_fltk_fl_utf8from_mb00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,6,&tolua_err)
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int x1 = ((int)  tolua_tonumber(tolua_S,3,0));
-  int y2 = ((int)  tolua_tonumber(tolua_S,4,0));
-  int x3 = ((int)  tolua_tonumber(tolua_S,5,0));
+  char* dst = ((char*)  tolua_tostring(tolua_S,1,0));
+  unsigned dstlen = ((unsigned)  tolua_tonumber(tolua_S,2,0));
+  const char* src = ((const char*)  tolua_tostring(tolua_S,3,0));
+  unsigned srclen = ((unsigned)  tolua_tonumber(tolua_S,4,0));
  {
-  fl_xyline(x,y,x1,y2,x3);
+  unsigned tolua_ret = (unsigned)  fl_utf8from_mb(dst,dstlen,src,srclen);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8from_mb'.",&tolua_err);
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_xyline01(tolua_S);
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_yxline */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_yxline00
-static int tolua_fltk_fltk_fl_yxline00(lua_State* tolua_S)
+/* function: fl_utf8froma */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8froma00
+static int tolua_fltk_fltk_fl_utf8froma00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isstring(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int y1 = ((int)  tolua_tonumber(tolua_S,3,0));
+  char* dst = ((char*)  tolua_tostring(tolua_S,1,0));
+  unsigned dstlen = ((unsigned)  tolua_tonumber(tolua_S,2,0));
+  const char* src = ((const char*)  tolua_tostring(tolua_S,3,0));
+  unsigned srclen = ((unsigned)  tolua_tonumber(tolua_S,4,0));
  {
-  fl_yxline(x,y,y1);
+  unsigned tolua_ret = (unsigned)  fl_utf8froma(dst,dstlen,src,srclen);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_yxline'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8froma'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_yxline */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_yxline01
-static int tolua_fltk_fltk_fl_yxline01(lua_State* tolua_S)
+/* function: fl_utf8fromwc */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8fromwc00
+static int tolua_fltk_fltk_fl_utf8fromwc00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,3,"const wchar_t",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int y1 = ((int)  tolua_tonumber(tolua_S,3,0));
-  int x2 = ((int)  tolua_tonumber(tolua_S,4,0));
+  char* dst = ((char*)  tolua_tostring(tolua_S,1,0));
+  unsigned dstlen = ((unsigned)  tolua_tonumber(tolua_S,2,0));
+  const wchar_t* src = ((const wchar_t*)  tolua_tousertype(tolua_S,3,0));
+  unsigned srclen = ((unsigned)  tolua_tonumber(tolua_S,4,0));
  {
-  fl_yxline(x,y,y1,x2);
+  unsigned tolua_ret = (unsigned)  fl_utf8fromwc(dst,dstlen,src,srclen);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8fromwc'.",&tolua_err);
  return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_yxline00(tolua_S);
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_yxline */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_yxline02
-static int tolua_fltk_fltk_fl_yxline02(lua_State* tolua_S)
+/* function: fl_utf8toUtf16 */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8toUtf1600
+static int tolua_fltk_fltk_fl_utf8toUtf1600(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,6,&tolua_err)
- )
- goto tolua_lerror;
- else
- {
-  int x = ((int)  tolua_tonumber(tolua_S,1,0));
-  int y = ((int)  tolua_tonumber(tolua_S,2,0));
-  int y1 = ((int)  tolua_tonumber(tolua_S,3,0));
-  int x2 = ((int)  tolua_tonumber(tolua_S,4,0));
-  int y3 = ((int)  tolua_tonumber(tolua_S,5,0));
- {
-  fl_yxline(x,y,y1,x2,y3);
- }
- }
- return 0;
-tolua_lerror:
- return tolua_fltk_fltk_fl_yxline01(tolua_S);
-}
-#endif //#ifndef TOLUA_DISABLE
-
-/* function: fl_show_colormap */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_show_colormap00
-static int tolua_fltk_fltk_fl_show_colormap00(lua_State* tolua_S)
-{
-#ifndef TOLUA_RELEASE
- tolua_Error tolua_err;
- if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned int oldcol = (( unsigned int)  tolua_tonumber(tolua_S,1,0));
+  const char* src = ((const char*)  tolua_tostring(tolua_S,1,0));
+  unsigned srclen = ((unsigned)  tolua_tonumber(tolua_S,2,0));
+  unsigned short dst = ((unsigned short)  tolua_tonumber(tolua_S,3,0));
+  unsigned dstlen = ((unsigned)  tolua_tonumber(tolua_S,4,0));
  {
-  unsigned int tolua_ret = ( unsigned int)  fl_show_colormap(oldcol);
+  unsigned tolua_ret = (unsigned)  fl_utf8toUtf16(src,srclen,&dst,dstlen);
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ tolua_pushnumber(tolua_S,(lua_Number)dst);
  }
  }
- return 1;
+ return 2;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_show_colormap'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8toUtf16'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_fopen */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_fopen00
-static int tolua_fltk_fltk_fl_fopen00(lua_State* tolua_S)
+/* function: fl_utf8to_mb */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8to_mb00
+static int tolua_fltk_fltk_fl_utf8to_mb00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
-  const char* mode = ((const char*)  tolua_tostring(tolua_S,2,0));
+  const char* src = ((const char*)  tolua_tostring(tolua_S,1,0));
+  unsigned srclen = ((unsigned)  tolua_tonumber(tolua_S,2,0));
+  char* dst = ((char*)  tolua_tostring(tolua_S,3,0));
+  unsigned dstlen = ((unsigned)  tolua_tonumber(tolua_S,4,0));
  {
-  FILE* tolua_ret = (FILE*)  fl_fopen(f,mode);
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"FILE");
+  unsigned tolua_ret = (unsigned)  fl_utf8to_mb(src,srclen,dst,dstlen);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_fopen'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8to_mb'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_locale_to_utf8 */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_locale_to_utf800
-static int tolua_fltk_fltk_fl_locale_to_utf800(lua_State* tolua_S)
+/* function: fl_utf8toa */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8toa00
+static int tolua_fltk_fltk_fl_utf8toa00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isstring(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isstring(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* s = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int len = ((int)  tolua_tonumber(tolua_S,2,0));
-  unsigned int codepage = ((unsigned int)  tolua_tonumber(tolua_S,3,0));
+  const char* src = ((const char*)  tolua_tostring(tolua_S,1,0));
+  unsigned srclen = ((unsigned)  tolua_tonumber(tolua_S,2,0));
+  char* dst = ((char*)  tolua_tostring(tolua_S,3,0));
+  unsigned dstlen = ((unsigned)  tolua_tonumber(tolua_S,4,0));
  {
-  char* tolua_ret = (char*)  fl_locale_to_utf8(s,len,codepage);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  unsigned tolua_ret = (unsigned)  fl_utf8toa(src,srclen,dst,dstlen);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_locale_to_utf8'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8toa'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8_to_locale */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8_to_locale00
-static int tolua_fltk_fltk_fl_utf8_to_locale00(lua_State* tolua_S)
+/* function: fl_utf8towc */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8towc00
+static int tolua_fltk_fltk_fl_utf8towc00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isstring(tolua_S,1,0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isusertype(tolua_S,3,"wchar_t",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* s = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int len = ((int)  tolua_tonumber(tolua_S,2,0));
-  unsigned int codepage = ((unsigned int)  tolua_tonumber(tolua_S,3,0));
+  const char* src = ((const char*)  tolua_tostring(tolua_S,1,0));
+  unsigned srclen = ((unsigned)  tolua_tonumber(tolua_S,2,0));
+  wchar_t* dst = ((wchar_t*)  tolua_tousertype(tolua_S,3,0));
+  unsigned dstlen = ((unsigned)  tolua_tonumber(tolua_S,4,0));
  {
-  char* tolua_ret = (char*)  fl_utf8_to_locale(s,len,codepage);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  unsigned tolua_ret = (unsigned)  fl_utf8towc(src,srclen,dst,dstlen);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8_to_locale'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_utf8towc'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_make_path */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_make_path00
-static int tolua_fltk_fltk_fl_make_path00(lua_State* tolua_S)
+/* function: fl_make_path_for_file */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_make_path_for_file00
+static int tolua_fltk_fltk_fl_make_path_for_file00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -66015,2131 +70206,2225 @@ static int tolua_fltk_fltk_fl_make_path00(lua_State* tolua_S)
  {
   const char* path = ((const char*)  tolua_tostring(tolua_S,1,0));
  {
-  char tolua_ret = (char)  fl_make_path(path);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  fl_make_path_for_file(path);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_make_path'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_make_path_for_file'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_getcwd */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_getcwd00
-static int tolua_fltk_fltk_fl_getcwd00(lua_State* tolua_S)
+/* function: fl_define_FL_SHADOW_LABEL */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_SHADOW_LABEL00
+static int tolua_fltk_fltk_fl_define_FL_SHADOW_LABEL00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  char* buf = ((char*)  tolua_tostring(tolua_S,1,0));
-  int maxlen = ((int)  tolua_tonumber(tolua_S,2,0));
  {
-  char* tolua_ret = (char*)  fl_getcwd(buf,maxlen);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  Fl_Labeltype tolua_ret = (Fl_Labeltype)  fl_define_FL_SHADOW_LABEL();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_getcwd'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_define_FL_SHADOW_LABEL'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_getenv */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_getenv00
-static int tolua_fltk_fltk_fl_getenv00(lua_State* tolua_S)
+/* function: fl_define_FL_ENGRAVED_LABEL */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_ENGRAVED_LABEL00
+static int tolua_fltk_fltk_fl_define_FL_ENGRAVED_LABEL00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* name = ((const char*)  tolua_tostring(tolua_S,1,0));
  {
-  char* tolua_ret = (char*)  fl_getenv(name);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  Fl_Labeltype tolua_ret = (Fl_Labeltype)  fl_define_FL_ENGRAVED_LABEL();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_getenv'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_define_FL_ENGRAVED_LABEL'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf2mbcs */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf2mbcs00
-static int tolua_fltk_fltk_fl_utf2mbcs00(lua_State* tolua_S)
+/* function: fl_define_FL_EMBOSSED_LABEL */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_EMBOSSED_LABEL00
+static int tolua_fltk_fltk_fl_define_FL_EMBOSSED_LABEL00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* src = ((const char*)  tolua_tostring(tolua_S,1,0));
  {
-  char* tolua_ret = (char*)  fl_utf2mbcs(src);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  Fl_Labeltype tolua_ret = (Fl_Labeltype)  fl_define_FL_EMBOSSED_LABEL();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf2mbcs'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_define_FL_EMBOSSED_LABEL'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8back */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8back00
-static int tolua_fltk_fltk_fl_utf8back00(lua_State* tolua_S)
+/* function: fl_define_FL_ROUND_UP_BOX */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_ROUND_UP_BOX00
+static int tolua_fltk_fltk_fl_define_FL_ROUND_UP_BOX00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
- !tolua_isstring(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* p = ((const char*)  tolua_tostring(tolua_S,1,0));
-  const char* start = ((const char*)  tolua_tostring(tolua_S,2,0));
-  const char* end = ((const char*)  tolua_tostring(tolua_S,3,0));
  {
-  char* tolua_ret = (char*)  fl_utf8back(p,start,end);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  Fl_Boxtype tolua_ret = (Fl_Boxtype)  fl_define_FL_ROUND_UP_BOX();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8back'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_define_FL_ROUND_UP_BOX'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8fwd */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8fwd00
-static int tolua_fltk_fltk_fl_utf8fwd00(lua_State* tolua_S)
+/* function: fl_define_FL_SHADOW_BOX */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_SHADOW_BOX00
+static int tolua_fltk_fltk_fl_define_FL_SHADOW_BOX00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
- !tolua_isstring(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* p = ((const char*)  tolua_tostring(tolua_S,1,0));
-  const char* start = ((const char*)  tolua_tostring(tolua_S,2,0));
-  const char* end = ((const char*)  tolua_tostring(tolua_S,3,0));
  {
-  char* tolua_ret = (char*)  fl_utf8fwd(p,start,end);
- tolua_pushstring(tolua_S,(const char*)tolua_ret);
+  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_SHADOW_BOX();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8fwd'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_define_FL_SHADOW_BOX'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_access */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_access00
-static int tolua_fltk_fltk_fl_access00(lua_State* tolua_S)
+/* function: fl_define_FL_ROUNDED_BOX */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_ROUNDED_BOX00
+static int tolua_fltk_fltk_fl_define_FL_ROUNDED_BOX00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int mode = ((int)  tolua_tonumber(tolua_S,2,0));
  {
-  int tolua_ret = (int)  fl_access(f,mode);
+  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_ROUNDED_BOX();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_access'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_define_FL_ROUNDED_BOX'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_chmod */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_chmod00
-static int tolua_fltk_fltk_fl_chmod00(lua_State* tolua_S)
+/* function: fl_define_FL_RFLAT_BOX */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_RFLAT_BOX00
+static int tolua_fltk_fltk_fl_define_FL_RFLAT_BOX00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int mode = ((int)  tolua_tonumber(tolua_S,2,0));
  {
-  int tolua_ret = (int)  fl_chmod(f,mode);
+  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_RFLAT_BOX();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_chmod'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_define_FL_RFLAT_BOX'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_execvp */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_execvp00
-static int tolua_fltk_fltk_fl_execvp00(lua_State* tolua_S)
+/* function: fl_define_FL_RSHADOW_BOX */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_RSHADOW_BOX00
+static int tolua_fltk_fltk_fl_define_FL_RSHADOW_BOX00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* file = ((const char*)  tolua_tostring(tolua_S,1,0));
-  char* argv = ((char*)  tolua_tostring(tolua_S,2,0));
  {
-  int tolua_ret = (int)  fl_execvp(file,&argv);
+  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_RSHADOW_BOX();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- tolua_pushstring(tolua_S,(const char*)argv);
  }
  }
- return 2;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_execvp'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_define_FL_RSHADOW_BOX'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_mkdir */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_mkdir00
-static int tolua_fltk_fltk_fl_mkdir00(lua_State* tolua_S)
+/* function: fl_define_FL_DIAMOND_BOX */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_DIAMOND_BOX00
+static int tolua_fltk_fltk_fl_define_FL_DIAMOND_BOX00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int mode = ((int)  tolua_tonumber(tolua_S,2,0));
  {
-  int tolua_ret = (int)  fl_mkdir(f,mode);
+  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_DIAMOND_BOX();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_mkdir'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_define_FL_DIAMOND_BOX'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_nonspacing */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_nonspacing00
-static int tolua_fltk_fltk_fl_nonspacing00(lua_State* tolua_S)
+/* function: fl_define_FL_OVAL_BOX */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_OVAL_BOX00
+static int tolua_fltk_fltk_fl_define_FL_OVAL_BOX00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned int ucs = ((unsigned int)  tolua_tonumber(tolua_S,1,0));
  {
-  int tolua_ret = (int)  fl_nonspacing(ucs);
+  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_OVAL_BOX();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_nonspacing'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_define_FL_OVAL_BOX'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_open */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_open00
-static int tolua_fltk_fltk_fl_open00(lua_State* tolua_S)
+/* function: fl_define_FL_PLASTIC_UP_BOX */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_PLASTIC_UP_BOX00
+static int tolua_fltk_fltk_fl_define_FL_PLASTIC_UP_BOX00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
-  int o = ((int)  tolua_tonumber(tolua_S,2,0));
  {
-  int tolua_ret = (int)  fl_open(f,o);
+  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_PLASTIC_UP_BOX();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_open'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_define_FL_PLASTIC_UP_BOX'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_rename */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rename00
-static int tolua_fltk_fltk_fl_rename00(lua_State* tolua_S)
+/* function: fl_define_FL_GTK_UP_BOX */
+#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_GTK_UP_BOX00
+static int tolua_fltk_fltk_fl_define_FL_GTK_UP_BOX00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isnoobj(tolua_S,1,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
-  const char* t = ((const char*)  tolua_tostring(tolua_S,2,0));
  {
-  int tolua_ret = (int)  fl_rename(f,t);
+  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_GTK_UP_BOX();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_rename'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'fl_define_FL_GTK_UP_BOX'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_rmdir */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_rmdir00
-static int tolua_fltk_fltk_fl_rmdir00(lua_State* tolua_S)
+/* method: new of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_new00
+static int tolua_fltk_flvw_Flv_Style_List_new00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertable(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
  {
-  int tolua_ret = (int)  fl_rmdir(f);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  Flv_Style_List* tolua_ret = (Flv_Style_List*)  Mtolua_new((Flv_Style_List)());
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style_List");
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_rmdir'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_stat */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_stat00
-static int tolua_fltk_fltk_fl_stat00(lua_State* tolua_S)
+/* method: new_local of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_new00_local
+static int tolua_fltk_flvw_Flv_Style_List_new00_local(lua_State* tolua_S)
+{
+ int result = tolua_fltk_flvw_Flv_Style_List_new00(tolua_S);
+ if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
+ return result;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: clear of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_clear00
+static int tolua_fltk_flvw_Flv_Style_List_clear00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isusertype(tolua_S,2,"stat",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* path = ((const char*)  tolua_tostring(tolua_S,1,0));
-  struct stat* buffer = ((struct stat*)  tolua_tousertype(tolua_S,2,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_stat(path,buffer);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->clear();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_stat'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_system */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_system00
-static int tolua_fltk_fltk_fl_system00(lua_State* tolua_S)
+/* method: clear_current of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_clear_current00
+static int tolua_fltk_flvw_Flv_Style_List_clear_current00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_current'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_system(f);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  bool tolua_ret = (bool)  self->clear_current();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_system'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_current'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_tolower */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_tolower00
-static int tolua_fltk_fltk_fl_tolower00(lua_State* tolua_S)
+/* method: compact of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_compact00
+static int tolua_fltk_flvw_Flv_Style_List_compact00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned int ucs = ((unsigned int)  tolua_tonumber(tolua_S,1,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'compact'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_tolower(ucs);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->compact();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_tolower'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'compact'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_toupper */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_toupper00
-static int tolua_fltk_fltk_fl_toupper00(lua_State* tolua_S)
+/* method: count of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_count00
+static int tolua_fltk_flvw_Flv_Style_List_count00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned int ucs = ((unsigned int)  tolua_tonumber(tolua_S,1,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'count'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_toupper(ucs);
+  int tolua_ret = (int)  self->count();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_toupper'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'count'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_unlink */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_unlink00
-static int tolua_fltk_fltk_fl_unlink00(lua_State* tolua_S)
+/* method: current of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_current00
+static int tolua_fltk_flvw_Flv_Style_List_current00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* f = ((const char*)  tolua_tostring(tolua_S,1,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'current'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_unlink(f);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  Flv_Style* tolua_ret = (Flv_Style*)  self->current();
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_unlink'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'current'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8bytes */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8bytes00
-static int tolua_fltk_fltk_fl_utf8bytes00(lua_State* tolua_S)
+/* method: find of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_find00
+static int tolua_fltk_flvw_Flv_Style_List_find00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned ucs = ((unsigned)  tolua_tonumber(tolua_S,1,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+  int n = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'find'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_utf8bytes(ucs);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  Flv_Style* tolua_ret = (Flv_Style*)  self->find(n);
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8bytes'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'find'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8encode */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8encode00
-static int tolua_fltk_fltk_fl_utf8encode00(lua_State* tolua_S)
+/* method: first of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_first00
+static int tolua_fltk_flvw_Flv_Style_List_first00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned ucs = ((unsigned)  tolua_tonumber(tolua_S,1,0));
-  char* buf = ((char*)  tolua_tostring(tolua_S,2,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'first'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_utf8encode(ucs,buf);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  Flv_Style* tolua_ret = (Flv_Style*)  self->first();
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8encode'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'first'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8len */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8len00
-static int tolua_fltk_fltk_fl_utf8len00(lua_State* tolua_S)
+/* method: insert of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_insert00
+static int tolua_fltk_flvw_Flv_Style_List_insert00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,2,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  char c = ((char)  tolua_tonumber(tolua_S,1,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Style* n = ((Flv_Style*)  tolua_tousertype(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'insert'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_utf8len(c);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  bool tolua_ret = (bool)  self->insert(n);
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8len'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'insert'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8locale */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8locale00
-static int tolua_fltk_fltk_fl_utf8locale00(lua_State* tolua_S)
+/* method: next of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_next00
+static int tolua_fltk_flvw_Flv_Style_List_next00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'next'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_utf8locale();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  Flv_Style* tolua_ret = (Flv_Style*)  self->next();
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8locale'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'next'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8test */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8test00
-static int tolua_fltk_fltk_fl_utf8test00(lua_State* tolua_S)
+/* method: prior of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_prior00
+static int tolua_fltk_flvw_Flv_Style_List_prior00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* src = ((const char*)  tolua_tostring(tolua_S,1,0));
-  unsigned len = ((unsigned)  tolua_tonumber(tolua_S,2,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'prior'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_utf8test(src,len);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  Flv_Style* tolua_ret = (Flv_Style*)  self->prior();
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8test'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'prior'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf_nb_char */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf_nb_char00
-static int tolua_fltk_fltk_fl_utf_nb_char00(lua_State* tolua_S)
+/* method: release of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_release00
+static int tolua_fltk_flvw_Flv_Style_List_release00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned const char* buf = ((unsigned const char*)  tolua_tostring(tolua_S,1,0));
-  int len = ((int)  tolua_tonumber(tolua_S,2,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'release'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_utf_nb_char(buf,len);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->release();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf_nb_char'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'release'.",&tolua_err);
  return 0;
 #endif
 }
-#endif //#ifndef TOLUA_DISABLE
-
-/* function: fl_utf_strcasecmp */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf_strcasecmp00
-static int tolua_fltk_fltk_fl_utf_strcasecmp00(lua_State* tolua_S)
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: release_current of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_release_current00
+static int tolua_fltk_flvw_Flv_Style_List_release_current00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* s1 = ((const char*)  tolua_tostring(tolua_S,1,0));
-  const char* s2 = ((const char*)  tolua_tostring(tolua_S,2,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'release_current'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_utf_strcasecmp(s1,s2);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  bool tolua_ret = (bool)  self->release_current();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf_strcasecmp'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'release_current'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf_strncasecmp */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf_strncasecmp00
-static int tolua_fltk_fltk_fl_utf_strncasecmp00(lua_State* tolua_S)
+/* method: skip_to of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_skip_to00
+static int tolua_fltk_flvw_Flv_Style_List_skip_to00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* s1 = ((const char*)  tolua_tostring(tolua_S,1,0));
-  const char* s2 = ((const char*)  tolua_tostring(tolua_S,2,0));
-  int n = ((int)  tolua_tonumber(tolua_S,3,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+  int v = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'skip_to'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_utf_strncasecmp(s1,s2,n);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  Flv_Style* tolua_ret = (Flv_Style*)  self->skip_to(v);
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf_strncasecmp'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'skip_to'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf_tolower */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf_tolower00
-static int tolua_fltk_fltk_fl_utf_tolower00(lua_State* tolua_S)
+/* method: get of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_get00
+static int tolua_fltk_flvw_Flv_Style_List_get00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isstring(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned const char* str = ((unsigned const char*)  tolua_tostring(tolua_S,1,0));
-  int len = ((int)  tolua_tonumber(tolua_S,2,0));
-  char* buf = ((char*)  tolua_tostring(tolua_S,3,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+  int value = ((int)  tolua_tonumber(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'get'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_utf_tolower(str,len,buf);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  Flv_Style& tolua_ret = (Flv_Style&)  self->get(value);
+  tolua_pushusertype(tolua_S,(void*)&tolua_ret,"Flv_Style");
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf_tolower'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'get'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf_toupper */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf_toupper00
-static int tolua_fltk_fltk_fl_utf_toupper00(lua_State* tolua_S)
+/* method: range of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_range00
+static int tolua_fltk_flvw_Flv_Style_List_range00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isstring(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned const char* str = ((unsigned const char*)  tolua_tostring(tolua_S,1,0));
-  int len = ((int)  tolua_tonumber(tolua_S,2,0));
-  char* buf = ((char*)  tolua_tostring(tolua_S,3,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+  int from = ((int)  tolua_tonumber(tolua_S,2,0));
+  int to = ((int)  tolua_tonumber(tolua_S,3,0));
+  int step = ((int)  tolua_tonumber(tolua_S,4,1));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'range'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_utf_toupper(str,len,buf);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  Flv_Style& tolua_ret = (Flv_Style&)  self->range(from,to,step);
+  tolua_pushusertype(tolua_S,(void*)&tolua_ret,"Flv_Style");
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf_toupper'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'range'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_wcwidth */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_wcwidth00
-static int tolua_fltk_fltk_fl_wcwidth00(lua_State* tolua_S)
+/* method: ranges of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_ranges00
+static int tolua_fltk_flvw_Flv_Style_List_ranges00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* src = ((const char*)  tolua_tostring(tolua_S,1,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'ranges'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_wcwidth(src);
+  int tolua_ret = (int)  self->ranges();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_wcwidth'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'ranges'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_wcwidth_ */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_wcwidth_00
-static int tolua_fltk_fltk_fl_wcwidth_00(lua_State* tolua_S)
+/* method: clear_ranges of class  Flv_Style_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_clear_ranges00
+static int tolua_fltk_flvw_Flv_Style_List_clear_ranges00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnumber(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  unsigned int ucs = ((unsigned int)  tolua_tonumber(tolua_S,1,0));
+  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_ranges'", NULL);
+#endif
  {
-  int tolua_ret = (int)  fl_wcwidth_(ucs);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->clear_ranges();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_wcwidth_'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_ranges'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8decode */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8decode00
-static int tolua_fltk_fltk_fl_utf8decode00(lua_State* tolua_S)
+/* method: new of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_new00
+static int tolua_fltk_flvw_Flv_Style_new00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isstring(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,4,&tolua_err)
+ !tolua_isusertable(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* p = ((const char*)  tolua_tostring(tolua_S,1,0));
-  const char* end = ((const char*)  tolua_tostring(tolua_S,2,0));
-  int len = ((int)  tolua_tonumber(tolua_S,3,0));
  {
-  unsigned tolua_ret = (unsigned)  fl_utf8decode(p,end,&len);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- tolua_pushnumber(tolua_S,(lua_Number)len);
+  Flv_Style* tolua_ret = (Flv_Style*)  Mtolua_new((Flv_Style)());
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
  }
  }
- return 2;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8decode'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8from_mb */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8from_mb00
-static int tolua_fltk_fltk_fl_utf8from_mb00(lua_State* tolua_S)
+/* method: new_local of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_new00_local
+static int tolua_fltk_flvw_Flv_Style_new00_local(lua_State* tolua_S)
+{
+ int result = tolua_fltk_flvw_Flv_Style_new00(tolua_S);
+ if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
+ return result;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: new of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_new01
+static int tolua_fltk_flvw_Flv_Style_new01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
+ !tolua_isusertable(tolua_S,1,"Flv_Style",0,&tolua_err) ||
  !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isstring(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  char* dst = ((char*)  tolua_tostring(tolua_S,1,0));
-  unsigned dstlen = ((unsigned)  tolua_tonumber(tolua_S,2,0));
-  const char* src = ((const char*)  tolua_tostring(tolua_S,3,0));
-  unsigned srclen = ((unsigned)  tolua_tonumber(tolua_S,4,0));
+  int value = ((int)  tolua_tonumber(tolua_S,2,0));
  {
-  unsigned tolua_ret = (unsigned)  fl_utf8from_mb(dst,dstlen,src,srclen);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  Flv_Style* tolua_ret = (Flv_Style*)  Mtolua_new((Flv_Style)(value));
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
  }
  }
  return 1;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8from_mb'.",&tolua_err);
- return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_flvw_Flv_Style_new00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8froma */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8froma00
-static int tolua_fltk_fltk_fl_utf8froma00(lua_State* tolua_S)
+/* method: new_local of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_new01_local
+static int tolua_fltk_flvw_Flv_Style_new01_local(lua_State* tolua_S)
+{
+ int result = tolua_fltk_flvw_Flv_Style_new01(tolua_S);
+ if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
+ return result;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: align of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_align00
+static int tolua_fltk_flvw_Flv_Style_align00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isstring(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  char* dst = ((char*)  tolua_tostring(tolua_S,1,0));
-  unsigned dstlen = ((unsigned)  tolua_tonumber(tolua_S,2,0));
-  const char* src = ((const char*)  tolua_tostring(tolua_S,3,0));
-  unsigned srclen = ((unsigned)  tolua_tonumber(tolua_S,4,0));
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'align'", NULL);
+#endif
  {
-  unsigned tolua_ret = (unsigned)  fl_utf8froma(dst,dstlen,src,srclen);
+ if(nparam < 2) {
+   unsigned tolua_ret = (  unsigned)  self->align();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+   unsigned opt = ((  unsigned)  tolua_tonumber(tolua_S,2,0));
+ self->align(opt);
+ return 0;
+ }
  }
  }
- return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8froma'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'align'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8fromwc */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8fromwc00
-static int tolua_fltk_fltk_fl_utf8fromwc00(lua_State* tolua_S)
+/* method: align_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_align_defined00
+static int tolua_fltk_flvw_Flv_Style_align_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isusertype(tolua_S,3,"const wchar_t",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  char* dst = ((char*)  tolua_tostring(tolua_S,1,0));
-  unsigned dstlen = ((unsigned)  tolua_tonumber(tolua_S,2,0));
-  const wchar_t* src = ((const wchar_t*)  tolua_tousertype(tolua_S,3,0));
-  unsigned srclen = ((unsigned)  tolua_tonumber(tolua_S,4,0));
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'align_defined'", NULL);
+#endif
  {
-  unsigned tolua_ret = (unsigned)  fl_utf8fromwc(dst,dstlen,src,srclen);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  bool tolua_ret = (bool)  self->align_defined();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8fromwc'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'align_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8toUtf16 */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8toUtf1600
-static int tolua_fltk_fltk_fl_utf8toUtf1600(lua_State* tolua_S)
+/* method: all_clear of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_all_clear00
+static int tolua_fltk_flvw_Flv_Style_all_clear00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* src = ((const char*)  tolua_tostring(tolua_S,1,0));
-  unsigned srclen = ((unsigned)  tolua_tonumber(tolua_S,2,0));
-  unsigned short dst = ((unsigned short)  tolua_tonumber(tolua_S,3,0));
-  unsigned dstlen = ((unsigned)  tolua_tonumber(tolua_S,4,0));
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'all_clear'", NULL);
+#endif
  {
-  unsigned tolua_ret = (unsigned)  fl_utf8toUtf16(src,srclen,&dst,dstlen);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- tolua_pushnumber(tolua_S,(lua_Number)dst);
+  bool tolua_ret = (bool)  self->all_clear();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
- return 2;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8toUtf16'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'all_clear'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8to_mb */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8to_mb00
-static int tolua_fltk_fltk_fl_utf8to_mb00(lua_State* tolua_S)
+/* method: all_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_all_defined00
+static int tolua_fltk_flvw_Flv_Style_all_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isstring(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* src = ((const char*)  tolua_tostring(tolua_S,1,0));
-  unsigned srclen = ((unsigned)  tolua_tonumber(tolua_S,2,0));
-  char* dst = ((char*)  tolua_tostring(tolua_S,3,0));
-  unsigned dstlen = ((unsigned)  tolua_tonumber(tolua_S,4,0));
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'all_defined'", NULL);
+#endif
  {
-  unsigned tolua_ret = (unsigned)  fl_utf8to_mb(src,srclen,dst,dstlen);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  bool tolua_ret = (bool)  self->all_defined();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8to_mb'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'all_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8toa */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8toa00
-static int tolua_fltk_fltk_fl_utf8toa00(lua_State* tolua_S)
+/* method: background of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_background00
+static int tolua_fltk_flvw_Flv_Style_background00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isstring(tolua_S,3,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* src = ((const char*)  tolua_tostring(tolua_S,1,0));
-  unsigned srclen = ((unsigned)  tolua_tonumber(tolua_S,2,0));
-  char* dst = ((char*)  tolua_tostring(tolua_S,3,0));
-  unsigned dstlen = ((unsigned)  tolua_tonumber(tolua_S,4,0));
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'background'", NULL);
+#endif
  {
-  unsigned tolua_ret = (unsigned)  fl_utf8toa(src,srclen,dst,dstlen);
+ if(nparam < 2) {
+  unsigned int tolua_ret = ( unsigned int)  self->background();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  unsigned int opt = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
+ self->background(opt);
+ return 0;
+ }
  }
  }
- return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8toa'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'background'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_utf8towc */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_utf8towc00
-static int tolua_fltk_fltk_fl_utf8towc00(lua_State* tolua_S)
+/* method: background_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_background_defined00
+static int tolua_fltk_flvw_Flv_Style_background_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isusertype(tolua_S,3,"wchar_t",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,5,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* src = ((const char*)  tolua_tostring(tolua_S,1,0));
-  unsigned srclen = ((unsigned)  tolua_tonumber(tolua_S,2,0));
-  wchar_t* dst = ((wchar_t*)  tolua_tousertype(tolua_S,3,0));
-  unsigned dstlen = ((unsigned)  tolua_tonumber(tolua_S,4,0));
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'background_defined'", NULL);
+#endif
  {
-  unsigned tolua_ret = (unsigned)  fl_utf8towc(src,srclen,dst,dstlen);
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  bool tolua_ret = (bool)  self->background_defined();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_utf8towc'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'background_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_make_path_for_file */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_make_path_for_file00
-static int tolua_fltk_fltk_fl_make_path_for_file00(lua_State* tolua_S)
+/* method: border of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_border00
+static int tolua_fltk_flvw_Flv_Style_border00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isstring(tolua_S,1,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  const char* path = ((const char*)  tolua_tostring(tolua_S,1,0));
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'border'", NULL);
+#endif
  {
-  fl_make_path_for_file(path);
+ if(nparam < 2) {
+  int tolua_ret = (int)  self->border();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
+ self->border(opt);
+ return 0;
+ }
  }
  }
- return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_make_path_for_file'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'border'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_define_FL_SHADOW_LABEL */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_SHADOW_LABEL00
-static int tolua_fltk_fltk_fl_define_FL_SHADOW_LABEL00(lua_State* tolua_S)
+/* method: border_color of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_border_color00
+static int tolua_fltk_flvw_Flv_Style_border_color00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'border_color'", NULL);
+#endif
  {
-  Fl_Labeltype tolua_ret = (Fl_Labeltype)  fl_define_FL_SHADOW_LABEL();
+ if(nparam < 2) {
+  unsigned int tolua_ret = ( unsigned int)  self->border_color();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  unsigned int opt = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
+ self->border_color(opt);
+ return 0;
+ }
  }
  }
- return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_define_FL_SHADOW_LABEL'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'border_color'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_define_FL_ENGRAVED_LABEL */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_ENGRAVED_LABEL00
-static int tolua_fltk_fltk_fl_define_FL_ENGRAVED_LABEL00(lua_State* tolua_S)
+/* method: border_color_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_border_color_defined00
+static int tolua_fltk_flvw_Flv_Style_border_color_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'border_color_defined'", NULL);
+#endif
  {
-  Fl_Labeltype tolua_ret = (Fl_Labeltype)  fl_define_FL_ENGRAVED_LABEL();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  bool tolua_ret = (bool)  self->border_color_defined();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_define_FL_ENGRAVED_LABEL'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'border_color_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_define_FL_EMBOSSED_LABEL */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_EMBOSSED_LABEL00
-static int tolua_fltk_fltk_fl_define_FL_EMBOSSED_LABEL00(lua_State* tolua_S)
+/* method: border_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_border_defined00
+static int tolua_fltk_flvw_Flv_Style_border_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'border_defined'", NULL);
+#endif
  {
-  Fl_Labeltype tolua_ret = (Fl_Labeltype)  fl_define_FL_EMBOSSED_LABEL();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  bool tolua_ret = (bool)  self->border_defined();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_define_FL_EMBOSSED_LABEL'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'border_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_define_FL_ROUND_UP_BOX */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_ROUND_UP_BOX00
-static int tolua_fltk_fltk_fl_define_FL_ROUND_UP_BOX00(lua_State* tolua_S)
+/* method: border_spacing of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_border_spacing00
+static int tolua_fltk_flvw_Flv_Style_border_spacing00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'border_spacing'", NULL);
+#endif
  {
-  Fl_Boxtype tolua_ret = (Fl_Boxtype)  fl_define_FL_ROUND_UP_BOX();
+ if(nparam < 2) {
+  int tolua_ret = (int)  self->border_spacing();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
+ self->border_spacing(opt);
+ return 0;
+ }
  }
  }
- return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_define_FL_ROUND_UP_BOX'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'border_spacing'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
-
-/* function: fl_define_FL_SHADOW_BOX */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_SHADOW_BOX00
-static int tolua_fltk_fltk_fl_define_FL_SHADOW_BOX00(lua_State* tolua_S)
+
+/* method: border_spacing_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_border_spacing_defined00
+static int tolua_fltk_flvw_Flv_Style_border_spacing_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'border_spacing_defined'", NULL);
+#endif
  {
-  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_SHADOW_BOX();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  bool tolua_ret = (bool)  self->border_spacing_defined();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_define_FL_SHADOW_BOX'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'border_spacing_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_define_FL_ROUNDED_BOX */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_ROUNDED_BOX00
-static int tolua_fltk_fltk_fl_define_FL_ROUNDED_BOX00(lua_State* tolua_S)
+/* method: bottom_border of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_bottom_border00
+static int tolua_fltk_flvw_Flv_Style_bottom_border00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'bottom_border'", NULL);
+#endif
  {
-  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_ROUNDED_BOX();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  bool tolua_ret = (bool)  self->bottom_border();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_define_FL_ROUNDED_BOX'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'bottom_border'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_define_FL_RFLAT_BOX */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_RFLAT_BOX00
-static int tolua_fltk_fltk_fl_define_FL_RFLAT_BOX00(lua_State* tolua_S)
+/* method: clear_align of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_align00
+static int tolua_fltk_flvw_Flv_Style_clear_align00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_align'", NULL);
+#endif
  {
-  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_RFLAT_BOX();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->clear_align();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_define_FL_RFLAT_BOX'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_align'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_define_FL_RSHADOW_BOX */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_RSHADOW_BOX00
-static int tolua_fltk_fltk_fl_define_FL_RSHADOW_BOX00(lua_State* tolua_S)
+/* method: clear_all of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_all00
+static int tolua_fltk_flvw_Flv_Style_clear_all00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_all'", NULL);
+#endif
  {
-  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_RSHADOW_BOX();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->clear_all();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_define_FL_RSHADOW_BOX'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_all'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_define_FL_DIAMOND_BOX */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_DIAMOND_BOX00
-static int tolua_fltk_fltk_fl_define_FL_DIAMOND_BOX00(lua_State* tolua_S)
+/* method: clear_background of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_background00
+static int tolua_fltk_flvw_Flv_Style_clear_background00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_background'", NULL);
+#endif
  {
-  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_DIAMOND_BOX();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->clear_background();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_define_FL_DIAMOND_BOX'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_background'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_define_FL_OVAL_BOX */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_OVAL_BOX00
-static int tolua_fltk_fltk_fl_define_FL_OVAL_BOX00(lua_State* tolua_S)
+/* method: clear_border of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_border00
+static int tolua_fltk_flvw_Flv_Style_clear_border00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_border'", NULL);
+#endif
  {
-  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_OVAL_BOX();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->clear_border();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_define_FL_OVAL_BOX'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_border'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_define_FL_PLASTIC_UP_BOX */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_PLASTIC_UP_BOX00
-static int tolua_fltk_fltk_fl_define_FL_PLASTIC_UP_BOX00(lua_State* tolua_S)
+/* method: clear_border_color of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_border_color00
+static int tolua_fltk_flvw_Flv_Style_clear_border_color00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_border_color'", NULL);
+#endif
  {
-  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_PLASTIC_UP_BOX();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->clear_border_color();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_define_FL_PLASTIC_UP_BOX'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_border_color'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* function: fl_define_FL_GTK_UP_BOX */
-#ifndef TOLUA_DISABLE_tolua_fltk_fltk_fl_define_FL_GTK_UP_BOX00
-static int tolua_fltk_fltk_fl_define_FL_GTK_UP_BOX00(lua_State* tolua_S)
+/* method: clear_border_spacing of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_border_spacing00
+static int tolua_fltk_flvw_Flv_Style_clear_border_spacing00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isnoobj(tolua_S,1,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_border_spacing'", NULL);
+#endif
  {
-  FL_EXPORT Fl_Boxtype tolua_ret = (FL_EXPORT Fl_Boxtype)  fl_define_FL_GTK_UP_BOX();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->clear_border_spacing();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'fl_define_FL_GTK_UP_BOX'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_border_spacing'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_new00
-static int tolua_fltk_flvw_Flv_Style_List_new00(lua_State* tolua_S)
+/* method: clear_editor of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_editor00
+static int tolua_fltk_flvw_Flv_Style_clear_editor00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertable(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_editor'", NULL);
+#endif
  {
-  Flv_Style_List* tolua_ret = (Flv_Style_List*)  Mtolua_new((Flv_Style_List)());
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style_List");
+  self->clear_editor();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_editor'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new_local of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_new00_local
-static int tolua_fltk_flvw_Flv_Style_List_new00_local(lua_State* tolua_S)
-{
- int result = tolua_fltk_flvw_Flv_Style_List_new00(tolua_S);
- if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
- return result;
-}
-#endif //#ifndef TOLUA_DISABLE
-
-/* method: clear of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_clear00
-static int tolua_fltk_flvw_Flv_Style_List_clear00(lua_State* tolua_S)
+/* method: clear_font of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_font00
+static int tolua_fltk_flvw_Flv_Style_clear_font00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_font'", NULL);
 #endif
  {
-  self->clear();
+  self->clear_font();
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_font'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_current of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_clear_current00
-static int tolua_fltk_flvw_Flv_Style_List_clear_current00(lua_State* tolua_S)
+/* method: clear_font_size of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_font_size00
+static int tolua_fltk_flvw_Flv_Style_clear_font_size00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_current'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_font_size'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->clear_current();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  self->clear_font_size();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_current'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_font_size'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: compact of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_compact00
-static int tolua_fltk_flvw_Flv_Style_List_compact00(lua_State* tolua_S)
+/* method: clear_foreground of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_foreground00
+static int tolua_fltk_flvw_Flv_Style_clear_foreground00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'compact'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_foreground'", NULL);
 #endif
  {
-  self->compact();
+  self->clear_foreground();
  }
  }
  return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'compact'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_foreground'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: count of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_count00
-static int tolua_fltk_flvw_Flv_Style_List_count00(lua_State* tolua_S)
+/* method: clear_frame of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_frame00
+static int tolua_fltk_flvw_Flv_Style_clear_frame00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'count'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_frame'", NULL);
 #endif
  {
-  int tolua_ret = (int)  self->count();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+  self->clear_frame();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'count'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_frame'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: current of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_current00
-static int tolua_fltk_flvw_Flv_Style_List_current00(lua_State* tolua_S)
+/* method: clear_height of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_height00
+static int tolua_fltk_flvw_Flv_Style_clear_height00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'current'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_height'", NULL);
 #endif
  {
-  Flv_Style* tolua_ret = (Flv_Style*)  self->current();
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
+  self->clear_height();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'current'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_height'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: find of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_find00
-static int tolua_fltk_flvw_Flv_Style_List_find00(lua_State* tolua_S)
+/* method: clear_locked of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_locked00
+static int tolua_fltk_flvw_Flv_Style_clear_locked00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
-  int n = ((int)  tolua_tonumber(tolua_S,2,0));
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'find'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_locked'", NULL);
 #endif
  {
-  Flv_Style* tolua_ret = (Flv_Style*)  self->find(n);
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
+  self->clear_locked();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'find'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_locked'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: first of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_first00
-static int tolua_fltk_flvw_Flv_Style_List_first00(lua_State* tolua_S)
+/* method: clear_resizable of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_resizable00
+static int tolua_fltk_flvw_Flv_Style_clear_resizable00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'first'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_resizable'", NULL);
 #endif
  {
-  Flv_Style* tolua_ret = (Flv_Style*)  self->first();
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
+  self->clear_resizable();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'first'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_resizable'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: insert of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_insert00
-static int tolua_fltk_flvw_Flv_Style_List_insert00(lua_State* tolua_S)
+/* method: clear_width of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_width00
+static int tolua_fltk_flvw_Flv_Style_clear_width00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
- !tolua_isusertype(tolua_S,2,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
-  Flv_Style* n = ((Flv_Style*)  tolua_tousertype(tolua_S,2,0));
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'insert'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_width'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->insert(n);
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  self->clear_width();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'insert'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_width'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: next of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_next00
-static int tolua_fltk_flvw_Flv_Style_List_next00(lua_State* tolua_S)
+/* method: clear_x_margin of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_x_margin00
+static int tolua_fltk_flvw_Flv_Style_clear_x_margin00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'next'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_x_margin'", NULL);
 #endif
  {
-  Flv_Style* tolua_ret = (Flv_Style*)  self->next();
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
+  self->clear_x_margin();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'next'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_x_margin'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: prior of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_prior00
-static int tolua_fltk_flvw_Flv_Style_List_prior00(lua_State* tolua_S)
+/* method: clear_y_margin of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_y_margin00
+static int tolua_fltk_flvw_Flv_Style_clear_y_margin00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'prior'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_y_margin'", NULL);
 #endif
  {
-  Flv_Style* tolua_ret = (Flv_Style*)  self->prior();
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
+  self->clear_y_margin();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'prior'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_y_margin'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: release of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_release00
-static int tolua_fltk_flvw_Flv_Style_List_release00(lua_State* tolua_S)
+/* method: editor of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_editor00
+static int tolua_fltk_flvw_Flv_Style_editor00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'release'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'editor'", NULL);
 #endif
  {
-  self->release();
+ if(nparam < 2) {
+  Fl_Widget* tolua_ret = (Fl_Widget*)  self->editor();
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Widget");
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isusertype(tolua_S,2,"Fl_Widget",0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  Fl_Widget* opt = ((Fl_Widget*)  tolua_tousertype(tolua_S,2,0));
+ self->editor(opt);
+ return 0;
+ }
  }
  }
- return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'release'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'editor'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: release_current of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_release_current00
-static int tolua_fltk_flvw_Flv_Style_List_release_current00(lua_State* tolua_S)
+/* method: editor_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_editor_defined00
+static int tolua_fltk_flvw_Flv_Style_editor_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'release_current'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'editor_defined'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->release_current();
+  bool tolua_ret = (bool)  self->editor_defined();
  tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'release_current'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'editor_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: skip_to of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_skip_to00
-static int tolua_fltk_flvw_Flv_Style_List_skip_to00(lua_State* tolua_S)
+/* method: font_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_font_defined00
+static int tolua_fltk_flvw_Flv_Style_font_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
-  int v = ((int)  tolua_tonumber(tolua_S,2,0));
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'skip_to'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'font_defined'", NULL);
 #endif
  {
-  Flv_Style* tolua_ret = (Flv_Style*)  self->skip_to(v);
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
+  bool tolua_ret = (bool)  self->font_defined();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'skip_to'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'font_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: get of class  Flv_Style_List */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_List_get00
-static int tolua_fltk_flvw_Flv_Style_List_get00(lua_State* tolua_S)
+/* method: font of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_font00
+static int tolua_fltk_flvw_Flv_Style_font00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style_List",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style_List* self = (Flv_Style_List*)  tolua_tousertype(tolua_S,1,0);
-  int value = ((int)  tolua_tonumber(tolua_S,2,0));
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'get'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'font'", NULL);
 #endif
  {
-  Flv_Style& tolua_ret = (Flv_Style&)  self->get(value);
-  tolua_pushusertype(tolua_S,(void*)&tolua_ret,"Flv_Style");
+ if(nparam < 2) {
+   int tolua_ret = (  int)  self->font();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+   int opt = ((  int)  tolua_tonumber(tolua_S,2,0));
+ self->font(opt);
+ return 0;
+ }
  }
  }
- return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'get'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'font'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_new00
-static int tolua_fltk_flvw_Flv_Style_new00(lua_State* tolua_S)
+/* method: font_size of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_font_size00
+static int tolua_fltk_flvw_Flv_Style_font_size00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertable(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'font_size'", NULL);
+#endif
  {
-  Flv_Style* tolua_ret = (Flv_Style*)  Mtolua_new((Flv_Style)());
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
+ if(nparam < 2) {
+  int tolua_ret = (int)  self->font_size();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
+ self->font_size(opt);
+ return 0;
+ }
  }
  }
- return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'font_size'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new_local of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_new00_local
-static int tolua_fltk_flvw_Flv_Style_new00_local(lua_State* tolua_S)
-{
- int result = tolua_fltk_flvw_Flv_Style_new00(tolua_S);
- if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
- return result;
-}
-#endif //#ifndef TOLUA_DISABLE
-
-/* method: new of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_new01
-static int tolua_fltk_flvw_Flv_Style_new01(lua_State* tolua_S)
+/* method: font_size_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_font_size_defined00
+static int tolua_fltk_flvw_Flv_Style_font_size_defined00(lua_State* tolua_S)
 {
+#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertable(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
+#endif
  {
-  int value = ((int)  tolua_tonumber(tolua_S,2,0));
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'font_size_defined'", NULL);
+#endif
  {
-  Flv_Style* tolua_ret = (Flv_Style*)  Mtolua_new((Flv_Style)(value));
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Style");
+  bool tolua_ret = (bool)  self->font_size_defined();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
-tolua_lerror:
- return tolua_fltk_flvw_Flv_Style_new00(tolua_S);
-}
-#endif //#ifndef TOLUA_DISABLE
-
-/* method: new_local of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_new01_local
-static int tolua_fltk_flvw_Flv_Style_new01_local(lua_State* tolua_S)
-{
- int result = tolua_fltk_flvw_Flv_Style_new01(tolua_S);
- if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
- return result;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'font_size_defined'.",&tolua_err);
+ return 0;
+#endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: align of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_align00
-static int tolua_fltk_flvw_Flv_Style_align00(lua_State* tolua_S)
+/* method: foreground of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_foreground00
+static int tolua_fltk_flvw_Flv_Style_foreground00(lua_State* tolua_S)
 {
  int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
@@ -68153,11 +72438,11 @@ static int tolua_fltk_flvw_Flv_Style_align00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'align'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'foreground'", NULL);
 #endif
  {
  if(nparam < 2) {
-   unsigned tolua_ret = (  unsigned)  self->align();
+  unsigned int tolua_ret = ( unsigned int)  self->foreground();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  return 1;
  } else {
@@ -68165,23 +72450,23 @@ static int tolua_fltk_flvw_Flv_Style_align00(lua_State* tolua_S)
  if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
  ) goto tolua_lerror;
 #endif
-   unsigned opt = ((  unsigned)  tolua_tonumber(tolua_S,2,0));
- self->align(opt);
+  unsigned int opt = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
+ self->foreground(opt);
  return 0;
  }
  }
  }
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'align'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'foreground'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: align_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_align_defined00
-static int tolua_fltk_flvw_Flv_Style_align_defined00(lua_State* tolua_S)
+/* method: foreground_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_foreground_defined00
+static int tolua_fltk_flvw_Flv_Style_foreground_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -68195,25 +72480,25 @@ static int tolua_fltk_flvw_Flv_Style_align_defined00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'align_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'foreground_defined'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->align_defined();
+  bool tolua_ret = (bool)  self->foreground_defined();
  tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'align_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'foreground_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: all_clear of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_all_clear00
-static int tolua_fltk_flvw_Flv_Style_all_clear00(lua_State* tolua_S)
+/* method: frame_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_frame_defined00
+static int tolua_fltk_flvw_Flv_Style_frame_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -68227,31 +72512,31 @@ static int tolua_fltk_flvw_Flv_Style_all_clear00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'all_clear'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'frame_defined'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->all_clear();
+  bool tolua_ret = (bool)  self->frame_defined();
  tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'all_clear'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'frame_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: all_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_all_defined00
-static int tolua_fltk_flvw_Flv_Style_all_defined00(lua_State* tolua_S)
+/* method: frame of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_frame00
+static int tolua_fltk_flvw_Flv_Style_frame00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
  )
  goto tolua_lerror;
  else
@@ -68259,25 +72544,35 @@ static int tolua_fltk_flvw_Flv_Style_all_defined00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'all_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'frame'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->all_defined();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+ if(nparam < 2) {
+  Fl_Boxtype tolua_ret = (Fl_Boxtype)  self->frame();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  Fl_Boxtype opt = ((Fl_Boxtype) (int)  tolua_tonumber(tolua_S,2,0));
+ self->frame(opt);
+ return 0;
+ }
  }
  }
- return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'all_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'frame'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: background of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_background00
-static int tolua_fltk_flvw_Flv_Style_background00(lua_State* tolua_S)
+/* method: height of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_height00
+static int tolua_fltk_flvw_Flv_Style_height00(lua_State* tolua_S)
 {
  int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
@@ -68291,11 +72586,11 @@ static int tolua_fltk_flvw_Flv_Style_background00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'background'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'height'", NULL);
 #endif
  {
  if(nparam < 2) {
-  unsigned int tolua_ret = ( unsigned int)  self->background();
+  int tolua_ret = (int)  self->height();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  return 1;
  } else {
@@ -68303,23 +72598,23 @@ static int tolua_fltk_flvw_Flv_Style_background00(lua_State* tolua_S)
  if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
  ) goto tolua_lerror;
 #endif
-  unsigned int opt = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
- self->background(opt);
+  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
+ self->height(opt);
  return 0;
  }
  }
  }
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'background'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'height'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: background_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_background_defined00
-static int tolua_fltk_flvw_Flv_Style_background_defined00(lua_State* tolua_S)
+/* method: height_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_height_defined00
+static int tolua_fltk_flvw_Flv_Style_height_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -68333,31 +72628,31 @@ static int tolua_fltk_flvw_Flv_Style_background_defined00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'background_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'height_defined'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->background_defined();
+  bool tolua_ret = (bool)  self->height_defined();
  tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'background_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'height_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: border of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_border00
-static int tolua_fltk_flvw_Flv_Style_border00(lua_State* tolua_S)
+/* method: inner_bottom_border of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_inner_bottom_border00
+static int tolua_fltk_flvw_Flv_Style_inner_bottom_border00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
@@ -68365,41 +72660,31 @@ static int tolua_fltk_flvw_Flv_Style_border00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'border'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'inner_bottom_border'", NULL);
 #endif
  {
- if(nparam < 2) {
-  int tolua_ret = (int)  self->border();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
- self->border(opt);
- return 0;
- }
+  bool tolua_ret = (bool)  self->inner_bottom_border();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'border'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'inner_bottom_border'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: border_color of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_border_color00
-static int tolua_fltk_flvw_Flv_Style_border_color00(lua_State* tolua_S)
+/* method: inner_left_border of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_inner_left_border00
+static int tolua_fltk_flvw_Flv_Style_inner_left_border00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
@@ -68407,35 +72692,25 @@ static int tolua_fltk_flvw_Flv_Style_border_color00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'border_color'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'inner_left_border'", NULL);
 #endif
  {
- if(nparam < 2) {
-  unsigned int tolua_ret = ( unsigned int)  self->border_color();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  unsigned int opt = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
- self->border_color(opt);
- return 0;
- }
+  bool tolua_ret = (bool)  self->inner_left_border();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'border_color'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'inner_left_border'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: border_color_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_border_color_defined00
-static int tolua_fltk_flvw_Flv_Style_border_color_defined00(lua_State* tolua_S)
+/* method: inner_right_border of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_inner_right_border00
+static int tolua_fltk_flvw_Flv_Style_inner_right_border00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -68449,25 +72724,25 @@ static int tolua_fltk_flvw_Flv_Style_border_color_defined00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'border_color_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'inner_right_border'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->border_color_defined();
+  bool tolua_ret = (bool)  self->inner_right_border();
  tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'border_color_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'inner_right_border'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: border_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_border_defined00
-static int tolua_fltk_flvw_Flv_Style_border_defined00(lua_State* tolua_S)
+/* method: inner_top_border of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_inner_top_border00
+static int tolua_fltk_flvw_Flv_Style_inner_top_border00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -68481,31 +72756,31 @@ static int tolua_fltk_flvw_Flv_Style_border_defined00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'border_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'inner_top_border'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->border_defined();
+  bool tolua_ret = (bool)  self->inner_top_border();
  tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'border_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'inner_top_border'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: border_spacing of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_border_spacing00
-static int tolua_fltk_flvw_Flv_Style_border_spacing00(lua_State* tolua_S)
+/* method: left_border of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_left_border00
+static int tolua_fltk_flvw_Flv_Style_left_border00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
@@ -68513,41 +72788,31 @@ static int tolua_fltk_flvw_Flv_Style_border_spacing00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'border_spacing'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'left_border'", NULL);
 #endif
  {
- if(nparam < 2) {
-  int tolua_ret = (int)  self->border_spacing();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
- self->border_spacing(opt);
- return 0;
- }
+  bool tolua_ret = (bool)  self->left_border();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'border_spacing'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'left_border'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: border_spacing_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_border_spacing_defined00
-static int tolua_fltk_flvw_Flv_Style_border_spacing_defined00(lua_State* tolua_S)
+/* method: locked of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_locked00
+static int tolua_fltk_flvw_Flv_Style_locked00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
  )
  goto tolua_lerror;
  else
@@ -68555,25 +72820,35 @@ static int tolua_fltk_flvw_Flv_Style_border_spacing_defined00(lua_State* tolua_S
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'border_spacing_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'locked'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->border_spacing_defined();
+ if(nparam < 2) {
+  bool tolua_ret = (bool)  self->locked();
  tolua_pushboolean(tolua_S,(bool)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isboolean(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  bool opt = ((bool)  tolua_toboolean(tolua_S,2,0));
+ self->locked(opt);
+ return 0;
+ }
  }
  }
- return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'border_spacing_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'locked'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: bottom_border of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_bottom_border00
-static int tolua_fltk_flvw_Flv_Style_bottom_border00(lua_State* tolua_S)
+/* method: locked_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_locked_defined00
+static int tolua_fltk_flvw_Flv_Style_locked_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -68587,31 +72862,31 @@ static int tolua_fltk_flvw_Flv_Style_bottom_border00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'bottom_border'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'locked_defined'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->bottom_border();
+  bool tolua_ret = (bool)  self->locked_defined();
  tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'bottom_border'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'locked_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_align of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_align00
-static int tolua_fltk_flvw_Flv_Style_clear_align00(lua_State* tolua_S)
+/* method: resizable of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_resizable00
+static int tolua_fltk_flvw_Flv_Style_resizable00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
  )
  goto tolua_lerror;
  else
@@ -68619,24 +72894,35 @@ static int tolua_fltk_flvw_Flv_Style_clear_align00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_align'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'resizable'", NULL);
 #endif
  {
-  self->clear_align();
+ if(nparam < 2) {
+  bool tolua_ret = (bool)  self->resizable();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isboolean(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  bool opt = ((bool)  tolua_toboolean(tolua_S,2,0));
+ self->resizable(opt);
+ return 0;
+ }
  }
  }
- return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_align'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'resizable'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_all of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_all00
-static int tolua_fltk_flvw_Flv_Style_clear_all00(lua_State* tolua_S)
+/* method: resizable_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_resizable_defined00
+static int tolua_fltk_flvw_Flv_Style_resizable_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -68650,24 +72936,25 @@ static int tolua_fltk_flvw_Flv_Style_clear_all00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_all'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'resizable_defined'", NULL);
 #endif
  {
-  self->clear_all();
+  bool tolua_ret = (bool)  self->resizable_defined();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_all'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'resizable_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_background of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_background00
-static int tolua_fltk_flvw_Flv_Style_clear_background00(lua_State* tolua_S)
+/* method: right_border of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_right_border00
+static int tolua_fltk_flvw_Flv_Style_right_border00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -68681,24 +72968,25 @@ static int tolua_fltk_flvw_Flv_Style_clear_background00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_background'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'right_border'", NULL);
 #endif
  {
-  self->clear_background();
+  bool tolua_ret = (bool)  self->right_border();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_background'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'right_border'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_border of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_border00
-static int tolua_fltk_flvw_Flv_Style_clear_border00(lua_State* tolua_S)
+/* method: top_border of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_top_border00
+static int tolua_fltk_flvw_Flv_Style_top_border00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -68712,30 +73000,31 @@ static int tolua_fltk_flvw_Flv_Style_clear_border00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_border'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'top_border'", NULL);
 #endif
  {
-  self->clear_border();
+  bool tolua_ret = (bool)  self->top_border();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_border'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'top_border'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_border_color of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_border_color00
-static int tolua_fltk_flvw_Flv_Style_clear_border_color00(lua_State* tolua_S)
+/* method: width of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_width00
+static int tolua_fltk_flvw_Flv_Style_width00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
  )
  goto tolua_lerror;
  else
@@ -68743,24 +73032,35 @@ static int tolua_fltk_flvw_Flv_Style_clear_border_color00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_border_color'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'width'", NULL);
 #endif
  {
-  self->clear_border_color();
+ if(nparam < 2) {
+  int tolua_ret = (int)  self->width();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
+ self->width(opt);
+ return 0;
+ }
  }
  }
- return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_border_color'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'width'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_border_spacing of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_border_spacing00
-static int tolua_fltk_flvw_Flv_Style_clear_border_spacing00(lua_State* tolua_S)
+/* method: width_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_width_defined00
+static int tolua_fltk_flvw_Flv_Style_width_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -68774,30 +73074,31 @@ static int tolua_fltk_flvw_Flv_Style_clear_border_spacing00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_border_spacing'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'width_defined'", NULL);
 #endif
  {
-  self->clear_border_spacing();
+  bool tolua_ret = (bool)  self->width_defined();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_border_spacing'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'width_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_editor of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_editor00
-static int tolua_fltk_flvw_Flv_Style_clear_editor00(lua_State* tolua_S)
+/* method: x_margin of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_x_margin00
+static int tolua_fltk_flvw_Flv_Style_x_margin00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
  )
  goto tolua_lerror;
  else
@@ -68805,24 +73106,35 @@ static int tolua_fltk_flvw_Flv_Style_clear_editor00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_editor'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'x_margin'", NULL);
 #endif
  {
-  self->clear_editor();
+ if(nparam < 2) {
+  int tolua_ret = (int)  self->x_margin();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
+ self->x_margin(opt);
+ return 0;
+ }
  }
  }
- return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_editor'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'x_margin'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_font of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_font00
-static int tolua_fltk_flvw_Flv_Style_clear_font00(lua_State* tolua_S)
+/* method: x_margin_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_x_margin_defined00
+static int tolua_fltk_flvw_Flv_Style_x_margin_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -68836,30 +73148,31 @@ static int tolua_fltk_flvw_Flv_Style_clear_font00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_font'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'x_margin_defined'", NULL);
 #endif
  {
-  self->clear_font();
+  bool tolua_ret = (bool)  self->x_margin_defined();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_font'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'x_margin_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_font_size of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_font_size00
-static int tolua_fltk_flvw_Flv_Style_clear_font_size00(lua_State* tolua_S)
+/* method: y_margin of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_y_margin00
+static int tolua_fltk_flvw_Flv_Style_y_margin00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
  )
  goto tolua_lerror;
  else
@@ -68867,24 +73180,35 @@ static int tolua_fltk_flvw_Flv_Style_clear_font_size00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_font_size'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'y_margin'", NULL);
 #endif
  {
-  self->clear_font_size();
+ if(nparam < 2) {
+  int tolua_ret = (int)  self->y_margin();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
+ self->y_margin(opt);
+ return 0;
+ }
  }
  }
- return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_font_size'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'y_margin'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_foreground of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_foreground00
-static int tolua_fltk_flvw_Flv_Style_clear_foreground00(lua_State* tolua_S)
+/* method: y_margin_defined of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_y_margin_defined00
+static int tolua_fltk_flvw_Flv_Style_y_margin_defined00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
@@ -68898,1457 +73222,1414 @@ static int tolua_fltk_flvw_Flv_Style_clear_foreground00(lua_State* tolua_S)
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_foreground'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'y_margin_defined'", NULL);
 #endif
  {
-  self->clear_foreground();
+  bool tolua_ret = (bool)  self->y_margin_defined();
+ tolua_pushboolean(tolua_S,(bool)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_foreground'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'y_margin_defined'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_frame of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_frame00
-static int tolua_fltk_flvw_Flv_Style_clear_frame00(lua_State* tolua_S)
+/* method: add of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_add00
+static int tolua_fltk_flvw_Flv_Style_add00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
  !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ (tolua_isvaluenil(tolua_S,2,&tolua_err) || !tolua_isusertype(tolua_S,2,"const Flv_Style",0,&tolua_err)) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
   Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  const Flv_Style* n = ((const Flv_Style*)  tolua_tousertype(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_frame'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'add'", NULL);
 #endif
  {
-  self->clear_frame();
+  const Flv_Style& tolua_ret = (const Flv_Style&)  self->add(*n);
+  tolua_pushusertype(tolua_S,(void*)&tolua_ret,"const Flv_Style");
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_frame'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'add'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_height of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_height00
-static int tolua_fltk_flvw_Flv_Style_clear_height00(lua_State* tolua_S)
+/* get function: cell_style of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_get_Flv_Style_cell_style
+static int tolua_get_Flv_Style_cell_style(lua_State* tolua_S)
+{
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in accessing variable 'cell_style'",NULL);
+#endif
+  tolua_pushusertype(tolua_S,(void*)&self->cell_style,"Flv_Style_List");
+ return 1;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* set function: cell_style of class  Flv_Style */
+#ifndef TOLUA_DISABLE_tolua_set_Flv_Style_cell_style
+static int tolua_set_Flv_Style_cell_style(lua_State* tolua_S)
+{
+  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (!self) tolua_error(tolua_S,"invalid 'self' in accessing variable 'cell_style'",NULL);
+ if ((tolua_isvaluenil(tolua_S,2,&tolua_err) || !tolua_isusertype(tolua_S,2,"Flv_Style_List",0,&tolua_err)))
+ tolua_error(tolua_S,"#vinvalid type in variable assignment.",&tolua_err);
+#endif
+  self->cell_style = *((Flv_Style_List*)  tolua_tousertype(tolua_S,2,0))
+;
+ return 0;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: new of class  Flv_CStyle */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_CStyle_new00
+static int tolua_fltk_flvw_Flv_CStyle_new00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isusertable(tolua_S,1,"Flv_CStyle",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
-#ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_height'", NULL);
-#endif
  {
-  self->clear_height();
+  Flv_CStyle* tolua_ret = (Flv_CStyle*)  Mtolua_new((Flv_CStyle)());
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_CStyle");
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_height'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_locked of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_locked00
-static int tolua_fltk_flvw_Flv_Style_clear_locked00(lua_State* tolua_S)
+/* method: new_local of class  Flv_CStyle */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_CStyle_new00_local
+static int tolua_fltk_flvw_Flv_CStyle_new00_local(lua_State* tolua_S)
+{
+ int result = tolua_fltk_flvw_Flv_CStyle_new00(tolua_S);
+ if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
+ return result;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: x of class  Flv_CStyle */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_CStyle_x00
+static int tolua_fltk_flvw_Flv_CStyle_x00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_CStyle",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_CStyle* self = (Flv_CStyle*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_locked'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'x'", NULL);
 #endif
  {
-  self->clear_locked();
+ if(nparam < 2) {
+  int tolua_ret = (int)  self->x();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
+ self->x(opt);
+ return 0;
+ }
  }
  }
- return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_locked'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'x'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_resizable of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_resizable00
-static int tolua_fltk_flvw_Flv_Style_clear_resizable00(lua_State* tolua_S)
+/* method: y of class  Flv_CStyle */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_CStyle_y00
+static int tolua_fltk_flvw_Flv_CStyle_y00(lua_State* tolua_S)
 {
+ int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_CStyle",0,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_CStyle* self = (Flv_CStyle*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_resizable'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'y'", NULL);
 #endif
  {
-  self->clear_resizable();
+ if(nparam < 2) {
+  int tolua_ret = (int)  self->y();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
+ return 1;
+ } else {
+#ifndef TOLUA_RELEASE
+ if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
+ ) goto tolua_lerror;
+#endif
+  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
+ self->y(opt);
+ return 0;
+ }
  }
  }
- return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_resizable'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'y'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_width of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_width00
-static int tolua_fltk_flvw_Flv_Style_clear_width00(lua_State* tolua_S)
+/* method: data_rows of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_data_rows00
+static int tolua_fltk_flvw_Flv_Data_Source_data_rows00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_width'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'data_rows'", NULL);
 #endif
  {
-  self->clear_width();
+  int tolua_ret = (int)  self->data_rows();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_width'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'data_rows'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_x_margin of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_x_margin00
-static int tolua_fltk_flvw_Flv_Style_clear_x_margin00(lua_State* tolua_S)
+/* method: data_cols of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_data_cols00
+static int tolua_fltk_flvw_Flv_Data_Source_data_cols00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_x_margin'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'data_cols'", NULL);
 #endif
  {
-  self->clear_x_margin();
+  int tolua_ret = (int)  self->data_cols();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_x_margin'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'data_cols'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: clear_y_margin of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_clear_y_margin00
-static int tolua_fltk_flvw_Flv_Style_clear_y_margin00(lua_State* tolua_S)
+/* method: data_number of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_data_number00
+static int tolua_fltk_flvw_Flv_Data_Source_data_number00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int R = ((int)  tolua_tonumber(tolua_S,2,0));
+  int C = ((int)  tolua_tonumber(tolua_S,3,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_y_margin'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'data_number'", NULL);
 #endif
  {
-  self->clear_y_margin();
+  double tolua_ret = (double)  self->data_number(R,C);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
- return 0;
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'clear_y_margin'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'data_number'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: editor of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_editor00
-static int tolua_fltk_flvw_Flv_Style_editor00(lua_State* tolua_S)
+/* method: data_type of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_data_type00
+static int tolua_fltk_flvw_Flv_Data_Source_data_type00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int C = ((int)  tolua_tonumber(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'editor'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'data_type'", NULL);
 #endif
  {
- if(nparam < 2) {
-  Fl_Widget* tolua_ret = (Fl_Widget*)  self->editor();
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Fl_Widget");
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isusertype(tolua_S,2,"Fl_Widget",0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  Fl_Widget* opt = ((Fl_Widget*)  tolua_tousertype(tolua_S,2,0));
- self->editor(opt);
- return 0;
- }
+  int tolua_ret = (int)  self->data_type(C);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'editor'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'data_type'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: editor_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_editor_defined00
-static int tolua_fltk_flvw_Flv_Style_editor_defined00(lua_State* tolua_S)
+/* method: data_name of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_data_name00
+static int tolua_fltk_flvw_Flv_Data_Source_data_name00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int C = ((int)  tolua_tonumber(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'editor_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'data_name'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->editor_defined();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  const char* tolua_ret = (const char*)  self->data_name(C);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'editor_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'data_name'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: font_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_font_defined00
-static int tolua_fltk_flvw_Flv_Style_font_defined00(lua_State* tolua_S)
+/* method: rows of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_rows00
+static int tolua_fltk_flvw_Flv_Data_Source_rows00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'font_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'rows'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->font_defined();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  int tolua_ret = (int)  self->rows();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'font_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'rows'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: font of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_font00
-static int tolua_fltk_flvw_Flv_Style_font00(lua_State* tolua_S)
+/* method: cols of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_cols00
+static int tolua_fltk_flvw_Flv_Data_Source_cols00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'font'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'cols'", NULL);
 #endif
  {
- if(nparam < 2) {
-   int tolua_ret = (  int)  self->font();
+  int tolua_ret = (int)  self->cols();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-   int opt = ((  int)  tolua_tonumber(tolua_S,2,0));
- self->font(opt);
- return 0;
- }
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'font'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'cols'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: font_size of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_font_size00
-static int tolua_fltk_flvw_Flv_Style_font_size00(lua_State* tolua_S)
+/* method: map_row of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_map_row00
+static int tolua_fltk_flvw_Flv_Data_Source_map_row00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int R = ((int)  tolua_tonumber(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'font_size'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'map_row'", NULL);
 #endif
  {
- if(nparam < 2) {
-  int tolua_ret = (int)  self->font_size();
+  int tolua_ret = (int)  self->map_row(R);
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
- self->font_size(opt);
- return 0;
- }
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'font_size'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'map_row'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: font_size_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_font_size_defined00
-static int tolua_fltk_flvw_Flv_Style_font_size_defined00(lua_State* tolua_S)
+/* method: map_col of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_map_col00
+static int tolua_fltk_flvw_Flv_Data_Source_map_col00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int C = ((int)  tolua_tonumber(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'font_size_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'map_col'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->font_size_defined();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  int tolua_ret = (int)  self->map_col(C);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'font_size_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'map_col'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: foreground of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_foreground00
-static int tolua_fltk_flvw_Flv_Style_foreground00(lua_State* tolua_S)
+/* method: flvw_Flv_Data_Source_as_string of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_as_string00
+static int tolua_fltk_flvw_Flv_Data_Source_as_string00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int R = ((int)  tolua_tonumber(tolua_S,2,0));
+  int C = ((int)  tolua_tonumber(tolua_S,3,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'foreground'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'flvw_Flv_Data_Source_as_string'", NULL);
 #endif
  {
- if(nparam < 2) {
-  unsigned int tolua_ret = ( unsigned int)  self->foreground();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  unsigned int opt = (( unsigned int)  tolua_tonumber(tolua_S,2,0));
- self->foreground(opt);
- return 0;
- }
+  tolua_outside  const char* tolua_ret = (tolua_outside  const char*)  flvw_Flv_Data_Source_as_string(self,R,C);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'foreground'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'as_string'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: foreground_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_foreground_defined00
-static int tolua_fltk_flvw_Flv_Style_foreground_defined00(lua_State* tolua_S)
+/* method: as_number of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_as_number00
+static int tolua_fltk_flvw_Flv_Data_Source_as_number00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int R = ((int)  tolua_tonumber(tolua_S,2,0));
+  int C = ((int)  tolua_tonumber(tolua_S,3,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'foreground_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'as_number'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->foreground_defined();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  double tolua_ret = (double)  self->as_number(R,C);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'foreground_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'as_number'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: frame_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_frame_defined00
-static int tolua_fltk_flvw_Flv_Style_frame_defined00(lua_State* tolua_S)
+/* method: col_name of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_col_name00
+static int tolua_fltk_flvw_Flv_Data_Source_col_name00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int C = ((int)  tolua_tonumber(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'frame_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'col_name'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->frame_defined();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  const char* tolua_ret = (const char*)  self->col_name(C);
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'frame_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'col_name'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: frame of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_frame00
-static int tolua_fltk_flvw_Flv_Style_frame00(lua_State* tolua_S)
+/* method: sort of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_sort00
+static int tolua_fltk_flvw_Flv_Data_Source_sort00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isboolean(tolua_S,3,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int C = ((int)  tolua_tonumber(tolua_S,2,0));
+  bool ascending = ((bool)  tolua_toboolean(tolua_S,3,true));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'frame'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'sort'", NULL);
 #endif
  {
- if(nparam < 2) {
-  Fl_Boxtype tolua_ret = (Fl_Boxtype)  self->frame();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  Fl_Boxtype opt = ((Fl_Boxtype) (int)  tolua_tonumber(tolua_S,2,0));
- self->frame(opt);
- return 0;
- }
+  self->sort(C,ascending);
  }
  }
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'frame'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'sort'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: height of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_height00
-static int tolua_fltk_flvw_Flv_Style_height00(lua_State* tolua_S)
+/* method: filter of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_filter00
+static int tolua_fltk_flvw_Flv_Data_Source_filter00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int C = ((int)  tolua_tonumber(tolua_S,2,0));
+  double lo = ((double)  tolua_tonumber(tolua_S,3,0));
+  double hi = ((double)  tolua_tonumber(tolua_S,4,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'height'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'filter'", NULL);
 #endif
  {
- if(nparam < 2) {
-  int tolua_ret = (int)  self->height();
+  int tolua_ret = (int)  self->filter(C,lo,hi);
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
- self->height(opt);
- return 0;
- }
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'height'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'filter'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: height_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_height_defined00
-static int tolua_fltk_flvw_Flv_Style_height_defined00(lua_State* tolua_S)
+/* method: filter of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_filter01
+static int tolua_fltk_flvw_Flv_Data_Source_filter01(lua_State* tolua_S)
 {
-#ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
-#endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int C = ((int)  tolua_tonumber(tolua_S,2,0));
+  const char* text = ((const char*)  tolua_tostring(tolua_S,3,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'height_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'filter'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->height_defined();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  int tolua_ret = (int)  self->filter(C,text);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
-#ifndef TOLUA_RELEASE
- tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'height_defined'.",&tolua_err);
- return 0;
-#endif
+tolua_lerror:
+ return tolua_fltk_flvw_Flv_Data_Source_filter00(tolua_S);
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: inner_bottom_border of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_inner_bottom_border00
-static int tolua_fltk_flvw_Flv_Style_inner_bottom_border00(lua_State* tolua_S)
+/* method: clear_row_map of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_clear_row_map00
+static int tolua_fltk_flvw_Flv_Data_Source_clear_row_map00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'inner_bottom_border'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_row_map'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->inner_bottom_border();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  self->clear_row_map();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'inner_bottom_border'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_row_map'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: inner_left_border of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_inner_left_border00
-static int tolua_fltk_flvw_Flv_Style_inner_left_border00(lua_State* tolua_S)
+/* method: flvw_Flv_Data_Source_row_map of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_row_map00
+static int tolua_fltk_flvw_Flv_Data_Source_row_map00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  lua_Object tbl = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'inner_left_border'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'flvw_Flv_Data_Source_row_map'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->inner_left_border();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  tolua_outside int tolua_ret = (tolua_outside int)  flvw_Flv_Data_Source_row_map(self,L,tbl);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'inner_left_border'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'row_map'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: inner_right_border of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_inner_right_border00
-static int tolua_fltk_flvw_Flv_Style_inner_right_border00(lua_State* tolua_S)
+/* method: flvw_Flv_Data_Source_col_map of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_col_map00
+static int tolua_fltk_flvw_Flv_Data_Source_col_map00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  lua_Object tbl = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'inner_right_border'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'flvw_Flv_Data_Source_col_map'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->inner_right_border();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  tolua_outside int tolua_ret = (tolua_outside int)  flvw_Flv_Data_Source_col_map(self,L,tbl);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'inner_right_border'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'col_map'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: inner_top_border of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_inner_top_border00
-static int tolua_fltk_flvw_Flv_Style_inner_top_border00(lua_State* tolua_S)
+/* method: clear_col_map of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_clear_col_map00
+static int tolua_fltk_flvw_Flv_Data_Source_clear_col_map00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'inner_top_border'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear_col_map'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->inner_top_border();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  self->clear_col_map();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'inner_top_border'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear_col_map'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: left_border of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_left_border00
-static int tolua_fltk_flvw_Flv_Style_left_border00(lua_State* tolua_S)
+/* method: data_changed of class  Flv_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Data_Source_data_changed00
+static int tolua_fltk_flvw_Flv_Data_Source_data_changed00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Data_Source",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* self = (Flv_Data_Source*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'left_border'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'data_changed'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->left_border();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  self->data_changed();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'left_border'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'data_changed'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: locked of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_locked00
-static int tolua_fltk_flvw_Flv_Style_locked00(lua_State* tolua_S)
+/* method: new of class  Flv_Array_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Array_Data_Source_new00
+static int tolua_fltk_flvw_Flv_Array_Data_Source_new00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
+ !tolua_isusertable(tolua_S,1,"Flv_Array_Data_Source",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
-#ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'locked'", NULL);
-#endif
  {
- if(nparam < 2) {
-  bool tolua_ret = (bool)  self->locked();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isboolean(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  bool opt = ((bool)  tolua_toboolean(tolua_S,2,0));
- self->locked(opt);
- return 0;
- }
+  Flv_Array_Data_Source* tolua_ret = (Flv_Array_Data_Source*)  Mtolua_new((Flv_Array_Data_Source)());
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Array_Data_Source");
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'locked'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: locked_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_locked_defined00
-static int tolua_fltk_flvw_Flv_Style_locked_defined00(lua_State* tolua_S)
+/* method: new_local of class  Flv_Array_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Array_Data_Source_new00_local
+static int tolua_fltk_flvw_Flv_Array_Data_Source_new00_local(lua_State* tolua_S)
+{
+ int result = tolua_fltk_flvw_Flv_Array_Data_Source_new00(tolua_S);
+ if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
+ return result;
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: delete of class  Flv_Array_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Array_Data_Source_delete00
+static int tolua_fltk_flvw_Flv_Array_Data_Source_delete00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Array_Data_Source",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Array_Data_Source* self = (Flv_Array_Data_Source*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'locked_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'delete'", NULL);
 #endif
- {
-  bool tolua_ret = (bool)  self->locked_defined();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
- }
+ Mtolua_delete(self);
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'locked_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'delete'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: resizable of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_resizable00
-static int tolua_fltk_flvw_Flv_Style_resizable00(lua_State* tolua_S)
+/* method: add_col of class  Flv_Array_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Array_Data_Source_add_col00
+static int tolua_fltk_flvw_Flv_Array_Data_Source_add_col00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Array_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,3,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Array_Data_Source* self = (Flv_Array_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int type = ((int)  tolua_tonumber(tolua_S,2,0));
+  const char* name = ((const char*)  tolua_tostring(tolua_S,3,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'resizable'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'add_col'", NULL);
 #endif
  {
- if(nparam < 2) {
-  bool tolua_ret = (bool)  self->resizable();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isboolean(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  bool opt = ((bool)  tolua_toboolean(tolua_S,2,0));
- self->resizable(opt);
- return 0;
- }
+  int tolua_ret = (int)  self->add_col(type,name);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'resizable'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'add_col'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: resizable_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_resizable_defined00
-static int tolua_fltk_flvw_Flv_Style_resizable_defined00(lua_State* tolua_S)
+/* method: data_rows of class  Flv_Array_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Array_Data_Source_set_data_rows00
+static int tolua_fltk_flvw_Flv_Array_Data_Source_set_data_rows00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Array_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Array_Data_Source* self = (Flv_Array_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int n = ((int)  tolua_tonumber(tolua_S,2,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'resizable_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'data_rows'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->resizable_defined();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  int tolua_ret = (int)  self->data_rows(n);
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'resizable_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'set_data_rows'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: right_border of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_right_border00
-static int tolua_fltk_flvw_Flv_Style_right_border00(lua_State* tolua_S)
+/* method: set_int of class  Flv_Array_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Array_Data_Source_set_int00
+static int tolua_fltk_flvw_Flv_Array_Data_Source_set_int00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Array_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Array_Data_Source* self = (Flv_Array_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int R = ((int)  tolua_tonumber(tolua_S,2,0));
+  int C = ((int)  tolua_tonumber(tolua_S,3,0));
+  int v = ((int)  tolua_tonumber(tolua_S,4,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'right_border'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'set_int'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->right_border();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  self->set_int(R,C,v);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'right_border'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'set_int'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: top_border of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_top_border00
-static int tolua_fltk_flvw_Flv_Style_top_border00(lua_State* tolua_S)
+/* method: set_double of class  Flv_Array_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Array_Data_Source_set_double00
+static int tolua_fltk_flvw_Flv_Array_Data_Source_set_double00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Array_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Array_Data_Source* self = (Flv_Array_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int R = ((int)  tolua_tonumber(tolua_S,2,0));
+  int C = ((int)  tolua_tonumber(tolua_S,3,0));
+  double v = ((double)  tolua_tonumber(tolua_S,4,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'top_border'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'set_double'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->top_border();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  self->set_double(R,C,v);
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'top_border'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'set_double'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: width of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_width00
-static int tolua_fltk_flvw_Flv_Style_width00(lua_State* tolua_S)
+/* method: set_string of class  Flv_Array_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Array_Data_Source_set_string00
+static int tolua_fltk_flvw_Flv_Array_Data_Source_set_string00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Array_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isstring(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Array_Data_Source* self = (Flv_Array_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  int R = ((int)  tolua_tonumber(tolua_S,2,0));
+  int C = ((int)  tolua_tonumber(tolua_S,3,0));
+  const char* v = ((const char*)  tolua_tostring(tolua_S,4,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'width'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'set_string'", NULL);
 #endif
  {
- if(nparam < 2) {
-  int tolua_ret = (int)  self->width();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
- self->width(opt);
- return 0;
- }
+  self->set_string(R,C,v);
  }
  }
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'width'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'set_string'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: width_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_width_defined00
-static int tolua_fltk_flvw_Flv_Style_width_defined00(lua_State* tolua_S)
+/* method: add_row of class  Flv_Array_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Array_Data_Source_add_row00
+static int tolua_fltk_flvw_Flv_Array_Data_Source_add_row00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Array_Data_Source",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Array_Data_Source* self = (Flv_Array_Data_Source*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'width_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'add_row'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->width_defined();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  int tolua_ret = (int)  self->add_row();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'width_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'add_row'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: x_margin of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_x_margin00
-static int tolua_fltk_flvw_Flv_Style_x_margin00(lua_State* tolua_S)
+/* method: flvw_Flv_Array_Data_Source_set_column of class  Flv_Array_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Array_Data_Source_set_column00
+static int tolua_fltk_flvw_Flv_Array_Data_Source_set_column00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Array_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Array_Data_Source* self = (Flv_Array_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+  lua_State* L =  tolua_S;
+  int C = ((int)  tolua_tonumber(tolua_S,2,0));
+  lua_Object tbl = ((lua_Object)  tolua_tovalue(tolua_S,3,0));
+  int R = ((int)  tolua_tonumber(tolua_S,4,0));
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'x_margin'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'flvw_Flv_Array_Data_Source_set_column'", NULL);
 #endif
  {
- if(nparam < 2) {
-  int tolua_ret = (int)  self->x_margin();
+  tolua_outside int tolua_ret = (tolua_outside int)  flvw_Flv_Array_Data_Source_set_column(self,L,C,tbl,R);
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
- self->x_margin(opt);
- return 0;
- }
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'x_margin'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'set_column'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: x_margin_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_x_margin_defined00
-static int tolua_fltk_flvw_Flv_Style_x_margin_defined00(lua_State* tolua_S)
+/* method: clear of class  Flv_Array_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Array_Data_Source_clear00
+static int tolua_fltk_flvw_Flv_Array_Data_Source_clear00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Array_Data_Source",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Array_Data_Source* self = (Flv_Array_Data_Source*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'x_margin_defined'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'clear'", NULL);
 #endif
  {
-  bool tolua_ret = (bool)  self->x_margin_defined();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  self->clear();
  }
  }
- return 1;
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'x_margin_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'clear'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: y_margin of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_y_margin00
-static int tolua_fltk_flvw_Flv_Style_y_margin00(lua_State* tolua_S)
+/* method: delete of class  Flv_Sqlite_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Sqlite_Data_Source_delete00
+static int tolua_fltk_flvw_Flv_Sqlite_Data_Source_delete00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Sqlite_Data_Source",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
-#ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'y_margin'", NULL);
-#endif
- {
- if(nparam < 2) {
-  int tolua_ret = (int)  self->y_margin();
- tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
+  Flv_Sqlite_Data_Source* self = (Flv_Sqlite_Data_Source*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'delete'", NULL);
 #endif
-  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
- self->y_margin(opt);
- return 0;
- }
- }
+ Mtolua_delete(self);
  }
+ return 0;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'y_margin'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'delete'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: y_margin_defined of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_y_margin_defined00
-static int tolua_fltk_flvw_Flv_Style_y_margin_defined00(lua_State* tolua_S)
+/* method: flvw_Flv_Sqlite_Data_Source_new of class  Flv_Sqlite_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Sqlite_Data_Source_new_local00
+static int tolua_fltk_flvw_Flv_Sqlite_Data_Source_new_local00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- !tolua_isnoobj(tolua_S,2,&tolua_err)
+ !tolua_isusertable(tolua_S,1,"Flv_Sqlite_Data_Source",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,1,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,1,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,5,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
-#ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'y_margin_defined'", NULL);
-#endif
+  lua_State* L =  tolua_S;
+  lua_Object vm = ((lua_Object)  tolua_tovalue(tolua_S,2,0));
+  int page_rows = ((int)  tolua_tonumber(tolua_S,3,64));
+  int max_pages = ((int)  tolua_tonumber(tolua_S,4,32));
  {
-  bool tolua_ret = (bool)  self->y_margin_defined();
- tolua_pushboolean(tolua_S,(bool)tolua_ret);
+  tolua_outside lua_Object tolua_ret = (tolua_outside lua_Object)  flvw_Flv_Sqlite_Data_Source_new(L,vm,page_rows,max_pages);
+ tolua_pushvalue(tolua_S,(int)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'y_margin_defined'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'new_local'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: add of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Style_add00
-static int tolua_fltk_flvw_Flv_Style_add00(lua_State* tolua_S)
+/* method: error of class  Flv_Sqlite_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Sqlite_Data_Source_error00
+static int tolua_fltk_flvw_Flv_Sqlite_Data_Source_error00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_Style",0,&tolua_err) ||
- (tolua_isvaluenil(tolua_S,2,&tolua_err) || !tolua_isusertype(tolua_S,2,"const Flv_Style",0,&tolua_err)) ||
- !tolua_isnoobj(tolua_S,3,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Sqlite_Data_Source",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
-  const Flv_Style* n = ((const Flv_Style*)  tolua_tousertype(tolua_S,2,0));
+  Flv_Sqlite_Data_Source* self = (Flv_Sqlite_Data_Source*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'add'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'error'", NULL);
 #endif
  {
-  const Flv_Style& tolua_ret = (const Flv_Style&)  self->add(*n);
-  tolua_pushusertype(tolua_S,(void*)&tolua_ret,"const Flv_Style");
+  const char* tolua_ret = (const char*)  self->error();
+ tolua_pushstring(tolua_S,(const char*)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'add'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'error'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* get function: cell_style of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_get_Flv_Style_cell_style
-static int tolua_get_Flv_Style_cell_style(lua_State* tolua_S)
-{
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
-#ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in accessing variable 'cell_style'",NULL);
-#endif
-  tolua_pushusertype(tolua_S,(void*)&self->cell_style,"Flv_Style_List");
- return 1;
-}
-#endif //#ifndef TOLUA_DISABLE
-
-/* set function: cell_style of class  Flv_Style */
-#ifndef TOLUA_DISABLE_tolua_set_Flv_Style_cell_style
-static int tolua_set_Flv_Style_cell_style(lua_State* tolua_S)
-{
-  Flv_Style* self = (Flv_Style*)  tolua_tousertype(tolua_S,1,0);
-#ifndef TOLUA_RELEASE
- tolua_Error tolua_err;
- if (!self) tolua_error(tolua_S,"invalid 'self' in accessing variable 'cell_style'",NULL);
- if ((tolua_isvaluenil(tolua_S,2,&tolua_err) || !tolua_isusertype(tolua_S,2,"Flv_Style_List",0,&tolua_err)))
- tolua_error(tolua_S,"#vinvalid type in variable assignment.",&tolua_err);
-#endif
-  self->cell_style = *((Flv_Style_List*)  tolua_tousertype(tolua_S,2,0))
-;
- return 0;
-}
-#endif //#ifndef TOLUA_DISABLE
-
-/* method: new of class  Flv_CStyle */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_CStyle_new00
-static int tolua_fltk_flvw_Flv_CStyle_new00(lua_State* tolua_S)
+/* method: page_rows of class  Flv_Sqlite_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Sqlite_Data_Source_page_rows00
+static int tolua_fltk_flvw_Flv_Sqlite_Data_Source_page_rows00(lua_State* tolua_S)
 {
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertable(tolua_S,1,"Flv_CStyle",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,1,"Flv_Sqlite_Data_Source",0,&tolua_err) ||
  !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
+  Flv_Sqlite_Data_Source* self = (Flv_Sqlite_Data_Source*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'page_rows'", NULL);
+#endif
  {
-  Flv_CStyle* tolua_ret = (Flv_CStyle*)  Mtolua_new((Flv_CStyle)());
-  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_CStyle");
+  int tolua_ret = (int)  self->page_rows();
+ tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
  }
  }
  return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'new'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'page_rows'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: new_local of class  Flv_CStyle */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_CStyle_new00_local
-static int tolua_fltk_flvw_Flv_CStyle_new00_local(lua_State* tolua_S)
-{
- int result = tolua_fltk_flvw_Flv_CStyle_new00(tolua_S);
- if(result) tolua_register_gc(tolua_S,lua_gettop(tolua_S));
- return result;
-}
-#endif //#ifndef TOLUA_DISABLE
-
-/* method: x of class  Flv_CStyle */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_CStyle_x00
-static int tolua_fltk_flvw_Flv_CStyle_x00(lua_State* tolua_S)
+/* method: max_pages of class  Flv_Sqlite_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Sqlite_Data_Source_max_pages00
+static int tolua_fltk_flvw_Flv_Sqlite_Data_Source_max_pages00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_CStyle",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Sqlite_Data_Source",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_CStyle* self = (Flv_CStyle*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Sqlite_Data_Source* self = (Flv_Sqlite_Data_Source*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'x'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'max_pages'", NULL);
 #endif
  {
- if(nparam < 2) {
-  int tolua_ret = (int)  self->x();
+  int tolua_ret = (int)  self->max_pages();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
- self->x(opt);
- return 0;
- }
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'x'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'max_pages'.",&tolua_err);
  return 0;
 #endif
 }
 #endif //#ifndef TOLUA_DISABLE
 
-/* method: y of class  Flv_CStyle */
-#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_CStyle_y00
-static int tolua_fltk_flvw_Flv_CStyle_y00(lua_State* tolua_S)
+/* method: cached_pages of class  Flv_Sqlite_Data_Source */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Sqlite_Data_Source_cached_pages00
+static int tolua_fltk_flvw_Flv_Sqlite_Data_Source_cached_pages00(lua_State* tolua_S)
 {
- int nparam = lua_gettop(tolua_S);
 #ifndef TOLUA_RELEASE
  tolua_Error tolua_err;
  if (
- !tolua_isusertype(tolua_S,1,"Flv_CStyle",0,&tolua_err)
+ !tolua_isusertype(tolua_S,1,"Flv_Sqlite_Data_Source",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
  )
  goto tolua_lerror;
  else
 #endif
  {
-  Flv_CStyle* self = (Flv_CStyle*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Sqlite_Data_Source* self = (Flv_Sqlite_Data_Source*)  tolua_tousertype(tolua_S,1,0);
 #ifndef TOLUA_RELEASE
- if (!self) tolua_error(tolua_S,"invalid 'self' in function 'y'", NULL);
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'cached_pages'", NULL);
 #endif
  {
- if(nparam < 2) {
-  int tolua_ret = (int)  self->y();
+  int tolua_ret = (int)  self->cached_pages();
  tolua_pushnumber(tolua_S,(lua_Number)tolua_ret);
- return 1;
- } else {
-#ifndef TOLUA_RELEASE
- if ( !tolua_isnumber(tolua_S,2,0,&tolua_err) || !tolua_isnoobj(tolua_S, 3,&tolua_err)
- ) goto tolua_lerror;
-#endif
-  int opt = ((int)  tolua_tonumber(tolua_S,2,0));
- self->y(opt);
- return 0;
- }
  }
  }
+ return 1;
 #ifndef TOLUA_RELEASE
  tolua_lerror:
- tolua_error(tolua_S,"#ferror in function 'y'.",&tolua_err);
+ tolua_error(tolua_S,"#ferror in function 'cached_pages'.",&tolua_err);
  return 0;
 #endif
 }
@@ -71448,6 +75729,41 @@ static int tolua_fltk_flvw_Flv_List_position_editor00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: redraw_rows of class  Flv_List */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_List_redraw_rows00
+static int tolua_fltk_flvw_Flv_List_redraw_rows00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Flv_List",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Flv_List* self = (Flv_List*)  tolua_tousertype(tolua_S,1,0);
+  int r1 = ((int)  tolua_tonumber(tolua_S,2,0));
+  int r2 = ((int)  tolua_tonumber(tolua_S,3,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'redraw_rows'", NULL);
+#endif
+ {
+  self->redraw_rows(r1,r2);
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'redraw_rows'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: row of class  Flv_List */
 #ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_List_row00
 static int tolua_fltk_flvw_Flv_List_row00(lua_State* tolua_S)
@@ -72303,7 +76619,7 @@ static int tolua_fltk_flvw_Flv_List_handle00(lua_State* tolua_S)
  class Lua__Flv_List : public Flv_List, public ToluaBase {
 public:
 	 void  draw_row( int Offset, int& X, int& Y, int& W, int& H, int R) {
-		if (push_method("draw_row",  NULL)) {
+		if (push_method(0, "draw_row",  NULL)) {
 			tolua_pushnumber(lua_state, (lua_Number)Offset);
 			tolua_pushnumber(lua_state, (lua_Number)X);
 			tolua_pushnumber(lua_state, (lua_Number)Y);
@@ -72316,7 +76632,7 @@ public:
 		};
 	};
 	 bool  get_cell_bounds( int& X, int& Y, int& W, int& H, int R, int C = 0) {
-		if (push_method("get_cell_bounds",  tolua_fltk_flvw_Flv_List_get_cell_bounds00)) {
+		if (push_method(1, "get_cell_bounds",  tolua_fltk_flvw_Flv_List_get_cell_bounds00)) {
 			tolua_pushnumber(lua_state, (lua_Number)X);
 			tolua_pushnumber(lua_state, (lua_Number)Y);
 			tolua_pushnumber(lua_state, (lua_Number)W);
@@ -72332,7 +76648,7 @@ public:
 		};
 	};
 	 void  get_style( Flv_Style& s, int R, int C = 0) {
-		if (push_method("get_style",  tolua_fltk_flvw_Flv_List_get_style00)) {
+		if (push_method(2, "get_style",  tolua_fltk_flvw_Flv_List_get_style00)) {
 			tolua_pushusertype(lua_state, (void*)&s, "Flv_Style");
 			tolua_pushnumber(lua_state, (lua_Number)R);
 			tolua_pushnumber(lua_state, (lua_Number)C);
@@ -72342,7 +76658,7 @@ public:
 		};
 	};
 	 void  load_editor( Fl_Widget* e, int R, int C = 0) {
-		if (push_method("load_editor",  tolua_fltk_flvw_Flv_List_load_editor00)) {
+		if (push_method(3, "load_editor",  tolua_fltk_flvw_Flv_List_load_editor00)) {
 			tolua_pushusertype(lua_state, (void*)e, "Fl_Widget");
 			tolua_pushnumber(lua_state, (lua_Number)R);
 			tolua_pushnumber(lua_state, (lua_Number)C);
@@ -72352,7 +76668,7 @@ public:
 		};
 	};
 	 void  position_editor( Fl_Widget* e, int x, int y, int w, int h, Flv_Style& s) {
-		if (push_method("position_editor",  tolua_fltk_flvw_Flv_List_position_editor00)) {
+		if (push_method(4, "position_editor",  tolua_fltk_flvw_Flv_List_position_editor00)) {
 			tolua_pushusertype(lua_state, (void*)e, "Fl_Widget");
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
@@ -72365,7 +76681,7 @@ public:
 		};
 	};
 	 int  row_height( int n) {
-		if (push_method("row_height",  tolua_fltk_flvw_Flv_List_row_height00)) {
+		if (push_method(5, "row_height",  tolua_fltk_flvw_Flv_List_row_height00)) {
 			tolua_pushnumber(lua_state, (lua_Number)n);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -72376,7 +76692,7 @@ public:
 		};
 	};
 	 int  row_height( int n, int R) {
-		if (push_method("set_row_height",  tolua_fltk_flvw_Flv_List_set_row_height00)) {
+		if (push_method(6, "set_row_height",  tolua_fltk_flvw_Flv_List_set_row_height00)) {
 			tolua_pushnumber(lua_state, (lua_Number)n);
 			tolua_pushnumber(lua_state, (lua_Number)R);
 			ToluaBase::dbcall(lua_state, 3, 1);
@@ -72388,7 +76704,7 @@ public:
 		};
 	};
 	 void  save_editor( Fl_Widget* e, int R, int C = 0) {
-		if (push_method("save_editor",  tolua_fltk_flvw_Flv_List_save_editor00)) {
+		if (push_method(7, "save_editor",  tolua_fltk_flvw_Flv_List_save_editor00)) {
 			tolua_pushusertype(lua_state, (void*)e, "Fl_Widget");
 			tolua_pushnumber(lua_state, (lua_Number)R);
 			tolua_pushnumber(lua_state, (lua_Number)C);
@@ -72398,7 +76714,7 @@ public:
 		};
 	};
 	 int  handle( int event) {
-		if (push_method("handle",  tolua_fltk_flvw_Flv_List_handle00)) {
+		if (push_method(8, "handle",  tolua_fltk_flvw_Flv_List_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)event);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -72409,7 +76725,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(9, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -72419,7 +76735,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(10, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -72429,7 +76745,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(11, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -72438,21 +76754,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(12, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Flv_List:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(13, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Flv_List:: hide();
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
+		if (push_method(14, "resize",  tolua_fltk_fltk_Fl_Widget_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -72463,7 +76779,7 @@ public:
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(15, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Flv_List:: show();
@@ -73441,6 +77757,98 @@ static int tolua_fltk_flvw_Flv_Table_col_selected00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: data_source of class  Flv_Table */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Table_data_source00
+static int tolua_fltk_flvw_Flv_Table_data_source00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Flv_Table",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Flv_Table* self = (Flv_Table*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'data_source'", NULL);
+#endif
+ {
+  Flv_Data_Source* tolua_ret = (Flv_Data_Source*)  self->data_source();
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Data_Source");
+ }
+ }
+ return 1;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'data_source'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: data_source of class  Flv_Table */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Table_data_source01
+static int tolua_fltk_flvw_Flv_Table_data_source01(lua_State* tolua_S)
+{
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Flv_Table",0,&tolua_err) ||
+ !tolua_isusertype(tolua_S,2,"Flv_Data_Source",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,3,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+ {
+  Flv_Table* self = (Flv_Table*)  tolua_tousertype(tolua_S,1,0);
+  Flv_Data_Source* v = ((Flv_Data_Source*)  tolua_tousertype(tolua_S,2,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'data_source'", NULL);
+#endif
+ {
+  Flv_Data_Source* tolua_ret = (Flv_Data_Source*)  self->data_source(v);
+  tolua_pushusertype(tolua_S,(void*)tolua_ret,"Flv_Data_Source");
+ }
+ }
+ return 1;
+tolua_lerror:
+ return tolua_fltk_flvw_Flv_Table_data_source00(tolua_S);
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: data_changed of class  Flv_Table */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Table_data_changed00
+static int tolua_fltk_flvw_Flv_Table_data_changed00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Flv_Table",0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,2,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Flv_Table* self = (Flv_Table*)  tolua_tousertype(tolua_S,1,0);
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'data_changed'", NULL);
+#endif
+ {
+  self->data_changed();
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'data_changed'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: col_width of class  Flv_Table */
 #ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Table_col_width00
 static int tolua_fltk_flvw_Flv_Table_col_width00(lua_State* tolua_S)
@@ -73857,6 +78265,80 @@ static int tolua_fltk_flvw_Flv_Table_move_row00(lua_State* tolua_S)
 }
 #endif //#ifndef TOLUA_DISABLE
 
+/* method: redraw_cell of class  Flv_Table */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Table_redraw_cell00
+static int tolua_fltk_flvw_Flv_Table_redraw_cell00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Flv_Table",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,4,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Flv_Table* self = (Flv_Table*)  tolua_tousertype(tolua_S,1,0);
+  int R = ((int)  tolua_tonumber(tolua_S,2,0));
+  int C = ((int)  tolua_tonumber(tolua_S,3,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'redraw_cell'", NULL);
+#endif
+ {
+  self->redraw_cell(R,C);
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'redraw_cell'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
+/* method: redraw_cells of class  Flv_Table */
+#ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Table_redraw_cells00
+static int tolua_fltk_flvw_Flv_Table_redraw_cells00(lua_State* tolua_S)
+{
+#ifndef TOLUA_RELEASE
+ tolua_Error tolua_err;
+ if (
+ !tolua_isusertype(tolua_S,1,"Flv_Table",0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,2,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,3,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,4,0,&tolua_err) ||
+ !tolua_isnumber(tolua_S,5,0,&tolua_err) ||
+ !tolua_isnoobj(tolua_S,6,&tolua_err)
+ )
+ goto tolua_lerror;
+ else
+#endif
+ {
+  Flv_Table* self = (Flv_Table*)  tolua_tousertype(tolua_S,1,0);
+  int r1 = ((int)  tolua_tonumber(tolua_S,2,0));
+  int c1 = ((int)  tolua_tonumber(tolua_S,3,0));
+  int r2 = ((int)  tolua_tonumber(tolua_S,4,0));
+  int c2 = ((int)  tolua_tonumber(tolua_S,5,0));
+#ifndef TOLUA_RELEASE
+ if (!self) tolua_error(tolua_S,"invalid 'self' in function 'redraw_cells'", NULL);
+#endif
+ {
+  self->redraw_cells(r1,c1,r2,c2);
+ }
+ }
+ return 0;
+#ifndef TOLUA_RELEASE
+ tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'redraw_cells'.",&tolua_err);
+ return 0;
+#endif
+}
+#endif //#ifndef TOLUA_DISABLE
+
 /* method: row of class  Flv_Table */
 #ifndef TOLUA_DISABLE_tolua_fltk_flvw_Flv_Table_row00
 static int tolua_fltk_flvw_Flv_Table_row00(lua_State* tolua_S)
@@ -74110,7 +78592,7 @@ static int tolua_fltk_flvw_Flv_Table_handle00(lua_State* tolua_S)
  class Lua__Flv_Table : public Flv_Table, public ToluaBase {
 public:
 	 void  draw_cell( int Offset, int& X, int& Y, int& W, int& H, int R, int C) {
-		if (push_method("draw_cell",  NULL)) {
+		if (push_method(0, "draw_cell",  NULL)) {
 			tolua_pushnumber(lua_state, (lua_Number)Offset);
 			tolua_pushnumber(lua_state, (lua_Number)X);
 			tolua_pushnumber(lua_state, (lua_Number)Y);
@@ -74124,7 +78606,7 @@ public:
 		};
 	};
 	 int  col_width( int c) {
-		if (push_method("col_width",  tolua_fltk_flvw_Flv_Table_col_width00)) {
+		if (push_method(1, "col_width",  tolua_fltk_flvw_Flv_Table_col_width00)) {
 			tolua_pushnumber(lua_state, (lua_Number)c);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -74135,7 +78617,7 @@ public:
 		};
 	};
 	 int  col_width( int n, int c) {
-		if (push_method("set_col_width",  tolua_fltk_flvw_Flv_Table_set_col_width00)) {
+		if (push_method(2, "set_col_width",  tolua_fltk_flvw_Flv_Table_set_col_width00)) {
 			tolua_pushnumber(lua_state, (lua_Number)n);
 			tolua_pushnumber(lua_state, (lua_Number)c);
 			ToluaBase::dbcall(lua_state, 3, 1);
@@ -74147,7 +78629,7 @@ public:
 		};
 	};
 	 void  get_style( Flv_Style& s, int R, int C = 0) {
-		if (push_method("get_style",  tolua_fltk_flvw_Flv_Table_get_style00)) {
+		if (push_method(3, "get_style",  tolua_fltk_flvw_Flv_Table_get_style00)) {
 			tolua_pushusertype(lua_state, (void*)&s, "Flv_Style");
 			tolua_pushnumber(lua_state, (lua_Number)R);
 			tolua_pushnumber(lua_state, (lua_Number)C);
@@ -74157,7 +78639,7 @@ public:
 		};
 	};
 	 void  resize( int x, int y, int w, int h) {
-		if (push_method("resize",  tolua_fltk_flvw_Flv_Table_resize00)) {
+		if (push_method(4, "resize",  tolua_fltk_flvw_Flv_Table_resize00)) {
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
 			tolua_pushnumber(lua_state, (lua_Number)w);
@@ -74168,7 +78650,7 @@ public:
 		};
 	};
 	 int  handle( int event) {
-		if (push_method("handle",  tolua_fltk_flvw_Flv_Table_handle00)) {
+		if (push_method(5, "handle",  tolua_fltk_flvw_Flv_Table_handle00)) {
 			tolua_pushnumber(lua_state, (lua_Number)event);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -74179,7 +78661,7 @@ public:
 		};
 	};
 	 void  draw_row( int Offset, int& X, int& Y, int& W, int& H, int R) {
-		if (push_method("draw_row",  NULL)) {
+		if (push_method(6, "draw_row",  NULL)) {
 			tolua_pushnumber(lua_state, (lua_Number)Offset);
 			tolua_pushnumber(lua_state, (lua_Number)X);
 			tolua_pushnumber(lua_state, (lua_Number)Y);
@@ -74192,7 +78674,7 @@ public:
 		};
 	};
 	 bool  get_cell_bounds( int& X, int& Y, int& W, int& H, int R, int C = 0) {
-		if (push_method("get_cell_bounds",  tolua_fltk_flvw_Flv_List_get_cell_bounds00)) {
+		if (push_method(7, "get_cell_bounds",  tolua_fltk_flvw_Flv_List_get_cell_bounds00)) {
 			tolua_pushnumber(lua_state, (lua_Number)X);
 			tolua_pushnumber(lua_state, (lua_Number)Y);
 			tolua_pushnumber(lua_state, (lua_Number)W);
@@ -74208,7 +78690,7 @@ public:
 		};
 	};
 	 void  load_editor( Fl_Widget* e, int R, int C = 0) {
-		if (push_method("load_editor",  tolua_fltk_flvw_Flv_List_load_editor00)) {
+		if (push_method(8, "load_editor",  tolua_fltk_flvw_Flv_List_load_editor00)) {
 			tolua_pushusertype(lua_state, (void*)e, "Fl_Widget");
 			tolua_pushnumber(lua_state, (lua_Number)R);
 			tolua_pushnumber(lua_state, (lua_Number)C);
@@ -74218,7 +78700,7 @@ public:
 		};
 	};
 	 void  position_editor( Fl_Widget* e, int x, int y, int w, int h, Flv_Style& s) {
-		if (push_method("position_editor",  tolua_fltk_flvw_Flv_List_position_editor00)) {
+		if (push_method(9, "position_editor",  tolua_fltk_flvw_Flv_List_position_editor00)) {
 			tolua_pushusertype(lua_state, (void*)e, "Fl_Widget");
 			tolua_pushnumber(lua_state, (lua_Number)x);
 			tolua_pushnumber(lua_state, (lua_Number)y);
@@ -74231,7 +78713,7 @@ public:
 		};
 	};
 	 int  row_height( int n) {
-		if (push_method("row_height",  tolua_fltk_flvw_Flv_List_row_height00)) {
+		if (push_method(10, "row_height",  tolua_fltk_flvw_Flv_List_row_height00)) {
 			tolua_pushnumber(lua_state, (lua_Number)n);
 			ToluaBase::dbcall(lua_state, 2, 1);
 			 int  tolua_ret = ( int )tolua_tonumber(lua_state, -1, 0);
@@ -74242,7 +78724,7 @@ public:
 		};
 	};
 	 void  save_editor( Fl_Widget* e, int R, int C = 0) {
-		if (push_method("save_editor",  tolua_fltk_flvw_Flv_List_save_editor00)) {
+		if (push_method(11, "save_editor",  tolua_fltk_flvw_Flv_List_save_editor00)) {
 			tolua_pushusertype(lua_state, (void*)e, "Fl_Widget");
 			tolua_pushnumber(lua_state, (lua_Number)R);
 			tolua_pushnumber(lua_state, (lua_Number)C);
@@ -74252,7 +78734,7 @@ public:
 		};
 	};
 	 Fl_Group*  as_group( void ) {
-		if (push_method("as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
+		if (push_method(12, "as_group",  tolua_fltk_fltk_Fl_Group_as_group00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Group*  tolua_ret = ( Fl_Group* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -74262,7 +78744,7 @@ public:
 		};
 	};
 	 Fl_Window*  as_window( void ) {
-		if (push_method("as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
+		if (push_method(13, "as_window",  tolua_fltk_fltk_Fl_Widget_as_window00)) {
 			ToluaBase::dbcall(lua_state, 1, 1);
 			 Fl_Window*  tolua_ret = ( Fl_Window* )tolua_tousertype(lua_state, -1, 0);
 			lua_pop(lua_state, 1);
@@ -74272,7 +78754,7 @@ public:
 		};
 	};
 	 void  do_callback( Fl_Widget* o, void* arg = 0) {
-		if (push_method("do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
+		if (push_method(14, "do_callback",  tolua_fltk_fltk_Fl_Widget_do_callback00)) {
 			tolua_pushusertype(lua_state, (void*)o, "Fl_Widget");
 			tolua_pushuserdata(lua_state, (void*)arg);
 			ToluaBase::dbcall(lua_state, 3, 0);
@@ -74281,21 +78763,21 @@ public:
 		};
 	};
 	 void  draw( void ) {
-		if (push_method("draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
+		if (push_method(15, "draw",  tolua_fltk_fltk_Fl_Widget_draw00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Flv_Table:: draw();
 		};
 	};
 	 void  hide( void ) {
-		if (push_method("hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
+		if (push_method(16, "hide",  tolua_fltk_fltk_Fl_Widget_hide00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Flv_Table:: hide();
 		};
 	};
 	 void  show( void ) {
-		if (push_method("show",  tolua_fltk_fltk_Fl_Widget_show00)) {
+		if (push_method(17, "show",  tolua_fltk_fltk_Fl_Widget_show00)) {
 			ToluaBase::dbcall(lua_state, 1, 0);
 		} else {
 			 Flv_Table:: show();
@@ -75495,6 +79977,7 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"new_local",tolua_fltk_fltk_Fl_Browser_new00_local);
    tolua_function(tolua_S,".call",tolua_fltk_fltk_Fl_Browser_new00_local);
    tolua_function(tolua_S,"add",tolua_fltk_fltk_Fl_Browser_add00);
+   tolua_function(tolua_S,"add_lines",tolua_fltk_fltk_Fl_Browser_add_lines00);
    tolua_function(tolua_S,"bottomline",tolua_fltk_fltk_Fl_Browser_bottomline00);
    tolua_function(tolua_S,"clear",tolua_fltk_fltk_Fl_Browser_clear00);
    tolua_function(tolua_S,"column_char",tolua_fltk_fltk_Fl_Browser_column_char00);
@@ -75539,6 +80022,43 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,".call",tolua_fltk_fltk_Lua__Fl_Browser_new00_local);
   tolua_endmodule(tolua_S);
   #ifdef __cplusplus
+  tolua_cclass(tolua_S,"Fl_Virtual_Browser","Fl_Virtual_Browser","Fl_Browser_",tolua_collect_Fl_Virtual_Browser);
+  #else
+  tolua_cclass(tolua_S,"Fl_Virtual_Browser","Fl_Virtual_Browser","Fl_Browser_",NULL);
+  #endif
+  tolua_beginmodule(tolua_S,"Fl_Virtual_Browser");
+   tolua_function(tolua_S,"new",tolua_fltk_fltk_Fl_Virtual_Browser_new00);
+   tolua_function(tolua_S,"new_local",tolua_fltk_fltk_Fl_Virtual_Browser_new00_local);
+   tolua_function(tolua_S,".call",tolua_fltk_fltk_Fl_Virtual_Browser_new00_local);
+   tolua_function(tolua_S,"delete",tolua_fltk_fltk_Fl_Virtual_Browser_delete00);
+   tolua_function(tolua_S,"size",tolua_fltk_fltk_Fl_Virtual_Browser_size02);
+   tolua_function(tolua_S,"lines",tolua_fltk_fltk_Fl_Virtual_Browser_lines00);
+   tolua_function(tolua_S,"data_source",tolua_fltk_fltk_Fl_Virtual_Browser_data_source00);
+   tolua_function(tolua_S,"data_changed",tolua_fltk_fltk_Fl_Virtual_Browser_data_changed00);
+   tolua_function(tolua_S,"text",tolua_fltk_fltk_Fl_Virtual_Browser_text00);
+   tolua_function(tolua_S,"line_height",tolua_fltk_fltk_Fl_Virtual_Browser_line_height00);
+   tolua_function(tolua_S,"column_char",tolua_fltk_fltk_Fl_Virtual_Browser_column_char00);
+   tolua_function(tolua_S,"get_column_widths",tolua_fltk_fltk_Fl_Virtual_Browser_get_column_widths00);
+   tolua_function(tolua_S,"set_column_widths",tolua_fltk_fltk_Fl_Virtual_Browser_set_column_widths00);
+   tolua_function(tolua_S,"display",tolua_fltk_fltk_Fl_Virtual_Browser_display00);
+   tolua_function(tolua_S,"topline",tolua_fltk_fltk_Fl_Virtual_Browser_topline00);
+   tolua_function(tolua_S,"value",tolua_fltk_fltk_Fl_Virtual_Browser_value00);
+   tolua_function(tolua_S,"handle",tolua_fltk_fltk_Fl_Virtual_Browser_handle00);
+  tolua_endmodule(tolua_S);
+  #ifdef __cplusplus
+  tolua_cclass(tolua_S,"Lua__Fl_Virtual_Browser","Lua__Fl_Virtual_Browser","Fl_Virtual_Browser",tolua_collect_Lua__Fl_Virtual_Browser);
+  #else
+  tolua_cclass(tolua_S,"Lua__Fl_Virtual_Browser","Lua__Fl_Virtual_Browser","Fl_Virtual_Browser",NULL);
+  #endif
+  tolua_beginmodule(tolua_S,"Lua__Fl_Virtual_Browser");
+   tolua_function(tolua_S,"tolua__set_instance",tolua_fltk_fltk_Lua__Fl_Virtual_Browser_tolua__set_instance00);
+   tolua_function(tolua_S,"Fl_Virtual_Browser__handle",tolua_fltk_fltk_Lua__Fl_Virtual_Browser_Fl_Virtual_Browser__handle00);
+   tolua_function(tolua_S,"new",tolua_fltk_fltk_Lua__Fl_Virtual_Browser_new00);
+   tolua_function(tolua_S,"new_local",tolua_fltk_fltk_Lua__Fl_Virtual_Browser_new00_local);
+   tolua_function(tolua_S,".call",tolua_fltk_fltk_Lua__Fl_Virtual_Browser_new00_local);
+   tolua_function(tolua_S,"delete",tolua_fltk_fltk_Lua__Fl_Virtual_Browser_delete00);
+  tolua_endmodule(tolua_S);
+  #ifdef __cplusplus
   tolua_cclass(tolua_S,"Fl_Button","Fl_Button","Fl_Widget",tolua_collect_Fl_Button);
   #else
   tolua_cclass(tolua_S,"Fl_Button","Fl_Button","Fl_Widget",NULL);
@@ -75850,6 +80370,7 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"td_bottom_gap",tolua_fltk_fltk_Fl_Help_View_td_bottom_gap00);
    tolua_function(tolua_S,"tr_gap",tolua_fltk_fltk_Fl_Help_View_tr_gap00);
    tolua_function(tolua_S,"line31",tolua_fltk_fltk_Fl_Help_View_line3100);
+   tolua_function(tolua_S,"async_images",tolua_fltk_fltk_Fl_Help_View_async_images00);
   tolua_endmodule(tolua_S);
   #ifdef __cplusplus
   tolua_cclass(tolua_S,"Fl_Hold_Browser","Fl_Hold_Browser","Fl_Browser",tolua_collect_Fl_Hold_Browser);
@@ -75883,6 +80404,7 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"new",tolua_fltk_fltk_Fl_Image_new00);
    tolua_function(tolua_S,"new_local",tolua_fltk_fltk_Fl_Image_new00_local);
    tolua_function(tolua_S,".call",tolua_fltk_fltk_Fl_Image_new00_local);
+   tolua_function(tolua_S,"delete",tolua_fltk_fltk_Fl_Image_delete00);
    tolua_function(tolua_S,"color_average",tolua_fltk_fltk_Fl_Image_color_average00);
    tolua_function(tolua_S,"copy",tolua_fltk_fltk_Fl_Image_copy01);
    tolua_function(tolua_S,"count",tolua_fltk_fltk_Fl_Image_count00);
@@ -75912,6 +80434,7 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"new",tolua_fltk_fltk_Lua__Fl_Image_new00);
    tolua_function(tolua_S,"new_local",tolua_fltk_fltk_Lua__Fl_Image_new00_local);
    tolua_function(tolua_S,".call",tolua_fltk_fltk_Lua__Fl_Image_new00_local);
+   tolua_function(tolua_S,"delete",tolua_fltk_fltk_Lua__Fl_Image_delete00);
   tolua_endmodule(tolua_S);
   tolua_cclass(tolua_S,"Fl_Pixmap","Fl_Pixmap","Fl_Image",NULL);
   tolua_beginmodule(tolua_S,"Fl_Pixmap");
@@ -76486,6 +81009,10 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"minimum",tolua_fltk_fltk_Fl_Progress_minimum00);
    tolua_function(tolua_S,"value",tolua_fltk_fltk_Fl_Progress_value00);
   tolua_endmodule(tolua_S);
+  tolua_constant(tolua_S,"FL_RGB_SCALING_NEAREST",FL_RGB_SCALING_NEAREST);
+  tolua_constant(tolua_S,"FL_RGB_SCALING_BOX",FL_RGB_SCALING_BOX);
+  tolua_constant(tolua_S,"FL_RGB_SCALING_BILINEAR",FL_RGB_SCALING_BILINEAR);
+  tolua_constant(tolua_S,"FL_RGB_SCALING_LANCZOS",FL_RGB_SCALING_LANCZOS);
   #ifdef __cplusplus
   tolua_cclass(tolua_S,"Fl_RGB_Image","Fl_RGB_Image","Fl_Image",tolua_collect_Fl_RGB_Image);
   #else
@@ -76496,10 +81023,11 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"new_local",tolua_fltk_fltk_Fl_RGB_Image_new00_local);
    tolua_function(tolua_S,".call",tolua_fltk_fltk_Fl_RGB_Image_new00_local);
    tolua_function(tolua_S,"color_average",tolua_fltk_fltk_Fl_RGB_Image_color_average00);
-   tolua_function(tolua_S,"copy",tolua_fltk_fltk_Fl_RGB_Image_copy01);
+   tolua_function(tolua_S,"copy",tolua_fltk_fltk_Fl_RGB_Image_copy02);
    tolua_function(tolua_S,"desaturate",tolua_fltk_fltk_Fl_RGB_Image_desaturate00);
    tolua_function(tolua_S,"draw",tolua_fltk_fltk_Fl_RGB_Image_draw01);
    tolua_function(tolua_S,"label",tolua_fltk_fltk_Fl_RGB_Image_label01);
+   tolua_function(tolua_S,"scaling",tolua_fltk_fltk_Fl_RGB_Image_scaling01);
    tolua_function(tolua_S,"uncache",tolua_fltk_fltk_Fl_RGB_Image_uncache00);
   tolua_endmodule(tolua_S);
   #ifdef __cplusplus
@@ -76706,14 +81234,22 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
   tolua_cclass(tolua_S,"Fl_Shared_Image","Fl_Shared_Image","Fl_Image",NULL);
   tolua_beginmodule(tolua_S,"Fl_Shared_Image");
    tolua_function(tolua_S,"add_handler",tolua_fltk_fltk_Fl_Shared_Image_add_handler00);
+   tolua_function(tolua_S,"cache_bytes",tolua_fltk_fltk_Fl_Shared_Image_cache_bytes00);
+   tolua_function(tolua_S,"cache_evictions",tolua_fltk_fltk_Fl_Shared_Image_cache_evictions00);
+   tolua_function(tolua_S,"cache_hits",tolua_fltk_fltk_Fl_Shared_Image_cache_hits00);
+   tolua_function(tolua_S,"cache_misses",tolua_fltk_fltk_Fl_Shared_Image_cache_misses00);
+   tolua_function(tolua_S,"cache_size",tolua_fltk_fltk_Fl_Shared_Image_cache_size01);
+   tolua_function(tolua_S,"clear_cache_stats",tolua_fltk_fltk_Fl_Shared_Image_clear_cache_stats00);
    tolua_function(tolua_S,"color_average",tolua_fltk_fltk_Fl_Shared_Image_color_average00);
    tolua_function(tolua_S,"copy",tolua_fltk_fltk_Fl_Shared_Image_copy01);
    tolua_function(tolua_S,"desaturate",tolua_fltk_fltk_Fl_Shared_Image_desaturate00);
    tolua_function(tolua_S,"draw",tolua_fltk_fltk_Fl_Shared_Image_draw01);
    tolua_function(tolua_S,"find",tolua_fltk_fltk_Fl_Shared_Image_find00);
    tolua_function(tolua_S,"get",tolua_fltk_fltk_Fl_Shared_Image_get00);
+   tolua_function(tolua_S,"loading",tolua_fltk_fltk_Fl_Shared_Image_loading00);
    tolua_function(tolua_S,"name",tolua_fltk_fltk_Fl_Shared_Image_name00);
    tolua_function(tolua_S,"num_images",tolua_fltk_fltk_Fl_Shared_Image_num_images00);
+   tolua_function(tolua_S,"probe",tolua_fltk_fltk_Fl_Shared_Image_probe00);
    tolua_function(tolua_S,"refcount",tolua_fltk_fltk_Fl_Shared_Image_refcount00);
    tolua_function(tolua_S,"release",tolua_fltk_fltk_Fl_Shared_Image_release00);
    tolua_function(tolua_S,"reload",tolua_fltk_fltk_Fl_Shared_Image_reload00);
@@ -76960,12 +81496,17 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"insertfile",tolua_fltk_fltk_Fl_Text_Buffer_insertfile00);
    tolua_function(tolua_S,"length",tolua_fltk_fltk_Fl_Text_Buffer_length00);
    tolua_function(tolua_S,"line_end",tolua_fltk_fltk_Fl_Text_Buffer_line_end00);
+   tolua_function(tolua_S,"line_of",tolua_fltk_fltk_Fl_Text_Buffer_line_of00);
    tolua_function(tolua_S,"line_start",tolua_fltk_fltk_Fl_Text_Buffer_line_start00);
    tolua_function(tolua_S,"line_text",tolua_fltk_fltk_Fl_Text_Buffer_line_text00);
    tolua_function(tolua_S,"loadfile",tolua_fltk_fltk_Fl_Text_Buffer_loadfile00);
+   tolua_function(tolua_S,"newline_count",tolua_fltk_fltk_Fl_Text_Buffer_newline_count00);
    tolua_function(tolua_S,"outputfile",tolua_fltk_fltk_Fl_Text_Buffer_outputfile00);
    tolua_function(tolua_S,"overlay_rectangular",tolua_fltk_fltk_Fl_Text_Buffer_overlay_rectangular00);
+   tolua_function(tolua_S,"pos_of_line",tolua_fltk_fltk_Fl_Text_Buffer_pos_of_line00);
    tolua_function(tolua_S,"primary_selection",tolua_fltk_fltk_Fl_Text_Buffer_primary_selection00);
+   tolua_function(tolua_S,"redo",tolua_fltk_fltk_Fl_Text_Buffer_redo00);
+   tolua_function(tolua_S,"redo_count",tolua_fltk_fltk_Fl_Text_Buffer_redo_count00);
    tolua_function(tolua_S,"remove",tolua_fltk_fltk_Fl_Text_Buffer_remove00);
    tolua_function(tolua_S,"remove_modify_callback",tolua_fltk_fltk_Fl_Text_Buffer_remove_modify_callback00);
    tolua_function(tolua_S,"remove_predelete_callback",tolua_fltk_fltk_Fl_Text_Buffer_remove_predelete_callback00);
@@ -76980,6 +81521,8 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"savefile",tolua_fltk_fltk_Fl_Text_Buffer_savefile00);
    tolua_function(tolua_S,"search_backward",tolua_fltk_fltk_Fl_Text_Buffer_search_backward00);
    tolua_function(tolua_S,"search_forward",tolua_fltk_fltk_Fl_Text_Buffer_search_forward00);
+   tolua_function(tolua_S,"search_all",tolua_fltk_fltk_Fl_Text_Buffer_search_all00);
+   tolua_function(tolua_S,"search_pattern",tolua_fltk_fltk_Fl_Text_Buffer_search_pattern00);
    tolua_function(tolua_S,"secondary_select",tolua_fltk_fltk_Fl_Text_Buffer_secondary_select00);
    tolua_function(tolua_S,"secondary_select_rectangular",tolua_fltk_fltk_Fl_Text_Buffer_secondary_select_rectangular00);
    tolua_function(tolua_S,"secondary_selected",tolua_fltk_fltk_Fl_Text_Buffer_secondary_selected00);
@@ -76999,6 +81542,10 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"text_in_rectangle",tolua_fltk_fltk_Fl_Text_Buffer_text_in_rectangle00);
    tolua_function(tolua_S,"text_range",tolua_fltk_fltk_Fl_Text_Buffer_text_range00);
    tolua_function(tolua_S,"undo",tolua_fltk_fltk_Fl_Text_Buffer_undo00);
+   tolua_function(tolua_S,"undo_checkpoint",tolua_fltk_fltk_Fl_Text_Buffer_undo_checkpoint00);
+   tolua_function(tolua_S,"undo_clear",tolua_fltk_fltk_Fl_Text_Buffer_undo_clear00);
+   tolua_function(tolua_S,"undo_count",tolua_fltk_fltk_Fl_Text_Buffer_undo_count00);
+   tolua_function(tolua_S,"undo_limit",tolua_fltk_fltk_Fl_Text_Buffer_undo_limit01);
    tolua_function(tolua_S,"unhighlight",tolua_fltk_fltk_Fl_Text_Buffer_unhighlight00);
    tolua_function(tolua_S,"unselect",tolua_fltk_fltk_Fl_Text_Buffer_unselect00);
    tolua_function(tolua_S,"word_end",tolua_fltk_fltk_Fl_Text_Buffer_word_end00);
@@ -77105,6 +81652,7 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"kf_page_down",tolua_fltk_fltk_Fl_Text_Editor_kf_page_down00);
    tolua_function(tolua_S,"kf_page_up",tolua_fltk_fltk_Fl_Text_Editor_kf_page_up00);
    tolua_function(tolua_S,"kf_paste",tolua_fltk_fltk_Fl_Text_Editor_kf_paste00);
+   tolua_function(tolua_S,"kf_redo",tolua_fltk_fltk_Fl_Text_Editor_kf_redo00);
    tolua_function(tolua_S,"kf_right",tolua_fltk_fltk_Fl_Text_Editor_kf_right00);
    tolua_function(tolua_S,"kf_select_all",tolua_fltk_fltk_Fl_Text_Editor_kf_select_all00);
    tolua_function(tolua_S,"kf_shift_move",tolua_fltk_fltk_Fl_Text_Editor_kf_shift_move00);
@@ -77125,6 +81673,38 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"new_local",tolua_fltk_fltk_Lua__Fl_Text_Editor_new00_local);
    tolua_function(tolua_S,".call",tolua_fltk_fltk_Lua__Fl_Text_Editor_new00_local);
   tolua_endmodule(tolua_S);
+  #ifdef __cplusplus
+  tolua_cclass(tolua_S,"Fl_Text_Highlighter","Fl_Text_Highlighter","",tolua_collect_Fl_Text_Highlighter);
+  #else
+  tolua_cclass(tolua_S,"Fl_Text_Highlighter","Fl_Text_Highlighter","",NULL);
+  #endif
+  tolua_beginmodule(tolua_S,"Fl_Text_Highlighter");
+   tolua_function(tolua_S,"new",tolua_fltk_fltk_Fl_Text_Highlighter_new00);
+   tolua_function(tolua_S,"new_local",tolua_fltk_fltk_Fl_Text_Highlighter_new00_local);
+   tolua_function(tolua_S,".call",tolua_fltk_fltk_Fl_Text_Highlighter_new00_local);
+   tolua_function(tolua_S,"delete",tolua_fltk_fltk_Fl_Text_Highlighter_delete00);
+   tolua_function(tolua_S,"attach",tolua_fltk_fltk_Fl_Text_Highlighter_attach00);
+   tolua_function(tolua_S,"detach",tolua_fltk_fltk_Fl_Text_Highlighter_detach00);
+   tolua_function(tolua_S,"restyle",tolua_fltk_fltk_Fl_Text_Highlighter_restyle00);
+   tolua_function(tolua_S,"style_to",tolua_fltk_fltk_Fl_Text_Highlighter_style_to00);
+   tolua_function(tolua_S,"styles",tolua_fltk_fltk_Fl_Text_Highlighter_styles00);
+   tolua_function(tolua_S,"display",tolua_fltk_fltk_Fl_Text_Highlighter_display00);
+   tolua_function(tolua_S,"style_buffer",tolua_fltk_fltk_Fl_Text_Highlighter_style_buffer00);
+   tolua_function(tolua_S,"styled_lines",tolua_fltk_fltk_Fl_Text_Highlighter_styled_lines00);
+   tolua_function(tolua_S,"lines_per_pass",tolua_fltk_fltk_Fl_Text_Highlighter_lines_per_pass01);
+  tolua_endmodule(tolua_S);
+  #ifdef __cplusplus
+  tolua_cclass(tolua_S,"Fl_Lua_Highlighter","Fl_Lua_Highlighter","Fl_Text_Highlighter",tolua_collect_Fl_Lua_Highlighter);
+  #else
+  tolua_cclass(tolua_S,"Fl_Lua_Highlighter","Fl_Lua_Highlighter","Fl_Text_Highlighter",NULL);
+  #endif
+  tolua_beginmodule(tolua_S,"Fl_Lua_Highlighter");
+   tolua_function(tolua_S,"new",tolua_fltk_fltk_Fl_Lua_Highlighter_new00);
+   tolua_function(tolua_S,"new_local",tolua_fltk_fltk_Fl_Lua_Highlighter_new00_local);
+   tolua_function(tolua_S,".call",tolua_fltk_fltk_Fl_Lua_Highlighter_new00_local);
+   tolua_function(tolua_S,"delete",tolua_fltk_fltk_Fl_Lua_Highlighter_delete00);
+   tolua_function(tolua_S,"rules",tolua_fltk_fltk_Fl_Lua_Highlighter_rules00);
+  tolua_endmodule(tolua_S);
   tolua_cclass(tolua_S,"Fl_Text_Selection","Fl_Text_Selection","",NULL);
   tolua_beginmodule(tolua_S,"Fl_Text_Selection");
    tolua_function(tolua_S,"endd",tolua_fltk_fltk_Fl_Text_Selection_endd00);
@@ -78186,6 +82766,46 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
   tolua_function(tolua_S,"fl_vertex",tolua_fltk_fltk_fl_vertex00);
   tolua_function(tolua_S,"fl_xyline",tolua_fltk_fltk_fl_xyline02);
   tolua_function(tolua_S,"fl_yxline",tolua_fltk_fltk_fl_yxline02);
+  tolua_constant(tolua_S,"FL_DL_COLOR",FL_DL_COLOR);
+  tolua_constant(tolua_S,"FL_DL_RECTF",FL_DL_RECTF);
+  tolua_constant(tolua_S,"FL_DL_RECT",FL_DL_RECT);
+  tolua_constant(tolua_S,"FL_DL_LINE",FL_DL_LINE);
+  tolua_constant(tolua_S,"FL_DL_POINT",FL_DL_POINT);
+  tolua_constant(tolua_S,"FL_DL_POLYGON",FL_DL_POLYGON);
+  tolua_constant(tolua_S,"FL_DL_LOOP",FL_DL_LOOP);
+  tolua_constant(tolua_S,"FL_DL_LINE_STYLE",FL_DL_LINE_STYLE);
+  tolua_constant(tolua_S,"FL_DL_FONT",FL_DL_FONT);
+  tolua_constant(tolua_S,"FL_DL_PUSH_CLIP",FL_DL_PUSH_CLIP);
+  tolua_constant(tolua_S,"FL_DL_POP_CLIP",FL_DL_POP_CLIP);
+  tolua_constant(tolua_S,"FL_DL_TEXT",FL_DL_TEXT);
+  tolua_constant(tolua_S,"FL_DL_TEXT_BOX",FL_DL_TEXT_BOX);
+  #ifdef __cplusplus
+  tolua_cclass(tolua_S,"Fl_Draw_List","Fl_Draw_List","",tolua_collect_Fl_Draw_List);
+  #else
+  tolua_cclass(tolua_S,"Fl_Draw_List","Fl_Draw_List","",NULL);
+  #endif
+  tolua_beginmodule(tolua_S,"Fl_Draw_List");
+   tolua_function(tolua_S,"new",tolua_fltk_fltk_Fl_Draw_List_new00);
+   tolua_function(tolua_S,"new_local",tolua_fltk_fltk_Fl_Draw_List_new00_local);
+   tolua_function(tolua_S,".call",tolua_fltk_fltk_Fl_Draw_List_new00_local);
+   tolua_function(tolua_S,"delete",tolua_fltk_fltk_Fl_Draw_List_delete00);
+   tolua_function(tolua_S,"clear",tolua_fltk_fltk_Fl_Draw_List_clear00);
+   tolua_function(tolua_S,"commands",tolua_fltk_fltk_Fl_Draw_List_commands00);
+   tolua_function(tolua_S,"size",tolua_fltk_fltk_Fl_Draw_List_size00);
+   tolua_function(tolua_S,"color",tolua_fltk_fltk_Fl_Draw_List_color00);
+   tolua_function(tolua_S,"rectf",tolua_fltk_fltk_Fl_Draw_List_rectf00);
+   tolua_function(tolua_S,"rect",tolua_fltk_fltk_Fl_Draw_List_rect00);
+   tolua_function(tolua_S,"line",tolua_fltk_fltk_Fl_Draw_List_line00);
+   tolua_function(tolua_S,"point",tolua_fltk_fltk_Fl_Draw_List_point00);
+   tolua_function(tolua_S,"polygon",tolua_fltk_fltk_Fl_Draw_List_polygon00);
+   tolua_function(tolua_S,"line_style",tolua_fltk_fltk_Fl_Draw_List_line_style00);
+   tolua_function(tolua_S,"font",tolua_fltk_fltk_Fl_Draw_List_font00);
+   tolua_function(tolua_S,"push_clip",tolua_fltk_fltk_Fl_Draw_List_push_clip00);
+   tolua_function(tolua_S,"pop_clip",tolua_fltk_fltk_Fl_Draw_List_pop_clip00);
+   tolua_function(tolua_S,"text",tolua_fltk_fltk_Fl_Draw_List_text01);
+   tolua_function(tolua_S,"append",tolua_fltk_fltk_Fl_Draw_List_append00);
+   tolua_function(tolua_S,"draw",tolua_fltk_fltk_Fl_Draw_List_draw00);
+  tolua_endmodule(tolua_S);
   tolua_function(tolua_S,"fl_show_colormap",tolua_fltk_fltk_fl_show_colormap00);
   tolua_function(tolua_S,"fl_fopen",tolua_fltk_fltk_fl_fopen00);
   tolua_function(tolua_S,"fl_locale_to_utf8",tolua_fltk_fltk_fl_locale_to_utf800);
@@ -78353,6 +82973,9 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"release_current",tolua_fltk_flvw_Flv_Style_List_release_current00);
    tolua_function(tolua_S,"skip_to",tolua_fltk_flvw_Flv_Style_List_skip_to00);
    tolua_function(tolua_S,"get",tolua_fltk_flvw_Flv_Style_List_get00);
+   tolua_function(tolua_S,"range",tolua_fltk_flvw_Flv_Style_List_range00);
+   tolua_function(tolua_S,"ranges",tolua_fltk_flvw_Flv_Style_List_ranges00);
+   tolua_function(tolua_S,"clear_ranges",tolua_fltk_flvw_Flv_Style_List_clear_ranges00);
   tolua_endmodule(tolua_S);
   #ifdef __cplusplus
   tolua_cclass(tolua_S,"Flv_Style","Flv_Style","",tolua_collect_Flv_Style);
@@ -78437,6 +83060,63 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"x",tolua_fltk_flvw_Flv_CStyle_x00);
    tolua_function(tolua_S,"y",tolua_fltk_flvw_Flv_CStyle_y00);
   tolua_endmodule(tolua_S);
+  tolua_constant(tolua_S,"FLV_DS_STRING",FLV_DS_STRING);
+  tolua_constant(tolua_S,"FLV_DS_INT",FLV_DS_INT);
+  tolua_constant(tolua_S,"FLV_DS_DOUBLE",FLV_DS_DOUBLE);
+  tolua_cclass(tolua_S,"Flv_Data_Source","Flv_Data_Source","",NULL);
+  tolua_beginmodule(tolua_S,"Flv_Data_Source");
+   tolua_function(tolua_S,"data_rows",tolua_fltk_flvw_Flv_Data_Source_data_rows00);
+   tolua_function(tolua_S,"data_cols",tolua_fltk_flvw_Flv_Data_Source_data_cols00);
+   tolua_function(tolua_S,"data_number",tolua_fltk_flvw_Flv_Data_Source_data_number00);
+   tolua_function(tolua_S,"data_type",tolua_fltk_flvw_Flv_Data_Source_data_type00);
+   tolua_function(tolua_S,"data_name",tolua_fltk_flvw_Flv_Data_Source_data_name00);
+   tolua_function(tolua_S,"rows",tolua_fltk_flvw_Flv_Data_Source_rows00);
+   tolua_function(tolua_S,"cols",tolua_fltk_flvw_Flv_Data_Source_cols00);
+   tolua_function(tolua_S,"map_row",tolua_fltk_flvw_Flv_Data_Source_map_row00);
+   tolua_function(tolua_S,"map_col",tolua_fltk_flvw_Flv_Data_Source_map_col00);
+   tolua_function(tolua_S,"as_string",tolua_fltk_flvw_Flv_Data_Source_as_string00);
+   tolua_function(tolua_S,"as_number",tolua_fltk_flvw_Flv_Data_Source_as_number00);
+   tolua_function(tolua_S,"col_name",tolua_fltk_flvw_Flv_Data_Source_col_name00);
+   tolua_function(tolua_S,"sort",tolua_fltk_flvw_Flv_Data_Source_sort00);
+   tolua_function(tolua_S,"filter",tolua_fltk_flvw_Flv_Data_Source_filter01);
+   tolua_function(tolua_S,"clear_row_map",tolua_fltk_flvw_Flv_Data_Source_clear_row_map00);
+   tolua_function(tolua_S,"row_map",tolua_fltk_flvw_Flv_Data_Source_row_map00);
+   tolua_function(tolua_S,"col_map",tolua_fltk_flvw_Flv_Data_Source_col_map00);
+   tolua_function(tolua_S,"clear_col_map",tolua_fltk_flvw_Flv_Data_Source_clear_col_map00);
+   tolua_function(tolua_S,"data_changed",tolua_fltk_flvw_Flv_Data_Source_data_changed00);
+  tolua_endmodule(tolua_S);
+  #ifdef __cplusplus
+  tolua_cclass(tolua_S,"Flv_Array_Data_Source","Flv_Array_Data_Source","Flv_Data_Source",tolua_collect_Flv_Array_Data_Source);
+  #else
+  tolua_cclass(tolua_S,"Flv_Array_Data_Source","Flv_Array_Data_Source","Flv_Data_Source",NULL);
+  #endif
+  tolua_beginmodule(tolua_S,"Flv_Array_Data_Source");
+   tolua_function(tolua_S,"new",tolua_fltk_flvw_Flv_Array_Data_Source_new00);
+   tolua_function(tolua_S,"new_local",tolua_fltk_flvw_Flv_Array_Data_Source_new00_local);
+   tolua_function(tolua_S,".call",tolua_fltk_flvw_Flv_Array_Data_Source_new00_local);
+   tolua_function(tolua_S,"delete",tolua_fltk_flvw_Flv_Array_Data_Source_delete00);
+   tolua_function(tolua_S,"add_col",tolua_fltk_flvw_Flv_Array_Data_Source_add_col00);
+   tolua_function(tolua_S,"set_data_rows",tolua_fltk_flvw_Flv_Array_Data_Source_set_data_rows00);
+   tolua_function(tolua_S,"set_int",tolua_fltk_flvw_Flv_Array_Data_Source_set_int00);
+   tolua_function(tolua_S,"set_double",tolua_fltk_flvw_Flv_Array_Data_Source_set_double00);
+   tolua_function(tolua_S,"set_string",tolua_fltk_flvw_Flv_Array_Data_Source_set_string00);
+   tolua_function(tolua_S,"add_row",tolua_fltk_flvw_Flv_Array_Data_Source_add_row00);
+   tolua_function(tolua_S,"set_column",tolua_fltk_flvw_Flv_Array_Data_Source_set_column00);
+   tolua_function(tolua_S,"clear",tolua_fltk_flvw_Flv_Array_Data_Source_clear00);
+  tolua_endmodule(tolua_S);
+  #ifdef __cplusplus
+  tolua_cclass(tolua_S,"Flv_Sqlite_Data_Source","Flv_Sqlite_Data_Source","Flv_Data_Source",tolua_collect_Flv_Sqlite_Data_Source);
+  #else
+  tolua_cclass(tolua_S,"Flv_Sqlite_Data_Source","Flv_Sqlite_Data_Source","Flv_Data_Source",NULL);
+  #endif
+  tolua_beginmodule(tolua_S,"Flv_Sqlite_Data_Source");
+   tolua_function(tolua_S,"delete",tolua_fltk_flvw_Flv_Sqlite_Data_Source_delete00);
+   tolua_function(tolua_S,"new_local",tolua_fltk_flvw_Flv_Sqlite_Data_Source_new_local00);
+   tolua_function(tolua_S,"error",tolua_fltk_flvw_Flv_Sqlite_Data_Source_error00);
+   tolua_function(tolua_S,"page_rows",tolua_fltk_flvw_Flv_Sqlite_Data_Source_page_rows00);
+   tolua_function(tolua_S,"max_pages",tolua_fltk_flvw_Flv_Sqlite_Data_Source_max_pages00);
+   tolua_function(tolua_S,"cached_pages",tolua_fltk_flvw_Flv_Sqlite_Data_Source_cached_pages00);
+  tolua_endmodule(tolua_S);
   #ifdef __cplusplus
   tolua_cclass(tolua_S,"Flv_List","Flv_List","Fl_Group",tolua_collect_Flv_List);
   #else
@@ -78475,6 +83155,7 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"multi_select",tolua_fltk_flvw_Flv_List_multi_select00);
    tolua_function(tolua_S,"persist_select",tolua_fltk_flvw_Flv_List_persist_select00);
    tolua_function(tolua_S,"position_editor",tolua_fltk_flvw_Flv_List_position_editor00);
+   tolua_function(tolua_S,"redraw_rows",tolua_fltk_flvw_Flv_List_redraw_rows00);
    tolua_function(tolua_S,"row",tolua_fltk_flvw_Flv_List_row00);
    tolua_function(tolua_S,"row_divider",tolua_fltk_flvw_Flv_List_row_divider00);
    tolua_function(tolua_S,"row_footer",tolua_fltk_flvw_Flv_List_row_footer00);
@@ -78547,6 +83228,8 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"col_resizable",tolua_fltk_flvw_Flv_Table_col_resizable00);
    tolua_function(tolua_S,"set_col_resizable",tolua_fltk_flvw_Flv_Table_set_col_resizable00);
    tolua_function(tolua_S,"col_selected",tolua_fltk_flvw_Flv_Table_col_selected00);
+   tolua_function(tolua_S,"data_source",tolua_fltk_flvw_Flv_Table_data_source01);
+   tolua_function(tolua_S,"data_changed",tolua_fltk_flvw_Flv_Table_data_changed00);
    tolua_function(tolua_S,"col_width",tolua_fltk_flvw_Flv_Table_col_width00);
    tolua_function(tolua_S,"set_col_width",tolua_fltk_flvw_Flv_Table_set_col_width00);
    tolua_function(tolua_S,"cols",tolua_fltk_flvw_Flv_Table_cols00);
@@ -78558,6 +83241,8 @@ TOLUA_API int tolua_fltk_open (lua_State* tolua_S)
    tolua_function(tolua_S,"move_col",tolua_fltk_flvw_Flv_Table_move_col00);
    tolua_function(tolua_S,"move_on_enter",tolua_fltk_flvw_Flv_Table_move_on_enter00);
    tolua_function(tolua_S,"move_row",tolua_fltk_flvw_Flv_Table_move_row00);
+   tolua_function(tolua_S,"redraw_cell",tolua_fltk_flvw_Flv_Table_redraw_cell00);
+   tolua_function(tolua_S,"redraw_cells",tolua_fltk_flvw_Flv_Table_redraw_cells00);
    tolua_function(tolua_S,"row",tolua_fltk_flvw_Flv_Table_row00);
    tolua_function(tolua_S,"select_row",tolua_fltk_flvw_Flv_Table_select_row00);
    tolua_function(tolua_S,"select_start_col",tolua_fltk_flvw_Flv_Table_select_start_col00);
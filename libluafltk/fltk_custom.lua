@@ -359,11 +359,15 @@ end
 
 function classVirtualClass:output_methods(btype)
 
+	-- each method gets a slot in ToluaBase's lookup cache
+	local slot = 0
 	for k,v in ipairs(self.methods) do
 
 		if v.f.name ~= 'new' and v.f.name ~= 'delete' then
 
-			self:output_method(v.f, btype)
+			if self:output_method(v.f, btype, slot) then
+				slot = slot + 1
+			end
 		end
 	end
 	output("\n")
@@ -383,10 +387,10 @@ function classVirtualClass:output_constructors()
 	end
 end
 
-function classVirtualClass:output_method(f, btype)
+function classVirtualClass:output_method(f, btype, slot)
 
 	if f.access == 2 then -- private
-		return
+		return false
 	end
 	
 	local ptr
@@ -411,7 +415,7 @@ function classVirtualClass:output_method(f, btype)
 	if f.access == 1 then
 		fn = "NULL"
 	end
-	output('\t\tif (push_method("',f.lname,'", ',fn,')) {')
+	output('\t\tif (push_method(',slot,', "',f.lname,'", ',fn,')) {')
 
 	--if f.type ~= 'void' then
 	--	output("\t\t\tint top = lua_gettop(lua_state)-1;")
@@ -492,6 +496,7 @@ function classVirtualClass:output_method(f, btype)
 	output("\t\t};")
 
 	output("\t};")
+	return true
 end
 
 function VirtualClass()
@@ -3,17 +3,24 @@
 
 #include <tolua++.h>
 
+// number of virtual methods per class whose lookup result is cached,
+// methods with a higher slot fall back to the plain lookup
+#define TOLUA_BASE_MAX_SLOTS 32
+
 class ToluaBase {
 
 	int lua_instance;
 
-protected:
+	// registry ref of a table holding the resolved lua functions by slot
+	int lua_method_cache;
 
-	lua_State* lua_state;
-
-	bool push_method(const char* name, lua_CFunction f) const {
+	// which slots were looked up / found overridden by lua since the
+	// last peer generation change (see tolua_peergeneration)
+	mutable unsigned int method_generation;
+	mutable unsigned int method_resolved;
+	mutable unsigned int method_overridden;
 
-		if (!lua_state) return false;
+	bool lookup_method(const char* name, lua_CFunction f) const {
 
 		lua_getref(lua_state, lua_instance);
 		lua_pushstring(lua_state, name);
@@ -53,6 +60,63 @@ protected:
 		return true;
 	};
 
+protected:
+
+	lua_State* lua_state;
+
+	bool push_method(const char* name, lua_CFunction f) const {
+
+		if (!lua_state) return false;
+
+		return lookup_method(name, f);
+	};
+
+	// same as above, but the result of the lookup is remembered in 'slot'
+	// so methods not overridden in lua never touch the lua state again
+	bool push_method(int slot, const char* name, lua_CFunction f) const {
+
+		if (!lua_state) return false;
+		if (slot >= TOLUA_BASE_MAX_SLOTS) return lookup_method(name, f);
+
+		unsigned int generation = tolua_peergeneration();
+		if (method_generation != generation) {
+
+			method_generation = generation;
+			method_resolved = 0;
+			method_overridden = 0;
+		};
+
+		unsigned int bit = 1u << slot;
+		if (method_resolved & bit) {
+
+			if (!(method_overridden & bit)) return false;
+
+			lua_rawgeti(lua_state, LUA_REGISTRYINDEX, lua_method_cache);
+			lua_rawgeti(lua_state, -1, slot+1);
+			lua_replace(lua_state, -2);
+			lua_getref(lua_state, lua_instance);
+			return true;
+		};
+
+		method_resolved |= bit;
+		lua_rawgeti(lua_state, LUA_REGISTRYINDEX, lua_method_cache);
+		if (lookup_method(name, f)) {
+
+			// stack: cache function instance
+			method_overridden |= bit;
+			lua_pushvalue(lua_state, -2);
+			lua_rawseti(lua_state, -4, slot+1);
+			lua_remove(lua_state, -3);
+			return true;
+		};
+
+		// drop a function cached before the generation change
+		lua_pushnil(lua_state);
+		lua_rawseti(lua_state, -2, slot+1);
+		lua_pop(lua_state, 1);
+		return false;
+	};
+
 	void dbcall(lua_State* L, int nargs, int nresults) const {
 
 		// using lua_call for now
@@ -62,10 +126,23 @@ public:
 
 	void tolua__set_instance(lua_State* L, lua_Object lo) {
 
+		if (lua_state) {
+
+			lua_unref(lua_state, lua_instance);
+			lua_unref(lua_state, lua_method_cache);
+		};
+
 		lua_state = L;
 
 		lua_pushvalue(L, lo);
 		lua_instance = lua_ref(lua_state, 1);
+
+		lua_newtable(L);
+		lua_method_cache = lua_ref(lua_state, 1);
+
+		method_generation = tolua_peergeneration();
+		method_resolved = 0;
+		method_overridden = 0;
 	};
 
 	ToluaBase() {
@@ -78,9 +155,9 @@ public:
 		if (lua_state) {
 
 			lua_unref(lua_state, lua_instance);
+			lua_unref(lua_state, lua_method_cache);
 		};
 	};
 };
 
 #endif
-
@@ -584,4 +584,72 @@ function colla:test()
     assert_equal (n, 3)
 end
 
+-------------------------------------------
+-- Reused row tables and bulk row fetch --
+-------------------------------------------
+
+reuse = lunit.TestCase("Row Reuse Tests")
+
+function reuse:setup()
+  self.db = assert( sqlite3.open_memory() )
+  assert_number( self.db:exec[[
+    CREATE TABLE test(id INTEGER PRIMARY KEY, name);
+    INSERT INTO test VALUES(1, 'one');
+    INSERT INTO test VALUES(2, NULL);
+    INSERT INTO test VALUES(3, 'three');
+  ]] )
+end
+
+function reuse:teardown()
+  assert_number( self.db:close() )
+end
+
+function reuse:test_rows()
+  local first, n = nil, 0
+  for row in self.db:rows("SELECT id, name FROM test ORDER BY id", true) do
+    first = first or row
+    assert_equal( first, row )
+    n = n + 1
+    assert_equal( n, row[1] )
+    if n == 2 then assert_nil( row[2] ) else assert_string( row[2] ) end
+  end
+  assert_equal( 3, n )
+end
+
+function reuse:test_nrows()
+  local mine, n = {}, 0
+  for row in self.db:nrows("SELECT id, name FROM test ORDER BY id", mine) do
+    assert_equal( mine, row )
+    n = n + 1
+    assert_equal( n, row.id )
+    if n == 2 then assert_nil( row.name ) else assert_string( row.name ) end
+  end
+  assert_equal( 3, n )
+  local stmt = assert_userdata( self.db:prepare("SELECT id FROM test") )
+  n = 0
+  for row in stmt:nrows(mine) do n = n + 1; assert_equal( mine, row ) end
+  assert_equal( 3, n )
+  assert_number( stmt:finalize() )
+end
+
+function reuse:test_fetch_many()
+  local stmt = assert_userdata( self.db:prepare("SELECT id, name FROM test ORDER BY id") )
+  local cols, n = stmt:fetch_many(2)
+  assert_equal( 2, n )
+  assert_equal( 2, #cols )
+  assert_equal( 1, cols[1][1] )
+  assert_equal( "one", cols[2][1] )
+  assert_nil( cols[2][2] )
+  local again, m = stmt:fetch_many(2, cols)
+  assert_equal( cols, again )
+  assert_equal( 1, m )
+  assert_equal( 3, cols[1][1] )
+  assert_equal( "three", cols[2][1] )
+  -- the statement was reset at the end of the result
+  cols, n = stmt:fetch_many(10)
+  assert_equal( 3, n )
+  assert_error( function() stmt:fetch_many(0) end )
+  assert_number( stmt:finalize() )
+end
+
 lunit.run()
@@ -219,6 +219,25 @@ static sdb_vm *lsqlite_checkvm(lua_State *L, int index) {
     return svm;
 }
 
+/* for C code working on a statement prepared from lua (e.g. table data
+** sources): returns the statement of the vm at index, NULL if closed, and
+** its sql text in *sql when sql is not NULL */
+LUALIB_API sqlite3_stmt *lsqlite_tostmt(lua_State *L, int index, const char **sql) {
+    sdb_vm *svm = lsqlite_getvm(L, index);
+    if (sql) {
+        *sql = NULL;
+        if (svm->vm) {
+            lua_pushlightuserdata(L, svm->db);
+            lua_rawget(L, LUA_REGISTRYINDEX);
+            lua_pushlightuserdata(L, svm);
+            lua_rawget(L, -2);
+            *sql = lua_tostring(L, -1); /* kept alive by the database table */
+            lua_pop(L, 2);
+        }
+    }
+    return svm->vm;
+}
+
 static int dbvm_isopen(lua_State *L) {
     sdb_vm *svm = lsqlite_getvm(L, 1);
     lua_pushboolean(L, svm->vm != NULL ? 1 : 0);
@@ -1458,6 +1477,27 @@ static int db_prepare(lua_State *L) {
     return 2;
 }
 
+/* called when stepping did not return a row: finalizes temporary vms and
+** resets the others, raises the error if there is one */
+static void vm_done(lua_State *L, sdb_vm *svm, int result) {
+    sqlite3_stmt *vm = svm->vm;
+
+    if (svm->temp) {
+        /* finalize and check for errors */
+        result = sqlite3_finalize(vm);
+        svm->vm = NULL;
+        cleanupvm(L, svm);
+    }
+    else if (result == SQLITE_DONE) {
+        result = sqlite3_reset(vm);
+    }
+
+    if (result != SQLITE_OK) {
+        lua_pushstring(L, sqlite3_errmsg(svm->db->db));
+        lua_error(L);
+    }
+}
+
 static int db_do_next_row(lua_State *L, int packed) {
     int result;
     sdb_vm *svm = lsqlite_checkvm(L, 1);
@@ -1472,13 +1512,36 @@ static int db_do_next_row(lua_State *L, int packed) {
 
     if (result == SQLITE_ROW) {
         if (packed) {
-            lua_newtable(L);
+            /* iterators made with a row table (see push_row_iterator) keep
+            ** it in upvalue 1 and return it for every row */
+            int reuse = lua_istable(L, lua_upvalueindex(1));
+            if (reuse)
+                lua_pushvalue(L, lua_upvalueindex(1));
+            else
+                lua_newtable(L);
             if (packed == 1) {
                 for (i = 0; i < columns;) {
                     vm_push_column(L, vm, i);
                     lua_rawseti(L, -2, ++i);
                 }
             }
+            else if (reuse) {
+                /* column names are pushed at the first row only and then
+                ** taken from upvalue 2 */
+                if (lua_objlen(L, lua_upvalueindex(2)) != (size_t)columns) {
+                    lua_createtable(L, columns, 0);
+                    for (i = 0; i < columns;) {
+                        lua_pushstring(L, sqlite3_column_name(vm, i));
+                        lua_rawseti(L, -2, ++i);
+                    }
+                    lua_replace(L, lua_upvalueindex(2));
+                }
+                for (i = 0; i < columns; ++i) {
+                    lua_rawgeti(L, lua_upvalueindex(2), i + 1);
+                    vm_push_column(L, vm, i);
+                    lua_rawset(L, -3);
+                }
+            }
             else {
                 for (i = 0; i < columns; ++i) {
                     lua_pushstring(L, sqlite3_column_name(vm, i));
@@ -1496,20 +1559,7 @@ static int db_do_next_row(lua_State *L, int packed) {
         }
     }
 
-    if (svm->temp) {
-        /* finalize and check for errors */
-        result = sqlite3_finalize(vm);
-        svm->vm = NULL;
-        cleanupvm(L, svm);
-    }
-    else if (result == SQLITE_DONE) {
-        result = sqlite3_reset(vm);
-    }
-
-    if (result != SQLITE_OK) {
-        lua_pushstring(L, sqlite3_errmsg(svm->db->db));
-        lua_error(L);
-    }
+    vm_done(L, svm, result);
     return 0;
 }
 
@@ -1525,12 +1575,27 @@ static int db_next_named_row(lua_State *L) {
     return db_do_next_row(L, 2);
 }
 
+/* pushes the iterator function f; when the value at index 'row' is a table,
+** or true for a new one, the iterator returns that same table for every row
+** instead of creating one per row */
+static void push_row_iterator(lua_State *L, int(*f)(lua_State *), int row) {
+    if (lua_istable(L, row))
+        lua_pushvalue(L, row);
+    else if (lua_toboolean(L, row))
+        lua_newtable(L);
+    else {
+        lua_pushcfunction(L, f);
+        return;
+    }
+    lua_pushnil(L); /* column names, filled at the first row */
+    lua_pushcclosure(L, f, 2);
+}
+
 static int dbvm_do_rows(lua_State *L, int(*f)(lua_State *)) {
     //sdb_vm *svm = 
     lsqlite_checkvm(L, 1);
+    push_row_iterator(L, f, 2);
     lua_pushvalue(L,1);
-    lua_pushcfunction(L, f);
-    lua_insert(L, -2);
     return 2;
 }
 
@@ -1546,11 +1611,66 @@ static int dbvm_urows(lua_State *L) {
     return dbvm_do_rows(L, db_next_row);
 }
 
+/*
+** Params: vm, n [, columns]
+** Steps vm up to n times. Returns a table with one array per column holding
+** the values of the rows read, and the number of rows read (less than n at
+** the end of the result). The arrays of a columns table given as third
+** argument are reused; their values past the rows read are left as they were.
+*/
+static int dbvm_fetch_many(lua_State *L) {
+    sdb_vm *svm = lsqlite_checkvm(L, 1);
+    int n = luaL_checkint(L, 2);
+    int columns = sqlite3_column_count(svm->vm);
+    int rows = 0;
+    int result = SQLITE_ROW;
+    int i;
+
+    /* the statement must be stepped for its values to be read after */
+    luaL_argcheck(L, n >= 1, 2, "at least one row expected");
+
+    lua_settop(L, 3);
+    if (!lua_istable(L, 3)) {
+        lua_createtable(L, columns, 0);
+        lua_replace(L, 3);
+    }
+    /* stack: vm, n, columns, then column arrays 1..columns */
+    luaL_checkstack(L, columns + 2, "too many columns");
+    for (i = 1; i <= columns; ++i) {
+        lua_rawgeti(L, 3, i);
+        if (!lua_istable(L, -1)) {
+            lua_pop(L, 1);
+            lua_createtable(L, n, 0);
+            lua_pushvalue(L, -1);
+            lua_rawseti(L, 3, i);
+        }
+    }
+
+    while (rows < n) {
+        result = stepvm(L, svm);
+        if (result != SQLITE_ROW) break;
+        ++rows;
+        for (i = 0; i < columns; ++i) {
+            vm_push_column(L, svm->vm, i);
+            lua_rawseti(L, 4 + i, rows);
+        }
+    }
+    svm->has_values = result == SQLITE_ROW ? 1 : 0;
+    svm->columns = sqlite3_data_count(svm->vm);
+    if (result != SQLITE_ROW)
+        vm_done(L, svm, result);
+
+    lua_pushvalue(L, 3);
+    lua_pushnumber(L, rows);
+    return 2;
+}
+
 static int db_do_rows(lua_State *L, int(*f)(lua_State *)) {
     sdb *db = lsqlite_checkdb(L, 1);
     const char *sql = luaL_checkstring(L, 2);
     sdb_vm *svm;
-    lua_settop(L,2); /* sql is on top of stack for call to newvm */
+    lua_settop(L,3);
+    lua_pushvalue(L,2); /* sql is on top of stack for call to newvm */
     svm = newvm(L, db);
     svm->temp = 1;
 
@@ -1561,7 +1681,7 @@ static int db_do_rows(lua_State *L, int(*f)(lua_State *)) {
         lua_error(L);
     }
 
-    lua_pushcfunction(L, f);
+    push_row_iterator(L, f, 3);
     lua_insert(L, -2);
     return 2;
 }
@@ -1820,6 +1940,7 @@ static const luaL_reg vmlib[] = {
     {"rows",                dbvm_rows               },
     {"urows",               dbvm_urows              },
     {"nrows",               dbvm_nrows              },
+    {"fetch_many",          dbvm_fetch_many         },
 
     /* compatibility names (added by request) */
     {"idata",               dbvm_get_values         },
@@ -0,0 +1,73 @@
+-- Fl_Browser test: lines read by load() and add_lines() are found by
+-- number, and topline(), middleline() and bottomline() scroll to them,
+-- also after the item heights change with textsize().
+-- Needs a display to measure the fonts.
+-- Prints "ok" when all checks pass, stops on the first failure.
+
+local dir = os.getenv("TMPDIR") or "/tmp"
+local data = dir .. "/browsertest" .. os.time() .. ".txt"
+local N = 3000
+
+local lines = {}
+for i = 1, N do lines[i] = "line " .. i end
+local f = assert(io.open(data, "wb"))
+-- no newline at the end, load() would read an empty last line
+f:write(table.concat(lines, "\n"))
+f:close()
+
+local function check(name, cond, msg)
+	assert(cond, name .. ": " .. msg)
+end
+
+-- scroll position of line with the browser scrolled by f
+local function at(b, f, line)
+	f(b, line)
+	return b:position()
+end
+
+-- all lines are the same height here, so topline() must give multiples
+-- of it, and bottomline() the end, like topline() does for the last line.
+-- bottomline() is called first, right after the lines or their heights
+-- changed, as a program showing the end of a log does
+local function check_positions(name, b)
+	local bottom = at(b, b.bottomline, b:size())
+	local h = at(b, b.topline, 2)
+	check(name, h > 0 and at(b, b.topline, 1) == 0, "no line height")
+	for _, line in ipairs({ 10, 1000, b:size() - 100 }) do
+		check(name, at(b, b.topline, line) == (line - 1) * h,
+			"topline(" .. line .. ") at " .. b:position() .. ", expected " .. (line - 1) * h)
+	end
+	local last = at(b, b.topline, b:size())
+	check(name, last > (b:size() - 100) * h, "topline(size()) at " .. last)
+	check(name, bottom == last,
+		"bottomline(size()) at " .. bottom .. ", expected " .. last)
+	local mid = at(b, b.middleline, 1000)
+	check(name, mid > 0 and mid < 999 * h, "middleline(1000) at " .. mid)
+	return h
+end
+
+local b = fltk.Fl_Browser:new(10, 10, 200, 300)
+
+-- load() then showing the end, the usual way to follow a log file
+check("load", b:load(data) == 1, "cannot read " .. data)
+check("load", b:size() == N, "size " .. b:size())
+check("load", b:text(1234) == "line 1234", "line 1234 is " .. tostring(b:text(1234)))
+local h = check_positions("load", b)
+print("load ok")
+
+-- taller lines: the positions must use the new heights
+b:textsize(b:textsize() * 2)
+check("textsize", check_positions("textsize", b) > h, "lines not taller")
+print("textsize ok")
+
+-- add_lines() appends many lines at once
+b:clear()
+b:add_lines(lines)
+b:add_lines({ "first extra", "last extra" })
+check("add_lines", b:size() == N + 2, "size " .. b:size())
+check("add_lines", b:text(N + 2) == "last extra", "last line " .. tostring(b:text(N + 2)))
+check_positions("add_lines", b)
+print("add_lines ok")
+
+os.remove(data)
+print("ok")
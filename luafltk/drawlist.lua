@@ -0,0 +1,59 @@
+-- Fl_Draw_List demo: a chart recorded once into a display list and
+-- replayed from the widget's draw() in a single call.
+-- "New data" records a new list; redraws in between only replay it.
+
+local W, H = 600, 300
+local NBARS = 2000
+
+local dl = fltk.Fl_Draw_List:new_local()
+
+local function record()
+	dl:clear()
+	local cmds, n = {}, 0
+	local function add(...)
+		for i = 1, select('#', ...) do
+			n = n + 1
+			cmds[n] = select(i, ...)
+		end
+	end
+	add(fltk.FL_DL_COLOR, fltk.FL_WHITE, fltk.FL_DL_RECTF, 0, 0, W, H)
+	local bw = W / NBARS
+	local v = H / 2
+	for i = 0, NBARS - 1 do
+		v = math.max(10, math.min(H - 10, v + math.random(-8, 8)))
+		add(fltk.FL_DL_COLOR, i % 2 == 0 and fltk.FL_BLUE or fltk.FL_DARK_BLUE,
+			fltk.FL_DL_RECTF, math.floor(i * bw), math.floor(H - v), math.max(1, math.floor(bw)), math.floor(v))
+	end
+	add(fltk.FL_DL_COLOR, fltk.FL_RED,
+		fltk.FL_DL_LINE, 0, H / 2, W, H / 2,
+		fltk.FL_DL_FONT, fltk.FL_HELVETICA, 14,
+		fltk.FL_DL_TEXT, 8, 20, string.format("%d bars, %d commands", NBARS, n))
+	dl:append(cmds)
+end
+
+local Chart = {}
+Chart.__index = Chart
+
+function Chart:draw()
+	dl:draw(self:x(), self:y())
+end
+
+function Chart:new(x, y, w, h)
+	local t = {}
+	setmetatable(t, Chart)
+	local wgt = fltk.Lua__Fl_Widget:new(x, y, w, h)
+	tolua.setpeer(wgt, t)
+	wgt:tolua__set_instance(wgt)
+	return wgt
+end
+
+window = fltk.Fl_Double_Window:new(W + 20, H + 60, "Fl_Draw_List")
+chart = Chart:new(10, 10, W, H)
+button = fltk.Fl_Button:new(10, H + 20, 100, 30, "New data")
+button:callback(function()
+	record()
+	chart:redraw()
+end)
+record()
+window:show_main()
+fltk.Fl:run()
@@ -0,0 +1,82 @@
+--	======================================================================
+--	File:    flvtable3.lua
+--	Program: flvtable3
+--
+--	Description:
+--	Example of an Flv_Table drawn from a Flv_Array_Data_Source.
+--	The cells are drawn in C++, Lua only loads the data.
+--	Click a column header to sort on that column.
+--	A timer changes a visible value and redraws only that cell.
+--	======================================================================
+
+local nrows = 100000
+
+local ds = flvw.Flv_Array_Data_Source:new_local()
+local c_id = ds:add_col(flvw.FLV_DS_INT, "Id")
+local c_name = ds:add_col(flvw.FLV_DS_STRING, "Name")
+local c_value = ds:add_col(flvw.FLV_DS_DOUBLE, "Value")
+
+local ids, names, values = {}, {}, {}
+for i=1,nrows do
+	ids[i] = i
+	names[i] = string.format("item %05d", (i*7919) % nrows)
+	values[i] = ((i*104729) % 100000) / 100
+end
+ds:set_column(c_id, ids)
+ds:set_column(c_name, names)
+ds:set_column(c_value, values)
+
+local sort_col, ascending = -1, true
+
+function tbl_cb(t)
+	if t.why_event == flvw.FLVE_ROW_HEADER_CLICKED then
+		local c = t:get_col(fltk.Fl:event_x(), fltk.Fl:event_y())
+		if c < 0 then return end
+		ascending = not (c == sort_col and ascending)
+		sort_col = c
+		ds:sort(c, ascending)
+		t:data_changed()
+	end
+end
+
+function main()
+	w = fltk.Fl_Double_Window:new( 400, 400, "Data source table" );
+	t = flvw.Flv_Table:new( 10, 10, 380, 350, "100000 rows" );
+	local filter = fltk.Fl_Input:new( 60, 365, 330, 25, "Filter" );
+	w:endd();
+	w:resizable(t);
+
+	t.callback_when = flvw.FLVEcb_ROW_HEADER_CLICKED;
+	t:callback(tbl_cb);
+	t.feature = bit.bor(flvw.FLVF_ROW_HEADER, flvw.FLVF_DIVIDERS, flvw.FLVF_ROW_SELECT);
+	t.global_style:width(120);
+	t.global_style:height(20);
+	t.global_style:resizable(true);
+	t.row_style:get(-1):font(fltk.FL_HELVETICA_BOLD);
+	t.row_style:range(1, 99999, 2):background(fltk.FL_LIGHT2);	--	Zebra stripes
+	t:data_source(ds);
+
+	filter.when = fltk.FL_WHEN_CHANGED;
+	filter:callback(function(i)
+		ds:clear_row_map()
+		if i.value ~= "" then ds:filter(c_name, i.value) end
+		if sort_col >= 0 then ds:sort(sort_col, ascending) end
+		t:data_changed()
+	end)
+
+	--	Live update, 5 times a second
+	local ticker
+	ticker = fltk.Fl:add_timeout(0.2, function()
+		local r = t.top_row + math.random(0, 15)
+		if r < ds:rows() then
+			ds:set_double(ds:map_row(r), c_value, math.random(0, 99999) / 100)
+			t:redraw_cell(r, c_value)
+		end
+		fltk.Fl:repeat_timeout(0.2, ticker)
+	end)
+
+	w:show_main();
+	fltk.Fl:run();
+end
+
+main()
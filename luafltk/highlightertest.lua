@@ -0,0 +1,56 @@
+-- Fl_Lua_Highlighter test: rule styles past the styles given to attach
+-- fall back to the first style, and a rule whose pattern raises an error
+-- is dropped without changing which rule the other lines are in.
+-- Needs a display, as Fl_Text_Display does.
+-- Prints "ok" when all checks pass, stops on the first failure.
+
+local function check(name, cond, msg)
+	assert(cond, name .. ": " .. msg)
+end
+
+local function setup(text, rules, nstyles)
+	local buf = fltk.Fl_Text_Buffer:new_local()
+	buf:text(text)
+	local disp = fltk.Fl_Text_Display:new(0, 0, 200, 100)
+	disp:buffer(buf)
+	local styles = {}
+	for i = 1, nstyles do styles[i] = { fltk.FL_BLACK } end
+	local hl = fltk.Fl_Lua_Highlighter:new()
+	hl:rules(rules)
+	hl:attach(disp, styles)
+	hl:style_to(buf:length())
+	return buf, hl
+end
+
+-- style 10 with 3 styles must not index past the style table
+local buf, hl = setup("abc 123 def\n-- note\n", {
+	{ "%d+", 10 },
+	{ "%-%-.*", 3 },
+}, 3)
+check("styles", hl:styles() == 3, "styles() is " .. hl:styles())
+check("styles", hl:style_buffer():text() == "AAAAAAAAAAAA" .. "CCCCCCC" .. "C",
+	"styles are " .. hl:style_buffer():text())
+hl:detach()
+print("styles ok")
+
+-- "x%f" only raises its error once an x is found, in the second line,
+-- when the first line is already in the block comment
+buf, hl = setup("/* a\nb */ x 5\nc\n", {
+	{ "x%f", 1 },
+	{ "/%*", "%*/", 2 },
+	{ "%d+", 3 },
+}, 3)
+local before = hl:style_buffer():text()
+check("bad pattern", string.sub(before, 1, 9) == "BBBBBBBBB",
+	"block comment styled " .. string.sub(before, 1, 9))
+-- restyle the second line from the state stored for the first one
+buf:insert(6, "y")
+hl:style_to(buf:length())
+local after = hl:style_buffer():text()
+check("bad pattern", string.sub(after, 6, 10) == "BBBBB",
+	"comment end styled " .. string.sub(after, 6, 10) .. " after the edit")
+check("bad pattern", string.sub(after, 14, 14) == "C", "number styled " .. string.sub(after, 14, 14))
+hl:detach()
+print("bad pattern ok")
+
+print("ok")
@@ -0,0 +1,69 @@
+-- Fl_RGB_Image resampling benchmark: a photo sized image is resized
+-- with each filter of Fl_RGB_Image::copy(W, H, filter), and recolored
+-- with color_average() and desaturate(). FL_RGB_SCALING_NEAREST is the
+-- filter copy(W, H) always used before, and still uses by default.
+-- The times are CPU time from os.clock(), as Lua has no finer wall
+-- clock than os.time(). Large images are resized by several threads
+-- whose times add up, so the numbers are what one core would take. The
+-- gain of the threads shows in the elapsed time of the whole script,
+-- for instance with the time command of the shell.
+-- Usage: imagescale.lua [image file], eyeball.ppm by default.
+
+local file = arg[1] or string.gsub(arg[0], "[^/\\]*$", "") .. "images/eyeball.ppm"
+local W, H = 4000, 3000
+local RUNS = 3
+
+local loaders = {
+	bmp = fltk.Fl_BMP_Image, jpg = fltk.Fl_JPEG_Image, jpeg = fltk.Fl_JPEG_Image,
+	png = fltk.Fl_PNG_Image, pnm = fltk.Fl_PNM_Image, ppm = fltk.Fl_PNM_Image,
+	pgm = fltk.Fl_PNM_Image,
+}
+local loader = loaders[string.lower(string.match(file, "%.(%w+)$") or "")]
+local src = loader and loader:new(file)
+if not src or src:w() == 0 then
+	print("cannot load " .. file)
+	return
+end
+
+-- enlarge the image to the test size, the filter does not matter here
+local big = tolua.cast(src:copy(W, H), "Fl_RGB_Image")
+print(string.format("%s: %dx%d, %d bytes per pixel", file, big:w(), big:h(), big:d()))
+
+local filters = {
+	{ "nearest", fltk.FL_RGB_SCALING_NEAREST },
+	{ "box", fltk.FL_RGB_SCALING_BOX },
+	{ "bilinear", fltk.FL_RGB_SCALING_BILINEAR },
+	{ "lanczos", fltk.FL_RGB_SCALING_LANCZOS },
+}
+
+-- best CPU time of RUNS calls of f, in milliseconds
+local function time(f)
+	local best
+	for i = 1, RUNS do
+		local t = os.clock()
+		f()
+		t = (os.clock() - t) * 1000
+		if not best or t < best then best = t end
+	end
+	return best
+end
+
+for _, size in ipairs({ { 400, 300 }, { 1920, 1440 }, { 8000, 6000 } }) do
+	for _, f in ipairs(filters) do
+		local ms = time(function()
+			big:copy(size[1], size[2], f[2]):delete()
+		end)
+		print(string.format("%dx%d -> %dx%d %-8s %8.1f ms CPU", W, H, size[1], size[2], f[1], ms))
+	end
+end
+
+print(string.format("color_average %8.1f ms CPU", time(function()
+	local c = big:copy()
+	c:color_average(fltk.FL_RED, 0.5)
+	c:delete()
+end)))
+print(string.format("desaturate    %8.1f ms CPU", time(function()
+	local c = big:copy()
+	c:desaturate()
+	c:delete()
+end)))
@@ -0,0 +1,81 @@
+-- Fl_Shared_Image cache test: with a cache_size() budget, released
+-- images are kept, the least recently released ones are evicted when
+-- over the budget, originals are decoded again by find(), and
+-- cache_size(0) deletes all the released images.
+-- Prints "ok" when all checks pass, stops on the first failure.
+
+local dir = string.gsub(arg[0], "[^/\\]*$", "") .. "images/"
+local EYEBALL, TILE = dir .. "eyeball.ppm", dir .. "tile.jpg"
+local SI = fltk.Fl_Shared_Image
+
+fltk.fl_register_images()
+
+local function check(name, cond, msg)
+	assert(cond, name .. ": " .. msg)
+end
+
+-- bytes taken by each decoded file, without a cache
+local function size_of(file)
+	local before = SI:cache_bytes()
+	local img = SI:get(file)
+	assert(img and img:w() > 0, "cannot load " .. file)
+	local bytes = SI:cache_bytes() - before
+	img:release()
+	return bytes
+end
+
+local eyeball, tile = size_of(EYEBALL), size_of(TILE)
+assert(SI:num_images() == 0 and SI:cache_bytes() == 0, "images kept without a cache")
+print("no cache ok")
+
+-- room for the larger of the two files only
+SI:cache_size(math.max(eyeball, tile) + 1)
+SI:clear_cache_stats()
+
+local a, b = SI:get(EYEBALL), SI:get(TILE)
+check("budget", SI:cache_misses() == 2, "misses " .. SI:cache_misses())
+-- images still used are never evicted
+check("budget", SI:cache_bytes() == eyeball + tile, "bytes " .. SI:cache_bytes())
+a:release()
+b:release()
+check("budget", SI:cache_evictions() == 1, "evictions " .. SI:cache_evictions())
+check("budget", SI:cache_bytes() == tile, "bytes " .. SI:cache_bytes())
+-- the evicted original stays known by name and size
+check("budget", SI:num_images() == 2, "images " .. SI:num_images())
+print("budget ok")
+
+-- the cached file is found without decoding it
+b = SI:find(TILE)
+check("hit", b and b:w() == 64 and b:h() == 64, "tile not cached")
+check("hit", SI:cache_hits() == 1 and SI:cache_misses() == 2, "hits " .. SI:cache_hits())
+b:release()
+
+-- the evicted one is decoded again, pushing the tile out this time
+a = SI:find(EYEBALL)
+check("reload", a and a:w() == 80 and a:h() == 80, "eyeball not decoded again")
+check("reload", SI:cache_misses() == 3, "misses " .. SI:cache_misses())
+check("reload", SI:cache_evictions() == 2, "evictions " .. SI:cache_evictions())
+check("reload", SI:cache_bytes() == eyeball, "bytes " .. SI:cache_bytes())
+a:release()
+print("reload ok")
+
+-- scaled copies are deleted when evicted, their original is released
+local c = SI:get(TILE, 32, 32)
+check("copy", c and c:w() == 32 and c:h() == 32, "no scaled copy")
+check("copy", SI:num_images() == 3, "images " .. SI:num_images())
+c:release()
+SI:cache_size(1)
+check("copy", SI:num_images() == 2, "images " .. SI:num_images())
+check("copy", SI:cache_bytes() == 0, "bytes " .. SI:cache_bytes())
+print("copy ok")
+
+-- cache_size(0) deletes the released images, keeps the used ones
+a = SI:get(EYEBALL)
+SI:cache_size(0)
+check("cleanup", SI:num_images() == 1, "images " .. SI:num_images())
+a:release()
+check("cleanup", SI:num_images() == 0, "images " .. SI:num_images())
+check("cleanup", SI:cache_bytes() == 0, "bytes " .. SI:cache_bytes())
+print("cleanup ok")
+
+print("ok")
@@ -0,0 +1,44 @@
+-- Fl_Text_Buffer:insertfile() test: reads files that cannot be sized
+-- (a named pipe) and checks that the text around the insertion point is
+-- kept. Needs mkfifo, so it only runs on POSIX systems.
+-- Prints "ok" when all checks pass, stops on the first failure.
+
+local dir = os.getenv("TMPDIR") or "/tmp"
+local fifo = dir .. "/textbuffertest" .. os.time() .. ".fifo"
+local data = dir .. "/textbuffertest" .. os.time() .. ".txt"
+
+-- 5000 bytes of numbered lines, so lost or moved bytes show up
+local lines = {}
+for i = 1, 500 do lines[i] = string.format("%8d\n", i) end
+local content = table.concat(lines)
+
+local f = assert(io.open(data, "wb"))
+f:write(content)
+f:close()
+
+local function through_fifo(buf, pos, buflen)
+	assert(os.execute("mkfifo " .. fifo) == 0, "mkfifo failed")
+	-- the writer blocks until insertfile() opens the pipe
+	os.execute("cat " .. data .. " > " .. fifo .. " &")
+	local e = buf:insertfile(fifo, pos, buflen)
+	os.remove(fifo)
+	return e
+end
+
+local function check(name, buflen, pos)
+	local buf = fltk.Fl_Text_Buffer:new_local()
+	buf:text("HEAD\nTAIL")
+	assert(through_fifo(buf, pos, buflen) == 0, name .. ": insertfile failed")
+	local expect = string.sub("HEAD\nTAIL", 1, pos) .. content .. string.sub("HEAD\nTAIL", pos + 1)
+	assert(buf:length() == #expect, name .. ": length " .. buf:length() .. ", expected " .. #expect)
+	assert(buf:text() == expect, name .. ": text differs")
+	assert(buf:count_lines(0, buf:length()) == 501, name .. ": line count")
+	print(name .. " ok")
+end
+
+check("default buffer", 128 * 1024, 4)
+check("small buffer", 100, 4)
+check("at start", 100, 0)
+check("at end", 100, 9)
+os.remove(data)
+print("ok")
@@ -0,0 +1,97 @@
+-- Fl_Text_Buffer undo journal test: replacements larger than the
+-- undo_limit() must not leave half an entry, and undo() must only ever
+-- go back to text the buffer really held. Random edits are checked
+-- against the list of texts the buffer went through.
+-- Prints "ok" when all checks pass, stops on the first failure.
+
+local function filler(c, n)
+	return string.rep(c, n)
+end
+
+-- a replace() too large for the journal clears it instead of keeping
+-- only the inserted half
+local function big_replace(name, limit, nold, nnew)
+	local buf = fltk.Fl_Text_Buffer:new_local()
+	buf:undo_limit(limit)
+	buf:text(filler("a", nold))
+	buf:undo_clear()
+	buf:insert(0, "x")
+	buf:replace(0, buf:length(), filler("b", nnew))
+	local after = buf:text()
+	while buf:undo() ~= 0 do
+		local t = buf:text()
+		assert(t == after or t == "x" .. filler("a", nold) or t == filler("a", nold),
+			name .. ": undo() gave text that never existed")
+	end
+	print(name .. " ok")
+end
+
+big_replace("deleted half over the limit", 1000, 5000, 10)
+big_replace("inserted half over the limit", 1000, 10, 5000)
+big_replace("both halves near the limit", 1000, 600, 600)
+
+-- random edits with small limits: every undo() and redo() must give a
+-- text of the history, in the right order
+math.randomseed(1)
+local letters = "abcdefghij\n"
+local function random_text(n)
+	local t = {}
+	for i = 1, n do
+		local k = math.random(#letters)
+		t[i] = string.sub(letters, k, k)
+	end
+	return table.concat(t)
+end
+
+for seed = 1, 40 do
+	math.randomseed(seed)
+	local buf = fltk.Fl_Text_Buffer:new_local()
+	buf:undo_limit(math.random(50, 2000))
+	local history = { buf:text() }
+	for step = 1, 300 do
+		local len = buf:length()
+		local a = math.random(0, len)
+		local b = math.random(a, math.min(len, a + math.random(0, 600)))
+		local op = math.random(4)
+		if op == 1 then
+			buf:insert(a, random_text(math.random(1, 3)))
+		elseif op == 2 then
+			buf:remove(a, b)
+		elseif op == 3 then
+			-- a replacement is one undo step of its own, or none
+			local before, text = buf:text(), random_text(math.random(0, 600))
+			buf:replace(a, b, text)
+			local after = buf:text()
+			if (a < b or #text > 0) and math.random(2) == 1 and buf:undo() ~= 0 then
+				assert(buf:text() == before,
+					"seed " .. seed .. ": undo() of replace() gave text that never existed")
+				assert(buf:redo() ~= 0 and buf:text() == after,
+					"seed " .. seed .. ": redo() of replace() did not restore the text")
+			end
+		else
+			buf:undo_checkpoint()
+		end
+		local t = buf:text()
+		if t ~= history[#history] then history[#history + 1] = t end
+	end
+	-- undo walks back through the history, possibly skipping the
+	-- coalesced steps, and never leaves it
+	local at = #history
+	local undone = {}
+	while buf:undo() ~= 0 do
+		local t = buf:text()
+		local i = at - 1
+		while i >= 1 and history[i] ~= t do i = i - 1 end
+		assert(i >= 1, "seed " .. seed .. ": undo() gave text that never existed")
+		undone[#undone + 1] = history[at]
+		at = i
+	end
+	-- redo comes back the same way
+	for i = #undone, 1, -1 do
+		assert(buf:redo() ~= 0 and buf:text() == undone[i],
+			"seed " .. seed .. ": redo() did not restore the text")
+	end
+end
+print("random edits ok")
+
+print("ok")
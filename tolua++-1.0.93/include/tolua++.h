@@ -112,6 +112,7 @@ TOLUA_API void tolua_pushstring (lua_State* L, const char* value);
 TOLUA_API void tolua_pushuserdata (lua_State* L, void* value);
 TOLUA_API void tolua_pushusertype (lua_State* L, void* value, const char* type);
 TOLUA_API void tolua_pushusertype_and_takeownership(lua_State* L, void* value, const char* type);
+TOLUA_API void tolua_pushusertypeid (lua_State* L, void* value, int id);
 TOLUA_API void tolua_pushfieldvalue (lua_State* L, int lo, int index, int v);
 TOLUA_API void tolua_pushfieldboolean (lua_State* L, int lo, int index, int v);
 TOLUA_API void tolua_pushfieldnumber (lua_State* L, int lo, int index, lua_Number v);
@@ -137,6 +138,14 @@ TOLUA_API void tolua_dobuffer(lua_State* L, char* B, unsigned int size, const ch
 
 TOLUA_API int class_gc_event (lua_State* L);
 
+TOLUA_API unsigned int tolua_peergeneration (void);
+TOLUA_API void tolua_touchpeers (void);
+
+TOLUA_API int tolua_typeid (lua_State* L, const char* type);
+TOLUA_API int tolua_mttypeid (lua_State* L, int lo);
+TOLUA_API int tolua_objtypeid (lua_State* L, int lo);
+TOLUA_API int tolua_typeisa (int id, int super_id);
+
 #ifdef __cplusplus
 static inline const char* tolua_tocppstring (lua_State* L, int narg, const char* def) {
 
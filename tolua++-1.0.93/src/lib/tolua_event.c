@@ -16,12 +16,29 @@
 
 #include "tolua++.h"
 
+/* Peer generation
+	* Bumped whenever a peer table or a class table is written, so that
+	* C++ code caching method lookups (see ToluaBase) knows when to re-resolve.
+*/
+static unsigned int peer_generation = 1;
+
+TOLUA_API unsigned int tolua_peergeneration (void)
+{
+	return peer_generation;
+}
+
+TOLUA_API void tolua_touchpeers (void)
+{
+	peer_generation++;
+}
+
 /* Store at ubox
 	* It stores, creating the corresponding table if needed,
 	* the pair key/value in the corresponding ubox table
 */
 static void storeatubox (lua_State* L, int lo)
 {
+	tolua_touchpeers();
 	#ifdef LUA_VERSION_NUM
 		lua_getfenv(L, lo);
 		if (lua_rawequal(L, -1, TOLUA_NOPEER)) {
@@ -112,6 +129,7 @@ static int module_newindex_event (lua_State* L)
 			return 0;
 		}
 	}
+	tolua_touchpeers();
 	/* call old newindex meta event */
 	if (lua_getmetatable(L,1) && lua_getmetatable(L,-1))
 	{
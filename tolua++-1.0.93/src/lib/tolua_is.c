@@ -23,8 +23,12 @@
 TOLUA_API int tolua_fast_isa(lua_State *L, int mt_indexa, int mt_indexb, int super_index)
 {
  int result;
+ int ida, idb;
 	if (lua_rawequal(L,mt_indexa,mt_indexb))
 		result = 1;
+	else if ((ida = tolua_mttypeid(L,mt_indexa)) != 0 &&
+	         (idb = tolua_mttypeid(L,mt_indexb)) != 0)
+		result = tolua_typeisa(ida,idb);
 	else
 	{
 		if (super_index) {
@@ -168,6 +172,12 @@ static int lua_isusertype (lua_State* L, int lo, const char* type)
 			return 0;
 		};
 	};
+	{
+		/* known type: compare ids */
+		int id = tolua_typeid(L,type);
+		if (id)
+			return tolua_typeisa(tolua_objtypeid(L,lo),id);
+	}
 	{
 		/* check if it is of the same type */
 		int r;
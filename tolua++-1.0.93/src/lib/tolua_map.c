@@ -22,6 +22,265 @@
 #include <math.h>
 
 
+/* Type descriptors
+	* Every metatable created by tolua gets a small integer id, stored in the
+	* metatable itself under a light userdata key. The descriptor keeps
+	* registry refs to the metatable and its ubox, and a bitset of the types
+	* its objects can be used as (the type itself and all its super types),
+	* so pushing an object needs no string lookups.
+	* Descriptors belong to the state opened last; any other state keeps
+	* using the string based lookups.
+*/
+typedef struct tolua_TypeInfo {
+	char* name;
+	int mt;                /* registry ref to the metatable */
+	int ubox;              /* registry ref to the ubox, resolved on first push */
+	unsigned int* isa;     /* bitset of super types, indexed by id */
+} tolua_TypeInfo;
+
+#define TOLUA_NAMECACHE_SIZE 256
+
+static tolua_TypeInfo* type_info = NULL;   /* indexed by id, 0 is unused */
+static int type_count = 0;
+static int type_alloc = 0;
+static int isa_words = 0;
+static const void* type_registry = NULL;
+static char type_id_key;
+
+/* type name pointer -> id, checked with strcmp on hit */
+static struct {
+	const char* name;
+	int id;
+} name_cache[TOLUA_NAMECACHE_SIZE];
+
+static void type_reset (lua_State* L)
+{
+	int i;
+	for (i=1; i<=type_count; ++i)
+	{
+		free(type_info[i].name);
+		free(type_info[i].isa);
+	}
+	free(type_info);
+	type_info = NULL;
+	type_count = type_alloc = isa_words = 0;
+	memset(name_cache, 0, sizeof(name_cache));
+	type_registry = lua_topointer(L, LUA_REGISTRYINDEX);
+}
+
+/* id stored in the metatable at index 'lo', 0 if none */
+static int type_mtid (lua_State* L, int lo)
+{
+	int id = 0;
+	if (lua_istable(L,lo))
+	{
+		lua_pushlightuserdata(L,&type_id_key);
+		lua_rawget(L,lo<0 ? lo-1 : lo);
+		id = (int)lua_tointeger(L,-1);
+		lua_pop(L,1);
+	}
+	return id;
+}
+
+/* Assign an id to the new metatable on the top of the stack */
+static void type_register (lua_State* L, const char* name)
+{
+	tolua_TypeInfo* t;
+	int id;
+	if (type_registry != lua_topointer(L, LUA_REGISTRYINDEX))
+		return;
+	id = type_count+1;
+	if (id >= type_alloc)
+	{
+		int n = type_alloc ? type_alloc*2 : 64;
+		tolua_TypeInfo* p = (tolua_TypeInfo*)realloc(type_info, n*sizeof(tolua_TypeInfo));
+		if (!p)
+			return;
+		type_info = p;
+		type_alloc = n;
+	}
+	if (id >= isa_words*32)
+	{
+		int i;
+		int n = isa_words ? isa_words*2 : 4;
+		for (i=1; i<id; ++i)
+		{
+			unsigned int* p = (unsigned int*)realloc(type_info[i].isa, n*sizeof(unsigned int));
+			if (!p)
+				return;
+			memset(p+isa_words, 0, (n-isa_words)*sizeof(unsigned int));
+			type_info[i].isa = p;
+		}
+		isa_words = n;
+	}
+	t = &type_info[id];
+	t->name = (char*)malloc(strlen(name)+1);
+	t->isa = (unsigned int*)calloc(isa_words, sizeof(unsigned int));
+	if (!t->name || !t->isa)
+	{
+		free(t->name);
+		free(t->isa);
+		return;
+	}
+	strcpy(t->name,name);
+	t->isa[id>>5] |= 1u << (id&31);
+	lua_pushvalue(L,-1);
+	t->mt = luaL_ref(L,LUA_REGISTRYINDEX);
+	t->ubox = LUA_NOREF;
+	type_count = id;
+
+	lua_pushlightuserdata(L,&type_id_key);
+	lua_pushinteger(L,id);
+	lua_rawset(L,-3);
+}
+
+/* 'name' is also a 'base': merge the bitset of 'base' into 'name' */
+static void type_mapsuper (lua_State* L, const char* name, const char* base)
+{
+	int id = tolua_typeid(L,name);
+	int bid = tolua_typeid(L,base);
+	if (id && bid)
+	{
+		int i;
+		for (i=0; i<isa_words; ++i)
+			type_info[id].isa[i] |= type_info[bid].isa[i];
+	}
+}
+
+/* Forget resolved ubox refs, after a metatable got a new ubox */
+static void type_resetubox (lua_State* L)
+{
+	int i;
+	if (type_registry != lua_topointer(L, LUA_REGISTRYINDEX))
+		return;
+	for (i=1; i<=type_count; ++i)
+	{
+		luaL_unref(L,LUA_REGISTRYINDEX,type_info[i].ubox);
+		type_info[i].ubox = LUA_NOREF;
+	}
+}
+
+static int type_ubox (lua_State* L, tolua_TypeInfo* t)
+{
+	if (t->ubox == LUA_NOREF)
+	{
+		lua_rawgeti(L,LUA_REGISTRYINDEX,t->mt);
+		lua_pushstring(L,"tolua_ubox");
+		lua_rawget(L,-2);                   /* stack: mt ubox */
+		if (lua_isnil(L,-1))
+		{
+			lua_pop(L,1);
+			lua_pushstring(L,"tolua_ubox");
+			lua_rawget(L,LUA_REGISTRYINDEX);
+		}
+		t->ubox = luaL_ref(L,LUA_REGISTRYINDEX);
+		lua_pop(L,1);
+	}
+	return t->ubox;
+}
+
+/* Get type id
+	* Returns the id of a registered type, or 0 if the type is unknown or
+	* registered in another state. Type names with a stable address (string
+	* literals, classId()) are resolved without touching the registry.
+*/
+TOLUA_API int tolua_typeid (lua_State* L, const char* type)
+{
+	unsigned int h = ((unsigned int)(size_t)type >> 2) & (TOLUA_NAMECACHE_SIZE-1);
+	int id = name_cache[h].id;
+	if (type_registry != lua_topointer(L, LUA_REGISTRYINDEX))
+		return 0;
+	if (name_cache[h].name == type && id && strcmp(type_info[id].name,type) == 0)
+		return id;
+	luaL_getmetatable(L,type);
+	id = type_mtid(L,-1);
+	lua_pop(L,1);
+	if (id)
+	{
+		name_cache[h].name = type;
+		name_cache[h].id = id;
+	}
+	return id;
+}
+
+/* Get type id of a metatable
+	* Returns the id of the metatable at 'lo', 0 if it is not a tolua type of
+	* the current state.
+*/
+TOLUA_API int tolua_mttypeid (lua_State* L, int lo)
+{
+	if (type_registry != lua_topointer(L, LUA_REGISTRYINDEX))
+		return 0;
+	return type_mtid(L,lo);
+}
+
+/* Get type id of an object
+	* Returns the id of the metatable of the value at 'lo', 0 if none.
+*/
+TOLUA_API int tolua_objtypeid (lua_State* L, int lo)
+{
+	int id = 0;
+	if (type_registry == lua_topointer(L, LUA_REGISTRYINDEX) && lua_getmetatable(L,lo))
+	{
+		id = type_mtid(L,-1);
+		lua_pop(L,1);
+	}
+	return id;
+}
+
+/* Check whether type 'id' can be used as type 'super_id' */
+TOLUA_API int tolua_typeisa (int id, int super_id)
+{
+	return id > 0 && id <= type_count && super_id > 0 && super_id <= type_count &&
+	       (type_info[id].isa[super_id>>5] >> (super_id&31)) & 1;
+}
+
+/* Push an object by type id
+	* Same as tolua_pushusertype, with the type given by tolua_typeid.
+*/
+TOLUA_API void tolua_pushusertypeid (lua_State* L, void* value, int id)
+{
+	tolua_TypeInfo* t;
+	if (value == NULL)
+	{
+		lua_pushnil(L);
+		return;
+	}
+	if (id <= 0 || id > type_count)
+		tolua_error(L,"invalid type id",NULL);
+	t = &type_info[id];
+	lua_rawgeti(L,LUA_REGISTRYINDEX,type_ubox(L,t));
+	lua_pushlightuserdata(L,value);
+	lua_rawget(L,-2);                       /* stack: ubox ubox[u] */
+	if (lua_isnil(L,-1))
+	{
+		lua_pop(L,1);                          /* stack: ubox */
+		lua_pushlightuserdata(L,value);
+		*(void**)lua_newuserdata(L,sizeof(void *)) = value;   /* stack: ubox u newud */
+		lua_pushvalue(L,-1);                   /* stack: ubox u newud newud */
+		lua_insert(L,-4);                      /* stack: newud ubox u newud */
+		lua_rawset(L,-3);                      /* stack: newud ubox */
+		lua_pop(L,1);                          /* stack: newud */
+		lua_rawgeti(L,LUA_REGISTRYINDEX,t->mt);
+		lua_setmetatable(L,-2);
+
+		#ifdef LUA_VERSION_NUM
+		lua_pushvalue(L, TOLUA_NOPEER);
+		lua_setfenv(L, -2);
+		#endif
+	}
+	else
+	{
+		lua_remove(L,-2);                      /* stack: ubox[u] */
+		/* update the metatable if 'type' is a more specialized class */
+		if (!tolua_typeisa(tolua_objtypeid(L,-1),id))
+		{
+			lua_rawgeti(L,LUA_REGISTRYINDEX,t->mt);
+			lua_setmetatable(L,-2);
+		}
+	}
+}
+
 /* Create metatable
 	* Create and register new metatable
 */
@@ -37,8 +296,10 @@ static int tolua_newmetatable (lua_State* L, char* name)
 	};
 	#endif
 
-	if (r)
+	if (r) {
+		type_register(L,name);
 		tolua_classevents(L); /* set meta events */
+	}
 	lua_pop(L,1);
 	return r;
 }
@@ -84,6 +345,8 @@ static void mapsuper (lua_State* L, const char* name, const char* base)
 		}
 	}
 	lua_pop(L,3);                       /* stack: <empty> */
+
+	type_mapsuper(L,name,base);
 }
 
 /* creates a 'tolua_ubox' table for base clases, and
@@ -137,6 +400,7 @@ static void mapinheritance (lua_State* L, const char* name, const char* base)
 	};
 
 	set_ubox(L);
+	type_resetubox(L);
 
 	lua_setmetatable(L,-2);
 	lua_pop(L,1);
@@ -264,6 +528,7 @@ static int tolua_bnd_setpeer(lua_State* L) {
 		lua_pushvalue(L, TOLUA_NOPEER);
 	};
 	lua_setfenv(L, -2);
+	tolua_touchpeers();
 
 	return 0;
 };
@@ -280,6 +545,16 @@ static int tolua_bnd_getpeer(lua_State* L) {
 };
 #endif
 
+/* Invalidate cached method lookups
+	* Needed after changing methods of a Lua class used as a peer's metatable,
+	* since those writes do not go through tolua events.
+*/
+static int tolua_bnd_touchpeers (lua_State* L)
+{
+	tolua_touchpeers();
+	return 0;
+}
+
 /* static int class_gc_event (lua_State* L); */
 
 TOLUA_API void tolua_open (lua_State* L)
@@ -291,6 +566,8 @@ TOLUA_API void tolua_open (lua_State* L)
  {
   lua_pushstring(L,"tolua_opened"); lua_pushboolean(L,1); lua_rawset(L,LUA_REGISTRYINDEX);
 
+  type_reset(L);
+
   #ifndef LUA_VERSION_NUM /* only prior to lua 5.1 */
   /* create peer object table */
   lua_pushstring(L, "tolua_peers"); lua_newtable(L);
@@ -331,6 +608,7 @@ TOLUA_API void tolua_open (lua_State* L)
   tolua_function(L,"releaseownership",tolua_bnd_releaseownership);
   tolua_function(L,"cast",tolua_bnd_cast);
   tolua_function(L,"inherit", tolua_bnd_inherit);
+  tolua_function(L,"touchpeers", tolua_bnd_touchpeers);
   #ifdef LUA_VERSION_NUM /* lua 5.1 */
   tolua_function(L, "setpeer", tolua_bnd_setpeer);
   tolua_function(L, "getpeer", tolua_bnd_getpeer);
@@ -50,8 +50,11 @@ TOLUA_API void tolua_pushuserdata (lua_State* L, void* value)
 
 TOLUA_API void tolua_pushusertype (lua_State* L, void* value, const char* type)
 {
+ int id;
  if (value == NULL)
   lua_pushnil(L);
+ else if ((id = tolua_typeid(L,type)) != 0)
+  tolua_pushusertypeid(L,value,id);
  else
  {
   luaL_getmetatable(L, type);
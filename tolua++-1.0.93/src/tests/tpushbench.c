@@ -0,0 +1,81 @@
+/* tolua: tolua_pushusertype microbenchmark
+** Measures pushes/sec for new objects, for objects already in the ubox,
+** and for objects pushed as a more specialized class.
+*/
+
+#include "lua.h"
+#include "lualib.h"
+#include "lauxlib.h"
+#include "tolua++.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define NOBJS  1000
+#define ROUNDS 2000
+
+static char objs[NOBJS];
+
+static void report (const char* what, long n, clock_t t)
+{
+	double s = (double)t/CLOCKS_PER_SEC;
+	if (s <= 0) s = 1.0/CLOCKS_PER_SEC;
+	printf("%-28s %10.0f pushes/sec\n", what, n/s);
+}
+
+static void bench (lua_State* L, const char* what, const char* type, int fresh)
+{
+	long n = 0;
+	int i, r;
+	clock_t t = 0;
+	int top = lua_gettop(L);
+	for (r=0; r<(fresh ? ROUNDS/20 : ROUNDS); ++r)
+	{
+		clock_t t0 = clock();
+		for (i=0; i<NOBJS; ++i)
+		{
+			tolua_pushusertype(L,objs+i,type);
+			lua_pop(L,1);
+		}
+		t += clock()-t0;
+		n += NOBJS;
+		if (fresh)   /* empty the ubox, outside of the timing */
+			lua_gc(L,LUA_GCCOLLECT,0);
+	}
+	report(what,n,t);
+	lua_settop(L,top);
+}
+
+int main ()
+{
+	int i;
+	lua_State* L = lua_open();
+	luaL_openlibs(L);
+	tolua_open(L);
+
+	tolua_usertype(L,"Base");
+	tolua_usertype(L,"Derived");
+	tolua_module(L,NULL,0);
+	tolua_beginmodule(L,NULL);
+	tolua_cclass(L,"Base","Base","",NULL);
+	tolua_cclass(L,"Derived","Derived","Base",NULL);
+	tolua_endmodule(L);
+
+	bench(L,"new objects","Base",1);
+
+	/* keep the objects alive in the ubox */
+	lua_newtable(L);
+	for (i=0; i<NOBJS; ++i)
+	{
+		tolua_pushusertype(L,objs+i,"Base");
+		lua_rawseti(L,-2,i+1);
+	}
+	bench(L,"boxed, same class","Base",0);
+	bench(L,"boxed, const class","const Base",0);
+	bench(L,"boxed, specialized class","Derived",0);
+	bench(L,"boxed, base class","Base",0);
+
+	lua_close(L);
+	return 0;
+}